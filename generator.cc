@@ -16,10 +16,19 @@ static std::ifstream open_config_file(const std::string path) {
     return file;
 }
 
-static std::string out_name(json const &config) {
+static std::string out_name(json const &config, const int sweep_round = -1) {
     auto fname_it = config.find("file_name");
     if (fname_it != config.end()) {
-        return *fname_it;
+        std::string fname = *fname_it;
+        if (sweep_round == -1)
+            return fname;
+
+        // one file per round of the sweep, told apart the same way as the generated names
+        std::stringstream suffix;
+        suffix << "_r" << std::setw(2) << std::setfill('0') << sweep_round;
+        const auto dot = fname.rfind('.');
+        return dot == std::string::npos ? fname + suffix.str()
+                                        : fname.insert(dot, suffix.str());
     }
 
     std::stringstream ss;
@@ -32,7 +41,7 @@ static std::string out_name(json const &config) {
 
     ss << a;
 
-    auto round = config_ref.value("round", -1);
+    auto round = sweep_round != -1 ? sweep_round : config_ref.value("round", -1);
     if (round != -1) {
         ss << "_r";
         ss << std::setw(2) << std::setfill('0') << round;
@@ -47,6 +56,18 @@ static std::string out_name(json const &config) {
     return ss.str();
 }
 
+/* A round sweep stream returns the outputs of its round counts in turn, each to its own file */
+static std::vector<std::string> out_names(json const &config) {
+    auto sweep = config.at("stream").find("round_sweep");
+    if (sweep == config.at("stream").end())
+        return {out_name(config)};
+
+    std::vector<std::string> names;
+    for (const int round : *sweep)
+        names.push_back(out_name(config, round));
+    return names;
+}
+
 generator::generator(const std::string config)
     : generator(open_config_file(config)) {}
 
@@ -54,7 +75,7 @@ generator::generator(json const &config)
     : _config(config)
     , _seed(seed::create(config.at("seed")))
     , _tv_count(config.at("tv_count"))
-    , _o_file_name(out_name(config)) {
+    , _o_file_names(out_names(config)) {
     seed_seq_from<pcg32> main_seeder(_seed);
     std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
 
@@ -64,19 +85,25 @@ generator::generator(json const &config)
 void generator::generate() {
 
     auto stdout_it = _config.find("stdout");
-    std::unique_ptr<std::ostream> ofstream_ptr;
-    std::ostream *o_file = nullptr;
+    std::vector<std::unique_ptr<std::ostream>> ofstream_ptrs;
+    std::vector<std::ostream *> o_files;
 
     if (stdout_it == _config.end() || stdout_it->get<bool>() == false) {
-        ofstream_ptr = std::make_unique<std::ofstream>(_o_file_name, std::ios::binary);
-        o_file = ofstream_ptr.get();
+        for (const std::string &name : _o_file_names) {
+            ofstream_ptrs.push_back(std::make_unique<std::ofstream>(name, std::ios::binary));
+            o_files.push_back(ofstream_ptrs.back().get());
+        }
     } else {
-        o_file = &(std::cout);
+        if (_o_file_names.size() != 1)
+            throw std::runtime_error("round sweep output cannot go to stdout");
+        o_files.push_back(&(std::cout));
     }
 
     for (std::size_t i = 0; i < _tv_count; ++i) {
-        vec_cview n = _stream_a->next();
-        for (auto o : n)
-            *o_file << o;
+        for (std::ostream *o_file : o_files) {
+            vec_cview n = _stream_a->next();
+            for (auto o : n)
+                *o_file << o;
+        }
     }
 }
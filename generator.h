@@ -6,6 +6,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 struct generator {
     generator(const std::string cofig);
@@ -31,5 +32,6 @@ private:
 
     std::unique_ptr<stream> _stream_a;
 
-    std::string _o_file_name;
+    // more than one for a round sweep
+    std::vector<std::string> _o_file_names;
 };
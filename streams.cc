@@ -362,6 +362,8 @@ make_stream(const json &config,
 #ifdef BUILD_block
     else if (type == "block")
         return std::make_unique<block::block_stream>(config, seeder, pipes, osize);
+    else if (type == "block_differential")
+        return std::make_unique<block::block_differential_stream>(config, seeder, pipes, osize);
 #endif
 #ifdef BUILD_prngs
     else if (type == "prng")
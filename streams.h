@@ -95,8 +95,9 @@ struct const_stream : stream {
 
     vec_cview next() override;
 
-private:
     static void fromHex(std::vector<value_type> &res, const std::string &hex);
+
+private:
     std::vector<value_type> _data;
 };
 
@@ -29,6 +29,48 @@ struct block_cipher {
     virtual void encrypt(const std::uint8_t *plaintext, std::uint8_t *ciphertext) = 0;
     virtual void decrypt(const std::uint8_t *ciphertext, std::uint8_t *plaintext) = 0;
 
+    /**
+     * Encrypts nblocks consecutive blocks of block_size bytes from in to out (ECB).
+     * The default calls encrypt() once per block; ciphers that can process several
+     * independent blocks at once override it. Overrides fall back to this loop when
+     * block_size is not their native block size.
+     */
+    virtual void encrypt_blocks(const std::uint8_t *in,
+                                std::uint8_t *out,
+                                const std::size_t nblocks,
+                                const std::size_t block_size) {
+        for (std::size_t i = 0; i < nblocks; ++i)
+            encrypt(in + i * block_size, out + i * block_size);
+    }
+
+    /**
+     * Decrypts nblocks consecutive blocks, see encrypt_blocks().
+     */
+    virtual void decrypt_blocks(const std::uint8_t *in,
+                                std::uint8_t *out,
+                                const std::size_t nblocks,
+                                const std::size_t block_size) {
+        for (std::size_t i = 0; i < nblocks; ++i)
+            decrypt(in + i * block_size, out + i * block_size);
+    }
+
+    /**
+     * Encrypts nblocks blocks once with each of the round counts rounds[0] < ... <
+     * rounds[count - 1] (none above the rounds of this instance), the blocks of rounds[i]
+     * going to out[i]. Ciphers whose reduced-round variants are prefixes of each other do
+     * it in a single pass over the rounds. Returns false when the cipher cannot, the
+     * caller needs an instance per round count then; nblocks == 0 only asks.
+     */
+    virtual bool encrypt_round_sweep(const std::uint8_t *in,
+                                     std::uint8_t *const *out,
+                                     const std::size_t nblocks,
+                                     const std::size_t block_size,
+                                     const std::size_t *rounds,
+                                     const std::size_t count) {
+        (void)in, (void)out, (void)nblocks, (void)block_size, (void)rounds, (void)count;
+        return false;
+    }
+
     void crypt(const std::uint8_t *in, std::uint8_t *out, const bool run_encryption = true) {
         if (run_encryption) {
             encrypt(in, out);
@@ -37,6 +79,18 @@ struct block_cipher {
         }
     }
 
+    void crypt_blocks(const std::uint8_t *in,
+                      std::uint8_t *out,
+                      const std::size_t nblocks,
+                      const std::size_t block_size,
+                      const bool run_encryption = true) {
+        if (run_encryption) {
+            encrypt_blocks(in, out, nblocks, block_size);
+        } else {
+            decrypt_blocks(in, out, nblocks, block_size);
+        }
+    }
+
 protected:
     std::size_t _rounds;
 };
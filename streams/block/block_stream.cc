@@ -1,28 +1,97 @@
 #include "block_stream.h"
 #include "block_cipher.h"
 #include "block_factory.h"
+#include "keyed_cipher_cache.h"
 #include "streams.h"
 #include <eacirc-core/json.h>
+#include <algorithm>
 
 namespace block {
 
 static int64_t reinit_freq(const json &config) {
-    try {
-        std::string init_freq = config.at("init_frequency");
-        if (init_freq == "only_once") {
-            return -1;
-        } else {
-            int64_t init_freq_int = std::stoll(init_freq);
-            if (init_freq_int < 1) {
-                throw std::runtime_error(
-                    "Reinitialization frequency has to be higher or equal to 1.");
-            }
-            return init_freq_int;
-        }
-    } catch (std::out_of_range &e) {
-        // this field is voluntary, we return presumed value "only_once"
+    // this field is voluntary, we presume value "only_once"
+    std::string init_freq = config.value("init_frequency", std::string("only_once"));
+    if (init_freq == "only_once") {
         return -1;
+    } else {
+        int64_t init_freq_int = std::stoll(init_freq);
+        if (init_freq_int < 1) {
+            throw std::runtime_error(
+                "Reinitialization frequency has to be higher or equal to 1.");
+        }
+        return init_freq_int;
+    }
+}
+
+static block_mode mode(const json &config) {
+    const std::string name = config.value("mode", std::string("ECB"));
+    if (name == "ECB")
+        return block_mode::ecb;
+    if (name == "CTR")
+        return block_mode::ctr;
+    if (name == "OFB")
+        return block_mode::ofb;
+    if (name == "CBC")
+        return block_mode::cbc;
+    throw std::runtime_error("Unsupported block cipher mode " + name +
+                             ", use one of ECB, CTR, OFB or CBC.");
+}
+
+static bool is_keystream_mode(const block_mode mode) {
+    return mode == block_mode::ctr || mode == block_mode::ofb;
+}
+
+// big-endian increment of the whole block, as in NIST SP 800-38A
+static void increment_counter(std::uint8_t *counter, const std::size_t size) {
+    for (std::size_t i = size; i-- > 0;) {
+        if (++counter[i] != 0)
+            break;
+    }
+}
+
+static void xor_block(std::uint8_t *dst, const std::uint8_t *src, const std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i)
+        dst[i] ^= src[i];
+}
+
+/**
+ * Optional "key_cache": number of keyed cipher instances kept for rekeying. Worth it when
+ * the key stream repeats keys and the key schedule is expensive (Blowfish, Twofish, LowMC).
+ */
+static std::unique_ptr<keyed_cipher_cache> make_key_cache(const json &config, const bool encrypt) {
+    const std::size_t capacity = config.value("key_cache", std::size_t(0));
+    if (capacity == 0)
+        return nullptr;
+
+    const std::string algorithm = config.at("algorithm");
+    const std::size_t round = config.at("round");
+    const std::size_t block_size = config.at("block_size");
+    const std::size_t key_size = config.at("key_size");
+    // LowMC takes its parameters from the config, the cache outlives the one passed in
+    const json config_copy = config;
+    return std::make_unique<keyed_cipher_cache>(capacity, [=] {
+        return make_block_cipher(algorithm, round, block_size, key_size, encrypt, &config_copy);
+    });
+}
+
+static std::vector<std::size_t> sweep_rounds(const json &config) {
+    auto sweep = config.find("round_sweep");
+    if (sweep == config.end())
+        return {};
+
+    const std::vector<std::size_t> rounds = *sweep;
+    const std::size_t max_round = config.at("round");
+    if (rounds.empty())
+        throw std::runtime_error("The round sweep needs at least one round count");
+    for (std::size_t i = 0; i < rounds.size(); ++i) {
+        if ((i > 0 && rounds[i] <= rounds[i - 1]) || rounds[i] > max_round)
+            throw std::runtime_error("The round sweep has to be ascending and at most \"round\"");
     }
+    if (mode(config) != block_mode::ecb || !config.value("encryption_mode", true))
+        throw std::runtime_error("The round sweep is supported only for ECB encryption");
+    if (config.value("key_cache", std::size_t(0)) != 0)
+        throw std::runtime_error("The round sweep cannot be combined with the key cache");
+    return rounds;
 }
 
 block_stream::block_stream(
@@ -34,17 +103,29 @@ block_stream::block_stream(
     , _round(config.at("round"))
     , _block_size(config.at("block_size"))
     , _reinit_freq(reinit_freq(config))
+    , _mode(mode(config))
     , _i(0)
-    , _source(make_stream(config.at("plaintext"), seeder, pipes, osize))
+    , _source(is_keystream_mode(_mode) && config.find("plaintext") == config.end()
+                      ? nullptr
+                      : make_stream(config.at("plaintext"), seeder, pipes, osize))
     , _iv(make_stream(config.at("iv"), seeder, pipes, _block_size))
     , _key(make_stream(config.at("key"), seeder, pipes, unsigned(config.at("key_size"))))
     , _run_encryption(config.value("encryption_mode", true))
-    , _encryptor(make_block_cipher(config.at("algorithm"),
-                                   unsigned(_round),
-                                   unsigned(_block_size),
-                                   unsigned(config.at("key_size")),
-                                   _run_encryption,
-                                   &config)) {
+    , _encryptor(config.value("key_cache", std::size_t(0)) != 0
+                         ? nullptr
+                         : make_block_cipher(config.at("algorithm"),
+                                             unsigned(_round),
+                                             unsigned(_block_size),
+                                             unsigned(config.at("key_size")),
+                                             // CTR and OFB run the forward cipher in both directions
+                                             _run_encryption || is_keystream_mode(_mode),
+                                             &config))
+    , _key_cache(make_key_cache(config, _run_encryption || is_keystream_mode(_mode)))
+    , _cipher(_encryptor.get())
+    , _chain(_block_size)
+    , _sweep_rounds(sweep_rounds(config))
+    , _sweep_data(_sweep_rounds.size() * osize)
+    , _sweep_pos(0) {
     logger::info() << "stream source is block cipher: " << config.at("algorithm") << std::endl;
 
     if (int(config.at("round")) < 0)
@@ -57,31 +138,291 @@ block_stream::block_stream(
                                   // this by mistake. Change to warning if needed
         throw std::runtime_error("Output size is not multiple of block size");
 
-    /* others modes than ECB are not implemented yet
-    vec_view iv_view = _iv->next();
-    _encryptor->ivsetup(iv_view.data(), iv_view.size());
-    */
+    for (std::size_t i = 0; i < _sweep_rounds.size(); ++i)
+        _sweep_out.push_back(_sweep_data.data() + i * osize);
+    if (!_sweep_rounds.empty() &&
+        !_encryptor->encrypt_round_sweep(
+                nullptr, nullptr, 0, _block_size, _sweep_rounds.data(), _sweep_rounds.size())) {
+        for (const std::size_t round : _sweep_rounds) {
+            _sweep_ciphers.push_back(make_block_cipher(config.at("algorithm"),
+                                                       unsigned(round),
+                                                       unsigned(_block_size),
+                                                       unsigned(config.at("key_size")),
+                                                       true,
+                                                       &config));
+        }
+        // the per-round ciphers produce every output, do not key the full-round one as well
+        _encryptor.reset();
+        _cipher = nullptr;
+    }
 
-    vec_cview key_view = _key->next();
-    _encryptor->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+    rekey();
+    load_iv();
 }
 
 block_stream::block_stream(block_stream &&) = default;
 block_stream::~block_stream() = default;
 
+void block_stream::rekey() {
+    vec_cview key_view = _key->next();
+    if (_key_cache) {
+        _cipher = &_key_cache->get(key_view.data(), key_view.size());
+    } else if (_encryptor) {
+        _encryptor->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+    }
+    for (auto &cipher : _sweep_ciphers)
+        cipher->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+}
+
+void block_stream::load_iv() {
+    // ECB has no IV, do not draw from the IV stream at all
+    if (_mode == block_mode::ecb)
+        return;
+
+    vec_cview iv_view = _iv->next();
+    std::copy_n(iv_view.begin(), _block_size, _chain.begin());
+}
+
 vec_cview block_stream::next() {
+    if (!_sweep_rounds.empty())
+        return next_sweep();
+
     ++_i;
     if (_reinit_freq != -1 && _i % std::size_t(_reinit_freq) == 0) {
-        vec_cview key_view = _key->next();
-        _encryptor->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+        rekey();
+        load_iv();
+    }
+
+    switch (_mode) {
+    case block_mode::ecb:
+        crypt_ecb();
+        break;
+    case block_mode::cbc:
+        crypt_cbc();
+        break;
+    case block_mode::ctr:
+        keystream_ctr();
+        xor_plaintext();
+        break;
+    case block_mode::ofb:
+        keystream_ofb();
+        xor_plaintext();
+        break;
     }
 
+    return make_view(_data.cbegin(), osize());
+}
+
+vec_cview block_stream::next_sweep() {
+    if (_sweep_pos == 0) {
+        ++_i;
+        if (_reinit_freq != -1 && _i % std::size_t(_reinit_freq) == 0)
+            rekey();
+
+        for (auto ptx_beg = _data.begin(); ptx_beg != _data.end();) {
+            vec_cview view = _source->next();
+            const std::size_t len = std::min(view.size(), std::size_t(_data.end() - ptx_beg));
+            ptx_beg = std::copy_n(view.begin(), len, ptx_beg);
+        }
+
+        const std::size_t nblocks = osize() / _block_size;
+        if (_sweep_ciphers.empty()) {
+            _cipher->encrypt_round_sweep(_data.data(),
+                                         _sweep_out.data(),
+                                         nblocks,
+                                         _block_size,
+                                         _sweep_rounds.data(),
+                                         _sweep_rounds.size());
+        } else {
+            for (std::size_t i = 0; i < _sweep_ciphers.size(); ++i)
+                _sweep_ciphers[i]->encrypt_blocks(_data.data(), _sweep_out[i], nblocks, _block_size);
+        }
+    }
+
+    // the outputs of one plaintext come out one round count after another
+    vec_cview out = make_view(_sweep_data.cbegin() + std::ptrdiff_t(_sweep_pos * osize()), osize());
+    _sweep_pos = (_sweep_pos + 1) % _sweep_rounds.size();
+    return out;
+}
+
+void block_stream::crypt_ecb() {
     for (auto ctx_beg = _data.begin();
          ctx_beg != _data.end();) { // ctx_beg += _source->osize() from inside
         vec_cview view = _source->next();
-        for (auto ptx_beg = view.begin(); ptx_beg != view.end() and ctx_beg != _data.end();
-             ptx_beg += _block_size, ctx_beg += _block_size) {
-            _encryptor->crypt(&(*ptx_beg), &(*ctx_beg), _run_encryption);
+        // hand over all whole blocks of this plaintext chunk in one call
+        const std::size_t len = std::min(view.size(), std::size_t(_data.end() - ctx_beg));
+        const std::size_t nblocks = (len + _block_size - 1) / _block_size;
+        _cipher->crypt_blocks(
+                view.data(), &(*ctx_beg), nblocks, _block_size, _run_encryption);
+        ctx_beg += std::ptrdiff_t(nblocks * _block_size);
+    }
+}
+
+void block_stream::crypt_cbc() {
+    for (auto ctx_beg = _data.begin(); ctx_beg != _data.end();) {
+        vec_cview view = _source->next();
+        const std::size_t len = std::min(view.size(), std::size_t(_data.end() - ctx_beg));
+        const std::size_t nblocks = len / _block_size;
+        if (nblocks == 0)
+            throw std::runtime_error("CBC mode needs the plaintext in whole blocks");
+        const std::uint8_t *in = view.data();
+        std::uint8_t *out = &(*ctx_beg);
+
+        if (_run_encryption) {
+            // each block depends on the previous ciphertext, so this one stays serial
+            for (std::size_t b = 0; b < nblocks; ++b, in += _block_size, out += _block_size) {
+                xor_block(_chain.data(), in, _block_size);
+                _cipher->encrypt(_chain.data(), out);
+                std::copy_n(out, _block_size, _chain.begin());
+            }
+        } else {
+            // decryption only needs the ciphertexts, all blocks go through at once
+            _cipher->decrypt_blocks(in, out, nblocks, _block_size);
+            xor_block(out, _chain.data(), _block_size);
+            for (std::size_t b = 1; b < nblocks; ++b)
+                xor_block(out + b * _block_size, in + (b - 1) * _block_size, _block_size);
+            std::copy_n(in + (nblocks - 1) * _block_size, _block_size, _chain.begin());
+        }
+        ctx_beg += std::ptrdiff_t(nblocks * _block_size);
+    }
+}
+
+void block_stream::keystream_ctr() {
+    const std::size_t nblocks = osize() / _block_size;
+
+    // lay out all counter blocks of the output, then encrypt them in one call
+    for (std::size_t b = 0; b < nblocks; ++b) {
+        std::copy(_chain.begin(), _chain.end(), _data.begin() + std::ptrdiff_t(b * _block_size));
+        increment_counter(_chain.data(), _block_size);
+    }
+    _cipher->encrypt_blocks(_data.data(), _data.data(), nblocks, _block_size);
+}
+
+void block_stream::keystream_ofb() {
+    for (auto out = _data.begin(); out != _data.end(); out += std::ptrdiff_t(_block_size)) {
+        _cipher->encrypt(_chain.data(), &(*out));
+        std::copy_n(out, _block_size, _chain.begin());
+    }
+}
+
+void block_stream::xor_plaintext() {
+    if (!_source)
+        return;
+
+    for (auto ctx_beg = _data.begin(); ctx_beg != _data.end();) {
+        vec_cview view = _source->next();
+        const std::size_t len = std::min(view.size(), std::size_t(_data.end() - ctx_beg));
+        xor_block(&(*ctx_beg), view.data(), len);
+        ctx_beg += std::ptrdiff_t(len);
+    }
+}
+
+
+static std::vector<std::vector<std::uint8_t>> differences(const json &config,
+                                                          const std::size_t block_size) {
+    const std::string difference = config.at("difference");
+    std::vector<std::vector<std::uint8_t>> diffs;
+
+    if (difference == "all_single_bit") {
+        // bit i is 1 << (i % 8) of byte i / 8, as in the sac streams
+        for (std::size_t i = 0; i < block_size * 8; ++i) {
+            diffs.emplace_back(block_size);
+            diffs.back()[i / 8] = std::uint8_t(1 << (i % 8));
+        }
+        return diffs;
+    }
+
+    diffs.emplace_back();
+    const_stream::fromHex(diffs.back(), difference);
+    if (diffs.back().size() != block_size)
+        throw std::runtime_error("The input difference has to be exactly one block");
+    if (std::all_of(diffs.back().begin(), diffs.back().end(), [](std::uint8_t b) { return b == 0; }))
+        throw std::runtime_error("The input difference must not be zero");
+    return diffs;
+}
+
+block_differential_stream::block_differential_stream(
+    const json &config,
+    default_seed_source &seeder,
+    std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> &pipes,
+    const std::size_t osize)
+    : stream(osize)
+    , _block_size(config.at("block_size"))
+    , _reinit_freq(reinit_freq(config))
+    , _xor_output(config.value("xor_output", false))
+    , _run_encryption(config.value("encryption_mode", true))
+    , _i(0)
+    , _differences(differences(config, _block_size))
+    , _pairs(osize / (_xor_output ? _block_size : 2 * _block_size))
+    // one draw of base blocks per output when the differences allow it
+    , _source(make_stream(config.at("plaintext"),
+                          seeder,
+                          pipes,
+                          _block_size * std::max(std::size_t(1), _pairs / _differences.size())))
+    , _key(make_stream(config.at("key"), seeder, pipes, unsigned(config.at("key_size"))))
+    , _cipher(make_block_cipher(config.at("algorithm"),
+                                unsigned(config.at("round")),
+                                unsigned(_block_size),
+                                unsigned(config.at("key_size")),
+                                _run_encryption,
+                                &config))
+    , _base_pos(0)
+    , _diff_pos(0)
+    , _pair_blocks(_xor_output ? 2 * osize : 0) {
+    logger::info() << "stream source is differential pairs of block cipher: "
+                   << config.at("algorithm") << std::endl;
+
+    if (int(config.at("round")) < 0)
+        throw std::runtime_error("The least number of rounds is 0.");
+    if (_block_size < 4)
+        throw std::runtime_error("The block size is at least 4 bytes");
+    if (_pairs == 0 || osize % (_xor_output ? _block_size : 2 * _block_size) != 0)
+        throw std::runtime_error(_xor_output
+                                         ? "Output size is not multiple of block size"
+                                         : "Output size is not multiple of a pair of blocks");
+
+    vec_cview key_view = _key->next();
+    _cipher->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+}
+
+block_differential_stream::block_differential_stream(block_differential_stream &&) = default;
+block_differential_stream::~block_differential_stream() = default;
+
+vec_cview block_differential_stream::next() {
+    ++_i;
+    if (_reinit_freq != -1 && _i % std::size_t(_reinit_freq) == 0) {
+        vec_cview key_view = _key->next();
+        _cipher->keysetup(key_view.data(), std::uint32_t(key_view.size()));
+    }
+
+    std::uint8_t *pairs = _xor_output ? _pair_blocks.data() : _data.data();
+    for (std::size_t p = 0; p < _pairs; ++p) {
+        if (_base_pos * _block_size == _base.size()) {
+            _base = _source->next().copy_to_vector();
+            _base_pos = 0;
+        }
+        const std::uint8_t *x = _base.data() + _base_pos * _block_size;
+        const std::uint8_t *d = _differences[_diff_pos].data();
+        std::uint8_t *out = pairs + 2 * p * _block_size;
+
+        std::copy_n(x, _block_size, out);
+        for (std::size_t i = 0; i < _block_size; ++i)
+            out[_block_size + i] = x[i] ^ d[i];
+
+        if (++_diff_pos == _differences.size()) {
+            _diff_pos = 0;
+            ++_base_pos;
+        }
+    }
+
+    // both members of every pair in one call, the multi-block backends see them as lanes
+    _cipher->crypt_blocks(pairs, pairs, 2 * _pairs, _block_size, _run_encryption);
+
+    if (_xor_output) {
+        for (std::size_t p = 0; p < _pairs; ++p) {
+            const std::uint8_t *pair = pairs + 2 * p * _block_size;
+            for (std::size_t i = 0; i < _block_size; ++i)
+                _data[p * _block_size + i] = pair[i] ^ pair[_block_size + i];
         }
     }
 
@@ -6,10 +6,18 @@
 #include <eacirc-core/optional.h>
 #include <eacirc-core/random.h>
 #include <memory>
+#include <vector>
 
 namespace block {
 
 struct block_cipher;
+class keyed_cipher_cache;
+
+/**
+ * Mode of operation of the block stream. CTR and OFB turn the cipher into a keystream
+ * generator: the plaintext stream is optional there and XORed onto the keystream when set.
+ */
+enum class block_mode { ecb, ctr, ofb, cbc };
 
 struct block_stream : public stream {
 public:
@@ -23,10 +31,19 @@ public:
     vec_cview next() override;
 
 private:
+    vec_cview next_sweep();
+    void rekey();
+    void load_iv();
+    void crypt_ecb();
+    void crypt_cbc();
+    void keystream_ctr();
+    void keystream_ofb();
+    void xor_plaintext();
 
     const std::size_t _round;
     const std::size_t _block_size;
     const int64_t _reinit_freq;
+    const block_mode _mode;
     std::size_t _i;
 
     std::unique_ptr<stream> _source;
@@ -34,7 +51,66 @@ private:
     std::unique_ptr<stream> _key;
 
     const bool _run_encryption;
+    // null when the key cache or the per-round sweep ciphers are used
     std::unique_ptr<block_cipher> _encryptor;
+    // optional, keeps the instances of the last keys so that repeated keys skip the key schedule
+    std::unique_ptr<keyed_cipher_cache> _key_cache;
+    // the instance in use, _encryptor or one of the cache
+    block_cipher *_cipher;
+
+    // CTR counter, OFB feedback or CBC previous ciphertext block
+    std::vector<std::uint8_t> _chain;
+
+    // optional "round_sweep": the round counts whose outputs are returned in turn, all from
+    // the same plaintext and key
+    const std::vector<std::size_t> _sweep_rounds;
+    // one instance per round count, for ciphers that cannot do the sweep in a single pass
+    std::vector<std::unique_ptr<block_cipher>> _sweep_ciphers;
+    std::vector<std::uint8_t> _sweep_data;
+    std::vector<std::uint8_t *> _sweep_out;
+    std::size_t _sweep_pos;
+};
+
+/**
+ * Differential (avalanche) pairs of a block cipher. Every base block x of the plaintext
+ * stream is encrypted together with x ^ d for the configured difference d, or for each
+ * single-bit difference in turn; all pairs of one output go through the cipher in a single
+ * multi-block call. The output is E(x) followed by E(x ^ d) for each pair, or only
+ * E(x) ^ E(x ^ d) with "xor_output".
+ */
+struct block_differential_stream : public stream {
+public:
+    block_differential_stream(
+            const json &config,
+            default_seed_source &seeder,
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> &pipes,
+            const std::size_t osize);
+    block_differential_stream(block_differential_stream &&);
+    ~block_differential_stream() override;
+
+    vec_cview next() override;
+
+private:
+    const std::size_t _block_size;
+    const int64_t _reinit_freq;
+    const bool _xor_output;
+    const bool _run_encryption;
+    std::size_t _i;
+
+    // input differences, used one after another on each base block
+    std::vector<std::vector<std::uint8_t>> _differences;
+    const std::size_t _pairs;
+
+    std::unique_ptr<stream> _source;
+    std::unique_ptr<stream> _key;
+    std::unique_ptr<block_cipher> _cipher;
+
+    // base blocks drawn from _source, the next one used and its next difference
+    std::vector<std::uint8_t> _base;
+    std::size_t _base_pos;
+    std::size_t _diff_pos;
+    // x, x ^ d interleaved for all pairs of one output; the ciphertexts for "xor_output"
+    std::vector<std::uint8_t> _pair_blocks;
 };
 
 } // namespace block
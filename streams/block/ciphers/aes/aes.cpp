@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <string>
 
 namespace block {
 
@@ -19,21 +20,18 @@ namespace block {
 #define Nk 4
 // Key length in bytes [128 bit]
 #define KEYLEN 16
-// The number of rounds in AES Cipher.
-static unsigned Nr = 10;
+// Block length in bytes [128 bit]
+#define BLOCKLEN 16
+// The maximal number of rounds in AES Cipher (the round keys are expanded for all of them).
+#define MAX_NR 10
 
 /*****************************************************************************/
-/* Private variables:                                                        */
+/* Private types:                                                            */
 /*****************************************************************************/
 // state - array holding the intermediate results during decryption.
+// The round keys and the number of rounds live in aes::aes_ctx and are passed explicitly,
+// so independent instances can run concurrently.
 typedef uint8_t state_t[4][4];
-static state_t* state;
-
-// The array that stores the round keys.
-static uint8_t RoundKey[176];
-
-// The Key input to the AES Program
-static const uint8_t* Key;
 
 // The lookup-tables are marked const so they can be placed in read-only storage instead of RAM
 // The numbers below can be computed dynamically trading ROM for RAM -
@@ -111,8 +109,9 @@ static uint8_t getSBoxInvert(uint8_t num)
   return rsbox[num];
 }
 
-// This function produces Nb(Nr+1) round keys. The round keys are used in each round to decrypt the states.
-static void KeyExpansion(void)
+// This function produces Nb(MAX_NR+1) round keys. The round keys are used in each round to decrypt the states.
+// A reduced-round cipher uses a prefix of them.
+static void KeyExpansion(uint8_t* RoundKey, const uint8_t* Key)
 {
   uint32_t i, j, k;
   uint8_t tempa[4]; // Used for the column/row operations
@@ -127,7 +126,7 @@ static void KeyExpansion(void)
   }
 
   // All other round keys are found from the previous round keys.
-  for(; (i < (Nb * (Nr + 1))); ++i)
+  for(; (i < (Nb * (MAX_NR + 1))); ++i)
   {
     for(j = 0; j < 4; ++j)
     {
@@ -179,7 +178,7 @@ static void KeyExpansion(void)
 
 // This function adds the round key to state.
 // The round key is added to the state by an XOR function.
-static void AddRoundKey(uint8_t round)
+static void AddRoundKey(state_t* state, const uint8_t* RoundKey, uint8_t round)
 {
   uint8_t i,j;
   for(i=0;i<4;++i)
@@ -193,7 +192,7 @@ static void AddRoundKey(uint8_t round)
 
 // The SubBytes Function Substitutes the values in the
 // state matrix with values in an S-box.
-static void SubBytes(void)
+static void SubBytes(state_t* state)
 {
   uint8_t i, j;
   for(i = 0; i < 4; ++i)
@@ -208,7 +207,7 @@ static void SubBytes(void)
 // The ShiftRows() function shifts the rows in the state to the left.
 // Each row is shifted with different offset.
 // Offset = Row number. So the first row is not shifted.
-static void ShiftRows(void)
+static void ShiftRows(state_t* state)
 {
   uint8_t temp;
 
@@ -242,7 +241,7 @@ static uint8_t xtime(uint8_t x)
 }
 
 // MixColumns function mixes the columns of the state matrix
-static void MixColumns(void)
+static void MixColumns(state_t* state)
 {
   uint8_t i;
   uint8_t Tmp,Tm,t;
@@ -270,7 +269,7 @@ static uint8_t Multiply(uint8_t x, uint8_t y)
 // MixColumns function mixes the columns of the state matrix.
 // The method used to multiply may be difficult to understand for the inexperienced.
 // Please use the references to gain more information.
-static void InvMixColumns(void)
+static void InvMixColumns(state_t* state)
 {
   int i;
   uint8_t a,b,c,d;
@@ -291,7 +290,7 @@ static void InvMixColumns(void)
 
 // The SubBytes Function Substitutes the values in the
 // state matrix with values in an S-box.
-static void InvSubBytes(void)
+static void InvSubBytes(state_t* state)
 {
   uint8_t i,j;
   for(i=0;i<4;++i)
@@ -303,7 +302,7 @@ static void InvSubBytes(void)
   }
 }
 
-static void InvShiftRows(void)
+static void InvShiftRows(state_t* state)
 {
   uint8_t temp;
 
@@ -333,54 +332,54 @@ static void InvShiftRows(void)
 
 
 // Cipher is the main function that encrypts the PlainText.
-static void Cipher(void)
+static void Cipher(state_t* state, const uint8_t* RoundKey, unsigned Nr)
 {
   uint8_t round = 0;
 
   // Add the First round key to the state before starting the rounds.
-  AddRoundKey(0);
+  AddRoundKey(state, RoundKey, 0);
 
   // There will be Nr rounds.
   // The first Nr-1 rounds are identical.
   // These Nr-1 rounds are executed in the loop below.
   for(round = 1; round < Nr; ++round)
   {
-    SubBytes();
-    ShiftRows();
-    MixColumns();
-    AddRoundKey(round);
+    SubBytes(state);
+    ShiftRows(state);
+    MixColumns(state);
+    AddRoundKey(state, RoundKey, round);
   }
 
   // The last round is given below.
   // The MixColumns function is not here in the last round.
-  SubBytes();
-  ShiftRows();
-  AddRoundKey(Nr);
+  SubBytes(state);
+  ShiftRows(state);
+  AddRoundKey(state, RoundKey, Nr);
 }
 
-static void InvCipher(void)
+static void InvCipher(state_t* state, const uint8_t* RoundKey, unsigned Nr)
 {
   uint8_t round=0;
 
   // Add the First round key to the state before starting the rounds.
-  AddRoundKey(Nr);
+  AddRoundKey(state, RoundKey, Nr);
 
   // There will be Nr rounds.
   // The first Nr-1 rounds are identical.
   // These Nr-1 rounds are executed in the loop below.
   for(round=Nr-1;round>0;round--)
   {
-    InvShiftRows();
-    InvSubBytes();
-    AddRoundKey(round);
-    InvMixColumns();
+    InvShiftRows(state);
+    InvSubBytes(state);
+    AddRoundKey(state, RoundKey, round);
+    InvMixColumns(state);
   }
 
   // The last round is given below.
   // The MixColumns function is not here in the last round.
-  InvShiftRows();
-  InvSubBytes();
-  AddRoundKey(0);
+  InvShiftRows(state);
+  InvSubBytes(state);
+  AddRoundKey(state, RoundKey, 0);
 }
 
 static void BlockCopy(uint8_t* output, const uint8_t* input)
@@ -398,34 +397,29 @@ static void BlockCopy(uint8_t* output, const uint8_t* input)
 /* Public functions:                                                         */
 /*****************************************************************************/
 
-static void AES128_ECB_encrypt(const uint8_t* input, const uint8_t* key, uint8_t* output)
+static void AES128_ECB_encrypt(const uint8_t* input, const uint8_t* round_key, unsigned Nr, uint8_t* output)
 {
   // Copy input to output, and work in-memory on output
   BlockCopy(output, input);
-  state = (state_t*)output;
-
-  Key = key;
-  KeyExpansion();
 
   // The next function call encrypts the PlainText with the Key using AES algorithm.
-  Cipher();
+  Cipher(reinterpret_cast<state_t *>(output), round_key, Nr);
 }
 
-static void AES128_ECB_decrypt(const uint8_t* input, const uint8_t* key, uint8_t *output)
+static void AES128_ECB_decrypt(const uint8_t* input, const uint8_t* round_key, unsigned Nr, uint8_t *output)
 {
   // Copy input to output, and work in-memory on output
   BlockCopy(output, input);
-  state = reinterpret_cast<state_t *>(output);
-
-  // The KeyExpansion routine must be called before encryption.
-  Key = key;
-  KeyExpansion();
 
-  InvCipher();
+  InvCipher(reinterpret_cast<state_t *>(output), round_key, Nr);
 }
 
 void aes::keysetup(const std::uint8_t* key, const uint64_t keysize) {
+    if (_rounds > MAX_NR)
+        throw std::runtime_error("AES supports at most " + std::to_string(MAX_NR) + " rounds");
     std::copy_n(key, keysize, _ctx.key);
+    // the KeyExpansion routine must be called before encryption, once per key is enough
+    KeyExpansion(_ctx.round_key, _ctx.key);
 }
 
 void aes::ivsetup(const std::uint8_t* iv, const std::uint64_t ivsize) {
@@ -434,14 +428,32 @@ void aes::ivsetup(const std::uint8_t* iv, const std::uint64_t ivsize) {
 
 void aes::encrypt(const std::uint8_t* plaintext,
              std::uint8_t* ciphertext) {
-    Nr = unsigned(_rounds); // setting rounds here allows running aes vs aes experiment
-    AES128_ECB_encrypt(plaintext, _ctx.key, ciphertext);
+    AES128_ECB_encrypt(plaintext, _ctx.round_key, unsigned(_rounds), ciphertext);
 }
 
 void aes::decrypt(const std::uint8_t* ciphertext,
              std::uint8_t* plaintext) {
-    Nr = unsigned(_rounds); // setting rounds here allows running aes vs aes experiment
-    AES128_ECB_decrypt(ciphertext, _ctx.key, plaintext);
+    AES128_ECB_decrypt(ciphertext, _ctx.round_key, unsigned(_rounds), plaintext);
+}
+
+void aes::encrypt_blocks(const std::uint8_t* in,
+                         std::uint8_t* out,
+                         const std::size_t nblocks,
+                         const std::size_t block_size) {
+    if (block_size != BLOCKLEN)
+        return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+    for (std::size_t i = 0; i < nblocks; ++i)
+        AES128_ECB_encrypt(in + i * BLOCKLEN, _ctx.round_key, unsigned(_rounds), out + i * BLOCKLEN);
+}
+
+void aes::decrypt_blocks(const std::uint8_t* in,
+                         std::uint8_t* out,
+                         const std::size_t nblocks,
+                         const std::size_t block_size) {
+    if (block_size != BLOCKLEN)
+        return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+    for (std::size_t i = 0; i < nblocks; ++i)
+        AES128_ECB_decrypt(in + i * BLOCKLEN, _ctx.round_key, unsigned(_rounds), out + i * BLOCKLEN);
 }
 
 } // namespace block
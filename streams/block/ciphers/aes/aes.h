@@ -14,9 +14,12 @@ namespace block {
 
         struct aes_ctx {
             aes_ctx()
-                : key{0} {}
+                : key{0}
+                , round_key{0} {}
 
             uint8_t key[16];
+            // expanded for the full 10 rounds, reduced-round variants use a prefix
+            uint8_t round_key[176];
         } _ctx;
 
     public:
@@ -32,5 +35,15 @@ namespace block {
 
         void decrypt(const std::uint8_t* ciphertext,
                      std::uint8_t* plaintext) override;
+
+        void encrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
+
+        void decrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
     };
 }
@@ -20,9 +20,8 @@ namespace aria {
 #define ARIA_REFERENCE_KEY_SCHEDULE
 
 //
-// Optimized macros
+// Optimized macros, the word tables below are used by the rounds of both key schedules
 //
-#ifndef ARIA_REFERENCE_KEY_SCHEDULE
 /* Begin macro */
 
 /* rotation */
@@ -56,6 +55,7 @@ namespace aria {
 
 /* End Macro*/
 
+#ifndef ARIA_REFERENCE_KEY_SCHEDULE
 /* Key Constant
  * 128bit : 0, 1,    2
  * 192bit : 1, 2,    3(0)
@@ -69,6 +69,8 @@ static const uint32_t Key_RC[5][4] = {
     {0x6db14acc, 0x9e21c820, 0xff28b1d5, 0xef5de2b0}
 };
 
+#endif
+
 /* 32bit expanded s-box */
 static const uint32_t S1[256] = {
     0x00636363, 0x007c7c7c, 0x00777777, 0x007b7b7b,
@@ -465,6 +467,7 @@ do {                                            \
 (Y) = (TMP2) ^ rotr32((TMP) ^ (TMP2), 16);  \
 } while(0)
 
+#ifndef ARIA_REFERENCE_KEY_SCHEDULE
 int aria_set_encrypt_key(const unsigned char *userKey, const int bits,
                          ARIA_KEY *key) {
     uint32_t reg0, reg1, reg2, reg3;
@@ -1031,6 +1034,10 @@ static ossl_inline void FE(ARIA_u128 *o, const ARIA_u128 *d,
 /*
  * Encrypt or decrypt a single block
  * in and out can overlap
+ *
+ * Each substitution step followed by a diffusion step is done on big-endian words
+ * with the expanded S-box tables (ARIA_SUBST_DIFF_ODD/EVEN), a closing substitution
+ * without diffusion uses sl1/sl2.
  */
 static void do_encrypt(unsigned char *o, const unsigned char *pin,
                        unsigned int rounds, const ARIA_u128 *keys,
@@ -1039,6 +1046,7 @@ static void do_encrypt(unsigned char *o, const unsigned char *pin,
     ARIA_u128 p{};
     ARIA_u128 y{};
     const bool is_full = nr == rounds;
+    uint32_t t0, t1, t2, t3;
     unsigned int i;
 
     memcpy(&p, pin, sizeof(p));
@@ -1046,25 +1054,49 @@ static void do_encrypt(unsigned char *o, const unsigned char *pin,
     // Extra zero key for decryption purposes, inverting transformation
     memset((char *) (keys) + sizeof(ARIA_u128) * (rounds+1), 0, sizeof(ARIA_u128));
 
-    for (i = 0; i < nr; i += 1) {
-        if ((enc && i > 0) || (!enc && (!is_full || i > 0))) {
-            a(&y, &p);
-            memcpy(&p, &y, sizeof(ARIA_u128));
-        }
+    // reduced decryption starts with a diffusion step, zero-round encryption is one
+    if (!is_full && (enc ? nr == 0 : nr > 0)) {
+        a(&y, &p);
+        memcpy(&p, &y, sizeof(ARIA_u128));
+    }
+
+    // ciphertext output for partial ARIA ends with a diffusion step as well
+    const unsigned int diffused = enc && !is_full ? nr : (nr > 0 ? nr - 1 : 0);
+
+    t0 = GET_U32_BE(p.c, 0);
+    t1 = GET_U32_BE(p.c, 1);
+    t2 = GET_U32_BE(p.c, 2);
+    t3 = GET_U32_BE(p.c, 3);
+
+    for (i = 0; i < diffused; i += 1) {
+        const ARIA_u128 *rk = &keys[enc || is_full ? i : ((i == 0 ? rounds+1 : rounds-nr+i))];
+        t0 ^= GET_U32_BE(rk, 0);
+        t1 ^= GET_U32_BE(rk, 1);
+        t2 ^= GET_U32_BE(rk, 2);
+        t3 ^= GET_U32_BE(rk, 3);
 
         // sl1 for encryption on first round, sl2 for dec if odd num of rounds
         if ((enc && (i&1) == 0) || (!enc && ((i&1) == (nr&1)))) {
-            sl1(&p, &p, &keys[enc || is_full ? i : ((i == 0 ? rounds+1 : rounds-nr+i))]);
+            ARIA_SUBST_DIFF_ODD(t0, t1, t2, t3);
         } else {
-            sl2(p.c, &p, &keys[enc || is_full ? i : ((i == 0 ? rounds+1 : rounds-nr+i))]);
+            ARIA_SUBST_DIFF_EVEN(t0, t1, t2, t3);
         }
     }
 
-    // ciphertext output for partial ARIA
-    if (enc && !is_full){
-        a(&y, &p);
-        memcpy(&p, &y, sizeof(ARIA_u128));
+    PUT_U32_BE(p.c, 0, t0);
+    PUT_U32_BE(p.c, 1, t1);
+    PUT_U32_BE(p.c, 2, t2);
+    PUT_U32_BE(p.c, 3, t3);
+
+    if (i < nr) {
+        const ARIA_u128 *rk = &keys[enc || is_full ? i : ((i == 0 ? rounds+1 : rounds-nr+i))];
+        if ((enc && (i&1) == 0) || (!enc && ((i&1) == (nr&1)))) {
+            sl1(&p, &p, rk);
+        } else {
+            sl2(p.c, &p, rk);
+        }
     }
+
     if (!enc && !is_full){
         xor128(p.c, p.c, &keys[rounds]);
     }
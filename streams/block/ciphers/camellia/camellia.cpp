@@ -281,29 +281,62 @@ static const signed char transposes[2][20] =
         }                                                   \
 }
 
+/*
+ * The P-function of camellia_feistel(), mapping the S-box outputs to the two words XORed
+ * onto z[0] (high half of the result) and z[1] (low half).
+ */
+static uint64_t camellia_p( uint32_t I0, uint32_t I1 )
+{
+    I0 ^= (I1 << 8) | (I1 >> 24);
+    I1 ^= (I0 << 16) | (I0 >> 16);
+    I0 ^= (I1 >> 8) | (I1 << 24);
+    I1 ^= (I0 >> 8) | (I0 << 24);
+
+    return ( (uint64_t) I1 << 32 ) | I0;
+}
+
+/*
+ * P is linear, so the F-function is the XOR of one entry per input byte: SP[j][b] is P of
+ * the S-box output of b alone at byte j (bytes 0-3 of x[0], then 4-7 of x[1]). Eight lookups
+ * replace the S-boxes and the shifts of P.
+ */
+struct camellia_sp_tables {
+    uint64_t SP[8][256];
+
+    camellia_sp_tables()
+    {
+        for( unsigned b = 0; b < 256; b++ ) {
+            const uint32_t s1 = SBOX1(b), s2 = SBOX2(b), s3 = SBOX3(b), s4 = SBOX4(b);
+
+            SP[0][b] = camellia_p( s1 << 24, 0 );
+            SP[1][b] = camellia_p( s2 << 16, 0 );
+            SP[2][b] = camellia_p( s3 <<  8, 0 );
+            SP[3][b] = camellia_p( s4,       0 );
+            SP[4][b] = camellia_p( 0, s2 << 24 );
+            SP[5][b] = camellia_p( 0, s3 << 16 );
+            SP[6][b] = camellia_p( 0, s4 <<  8 );
+            SP[7][b] = camellia_p( 0, s1       );
+        }
+    }
+};
+
+static const camellia_sp_tables sp_tables;
+
 static void camellia_feistel( const uint32_t x[2], const uint32_t k[2],
                               uint32_t z[2])
 {
+    const uint64_t (*SP)[256] = sp_tables.SP;
     uint32_t I0, I1;
     I0 = x[0] ^ k[0];
     I1 = x[1] ^ k[1];
 
-    I0 = ((uint32_t) SBOX1((I0 >> 24) & 0xFF) << 24) |
-         ((uint32_t) SBOX2((I0 >> 16) & 0xFF) << 16) |
-         ((uint32_t) SBOX3((I0 >>  8) & 0xFF) <<  8) |
-         ((uint32_t) SBOX4((I0      ) & 0xFF)      );
-    I1 = ((uint32_t) SBOX2((I1 >> 24) & 0xFF) << 24) |
-         ((uint32_t) SBOX3((I1 >> 16) & 0xFF) << 16) |
-         ((uint32_t) SBOX4((I1 >>  8) & 0xFF) <<  8) |
-         ((uint32_t) SBOX1((I1      ) & 0xFF)      );
-
-    I0 ^= (I1 << 8) | (I1 >> 24);
-    I1 ^= (I0 << 16) | (I0 >> 16);
-    I0 ^= (I1 >> 8) | (I1 << 24);
-    I1 ^= (I0 >> 8) | (I0 << 24);
+    const uint64_t t = SP[0][(I0 >> 24)       ] ^ SP[1][(I0 >> 16) & 0xFF] ^
+                       SP[2][(I0 >>  8) & 0xFF] ^ SP[3][(I0      ) & 0xFF] ^
+                       SP[4][(I1 >> 24)       ] ^ SP[5][(I1 >> 16) & 0xFF] ^
+                       SP[6][(I1 >>  8) & 0xFF] ^ SP[7][(I1      ) & 0xFF];
 
-    z[0] ^= I1;
-    z[1] ^= I0;
+    z[0] ^= (uint32_t) ( t >> 32 );
+    z[1] ^= (uint32_t) t;
 }
 
 void mbedtls_camellia_init( mbedtls_camellia_context *ctx )
@@ -29,3 +29,9 @@ void des_crypt(const BYTE in[], BYTE out[], const BYTE key[][6], const unsigned
 
 void three_des_key_setup(const BYTE key[], BYTE schedule[][16][6], DES_MODE mode);
 void three_des_crypt(const BYTE in[], BYTE out[], const BYTE key[][16][6], const unsigned rounds);
+
+/* Same as des_crypt()/three_des_crypt() on nblocks consecutive blocks, bitsliced, see des_bitslice.cpp */
+void des_crypt_blocks(const BYTE in[], BYTE out[], const size_t nblocks, const BYTE key[][6],
+                      const unsigned rounds);
+void three_des_crypt_blocks(const BYTE in[], BYTE out[], const size_t nblocks,
+                            const BYTE key[][16][6], const unsigned rounds);
@@ -0,0 +1,234 @@
+/*
+ * Bitsliced DES: slice i holds bit i of many blocks (one block per bit position), so one
+ * round of all blocks is the S-box circuits of des_bitslice_sboxes.h evaluated on whole
+ * machine words, and the bit permutations are free renumbering of the slices.
+ *
+ * Groups of 256 blocks use four 64-bit words per slice, which the compiler vectorises;
+ * the remainder is done 64 blocks at a time, and a short tail with the table-based
+ * des_crypt(). The round structure (including round reduction) is the one of des_crypt().
+ */
+
+#include "des.h"
+#include "des_bitslice_sboxes.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// FIPS 46-3 tables, 1-based bit positions
+const unsigned char ip_table[64] = {58, 50, 42, 34, 26, 18, 10, 2,  60, 52, 44, 36, 28, 20, 12, 4,
+                                    62, 54, 46, 38, 30, 22, 14, 6,  64, 56, 48, 40, 32, 24, 16, 8,
+                                    57, 49, 41, 33, 25, 17, 9,  1,  59, 51, 43, 35, 27, 19, 11, 3,
+                                    61, 53, 45, 37, 29, 21, 13, 5,  63, 55, 47, 39, 31, 23, 15, 7};
+const unsigned char fp_table[64] = {40, 8, 48, 16, 56, 24, 64, 32, 39, 7, 47, 15, 55, 23, 63, 31,
+                                    38, 6, 46, 14, 54, 22, 62, 30, 37, 5, 45, 13, 53, 21, 61, 29,
+                                    36, 4, 44, 12, 52, 20, 60, 28, 35, 3, 43, 11, 51, 19, 59, 27,
+                                    34, 2, 42, 10, 50, 18, 58, 26, 33, 1, 41, 9,  49, 17, 57, 25};
+const unsigned char e_table[48] = {32, 1,  2,  3,  4,  5,  4,  5,  6,  7,  8,  9,
+                                   8,  9,  10, 11, 12, 13, 12, 13, 14, 15, 16, 17,
+                                   16, 17, 18, 19, 20, 21, 20, 21, 22, 23, 24, 25,
+                                   24, 25, 26, 27, 28, 29, 28, 29, 30, 31, 32, 1};
+const unsigned char p_table[32] = {16, 7, 20, 21, 29, 12, 28, 17, 1,  15, 23, 26, 5,  18, 31, 10,
+                                   2,  8, 24, 14, 32, 27, 3,  9,  19, 13, 30, 6,  22, 11, 4,  25};
+
+const unsigned des_rounds = 16;
+// below this many blocks the table-based des_crypt() is faster than a 64-block slice
+const size_t min_bitsliced_blocks = 8;
+
+// four 64-bit slice words side by side, i.e. 256 blocks
+struct slice4 {
+    std::uint64_t w[4];
+};
+
+inline slice4 operator^(const slice4 &a, const slice4 &b) {
+    return slice4{{a.w[0] ^ b.w[0], a.w[1] ^ b.w[1], a.w[2] ^ b.w[2], a.w[3] ^ b.w[3]}};
+}
+inline slice4 operator&(const slice4 &a, const slice4 &b) {
+    return slice4{{a.w[0] & b.w[0], a.w[1] & b.w[1], a.w[2] & b.w[2], a.w[3] & b.w[3]}};
+}
+inline slice4 operator|(const slice4 &a, const slice4 &b) {
+    return slice4{{a.w[0] | b.w[0], a.w[1] | b.w[1], a.w[2] | b.w[2], a.w[3] | b.w[3]}};
+}
+inline slice4 operator~(const slice4 &a) {
+    return slice4{{~a.w[0], ~a.w[1], ~a.w[2], ~a.w[3]}};
+}
+
+template <typename T>
+T broadcast(const std::uint64_t v);
+
+template <>
+inline std::uint64_t broadcast<std::uint64_t>(const std::uint64_t v) {
+    return v;
+}
+template <>
+inline slice4 broadcast<slice4>(const std::uint64_t v) {
+    return slice4{{v, v, v, v}};
+}
+
+inline std::uint64_t &slice_word(std::uint64_t &s, const unsigned) {
+    return s;
+}
+inline std::uint64_t &slice_word(slice4 &s, const unsigned g) {
+    return s.w[g];
+}
+
+/**
+ * Transposes a 64x64 bit matrix, row i given by a[i] with bit 0 the most significant one
+ * (Hacker's Delight, 7-3).
+ */
+void transpose64(std::uint64_t a[64]) {
+    std::uint64_t m = 0x00000000ffffffffull;
+    for (unsigned j = 32; j != 0; j >>= 1, m ^= m << j) {
+        for (unsigned k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            const std::uint64_t t = (a[k] ^ (a[k | j] >> j)) & m;
+            a[k] ^= t;
+            a[k | j] ^= t << j;
+        }
+    }
+}
+
+/**
+ * Subkey bits of all 16 rounds expanded to all-zero/all-one words, XORed onto the
+ * expanded half-block slices.
+ */
+struct key_masks {
+    explicit key_masks(const BYTE key[][6]) {
+        for (unsigned r = 0; r < des_rounds; ++r) {
+            for (unsigned b = 0; b < 48; ++b)
+                mask[r][b] = 0 - std::uint64_t((key[r][b / 8] >> (7 - b % 8)) & 1);
+        }
+    }
+
+    std::uint64_t mask[des_rounds][48];
+};
+
+template <typename T>
+inline void f(const T *r, const std::uint64_t *kmask, T *l) {
+    T x[48];
+    for (unsigned b = 0; b < 48; ++b)
+        x[b] = r[e_table[b] - 1] ^ broadcast<T>(kmask[b]);
+
+    T y[32];
+    des_bs_s1(x, y);
+    des_bs_s2(x + 6, y + 4);
+    des_bs_s3(x + 12, y + 8);
+    des_bs_s4(x + 18, y + 12);
+    des_bs_s5(x + 24, y + 16);
+    des_bs_s6(x + 30, y + 20);
+    des_bs_s7(x + 36, y + 24);
+    des_bs_s8(x + 42, y + 28);
+
+    for (unsigned i = 0; i < 32; ++i)
+        l[i] = l[i] ^ y[p_table[i] - 1];
+}
+
+/* The rounds of des_crypt() between IP and IP^-1, lr[0..31] is L, lr[32..63] R */
+template <typename T>
+void crypt_rounds(T *lr, const key_masks &keys, const unsigned rounds) {
+    T *l = lr;
+    T *r = lr + 32;
+    for (unsigned idx = 0; idx + 1 < rounds; ++idx) {
+        f(r, keys.mask[idx], l);
+        std::swap(l, r);
+    }
+    // the final round does not switch sides and always takes the last subkey
+    f(r, keys.mask[des_rounds - 1], l);
+
+    if (l != lr)
+        std::swap_ranges(lr, lr + 32, lr + 32);
+}
+
+template <typename T>
+void crypt_group(const BYTE in[],
+                 BYTE out[],
+                 const size_t nblocks,
+                 const key_masks *keys,
+                 const unsigned nkeys,
+                 const unsigned rounds) {
+    const unsigned groups = sizeof(T) / sizeof(std::uint64_t);
+    T slices[64];
+    std::uint64_t rows[64];
+
+    for (unsigned g = 0; g < groups; ++g) {
+        for (unsigned j = 0; j < 64; ++j) {
+            const size_t blk = g * 64 + j;
+            rows[j] = 0;
+            for (unsigned i = 0; blk < nblocks && i < DES_BLOCK_SIZE; ++i)
+                rows[j] = (rows[j] << 8) | in[blk * DES_BLOCK_SIZE + i];
+        }
+        transpose64(rows);
+        for (unsigned i = 0; i < 64; ++i)
+            slice_word(slices[i], g) = rows[i];
+    }
+
+    T lr[64];
+    for (unsigned i = 0; i < 64; ++i)
+        lr[i] = slices[ip_table[i] - 1];
+
+    // IP^-1 of one pass and IP of the next one cancel out, 3DES stays in the sliced domain
+    for (unsigned k = 0; k < nkeys; ++k)
+        crypt_rounds(lr, keys[k], rounds);
+
+    for (unsigned i = 0; i < 64; ++i)
+        slices[i] = lr[fp_table[i] - 1];
+
+    for (unsigned g = 0; g < groups; ++g) {
+        for (unsigned i = 0; i < 64; ++i)
+            rows[i] = slice_word(slices[i], g);
+        transpose64(rows);
+        for (unsigned j = 0; j < 64 && g * 64 + j < nblocks; ++j) {
+            for (unsigned i = 0; i < DES_BLOCK_SIZE; ++i)
+                out[(g * 64 + j) * DES_BLOCK_SIZE + i] = BYTE(rows[j] >> (56 - 8 * i));
+        }
+    }
+}
+
+/* Returns the number of blocks done, the short tail is left to the table-based code */
+size_t crypt_blocks(const BYTE in[],
+                    BYTE out[],
+                    const size_t nblocks,
+                    const key_masks *keys,
+                    const unsigned nkeys,
+                    const unsigned rounds) {
+    size_t done = 0;
+    for (; nblocks - done >= 256; done += 256) {
+        crypt_group<slice4>(
+                in + done * DES_BLOCK_SIZE, out + done * DES_BLOCK_SIZE, 256, keys, nkeys, rounds);
+    }
+    while (nblocks - done >= min_bitsliced_blocks) {
+        const size_t n = std::min(nblocks - done, size_t(64));
+        crypt_group<std::uint64_t>(
+                in + done * DES_BLOCK_SIZE, out + done * DES_BLOCK_SIZE, n, keys, nkeys, rounds);
+        done += n;
+    }
+    return done;
+}
+
+} // namespace
+
+void des_crypt_blocks(
+        const BYTE in[], BYTE out[], const size_t nblocks, const BYTE key[][6], const unsigned rounds) {
+    size_t done = 0;
+    // above 16 rounds des_crypt() reads past the schedule, keep exactly its behaviour
+    if (rounds <= des_rounds && nblocks >= min_bitsliced_blocks) {
+        const key_masks keys(key);
+        done = crypt_blocks(in, out, nblocks, &keys, 1, rounds);
+    }
+    for (size_t i = done; i < nblocks; ++i)
+        des_crypt(in + i * DES_BLOCK_SIZE, out + i * DES_BLOCK_SIZE, key, rounds);
+}
+
+void three_des_crypt_blocks(const BYTE in[],
+                            BYTE out[],
+                            const size_t nblocks,
+                            const BYTE key[][16][6],
+                            const unsigned rounds) {
+    size_t done = 0;
+    if (rounds <= des_rounds && nblocks >= min_bitsliced_blocks) {
+        const key_masks keys[3] = {key_masks(key[0]), key_masks(key[1]), key_masks(key[2])};
+        done = crypt_blocks(in, out, nblocks, keys, 3, rounds);
+    }
+    for (size_t i = done; i < nblocks; ++i)
+        three_des_crypt(in + i * DES_BLOCK_SIZE, out + i * DES_BLOCK_SIZE, key, rounds);
+}
@@ -0,0 +1,891 @@
+#pragma once
+
+/*
+ * Boolean circuits of the DES S-boxes for the bitsliced implementation in des_bitslice.cpp.
+ *
+ * Generated from the sbox1..sbox8 tables of des.cpp: each output bit is a multiplexer tree
+ * over the six input bits, with equal subfunctions shared between the four outputs, in the
+ * variable order giving the fewest gates. x[0..5] are the S-box input bits in DES order
+ * (x[0] and x[5] select the row), y[0..3] the output bits, y[0] being the most significant.
+ */
+
+// S1, 107 gates
+template <typename T>
+static inline void des_bs_s1(const T* x, T* y) {
+    const T t0 = ~x[4];
+    const T t1 = t0 ^ x[1];
+    const T t2 = t1 ^ x[4];
+    const T t3 = t2 & x[2];
+    const T t4 = t1 ^ t3;
+    const T t5 = x[4] & x[2];
+    const T t6 = t1 ^ t5;
+    const T t7 = t4 ^ t6;
+    const T t8 = t7 & x[3];
+    const T t9 = t4 ^ t8;
+    const T t10 = x[4] ^ x[1];
+    const T t11 = t10 ^ t3;
+    const T t12 = t0 & x[2];
+    const T t13 = x[1] ^ t12;
+    const T t14 = t11 ^ t13;
+    const T t15 = t14 & x[3];
+    const T t16 = t11 ^ t15;
+    const T t17 = t9 ^ t16;
+    const T t18 = t17 & x[5];
+    const T t19 = t9 ^ t18;
+    const T t20 = t0 | t2;
+    const T t21 = x[4] & t2;
+    const T t22 = t20 ^ t12;
+    const T t23 = t13 ^ t22;
+    const T t24 = t23 & x[3];
+    const T t25 = t13 ^ t24;
+    const T t26 = t23 ^ t10;
+    const T t27 = t26 & x[2];
+    const T t28 = t23 ^ t27;
+    const T t29 = x[4] & x[1];
+    const T t30 = t1 ^ t29;
+    const T t31 = t30 & x[2];
+    const T t32 = t1 ^ t31;
+    const T t33 = t28 ^ t32;
+    const T t34 = t33 & x[3];
+    const T t35 = t28 ^ t34;
+    const T t36 = t25 ^ t35;
+    const T t37 = t36 & x[5];
+    const T t38 = t25 ^ t37;
+    const T t39 = t19 ^ t38;
+    const T t40 = t39 & x[0];
+    const T t41 = t19 ^ t40;
+    const T t42 = t2 ^ t12;
+    const T t43 = t26 ^ t12;
+    const T t44 = t42 ^ t43;
+    const T t45 = t44 & x[3];
+    const T t46 = t42 ^ t45;
+    const T t47 = x[4] ^ t3;
+    const T t48 = t10 & x[2];
+    const T t49 = t20 ^ t48;
+    const T t50 = t43 & x[3];
+    const T t51 = t47 ^ t50;
+    const T t52 = t46 ^ t51;
+    const T t53 = t52 & x[5];
+    const T t54 = t46 ^ t53;
+    const T t55 = t44 & x[2];
+    const T t56 = t26 ^ t55;
+    const T t57 = t0 & x[1];
+    const T t58 = t1 ^ t27;
+    const T t59 = t56 ^ t58;
+    const T t60 = t59 & x[3];
+    const T t61 = t56 ^ t60;
+    const T t62 = t49 ^ x[3];
+    const T t63 = t61 ^ t62;
+    const T t64 = t63 & x[5];
+    const T t65 = t61 ^ t64;
+    const T t66 = t54 ^ t65;
+    const T t67 = t66 & x[0];
+    const T t68 = t54 ^ t67;
+    const T t69 = t4 & x[3];
+    const T t70 = t56 ^ t69;
+    const T t71 = t44 ^ t27;
+    const T t72 = t20 & x[3];
+    const T t73 = t71 ^ t72;
+    const T t74 = t70 ^ t73;
+    const T t75 = t74 & x[5];
+    const T t76 = t70 ^ t75;
+    const T t77 = t57 ^ t5;
+    const T t78 = t26 & x[3];
+    const T t79 = t77 ^ t78;
+    const T t80 = t22 & x[3];
+    const T t81 = t58 ^ t80;
+    const T t82 = t79 ^ t81;
+    const T t83 = t82 & x[5];
+    const T t84 = t79 ^ t83;
+    const T t85 = t76 ^ t84;
+    const T t86 = t85 & x[0];
+    const T t87 = t76 ^ t86;
+    const T t88 = t77 ^ t72;
+    const T t89 = t21 ^ t55;
+    const T t90 = t89 ^ t24;
+    const T t91 = t88 ^ t90;
+    const T t92 = t91 & x[5];
+    const T t93 = t88 ^ t92;
+    const T t94 = x[1] ^ t5;
+    const T t95 = t11 ^ t94;
+    const T t96 = t95 & x[3];
+    const T t97 = t11 ^ t96;
+    const T t98 = t26 ^ x[2];
+    const T t99 = t1 & x[3];
+    const T t100 = t98 ^ t99;
+    const T t101 = t97 ^ t100;
+    const T t102 = t101 & x[5];
+    const T t103 = t97 ^ t102;
+    const T t104 = t93 ^ t103;
+    const T t105 = t104 & x[0];
+    const T t106 = t93 ^ t105;
+    y[0] = t41;
+    y[1] = t68;
+    y[2] = t87;
+    y[3] = t106;
+}
+
+// S2, 107 gates
+template <typename T>
+static inline void des_bs_s2(const T* x, T* y) {
+    const T t0 = ~x[4];
+    const T t1 = t0 ^ x[0];
+    const T t2 = ~x[0];
+    const T t3 = x[4] | t2;
+    const T t4 = x[4] ^ x[0];
+    const T t5 = t3 ^ t4;
+    const T t6 = t5 & x[1];
+    const T t7 = t3 ^ t6;
+    const T t8 = t1 ^ t7;
+    const T t9 = t8 & x[3];
+    const T t10 = t1 ^ t9;
+    const T t11 = t2 & x[1];
+    const T t12 = t4 ^ t11;
+    const T t13 = t0 & x[0];
+    const T t14 = t13 ^ x[4];
+    const T t15 = t14 & x[1];
+    const T t16 = t13 ^ t15;
+    const T t17 = t12 ^ t9;
+    const T t18 = t10 ^ t17;
+    const T t19 = t18 & x[2];
+    const T t20 = t10 ^ t19;
+    const T t21 = t3 & x[1];
+    const T t22 = t14 ^ t21;
+    const T t23 = t22 ^ t16;
+    const T t24 = t23 & x[3];
+    const T t25 = t22 ^ t24;
+    const T t26 = x[4] & t2;
+    const T t27 = t1 ^ t21;
+    const T t28 = t27 ^ t24;
+    const T t29 = t25 ^ t28;
+    const T t30 = t29 & x[2];
+    const T t31 = t25 ^ t30;
+    const T t32 = t20 ^ t31;
+    const T t33 = t32 & x[5];
+    const T t34 = t20 ^ t33;
+    const T t35 = t1 ^ x[1];
+    const T t36 = t4 ^ t14;
+    const T t37 = t36 & x[1];
+    const T t38 = t4 ^ t37;
+    const T t39 = t35 ^ t38;
+    const T t40 = t39 & x[3];
+    const T t41 = t35 ^ t40;
+    const T t42 = t0 & t2;
+    const T t43 = t1 ^ t37;
+    const T t44 = t4 ^ x[1];
+    const T t45 = t43 ^ t40;
+    const T t46 = t41 ^ t45;
+    const T t47 = t46 & x[2];
+    const T t48 = t41 ^ t47;
+    const T t49 = t0 & x[3];
+    const T t50 = t44 ^ t49;
+    const T t51 = t1 ^ x[3];
+    const T t52 = t50 ^ t51;
+    const T t53 = t52 & x[2];
+    const T t54 = t50 ^ t53;
+    const T t55 = t48 ^ t54;
+    const T t56 = t55 & x[5];
+    const T t57 = t48 ^ t56;
+    const T t58 = t14 ^ t46;
+    const T t59 = t27 ^ t58;
+    const T t60 = t59 & x[3];
+    const T t61 = t27 ^ t60;
+    const T t62 = t29 ^ x[1];
+    const T t63 = t4 & x[3];
+    const T t64 = t62 ^ t63;
+    const T t65 = t61 ^ t64;
+    const T t66 = t65 & x[2];
+    const T t67 = t61 ^ t66;
+    const T t68 = t42 ^ t6;
+    const T t69 = t68 ^ t4;
+    const T t70 = t69 & x[3];
+    const T t71 = t68 ^ t70;
+    const T t72 = ~x[1];
+    const T t73 = t42 | t72;
+    const T t74 = x[4] ^ x[1];
+    const T t75 = t73 ^ t74;
+    const T t76 = t75 & x[3];
+    const T t77 = t73 ^ t76;
+    const T t78 = t71 ^ t77;
+    const T t79 = t78 & x[2];
+    const T t80 = t71 ^ t79;
+    const T t81 = t67 ^ t80;
+    const T t82 = t81 & x[5];
+    const T t83 = t67 ^ t82;
+    const T t84 = t13 & x[1];
+    const T t85 = t2 ^ t84;
+    const T t86 = x[0] ^ t15;
+    const T t87 = t85 ^ t86;
+    const T t88 = t87 & x[3];
+    const T t89 = t85 ^ t88;
+    const T t90 = t26 ^ t15;
+    const T t91 = t90 ^ t88;
+    const T t92 = t89 ^ t91;
+    const T t93 = t92 & x[2];
+    const T t94 = t89 ^ t93;
+    const T t95 = t29 ^ t11;
+    const T t96 = t95 ^ t74;
+    const T t97 = t96 & x[3];
+    const T t98 = t95 ^ t97;
+    const T t99 = t5 ^ t46;
+    const T t100 = t99 ^ t97;
+    const T t101 = t98 ^ t100;
+    const T t102 = t101 & x[2];
+    const T t103 = t98 ^ t102;
+    const T t104 = t94 ^ t103;
+    const T t105 = t104 & x[5];
+    const T t106 = t94 ^ t105;
+    y[0] = t34;
+    y[1] = t57;
+    y[2] = t83;
+    y[3] = t106;
+}
+
+// S3, 101 gates
+template <typename T>
+static inline void des_bs_s3(const T* x, T* y) {
+    const T t0 = ~x[4];
+    const T t1 = t0 ^ x[1];
+    const T t2 = x[5] | t0;
+    const T t3 = t2 & x[1];
+    const T t4 = t1 ^ t3;
+    const T t5 = t4 & x[2];
+    const T t6 = t1 ^ t5;
+    const T t7 = ~x[5];
+    const T t8 = t7 | x[4];
+    const T t9 = t7 ^ x[4];
+    const T t10 = t8 ^ t9;
+    const T t11 = t10 & x[1];
+    const T t12 = t8 ^ t11;
+    const T t13 = x[5] ^ x[4];
+    const T t14 = t9 ^ x[1];
+    const T t15 = t12 ^ t14;
+    const T t16 = t15 & x[2];
+    const T t17 = t12 ^ t16;
+    const T t18 = t6 ^ t17;
+    const T t19 = t18 & x[3];
+    const T t20 = t6 ^ t19;
+    const T t21 = t9 ^ t16;
+    const T t22 = t21 ^ x[3];
+    const T t23 = t20 ^ t22;
+    const T t24 = t23 & x[0];
+    const T t25 = t20 ^ t24;
+    const T t26 = x[5] ^ t10;
+    const T t27 = t26 & x[1];
+    const T t28 = x[5] ^ t27;
+    const T t29 = t28 ^ t14;
+    const T t30 = t29 & x[2];
+    const T t31 = t28 ^ t30;
+    const T t32 = t7 | t0;
+    const T t33 = t7 & x[1];
+    const T t34 = t32 ^ t33;
+    const T t35 = t15 ^ t34;
+    const T t36 = t35 & x[2];
+    const T t37 = t15 ^ t36;
+    const T t38 = t31 ^ t37;
+    const T t39 = t38 & x[3];
+    const T t40 = t31 ^ t39;
+    const T t41 = t7 ^ x[1];
+    const T t42 = t0 & x[2];
+    const T t43 = t41 ^ t42;
+    const T t44 = t0 ^ t33;
+    const T t45 = x[5] & x[4];
+    const T t46 = t2 & x[2];
+    const T t47 = t44 ^ t46;
+    const T t48 = t43 ^ t47;
+    const T t49 = t48 & x[3];
+    const T t50 = t43 ^ t49;
+    const T t51 = t40 ^ t50;
+    const T t52 = t51 & x[0];
+    const T t53 = t40 ^ t52;
+    const T t54 = t9 ^ t3;
+    const T t55 = t32 ^ t27;
+    const T t56 = t54 ^ t55;
+    const T t57 = t56 & x[2];
+    const T t58 = t54 ^ t57;
+    const T t59 = t45 & x[1];
+    const T t60 = t10 ^ t59;
+    const T t61 = t60 ^ x[2];
+    const T t62 = t58 ^ t61;
+    const T t63 = t62 & x[3];
+    const T t64 = t58 ^ t63;
+    const T t65 = x[4] ^ t33;
+    const T t66 = t65 ^ t13;
+    const T t67 = t66 & x[2];
+    const T t68 = t65 ^ t67;
+    const T t69 = t9 ^ t27;
+    const T t70 = t3 ^ t69;
+    const T t71 = t70 & x[2];
+    const T t72 = t3 ^ t71;
+    const T t73 = t68 ^ t72;
+    const T t74 = t73 & x[3];
+    const T t75 = t68 ^ t74;
+    const T t76 = t64 ^ t75;
+    const T t77 = t76 & x[0];
+    const T t78 = t64 ^ t77;
+    const T t79 = x[5] ^ x[1];
+    const T t80 = x[4] & x[2];
+    const T t81 = t79 ^ t80;
+    const T t82 = t0 & x[3];
+    const T t83 = t81 ^ t82;
+    const T t84 = t32 & x[1];
+    const T t85 = x[4] ^ t84;
+    const T t86 = t35 ^ t85;
+    const T t87 = t86 & x[2];
+    const T t88 = t35 ^ t87;
+    const T t89 = t13 ^ t27;
+    const T t90 = t8 & x[1];
+    const T t91 = t9 ^ t90;
+    const T t92 = t89 ^ t91;
+    const T t93 = t92 & x[2];
+    const T t94 = t89 ^ t93;
+    const T t95 = t88 ^ t94;
+    const T t96 = t95 & x[3];
+    const T t97 = t88 ^ t96;
+    const T t98 = t83 ^ t97;
+    const T t99 = t98 & x[0];
+    const T t100 = t83 ^ t99;
+    y[0] = t25;
+    y[1] = t53;
+    y[2] = t78;
+    y[3] = t100;
+}
+
+// S4, 74 gates
+template <typename T>
+static inline void des_bs_s4(const T* x, T* y) {
+    const T t0 = ~x[3];
+    const T t1 = t0 ^ x[2];
+    const T t2 = x[3] ^ t1;
+    const T t3 = t2 & x[4];
+    const T t4 = x[3] ^ t3;
+    const T t5 = x[3] ^ x[2];
+    const T t6 = x[3] & x[4];
+    const T t7 = t5 ^ t6;
+    const T t8 = t4 ^ t7;
+    const T t9 = t8 & x[1];
+    const T t10 = t4 ^ t9;
+    const T t11 = t0 | t2;
+    const T t12 = t11 ^ x[2];
+    const T t13 = t12 & x[4];
+    const T t14 = t11 ^ t13;
+    const T t15 = t1 ^ t13;
+    const T t16 = t14 ^ t15;
+    const T t17 = t16 & x[1];
+    const T t18 = t14 ^ t17;
+    const T t19 = t10 ^ t18;
+    const T t20 = t19 & x[0];
+    const T t21 = t10 ^ t20;
+    const T t22 = t5 & x[4];
+    const T t23 = t2 ^ t22;
+    const T t24 = t12 & x[1];
+    const T t25 = t23 ^ t24;
+    const T t26 = t0 & x[4];
+    const T t27 = x[2] ^ t26;
+    const T t28 = t0 ^ x[4];
+    const T t29 = t27 ^ t28;
+    const T t30 = t29 & x[1];
+    const T t31 = t27 ^ t30;
+    const T t32 = t25 ^ t31;
+    const T t33 = t32 & x[0];
+    const T t34 = t25 ^ t33;
+    const T t35 = t21 ^ t34;
+    const T t36 = t35 & x[5];
+    const T t37 = t21 ^ t36;
+    const T t38 = t0 ^ t3;
+    const T t39 = t38 ^ t9;
+    const T t40 = t0 | x[2];
+    const T t41 = t39 ^ t20;
+    const T t42 = t34 ^ t41;
+    const T t43 = t42 & x[5];
+    const T t44 = t34 ^ t43;
+    const T t45 = t40 & x[4];
+    const T t46 = t2 ^ t45;
+    const T t47 = t11 & x[1];
+    const T t48 = t46 ^ t47;
+    const T t49 = x[2] & x[4];
+    const T t50 = t1 ^ t49;
+    const T t51 = t2 ^ t26;
+    const T t52 = t50 ^ t51;
+    const T t53 = t52 & x[1];
+    const T t54 = t50 ^ t53;
+    const T t55 = t48 ^ t54;
+    const T t56 = t55 & x[0];
+    const T t57 = t48 ^ t56;
+    const T t58 = t27 & x[1];
+    const T t59 = t7 ^ t58;
+    const T t60 = t0 ^ t22;
+    const T t61 = t40 & x[1];
+    const T t62 = t60 ^ t61;
+    const T t63 = t59 ^ t62;
+    const T t64 = t63 & x[0];
+    const T t65 = t59 ^ t64;
+    const T t66 = t57 ^ t65;
+    const T t67 = t66 & x[5];
+    const T t68 = t57 ^ t67;
+    const T t69 = t29 ^ t58;
+    const T t70 = t69 ^ t64;
+    const T t71 = t70 ^ t57;
+    const T t72 = t71 & x[5];
+    const T t73 = t70 ^ t72;
+    y[0] = t37;
+    y[1] = t44;
+    y[2] = t68;
+    y[3] = t73;
+}
+
+// S5, 109 gates
+template <typename T>
+static inline void des_bs_s5(const T* x, T* y) {
+    const T t0 = ~x[4];
+    const T t1 = x[4] ^ x[1];
+    const T t2 = x[4] & x[0];
+    const T t3 = t1 ^ t2;
+    const T t4 = ~x[1];
+    const T t5 = t0 & x[0];
+    const T t6 = x[0] & x[2];
+    const T t7 = t3 ^ t6;
+    const T t8 = x[4] | t4;
+    const T t9 = t4 ^ t8;
+    const T t10 = t9 & x[0];
+    const T t11 = t4 ^ t10;
+    const T t12 = t9 ^ t1;
+    const T t13 = t12 & x[0];
+    const T t14 = t9 ^ t13;
+    const T t15 = t11 ^ t14;
+    const T t16 = t15 & x[2];
+    const T t17 = t11 ^ t16;
+    const T t18 = t7 ^ t17;
+    const T t19 = t18 & x[5];
+    const T t20 = t7 ^ t19;
+    const T t21 = t0 | x[1];
+    const T t22 = t21 ^ x[4];
+    const T t23 = t22 & x[0];
+    const T t24 = t21 ^ t23;
+    const T t25 = t14 ^ t24;
+    const T t26 = t25 & x[2];
+    const T t27 = t14 ^ t26;
+    const T t28 = t0 ^ x[1];
+    const T t29 = t12 ^ t23;
+    const T t30 = t8 & x[2];
+    const T t31 = t29 ^ t30;
+    const T t32 = t27 ^ t31;
+    const T t33 = t32 & x[5];
+    const T t34 = t27 ^ t33;
+    const T t35 = t20 ^ t34;
+    const T t36 = t35 & x[3];
+    const T t37 = t20 ^ t36;
+    const T t38 = x[4] ^ x[0];
+    const T t39 = t4 & x[0];
+    const T t40 = t0 ^ t39;
+    const T t41 = t38 ^ t40;
+    const T t42 = t41 & x[2];
+    const T t43 = t38 ^ t42;
+    const T t44 = t1 & x[2];
+    const T t45 = t25 ^ t44;
+    const T t46 = t43 ^ t45;
+    const T t47 = t46 & x[5];
+    const T t48 = t43 ^ t47;
+    const T t49 = t28 ^ t5;
+    const T t50 = t1 ^ x[0];
+    const T t51 = t49 ^ t50;
+    const T t52 = t51 & x[2];
+    const T t53 = t49 ^ t52;
+    const T t54 = t53 ^ x[5];
+    const T t55 = t48 ^ t54;
+    const T t56 = t55 & x[3];
+    const T t57 = t48 ^ t56;
+    const T t58 = t0 & t4;
+    const T t59 = t58 ^ t23;
+    const T t60 = t4 ^ t13;
+    const T t61 = t59 ^ t60;
+    const T t62 = t61 & x[2];
+    const T t63 = t59 ^ t62;
+    const T t64 = t60 ^ t1;
+    const T t65 = t64 & x[2];
+    const T t66 = t60 ^ t65;
+    const T t67 = t63 ^ t66;
+    const T t68 = t67 & x[5];
+    const T t69 = t63 ^ t68;
+    const T t70 = x[1] ^ t13;
+    const T t71 = t70 ^ t30;
+    const T t72 = t21 ^ x[0];
+    const T t73 = t72 ^ t65;
+    const T t74 = t71 ^ t73;
+    const T t75 = t74 & x[5];
+    const T t76 = t71 ^ t75;
+    const T t77 = t69 ^ t76;
+    const T t78 = t77 & x[3];
+    const T t79 = t69 ^ t78;
+    const T t80 = t9 ^ x[1];
+    const T t81 = t80 & x[0];
+    const T t82 = t9 ^ t81;
+    const T t83 = t0 ^ x[0];
+    const T t84 = t82 ^ t83;
+    const T t85 = t84 & x[2];
+    const T t86 = t82 ^ t85;
+    const T t87 = t9 & x[2];
+    const T t88 = t50 ^ t87;
+    const T t89 = t86 ^ t88;
+    const T t90 = t89 & x[5];
+    const T t91 = t86 ^ t90;
+    const T t92 = t12 ^ t5;
+    const T t93 = t28 ^ t10;
+    const T t94 = t92 ^ t93;
+    const T t95 = t94 & x[2];
+    const T t96 = t92 ^ t95;
+    const T t97 = t80 ^ t13;
+    const T t98 = t21 & x[0];
+    const T t99 = t4 ^ t98;
+    const T t100 = t97 ^ t99;
+    const T t101 = t100 & x[2];
+    const T t102 = t97 ^ t101;
+    const T t103 = t96 ^ t102;
+    const T t104 = t103 & x[5];
+    const T t105 = t96 ^ t104;
+    const T t106 = t91 ^ t105;
+    const T t107 = t106 & x[3];
+    const T t108 = t91 ^ t107;
+    y[0] = t37;
+    y[1] = t57;
+    y[2] = t79;
+    y[3] = t108;
+}
+
+// S6, 107 gates
+template <typename T>
+static inline void des_bs_s6(const T* x, T* y) {
+    const T t0 = ~x[1];
+    const T t1 = ~x[5];
+    const T t2 = x[5] ^ x[1];
+    const T t3 = t1 & x[4];
+    const T t4 = t0 ^ t3;
+    const T t5 = t1 ^ x[4];
+    const T t6 = t4 ^ t5;
+    const T t7 = t6 & x[2];
+    const T t8 = t4 ^ t7;
+    const T t9 = t1 ^ x[1];
+    const T t10 = x[5] & t0;
+    const T t11 = t1 | x[1];
+    const T t12 = t10 ^ x[4];
+    const T t13 = t9 ^ t12;
+    const T t14 = t13 & x[2];
+    const T t15 = t9 ^ t14;
+    const T t16 = t8 ^ t15;
+    const T t17 = t16 & x[3];
+    const T t18 = t8 ^ t17;
+    const T t19 = t10 ^ t1;
+    const T t20 = t19 & x[4];
+    const T t21 = t10 ^ t20;
+    const T t22 = t9 ^ t21;
+    const T t23 = t22 & x[2];
+    const T t24 = t9 ^ t23;
+    const T t25 = t1 & t0;
+    const T t26 = t25 ^ t20;
+    const T t27 = ~x[4];
+    const T t28 = x[5] | t27;
+    const T t29 = t26 ^ t28;
+    const T t30 = t29 & x[2];
+    const T t31 = t26 ^ t30;
+    const T t32 = t24 ^ t31;
+    const T t33 = t32 & x[3];
+    const T t34 = t24 ^ t33;
+    const T t35 = t18 ^ t34;
+    const T t36 = t35 & x[0];
+    const T t37 = t18 ^ t36;
+    const T t38 = t9 ^ x[4];
+    const T t39 = t27 & x[2];
+    const T t40 = t38 ^ t39;
+    const T t41 = x[5] ^ t20;
+    const T t42 = t41 ^ x[2];
+    const T t43 = t40 ^ t42;
+    const T t44 = t43 & x[3];
+    const T t45 = t40 ^ t44;
+    const T t46 = t2 ^ x[4];
+    const T t47 = x[5] & x[1];
+    const T t48 = t47 ^ t2;
+    const T t49 = t48 & x[4];
+    const T t50 = t47 ^ t49;
+    const T t51 = t46 ^ t50;
+    const T t52 = t51 & x[2];
+    const T t53 = t46 ^ t52;
+    const T t54 = x[5] | t0;
+    const T t55 = t1 ^ t49;
+    const T t56 = t0 ^ x[4];
+    const T t57 = t55 ^ t56;
+    const T t58 = t57 & x[2];
+    const T t59 = t55 ^ t58;
+    const T t60 = t53 ^ t59;
+    const T t61 = t60 & x[3];
+    const T t62 = t53 ^ t61;
+    const T t63 = t45 ^ t62;
+    const T t64 = t63 & x[0];
+    const T t65 = t45 ^ t64;
+    const T t66 = t47 & x[4];
+    const T t67 = x[5] ^ t66;
+    const T t68 = t54 & x[4];
+    const T t69 = t2 ^ t68;
+    const T t70 = t67 ^ t69;
+    const T t71 = t70 & x[2];
+    const T t72 = t67 ^ t71;
+    const T t73 = t11 & x[4];
+    const T t74 = t55 ^ t71;
+    const T t75 = t72 ^ t74;
+    const T t76 = t75 & x[3];
+    const T t77 = t72 ^ t76;
+    const T t78 = x[1] ^ t20;
+    const T t79 = t55 & x[2];
+    const T t80 = t78 ^ t79;
+    const T t81 = t56 ^ t79;
+    const T t82 = t80 ^ t81;
+    const T t83 = t82 & x[3];
+    const T t84 = t80 ^ t83;
+    const T t85 = t77 ^ t84;
+    const T t86 = t85 & x[0];
+    const T t87 = t77 ^ t86;
+    const T t88 = t0 & x[2];
+    const T t89 = x[4] ^ t88;
+    const T t90 = x[1] ^ t73;
+    const T t91 = t48 ^ t66;
+    const T t92 = t90 ^ t91;
+    const T t93 = t92 & x[2];
+    const T t94 = t90 ^ t93;
+    const T t95 = t89 ^ t94;
+    const T t96 = t95 & x[3];
+    const T t97 = t89 ^ t96;
+    const T t98 = t11 ^ x[4];
+    const T t99 = t98 ^ t14;
+    const T t100 = t9 ^ t39;
+    const T t101 = t99 ^ t100;
+    const T t102 = t101 & x[3];
+    const T t103 = t99 ^ t102;
+    const T t104 = t97 ^ t103;
+    const T t105 = t104 & x[0];
+    const T t106 = t97 ^ t105;
+    y[0] = t37;
+    y[1] = t65;
+    y[2] = t87;
+    y[3] = t106;
+}
+
+// S7, 104 gates
+template <typename T>
+static inline void des_bs_s7(const T* x, T* y) {
+    const T t0 = ~x[4];
+    const T t1 = t0 | x[3];
+    const T t2 = x[4] ^ t1;
+    const T t3 = t2 & x[2];
+    const T t4 = x[4] ^ t3;
+    const T t5 = x[4] ^ x[3];
+    const T t6 = ~x[3];
+    const T t7 = x[4] & t6;
+    const T t8 = t5 ^ t7;
+    const T t9 = t8 & x[2];
+    const T t10 = t5 ^ t9;
+    const T t11 = t4 ^ t10;
+    const T t12 = t11 & x[1];
+    const T t13 = t4 ^ t12;
+    const T t14 = t0 ^ x[3];
+    const T t15 = t0 & x[2];
+    const T t16 = x[3] ^ t15;
+    const T t17 = x[4] | t6;
+    const T t18 = t17 ^ x[2];
+    const T t19 = t16 ^ t18;
+    const T t20 = t19 & x[1];
+    const T t21 = t16 ^ t20;
+    const T t22 = t13 ^ t21;
+    const T t23 = t22 & x[0];
+    const T t24 = t13 ^ t23;
+    const T t25 = t0 ^ x[2];
+    const T t26 = x[3] & x[1];
+    const T t27 = t25 ^ t26;
+    const T t28 = x[4] | x[3];
+    const T t29 = x[4] & x[2];
+    const T t30 = t28 ^ t29;
+    const T t31 = t30 ^ t20;
+    const T t32 = t27 ^ t31;
+    const T t33 = t32 & x[0];
+    const T t34 = t27 ^ t33;
+    const T t35 = t24 ^ t34;
+    const T t36 = t35 & x[5];
+    const T t37 = t24 ^ t36;
+    const T t38 = x[4] ^ x[2];
+    const T t39 = t14 ^ t38;
+    const T t40 = t39 & x[1];
+    const T t41 = t14 ^ t40;
+    const T t42 = t41 ^ t13;
+    const T t43 = t42 & x[0];
+    const T t44 = t41 ^ t43;
+    const T t45 = t0 & t6;
+    const T t46 = t14 ^ t45;
+    const T t47 = t46 & x[2];
+    const T t48 = t14 ^ t47;
+    const T t49 = t1 ^ t3;
+    const T t50 = t48 ^ t49;
+    const T t51 = t50 & x[1];
+    const T t52 = t48 ^ t51;
+    const T t53 = t6 & x[2];
+    const T t54 = x[4] ^ t53;
+    const T t55 = t25 ^ t54;
+    const T t56 = t55 & x[1];
+    const T t57 = t25 ^ t56;
+    const T t58 = t52 ^ t57;
+    const T t59 = t58 & x[0];
+    const T t60 = t52 ^ t59;
+    const T t61 = t44 ^ t60;
+    const T t62 = t61 & x[5];
+    const T t63 = t44 ^ t62;
+    const T t64 = t28 ^ x[2];
+    const T t65 = t2 & x[1];
+    const T t66 = t64 ^ t65;
+    const T t67 = t8 ^ t29;
+    const T t68 = t2 ^ x[2];
+    const T t69 = t67 ^ t68;
+    const T t70 = t69 & x[1];
+    const T t71 = t67 ^ t70;
+    const T t72 = t66 ^ t71;
+    const T t73 = t72 & x[0];
+    const T t74 = t66 ^ t73;
+    const T t75 = x[3] ^ t9;
+    const T t76 = t75 ^ t56;
+    const T t77 = t17 & x[1];
+    const T t78 = t39 ^ t77;
+    const T t79 = t76 ^ t78;
+    const T t80 = t79 & x[0];
+    const T t81 = t76 ^ t80;
+    const T t82 = t74 ^ t81;
+    const T t83 = t82 & x[5];
+    const T t84 = t74 ^ t83;
+    const T t85 = t17 & x[2];
+    const T t86 = t7 ^ t85;
+    const T t87 = t1 ^ t9;
+    const T t88 = t86 ^ t87;
+    const T t89 = t88 & x[1];
+    const T t90 = t86 ^ t89;
+    const T t91 = t1 ^ t85;
+    const T t92 = t90 ^ x[0];
+    const T t93 = t18 & x[1];
+    const T t94 = t91 ^ t93;
+    const T t95 = t5 ^ x[2];
+    const T t96 = t1 & x[1];
+    const T t97 = t95 ^ t96;
+    const T t98 = t94 ^ t97;
+    const T t99 = t98 & x[0];
+    const T t100 = t94 ^ t99;
+    const T t101 = t92 ^ t100;
+    const T t102 = t101 & x[5];
+    const T t103 = t92 ^ t102;
+    y[0] = t37;
+    y[1] = t63;
+    y[2] = t84;
+    y[3] = t103;
+}
+
+// S8, 100 gates
+template <typename T>
+static inline void des_bs_s8(const T* x, T* y) {
+    const T t0 = ~x[3];
+    const T t1 = ~x[1];
+    const T t2 = t0 | t1;
+    const T t3 = t2 ^ x[3];
+    const T t4 = t3 & x[2];
+    const T t5 = t2 ^ t4;
+    const T t6 = t0 & t1;
+    const T t7 = x[1] ^ t4;
+    const T t8 = t5 ^ t7;
+    const T t9 = t8 & x[4];
+    const T t10 = t5 ^ t9;
+    const T t11 = x[3] ^ x[1];
+    const T t12 = t0 ^ x[1];
+    const T t13 = t11 ^ x[2];
+    const T t14 = t0 & x[1];
+    const T t15 = t8 ^ x[2];
+    const T t16 = t3 & x[4];
+    const T t17 = t13 ^ t16;
+    const T t18 = t10 ^ t17;
+    const T t19 = t18 & x[5];
+    const T t20 = t10 ^ t19;
+    const T t21 = x[3] & x[1];
+    const T t22 = t21 ^ x[2];
+    const T t23 = t22 ^ t12;
+    const T t24 = t23 & x[4];
+    const T t25 = t22 ^ t24;
+    const T t26 = x[3] | x[1];
+    const T t27 = x[1] & x[2];
+    const T t28 = t26 ^ t27;
+    const T t29 = t14 ^ x[2];
+    const T t30 = t28 ^ t29;
+    const T t31 = t30 & x[4];
+    const T t32 = t28 ^ t31;
+    const T t33 = t25 ^ t32;
+    const T t34 = t33 & x[5];
+    const T t35 = t25 ^ t34;
+    const T t36 = t20 ^ t35;
+    const T t37 = t36 & x[0];
+    const T t38 = t20 ^ t37;
+    const T t39 = t6 ^ t27;
+    const T t40 = t15 & x[4];
+    const T t41 = t39 ^ t40;
+    const T t42 = t1 & x[2];
+    const T t43 = t0 ^ t42;
+    const T t44 = t41 ^ x[5];
+    const T t45 = t1 ^ t4;
+    const T t46 = t45 ^ x[4];
+    const T t47 = x[2] & x[4];
+    const T t48 = t13 ^ t47;
+    const T t49 = t46 ^ t48;
+    const T t50 = t49 & x[5];
+    const T t51 = t46 ^ t50;
+    const T t52 = t44 ^ t51;
+    const T t53 = t52 & x[0];
+    const T t54 = t44 ^ t53;
+    const T t55 = x[1] ^ x[2];
+    const T t56 = t55 ^ t12;
+    const T t57 = t56 & x[4];
+    const T t58 = t55 ^ t57;
+    const T t59 = t8 & x[2];
+    const T t60 = t21 ^ t59;
+    const T t61 = t60 ^ t24;
+    const T t62 = t58 ^ t61;
+    const T t63 = t62 & x[5];
+    const T t64 = t58 ^ t63;
+    const T t65 = t12 ^ x[2];
+    const T t66 = t65 ^ t43;
+    const T t67 = t66 & x[4];
+    const T t68 = t65 ^ t67;
+    const T t69 = t2 ^ t59;
+    const T t70 = t0 & x[4];
+    const T t71 = t69 ^ t70;
+    const T t72 = t68 ^ t71;
+    const T t73 = t72 & x[5];
+    const T t74 = t68 ^ t73;
+    const T t75 = t64 ^ t74;
+    const T t76 = t75 & x[0];
+    const T t77 = t64 ^ t76;
+    const T t78 = t65 ^ t16;
+    const T t79 = t12 & x[2];
+    const T t80 = t1 ^ t79;
+    const T t81 = t3 ^ t27;
+    const T t82 = t80 ^ t81;
+    const T t83 = t82 & x[4];
+    const T t84 = t80 ^ t83;
+    const T t85 = t78 ^ t84;
+    const T t86 = t85 & x[5];
+    const T t87 = t78 ^ t86;
+    const T t88 = t39 ^ t31;
+    const T t89 = t21 & x[2];
+    const T t90 = x[1] ^ t89;
+    const T t91 = t90 ^ t45;
+    const T t92 = t91 & x[4];
+    const T t93 = t90 ^ t92;
+    const T t94 = t88 ^ t93;
+    const T t95 = t94 & x[5];
+    const T t96 = t88 ^ t95;
+    const T t97 = t87 ^ t96;
+    const T t98 = t97 & x[0];
+    const T t99 = t87 ^ t98;
+    y[0] = t38;
+    y[1] = t54;
+    y[2] = t77;
+    y[3] = t99;
+}
@@ -36,4 +36,22 @@ void single_des::encrypt(const std::uint8_t* plaintext, std::uint8_t* ciphertext
 void single_des::decrypt(const std::uint8_t* ciphertext, std::uint8_t* plaintext) {
     des_crypt(ciphertext, plaintext, _ctx.schedule, unsigned(_rounds));
 }
+
+void single_des::encrypt_blocks(const std::uint8_t* in,
+                                std::uint8_t* out,
+                                const std::size_t nblocks,
+                                const std::size_t block_size) {
+    if (block_size != DES_BLOCK_SIZE)
+        return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+    des_crypt_blocks(in, out, nblocks, _ctx.schedule, unsigned(_rounds));
+}
+
+void single_des::decrypt_blocks(const std::uint8_t* in,
+                                std::uint8_t* out,
+                                const std::size_t nblocks,
+                                const std::size_t block_size) {
+    if (block_size != DES_BLOCK_SIZE)
+        return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+    des_crypt_blocks(in, out, nblocks, _ctx.schedule, unsigned(_rounds));
+}
 } //namespace block
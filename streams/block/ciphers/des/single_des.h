@@ -37,5 +37,15 @@ namespace block {
 
         void decrypt(const std::uint8_t* ciphertext,
                      std::uint8_t* plaintext) override;
+
+        void encrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
+
+        void decrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
     };
 }
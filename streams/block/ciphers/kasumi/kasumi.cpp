@@ -10,7 +10,7 @@
 #include <cstdio>
 #include "kasumi.h"
 
- const int BLOCK_SIZE = 64;
+ const int BLOCK_SIZE = 8; // in bytes, used as the stride between blocks
 
  /**
    * Bit rotation left by a compile-time constant amount
@@ -82,15 +82,13 @@ uint8_t pibox_inv[] = {
 } while (0)
 
 #define LSX(out, in, c, ctx) do {			\
-	X_func(out, in, c);				\
-	S_func(out);					\
-	L_func(out, out, ctx);				\
+	(void) (ctx);					\
+	LSX_table(out, in, c);				\
 } while (0)
 
 #define LSXinv(out, in, c, ctx) do {			\
-	X_func(out, in, c);				\
-	Linv_func(out, out, ctx);			\
-	Sinv_func(out);					\
+	(void) (ctx);					\
+	LSXinv_table(out, in, c);			\
 } while (0)
 
 #define PRINT_BLOCK(block) do {				\
@@ -217,6 +215,75 @@ Linv_func(uint8_t *out, const uint8_t *in, const struct kuzn_ctx *ctx)
 		Rinv_func(out, in, ctx);
 }
 
+/*
+ * Table form of the round transformation. L is linear, so L(S(x)) is the XOR over the 16
+ * bytes of ls[i][x[i]], the image under L of a block holding only S(x[i]) at byte i;
+ * linv does the same for L^-1 alone. 16 lookups of 16 bytes replace the 256 GF(2^8)
+ * multiplications of L_func(). The tables (and the GF(2^8) log tables they are built from)
+ * are filled once during static initialisation and only read afterwards.
+ */
+struct kuzn_tables {
+	uint64_t ls[16][256][2];
+	uint64_t linv[16][256][2];
+
+	kuzn_tables()
+	{
+		uint8_t block[16];
+		int i, b;
+
+		galois_init_tables(KUZN_POLY);
+
+		for (i = 0; i < 0x10; i++) {
+			for (b = 0; b < 256; b++) {
+				memset(block, 0, sizeof(block));
+				block[i] = pibox[b];
+				L_func(block, block, NULL);
+				memcpy(ls[i][b], block, sizeof(block));
+
+				memset(block, 0, sizeof(block));
+				block[i] = b;
+				Linv_func(block, block, NULL);
+				memcpy(linv[i][b], block, sizeof(block));
+			}
+		}
+	}
+};
+
+static const kuzn_tables tables;
+
+/* L(S(X[k](in))), in and out may be the same */
+static void
+LSX_table(uint8_t *out, const uint8_t *in, const uint8_t *k)
+{
+	uint64_t lo = 0, hi = 0;
+	int i;
+
+	for (i = 0; i < 0x10; i++) {
+		const uint64_t *t = tables.ls[i][in[i] ^ k[i]];
+		lo ^= t[0];
+		hi ^= t[1];
+	}
+	memcpy(out, &lo, 8);
+	memcpy(out + 8, &hi, 8);
+}
+
+/* S^-1(L^-1(X[k](in))), in and out may be the same */
+static void
+LSXinv_table(uint8_t *out, const uint8_t *in, const uint8_t *k)
+{
+	uint64_t lo = 0, hi = 0;
+	int i;
+
+	for (i = 0; i < 0x10; i++) {
+		const uint64_t *t = tables.linv[i][in[i] ^ k[i]];
+		lo ^= t[0];
+		hi ^= t[1];
+	}
+	memcpy(out, &lo, 8);
+	memcpy(out + 8, &hi, 8);
+	Sinv_func(out);
+}
+
 static void
 F_func(uint8_t *out, const uint8_t *in, const uint8_t *c, const struct kuzn_ctx *ctx)
 {
@@ -260,8 +327,6 @@ kuzn_context_init(struct kuzn_ctx *ctx)
 
 	// p(x) = x**8 + x**7 + x**6 + x + 1
 	ctx->polynomial = KUZN_POLY;
-
-	galois_init_tables(ctx->polynomial);
 }
 
 void
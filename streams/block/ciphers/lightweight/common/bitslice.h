@@ -0,0 +1,359 @@
+#pragma once
+
+/*
+ * Bitsliced evaluation of the lightweight ciphers on 256 blocks at once.
+ *
+ * A slice holds one bit position of all the blocks, one block per bit. A block of B bytes
+ * becomes 8 * B slices, slice 8 * i + b holding bit b of byte i, so a little-endian w-bit
+ * word of the block is w consecutive slices, least significant bit first. In that form
+ *  - shifts and rotations of the cipher words are renumbering of the slices,
+ *  - S-boxes are boolean circuits evaluated on whole slices,
+ *  - linear layers are XORs of slices, and
+ *  - round keys and constants are XORs of all-zero/all-one slices.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace block {
+namespace bitslice {
+
+// machine words side by side in one slice, the compiler vectorises the loops over them
+const std::size_t slice_words = 4;
+// blocks in one slice
+const std::size_t lanes = 64 * slice_words;
+// below this many blocks transposing in and out costs more than the per-block code
+const std::size_t min_blocks = 64;
+
+/* One bit position of lanes blocks, the bit of block j in bit j % 64 of w[j / 64] */
+struct slice {
+    std::uint64_t w[slice_words];
+};
+
+inline slice operator^(const slice &a, const slice &b) {
+    slice r;
+    for (std::size_t g = 0; g < slice_words; ++g)
+        r.w[g] = a.w[g] ^ b.w[g];
+    return r;
+}
+
+inline slice operator&(const slice &a, const slice &b) {
+    slice r;
+    for (std::size_t g = 0; g < slice_words; ++g)
+        r.w[g] = a.w[g] & b.w[g];
+    return r;
+}
+
+inline slice operator|(const slice &a, const slice &b) {
+    slice r;
+    for (std::size_t g = 0; g < slice_words; ++g)
+        r.w[g] = a.w[g] | b.w[g];
+    return r;
+}
+
+inline slice operator~(const slice &a) {
+    slice r;
+    for (std::size_t g = 0; g < slice_words; ++g)
+        r.w[g] = ~a.w[g];
+    return r;
+}
+
+inline slice &operator^=(slice &a, const slice &b) {
+    return a = a ^ b;
+}
+
+/* All-zero slice for bit = 0, all-one for bit = 1 */
+inline slice broadcast(const unsigned bit) {
+    slice r;
+    for (std::size_t g = 0; g < slice_words; ++g)
+        r.w[g] = 0 - std::uint64_t(bit & 1);
+    return r;
+}
+
+/**
+ * Bits-bit word of the cipher state in sliced form: slice s[k] is bit k of the word.
+ * The operators behave like the ones of the plain unsigned word, with the results
+ * truncated to Bits bits, so the source circuits can be run on it unchanged.
+ */
+template <unsigned Bits>
+struct word {
+    slice s[Bits];
+};
+
+template <unsigned Bits>
+inline word<Bits> operator^(const word<Bits> &a, const word<Bits> &b) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = a.s[k] ^ b.s[k];
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> operator&(const word<Bits> &a, const word<Bits> &b) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = a.s[k] & b.s[k];
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> operator|(const word<Bits> &a, const word<Bits> &b) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = a.s[k] | b.s[k];
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> operator~(const word<Bits> &a) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = ~a.s[k];
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> operator<<(const word<Bits> &a, const unsigned n) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = k >= n ? a.s[k - n] : broadcast(0);
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> operator>>(const word<Bits> &a, const unsigned n) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = k + n < Bits ? a.s[k + n] : broadcast(0);
+    return r;
+}
+
+/* Left rotation by n < Bits, which is only renumbering the slices */
+template <unsigned Bits>
+inline word<Bits> rotate_left(const word<Bits> &a, const unsigned n) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[(k + n) % Bits] = a.s[k];
+    return r;
+}
+
+/* XOR of the same constant into every block, e.g. a round key */
+template <unsigned Bits>
+inline word<Bits> operator^(const word<Bits> &a, const std::uint64_t c) {
+    word<Bits> r;
+    for (unsigned k = 0; k < Bits; ++k)
+        r.s[k] = a.s[k] ^ broadcast(unsigned(c >> k));
+    return r;
+}
+
+template <unsigned Bits>
+inline word<Bits> &operator^=(word<Bits> &a, const word<Bits> &b) {
+    return a = a ^ b;
+}
+
+template <unsigned Bits>
+inline word<Bits> &operator&=(word<Bits> &a, const word<Bits> &b) {
+    return a = a & b;
+}
+
+template <unsigned Bits>
+inline word<Bits> &operator|=(word<Bits> &a, const word<Bits> &b) {
+    return a = a | b;
+}
+
+template <unsigned Bits>
+inline word<Bits> &operator^=(word<Bits> &a, const std::uint64_t c) {
+    return a = a ^ c;
+}
+
+/* One step of transpose64(): swaps the off-diagonal J x J blocks of every 2J x 2J block */
+template <unsigned J>
+inline void transpose_step(std::uint64_t a[64], const std::uint64_t m) {
+    for (unsigned base = 0; base < 64; base += 2 * J) {
+        for (unsigned k = base; k < base + J; ++k) {
+            const std::uint64_t t = ((a[k] >> J) ^ a[k + J]) & m;
+            a[k] ^= t << J;
+            a[k + J] ^= t;
+        }
+    }
+}
+
+/**
+ * Transposes a 64x64 bit matrix in place, bit j of a[i] is swapped with bit i of a[j]
+ * (Hacker's Delight, 7-3, with bit 0 the least significant one). The steps are spelled
+ * out so that the inner loops have a fixed stride and get vectorised.
+ */
+inline void transpose64(std::uint64_t a[64]) {
+    transpose_step<32>(a, 0x00000000ffffffffull);
+    transpose_step<16>(a, 0x0000ffff0000ffffull);
+    transpose_step<8>(a, 0x00ff00ff00ff00ffull);
+    transpose_step<4>(a, 0x0f0f0f0f0f0f0f0full);
+    transpose_step<2>(a, 0x3333333333333333ull);
+    transpose_step<1>(a, 0x5555555555555555ull);
+}
+
+inline std::uint64_t load_le64(const std::uint8_t *p) {
+    std::uint64_t x = 0;
+    for (unsigned i = 0; i < 8; ++i)
+        x |= std::uint64_t(p[i]) << (8 * i);
+    return x;
+}
+
+inline void store_le64(const std::uint64_t x, std::uint8_t *p) {
+    for (unsigned i = 0; i < 8; ++i)
+        p[i] = std::uint8_t(x >> (8 * i));
+}
+
+/**
+ * Slices nblocks <= lanes blocks of BlockSize bytes into the words w, slice k going to bit
+ * k % Bits of w[k / Bits]. The lanes of missing blocks are zero.
+ */
+template <std::size_t BlockSize, unsigned Bits>
+void load(const std::uint8_t *in, const std::size_t nblocks, word<Bits> *w) {
+    static_assert(BlockSize % 8 == 0, "blocks are sliced 64 bits at a time");
+    std::uint64_t rows[64];
+    for (std::size_t g = 0; g < slice_words; ++g) {
+        for (std::size_t c = 0; c < BlockSize / 8; ++c) {
+            for (std::size_t j = 0; j < 64; ++j) {
+                const std::size_t blk = 64 * g + j;
+                rows[j] = blk < nblocks ? load_le64(in + blk * BlockSize + 8 * c) : 0;
+            }
+            transpose64(rows);
+            for (unsigned k = 0; k < 64; ++k) {
+                const std::size_t bit = 64 * c + k;
+                w[bit / Bits].s[bit % Bits].w[g] = rows[k];
+            }
+        }
+    }
+}
+
+/* Inverse of load() */
+template <std::size_t BlockSize, unsigned Bits>
+void store(const word<Bits> *w, std::uint8_t *out, const std::size_t nblocks) {
+    std::uint64_t rows[64];
+    for (std::size_t g = 0; g < slice_words && 64 * g < nblocks; ++g) {
+        for (std::size_t c = 0; c < BlockSize / 8; ++c) {
+            for (unsigned k = 0; k < 64; ++k) {
+                const std::size_t bit = 64 * c + k;
+                rows[k] = w[bit / Bits].s[bit % Bits].w[g];
+            }
+            transpose64(rows);
+            for (std::size_t j = 0; j < 64 && 64 * g + j < nblocks; ++j)
+                store_le64(rows[j], out + (64 * g + j) * BlockSize + 8 * c);
+        }
+    }
+}
+
+/**
+ * Runs kernel(state) on groups of up to lanes blocks, the state being the block as an array
+ * of BlockSize * 8 / Bits words. Returns the number of blocks done; a tail shorter than
+ * min_blocks is left to the per-block code. in and out may be the same buffer.
+ */
+template <std::size_t BlockSize, unsigned Bits, typename Kernel>
+std::size_t crypt_blocks(const std::uint8_t *in, std::uint8_t *out, const std::size_t nblocks, Kernel kernel) {
+    static_assert(BlockSize * 8 % Bits == 0, "the state must be a whole number of words");
+    word<Bits> state[BlockSize * 8 / Bits];
+    std::size_t done = 0;
+    while (nblocks - done >= min_blocks) {
+        const std::size_t n = nblocks - done < lanes ? nblocks - done : lanes;
+        load<BlockSize>(in + done * BlockSize, n, state);
+        kernel(state);
+        store<BlockSize>(state, out + done * BlockSize, n);
+        done += n;
+    }
+    return done;
+}
+
+/**
+ * Algebraic normal form of output bit `bit` of a 4-bit S-box: bit m of the result is the
+ * coefficient of the monomial made of the input bits set in m. The S-box is packed into
+ * `table` with S(x) in bits 4x..4x+3.
+ */
+constexpr unsigned sbox4_anf(const std::uint64_t table, const unsigned bit) {
+    unsigned anf = 0;
+    for (unsigned m = 0; m < 16; ++m) {
+        unsigned c = 0;
+        for (unsigned x = 0; x < 16; ++x) {
+            if ((x & m) == x)
+                c ^= (table >> (4 * x + bit)) & 1;
+        }
+        anf |= c << m;
+    }
+    return anf;
+}
+
+/**
+ * 4-bit S-box on the slices x[0..3] (x[0] the least significant input bit), evaluated as
+ * its algebraic normal form: the products of the inputs are computed once and each output
+ * bit is the XOR of its monomials. Table as in sbox4_anf(); the circuit is fixed at
+ * compile time, so the unused products are dropped.
+ */
+template <std::uint64_t Table>
+inline void sbox4(slice *x) {
+    static constexpr unsigned anf[4] = {
+            sbox4_anf(Table, 0), sbox4_anf(Table, 1), sbox4_anf(Table, 2), sbox4_anf(Table, 3)};
+
+    slice mono[16];
+    mono[0] = broadcast(1);
+    for (unsigned m = 1; m < 16; ++m) {
+        const unsigned low = m & (0 - m);
+        const unsigned idx = low == 1 ? 0 : low == 2 ? 1 : low == 4 ? 2 : 3;
+        mono[m] = m == low ? x[idx] : mono[m ^ low] & x[idx];
+    }
+
+    slice y[4] = {broadcast(0), broadcast(0), broadcast(0), broadcast(0)};
+    for (unsigned b = 0; b < 4; ++b) {
+        for (unsigned m = 0; m < 16; ++m) {
+            if ((anf[b] >> m) & 1)
+                y[b] ^= mono[m];
+        }
+    }
+    for (unsigned b = 0; b < 4; ++b)
+        x[b] = y[b];
+}
+
+/**
+ * GF(2)-linear map of Bits-bit words, recovered from a scalar implementation by feeding it
+ * the unit vectors. Every output slice is then the XOR of the input slices its row has set,
+ * a bit permutation being plain copies.
+ */
+template <unsigned Bits>
+class linear_map {
+public:
+    /* f: std::uint64_t(std::uint64_t), linear over GF(2) on its low Bits bits */
+    template <typename F>
+    explicit linear_map(F f) {
+        std::uint64_t columns[Bits];
+        for (unsigned i = 0; i < Bits; ++i)
+            columns[i] = f(std::uint64_t(1) << i);
+
+        unsigned n = 0;
+        for (unsigned k = 0; k < Bits; ++k) {
+            _begin[k] = n;
+            for (unsigned i = 0; i < Bits; ++i) {
+                if ((columns[i] >> k) & 1)
+                    _index[n++] = std::uint8_t(i);
+            }
+        }
+        _begin[Bits] = n;
+    }
+
+    word<Bits> operator()(const word<Bits> &x) const {
+        word<Bits> y;
+        for (unsigned k = 0; k < Bits; ++k) {
+            slice acc = broadcast(0);
+            for (unsigned n = _begin[k]; n < _begin[k + 1]; ++n)
+                acc ^= x.s[_index[n]];
+            y.s[k] = acc;
+        }
+        return y;
+    }
+
+private:
+    // the input slices of output slice k are _index[_begin[k]] .. _index[_begin[k + 1] - 1]
+    std::uint8_t _index[Bits * Bits];
+    std::uint16_t _begin[Bits + 1];
+};
+
+} // namespace bitslice
+} // namespace block
@@ -6,6 +6,8 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
+#include <type_traits>
 
 #define LBOX_WORD ROM_DATA_WORD
 #define READ_LBOX_WORD READ_ROM_DATA_WORD
@@ -14,7 +16,7 @@
 #define READ_LBOX_INV_WORD READ_ROM_DATA_WORD
 
 #define SBOX_Inv(x) do {                   \
-  uint16_t __t0, __t1, __t2;               \
+  std::remove_reference<decltype(x[0])>::type __t0, __t1, __t2; \
   /* S5 Inv */                             \
   x[1] ^= x[0];                            \
   x[1] ^= x[2] & x[4];                     \
@@ -52,7 +54,7 @@
 } while(0)
 
 #define SBOX(x) do {                       \
-  uint16_t __t0, __t1, __t2;               \
+  std::remove_reference<decltype(x[0])>::type __t0, __t1, __t2; \
   /* S5 */                                 \
   x[2] ^= x[0] & x[1];                     \
   x[1] ^= x[2];                            \
@@ -239,6 +241,10 @@ namespace block {
                 0x13ad, 0x9100, 0x55fe, 0xd753, 0x46a6, 0xc40b, 0x00f5, 0x8258,
                 0x7f2e, 0xfd83, 0x397d, 0xbbd0, 0x2a25, 0xa888, 0x6c76, 0xeedb,
         };
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
     public:
         fantomas(size_t rounds) : lightweight(rounds) {};
 
@@ -106,11 +106,7 @@ namespace block {
         x[0] = temp;
     }
 
-    void hight::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != HIGHT_KEY_SIZE) {
-            throw std::runtime_error("HIGHT function only support key size: " + std::to_string(HIGHT_KEY_SIZE));
-        }
-
+    void hight::key_schedule(const uint8_t *key) {
         uint8_t i, j, index;
 
         _key[0] = key[12];
@@ -77,10 +77,10 @@ namespace block {
 
         void DecryptFinalTransfomation(uint8_t *x, const uint8_t *wk);
 
-    public:
-        hight(size_t rounds) : lightweight(rounds) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        hight(size_t rounds) : lightweight(rounds, HIGHT_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
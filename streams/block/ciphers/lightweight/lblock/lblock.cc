@@ -4,7 +4,36 @@
 
 #include "lblock.h"
 
-void block::lblock::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
+namespace {
+
+    using block::bitslice::word;
+
+    /* Confusion function S on the sliced half: S0..S7 packed with S(x) in bits 4x..4x+3 on nibbles 0..7 */
+    void s_bitsliced(word<32> &t) {
+        block::bitslice::sbox4<0x5C673821BA4D0F9Eull>(t.s);
+        block::bitslice::sbox4<0x318265C7A0DF9EB4ull>(t.s + 4);
+        block::bitslice::sbox4<0xA842395B60DFC7E1ull>(t.s + 8);
+        block::bitslice::sbox4<0x1425DCA9E3F0B867ull>(t.s + 12);
+        block::bitslice::sbox4<0x36AB9481DC270F5Eull>(t.s + 16);
+        block::bitslice::sbox4<0x548136A790EFCBD2ull>(t.s + 20);
+        block::bitslice::sbox4<0x218375C6DAF0E49Bull>(t.s + 24);
+        block::bitslice::sbox4<0x6C573812B94E0FADull>(t.s + 28);
+    }
+
+    /* Diffusion function P: nibble q of the result is nibble source[q] of t */
+    word<32> p_bitsliced(const word<32> &t) {
+        static const unsigned source[8] = {1, 3, 0, 2, 5, 7, 4, 6};
+        word<32> p;
+        for (unsigned q = 0; q < 8; q++) {
+            for (unsigned b = 0; b < 4; b++)
+                p.s[4 * q + b] = t.s[4 * source[q] + b];
+        }
+        return p;
+    }
+
+} // namespace
+
+void block::lblock::key_schedule(const uint8_t *key) {
     uint16_t shiftedKey[2];
     uint8_t keyCopy[LBLOCK_KEY_SIZE];
 
@@ -985,3 +1014,60 @@ void block::lblock::Decrypt(uint8_t *block) {
 
     X[0] = Temp[0];
 }
+
+std::size_t block::lblock::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const std::size_t nblocks) {
+    if (_rounds > LBLOCK_NUMBER_OF_ROUNDS)
+        return 0;
+
+    const uint32_t *K = (const uint32_t *) _key;
+    return bitslice::crypt_blocks<LBLOCK_BLOCK_SIZE, 32>(in, out, nblocks, [&](word<32> *X) {
+        // the halves are stored alternately as in Encrypt(), which matters for odd round counts
+        word<32> Temp = X[1];
+
+        for (std::size_t i = 1; i <= _rounds; i++) {
+            if (i % 2 == 0) {
+                X[0] = Temp;
+            } else {
+                X[1] = Temp;
+            }
+
+            Temp ^= READ_ROUND_KEY_DOUBLE_WORD(K[i - 1]);
+            s_bitsliced(Temp);
+
+            /* F(X(i-1), K(i-1)) XOR (X(i-2) <<< 8) */
+            const word<32> &x = X[i % 2 == 0 ? 1 : 0];
+            Temp = p_bitsliced(Temp) ^ block::bitslice::rotate_left(x, 8);
+        }
+
+        X[1] = X[0];
+        X[0] = Temp;
+    });
+}
+
+std::size_t block::lblock::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const std::size_t nblocks) {
+    if (_rounds > LBLOCK_NUMBER_OF_ROUNDS)
+        return 0;
+
+    const uint32_t *K = (const uint32_t *) _key;
+    return bitslice::crypt_blocks<LBLOCK_BLOCK_SIZE, 32>(in, out, nblocks, [&](word<32> *X) {
+        word<32> Temp = X[1];
+
+        for (std::size_t i = _rounds; i >= 1; i--) {
+            if (i % 2 != 0) {
+                X[0] = Temp;
+            } else {
+                X[1] = Temp;
+            }
+
+            Temp ^= READ_ROUND_KEY_DOUBLE_WORD(K[i - 1]);
+            s_bitsliced(Temp);
+
+            /* F(X(j+1), K(j+1)) XOR X(j+2)) >>> 8) */
+            const word<32> t = X[i % 2 != 0 ? 1 : 0] ^ p_bitsliced(Temp);
+            Temp = block::bitslice::rotate_left(t, 24);
+        }
+
+        X[1] = X[0];
+        X[0] = Temp;
+    });
+}
@@ -6,6 +6,7 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define SBOX_BYTE RAM_DATA_BYTE
 #define READ_SBOX_BYTE READ_RAM_DATA_BYTE
@@ -34,10 +35,14 @@ namespace block {
         SBOX_BYTE S8[16] = {8, 7, 14, 5, 15, 13, 0, 6, 11, 12, 9, 10, 2, 4, 1, 3};
         SBOX_BYTE S9[16] = {11, 5, 15, 0, 7, 2, 9, 13, 4, 8, 1, 12, 14, 10, 3, 6};
 
-    public:
-        lblock(size_t rounds) : lightweight(rounds) {}
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        lblock(size_t rounds) : lightweight(rounds, LBLOCK_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
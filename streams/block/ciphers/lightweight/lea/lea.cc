@@ -4,14 +4,11 @@
 
 #include <streams/block/ciphers/lightweight/common/rotations/rot32.h>
 #include "lea.h"
+#include <algorithm>
 
 namespace block {
 
-    void lea::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != LEA_KEY_SIZE) {
-            throw std::runtime_error("LEA function only support key size: " + std::to_string(LEA_KEY_SIZE));
-        }
-
+    void lea::key_schedule(const uint8_t *key) {
         uint32_t *rk = (uint32_t *) _key;
         uint32_t *t = (uint32_t *) key;
         uint32_t delta[4] = {READ_RAM_DATA_DOUBLE_WORD(DELTA[0]), READ_RAM_DATA_DOUBLE_WORD(DELTA[1]),
@@ -113,4 +110,112 @@ namespace block {
         blk[2] = b2;
         blk[3] = b3;
     }
+
+    void lea::encrypt_blocks(const std::uint8_t *in,
+                             std::uint8_t *out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size) {
+        if (block_size != LEA_BLOCK_SIZE)
+            return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+
+        std::copy_n(in, nblocks * LEA_BLOCK_SIZE, out);
+
+        size_t b = 0;
+        for (; b + lanes <= nblocks; b += lanes) {
+            uint32_t *blk = (uint32_t *) (out + b * LEA_BLOCK_SIZE);
+            uint32_t *rk = (uint32_t *) _key;
+            uint32_t b0[lanes], b1[lanes], b2[lanes], b3[lanes];
+
+            for (size_t l = 0; l < lanes; ++l) {
+                b0[l] = blk[4 * l];
+                b1[l] = blk[4 * l + 1];
+                b2[l] = blk[4 * l + 2];
+                b3[l] = blk[4 * l + 3];
+            }
+
+            // same schedule as Encrypt(): four rounds per iteration
+            for (unsigned i = 0; i < _rounds; i += 4, rk += 16) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    b3[l] = rot32r3((b2[l] ^ RK(rk, 1)) + (b3[l] ^ RK(rk, 0)));
+                    b2[l] = rot32r5((b1[l] ^ RK(rk, 2)) + (b2[l] ^ RK(rk, 0)));
+                    b1[l] = rot32l9((b0[l] ^ RK(rk, 3)) + (b1[l] ^ RK(rk, 0)));
+
+                    b0[l] = rot32r3((b3[l] ^ RK(rk, 5)) + (b0[l] ^ RK(rk, 4)));
+                    b3[l] = rot32r5((b2[l] ^ RK(rk, 6)) + (b3[l] ^ RK(rk, 4)));
+                    b2[l] = rot32l9((b1[l] ^ RK(rk, 7)) + (b2[l] ^ RK(rk, 4)));
+
+                    b1[l] = rot32r3((b0[l] ^ RK(rk, 9)) + (b1[l] ^ RK(rk, 8)));
+                    b0[l] = rot32r5((b3[l] ^ RK(rk, 10)) + (b0[l] ^ RK(rk, 8)));
+                    b3[l] = rot32l9((b2[l] ^ RK(rk, 11)) + (b3[l] ^ RK(rk, 8)));
+
+                    b2[l] = rot32r3((b1[l] ^ RK(rk, 13)) + (b2[l] ^ RK(rk, 12)));
+                    b1[l] = rot32r5((b0[l] ^ RK(rk, 14)) + (b1[l] ^ RK(rk, 12)));
+                    b0[l] = rot32l9((b3[l] ^ RK(rk, 15)) + (b0[l] ^ RK(rk, 12)));
+                }
+            }
+
+            for (size_t l = 0; l < lanes; ++l) {
+                blk[4 * l] = b0[l];
+                blk[4 * l + 1] = b1[l];
+                blk[4 * l + 2] = b2[l];
+                blk[4 * l + 3] = b3[l];
+            }
+        }
+        for (; b < nblocks; ++b)
+            Encrypt(out + b * LEA_BLOCK_SIZE);
+    }
+
+    void lea::decrypt_blocks(const std::uint8_t *in,
+                             std::uint8_t *out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size) {
+        if (block_size != LEA_BLOCK_SIZE)
+            return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+
+        std::copy_n(in, nblocks * LEA_BLOCK_SIZE, out);
+
+        size_t b = 0;
+        for (; b + lanes <= nblocks; b += lanes) {
+            uint32_t *blk = (uint32_t *) (out + b * LEA_BLOCK_SIZE);
+            uint32_t *rk = (uint32_t *) _key + 92;
+            uint32_t b0[lanes], b1[lanes], b2[lanes], b3[lanes];
+
+            for (size_t l = 0; l < lanes; ++l) {
+                b0[l] = blk[4 * l];
+                b1[l] = blk[4 * l + 1];
+                b2[l] = blk[4 * l + 2];
+                b3[l] = blk[4 * l + 3];
+            }
+
+            // same schedule as Decrypt(): four rounds per iteration, walking the keys backwards
+            for (int i = int(_rounds) - 1; i >= 0; i -= 4, rk -= 16) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    b0[l] = (rot32r9(b0[l]) - (b3[l] ^ RK(rk, 3))) ^ RK(rk, 0);
+                    b1[l] = (rot32l5(b1[l]) - (b0[l] ^ RK(rk, 2))) ^ RK(rk, 0);
+                    b2[l] = (rot32l3(b2[l]) - (b1[l] ^ RK(rk, 1))) ^ RK(rk, 0);
+
+                    b3[l] = (rot32r9(b3[l]) - (b2[l] ^ RK(rk, -1))) ^ RK(rk, -4);
+                    b0[l] = (rot32l5(b0[l]) - (b3[l] ^ RK(rk, -2))) ^ RK(rk, -4);
+                    b1[l] = (rot32l3(b1[l]) - (b0[l] ^ RK(rk, -3))) ^ RK(rk, -4);
+
+                    b2[l] = (rot32r9(b2[l]) - (b1[l] ^ RK(rk, -5))) ^ RK(rk, -8);
+                    b3[l] = (rot32l5(b3[l]) - (b2[l] ^ RK(rk, -6))) ^ RK(rk, -8);
+                    b0[l] = (rot32l3(b0[l]) - (b3[l] ^ RK(rk, -7))) ^ RK(rk, -8);
+
+                    b1[l] = (rot32r9(b1[l]) - (b0[l] ^ RK(rk, -9))) ^ RK(rk, -12);
+                    b2[l] = (rot32l5(b2[l]) - (b1[l] ^ RK(rk, -10))) ^ RK(rk, -12);
+                    b3[l] = (rot32l3(b3[l]) - (b2[l] ^ RK(rk, -11))) ^ RK(rk, -12);
+                }
+            }
+
+            for (size_t l = 0; l < lanes; ++l) {
+                blk[4 * l] = b0[l];
+                blk[4 * l + 1] = b1[l];
+                blk[4 * l + 2] = b2[l];
+                blk[4 * l + 3] = b3[l];
+            }
+        }
+        for (; b < nblocks; ++b)
+            Decrypt(out + b * LEA_BLOCK_SIZE);
+    }
 }
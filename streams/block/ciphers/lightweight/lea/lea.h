@@ -18,13 +18,29 @@ namespace block {
     class lea : public lightweight<LEA_ROUND_KEYS_SIZE, LEA_BLOCK_SIZE> {
         RAM_DATA_DOUBLE_WORD DELTA[4]= {0xc3efe9db, 0x88c4d604, 0xe789f229, 0xc6f98763};
 
-    public:
-        lea(size_t rounds) : lightweight(rounds) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        lea(size_t rounds) : lightweight(rounds, LEA_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
         void Decrypt(uint8_t *block) override;
+
+        /**
+         * Number of independent blocks advanced together by encrypt_blocks() and
+         * decrypt_blocks(), the lane loops are vectorised by the compiler.
+         */
+        static const size_t lanes = 4;
+
+        void encrypt_blocks(const std::uint8_t *in,
+                            std::uint8_t *out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
+
+        void decrypt_blocks(const std::uint8_t *in,
+                            std::uint8_t *out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
     };
 }
@@ -6,24 +6,53 @@
 
 namespace block {
 
-    void led::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != LED_KEY_SIZE) {
-            throw std::runtime_error("LEA function only support key size: " + std::to_string(LED_KEY_SIZE));
+    namespace {
+
+        // PRESENT S-box of LED and its inverse, S(x) in bits 4x..4x+3
+        constexpr uint64_t led_sbox = 0x21748FE3DA09B65Cull;
+        constexpr uint64_t led_inv_sbox = 0xA970364BD21C8FE5ull;
+
+        // first slice of state[i / 4][i % 4], the even nibbles being the high halves of the block bytes
+        inline unsigned nibble_slice(const unsigned i) {
+            return 8 * (i >> 1) + ((i & 1) ? 0 : 4);
+        }
+
+        // the state as the block bytes of Encrypt(), read as a little-endian word
+        uint64_t pack(uint8_t (*state)[4]) {
+            uint64_t x = 0;
+            for (unsigned i = 0; i < 16; i++)
+                x |= uint64_t(state[i / 4][i % 4] & 0xF) << nibble_slice(i);
+            return x;
+        }
+
+        void unpack(const uint64_t x, uint8_t (*state)[4]) {
+            for (unsigned i = 0; i < 16; i++)
+                state[i / 4][i % 4] = (x >> nibble_slice(i)) & 0xF;
         }
 
+    } // namespace
+
+    void led::key_schedule(const uint8_t *key) {
         uint8_t i;
+        uint8_t nibbles[2 * LED_KEY_SIZE];
 
-        for(i = 0; i < LED_ROUND_KEYS_SIZE; i ++)
+        for(i = 0; i < 2 * LED_KEY_SIZE; i ++)
         {
             if(i % 2)
             {
-                _key[i] = key[i >> 1] & 0xF;
+                nibbles[i] = key[i >> 1] & 0xF;
             }
             else
             {
-                _key[i] = (key[i >> 1] >> 4) & 0xF;
+                nibbles[i] = (key[i >> 1] >> 4) & 0xF;
             }
         }
+
+        /* the 80-bit key is used cyclically, step s takes nibbles 16s .. 16s + 15 of the sequence */
+        for(i = 0; i < LED_ROUND_KEYS_SIZE; i ++)
+        {
+            _key[i] = nibbles[i % (2 * LED_KEY_SIZE)];
+        }
     }
 
     void led::Encrypt(uint8_t *block) {
@@ -101,7 +130,7 @@ namespace block {
         {
             for(j = 0; j < 4; j++)
             {
-                state[i][j] ^= READ_ROUND_KEY_BYTE(keyBytes[(4 * i + j + half * 16) % LED_ROUND_KEYS_SIZE]);
+                state[i][j] ^= READ_ROUND_KEY_BYTE(keyBytes[4 * i + j + half * 16]);
             }
         }
     }
@@ -181,5 +210,90 @@ namespace block {
         }
     }
 
+    void led::round_constants(uint64_t keys[LED_NUMBER_OF_ROUNDS / 4 + 1], uint64_t constants[LED_NUMBER_OF_ROUNDS]) {
+        uint8_t state[4][4];
+
+        for (unsigned half = 0; half <= LED_NUMBER_OF_ROUNDS / 4; half++) {
+            memset(state, 0, sizeof(state));
+            AddKey(state, _key, half);
+            keys[half] = pack(state);
+        }
+        for (unsigned r = 0; r < LED_NUMBER_OF_ROUNDS; r++) {
+            memset(state, 0, sizeof(state));
+            AddConstants(state, r);
+            constants[r] = pack(state);
+        }
+    }
 
+    size_t led::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > LED_NUMBER_OF_ROUNDS)
+            return 0;
+
+        // ShiftRows and MixColumnsSerial: SCShRMCS() with the S-box undone, the tables are the same in every instance
+        static const bitslice::linear_map<64> shr_mcs([this](const uint64_t x) {
+            uint8_t state[4][4];
+            unpack(x, state);
+            for (unsigned i = 0; i < 16; i++)
+                state[i / 4][i % 4] = READ_INVERSE_SBOX_BYTE(invSbox[state[i / 4][i % 4]]);
+            SCShRMCS(state);
+            return pack(state);
+        });
+
+        uint64_t keys[LED_NUMBER_OF_ROUNDS / 4 + 1];
+        uint64_t constants[LED_NUMBER_OF_ROUNDS];
+        round_constants(keys, constants);
+
+        return bitslice::crypt_blocks<LED_BLOCK_SIZE, 64>(in, out, nblocks, [&](bitslice::word<64> *state) {
+            size_t i, j, n;
+
+            *state ^= keys[0];
+            for (i = 0; i < (_rounds >> 2); i++) {
+                for (j = 0; j < 4; j++) {
+                    *state ^= constants[i * 4 + j];
+                    for (n = 0; n < 16; n++)
+                        bitslice::sbox4<led_sbox>(state->s + nibble_slice(n));
+                    *state = shr_mcs(*state);
+                }
+                *state ^= keys[i + 1];
+            }
+        });
+    }
+
+    size_t led::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > LED_NUMBER_OF_ROUNDS)
+            return 0;
+
+        // inverse MixColumnsSerial and ShiftRows: invSCShRMCS() with the inverse S-box undone
+        static const bitslice::linear_map<64> inv_shr_mcs([this](const uint64_t x) {
+            uint8_t sbox[16];
+            for (unsigned v = 0; v < 16; v++)
+                sbox[READ_INVERSE_SBOX_BYTE(invSbox[v])] = v;
+
+            uint8_t state[4][4];
+            unpack(x, state);
+            invSCShRMCS(state);
+            for (unsigned i = 0; i < 16; i++)
+                state[i / 4][i % 4] = sbox[state[i / 4][i % 4]];
+            return pack(state);
+        });
+
+        uint64_t keys[LED_NUMBER_OF_ROUNDS / 4 + 1];
+        uint64_t constants[LED_NUMBER_OF_ROUNDS];
+        round_constants(keys, constants);
+
+        return bitslice::crypt_blocks<LED_BLOCK_SIZE, 64>(in, out, nblocks, [&](bitslice::word<64> *state) {
+            size_t i, j, n;
+
+            for (i = _rounds >> 2; i > 0; i--) {
+                *state ^= keys[i];
+                for (j = 4; j > 0; j--) {
+                    *state = inv_shr_mcs(*state);
+                    for (n = 0; n < 16; n++)
+                        bitslice::sbox4<led_inv_sbox>(state->s + nibble_slice(n));
+                    *state ^= constants[(i - 1) * 4 + j - 1];
+                }
+            }
+            *state ^= keys[0];
+        });
+    }
 }
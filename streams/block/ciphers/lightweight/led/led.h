@@ -7,6 +7,7 @@
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <cstring>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define INVERSE_SBOX_BYTE RAM_DATA_BYTE
 #define READ_INVERSE_SBOX_BYTE READ_RAM_DATA_BYTE
@@ -23,7 +24,7 @@
 #define LED_BLOCK_SIZE 8
 
 #define LED_KEY_SIZE 10
-#define LED_ROUND_KEYS_SIZE 20
+#define LED_ROUND_KEYS_SIZE 208 /* 16 key nibbles for each of the 13 AddKey() steps */
 
 #define LED_NUMBER_OF_ROUNDS 48
 
@@ -70,10 +71,17 @@ namespace block {
                 0x6E92, 0x2B7F, 0xE46B, 0xA186, 0x5943, 0x1CAE, 0xD3BA, 0x9657 }
         };
 
-    public:
-        led(size_t rounds) : lightweight(rounds) {}
+        /* AddKey() and AddConstants() of every round as constants XORed onto the packed state */
+        void round_constants(uint64_t keys[LED_NUMBER_OF_ROUNDS / 4 + 1], uint64_t constants[LED_NUMBER_OF_ROUNDS]);
+
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        led(size_t rounds) : lightweight(rounds, LED_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
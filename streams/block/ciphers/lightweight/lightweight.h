@@ -11,17 +11,25 @@
 
 namespace block {
 
-    template <size_t KEY_SIZE, size_t BLOCK_SIZE>
+    /**
+     * Base of the ciphers taken from the FELICS framework. The whole round-key schedule
+     * (ROUND_KEYS_SIZE bytes, enough for the full number of rounds) is expanded once by
+     * keysetup() into _key; Encrypt() and Decrypt() only read it.
+     */
+    template <size_t ROUND_KEYS_SIZE, size_t BLOCK_SIZE>
     class lightweight : public block_cipher {
     public:
-        lightweight(size_t rounds) : block_cipher(rounds) {};
+        /* key_size is the size of the master key, by default the key is its own schedule */
+        lightweight(size_t rounds, size_t key_size = ROUND_KEYS_SIZE)
+            : block_cipher(rounds)
+            , _key_size(key_size) {};
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override {
-            if (keysize != KEY_SIZE) {
-                throw std::runtime_error("Used lightweight function only support key size: " + std::to_string(KEY_SIZE));
+        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) final {
+            if (keysize != _key_size) {
+                throw std::runtime_error("Used lightweight function only support key size: " + std::to_string(_key_size));
             }
 
-            std::copy_n(key, keysize, _key);
+            key_schedule(key);
         }
 
         void ivsetup(const std::uint8_t *iv, const std::uint64_t ivsize) override {
@@ -40,11 +48,64 @@ namespace block {
             Decrypt(plaintext);
         }
 
+        // bitsliced groups first, the rest is copied once and then encrypted in place, block by block
+        void encrypt_blocks(const std::uint8_t *in,
+                            std::uint8_t *out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override {
+            if (block_size != BLOCK_SIZE)
+                return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+            const std::size_t done = encrypt_bitsliced(in, out, nblocks);
+            std::copy_n(in + done * BLOCK_SIZE, (nblocks - done) * BLOCK_SIZE, out + done * BLOCK_SIZE);
+            for (std::size_t i = done; i < nblocks; ++i)
+                Encrypt(out + i * BLOCK_SIZE);
+        }
+
+        void decrypt_blocks(const std::uint8_t *in,
+                            std::uint8_t *out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override {
+            if (block_size != BLOCK_SIZE)
+                return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+            const std::size_t done = decrypt_bitsliced(in, out, nblocks);
+            std::copy_n(in + done * BLOCK_SIZE, (nblocks - done) * BLOCK_SIZE, out + done * BLOCK_SIZE);
+            for (std::size_t i = done; i < nblocks; ++i)
+                Decrypt(out + i * BLOCK_SIZE);
+        }
+
         virtual void Encrypt(uint8_t *block) = 0;
         virtual void Decrypt(uint8_t *block) = 0;
 
     protected:
-        uint8_t _key[KEY_SIZE];
+        /**
+         * Bitsliced versions of Encrypt()/Decrypt() on many blocks (see common/bitslice.h),
+         * bit-exact with them for the current round count. They return the number of
+         * leading blocks done; the default does none.
+         */
+        virtual std::size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const std::size_t nblocks) {
+            (void)in;
+            (void)out;
+            (void)nblocks;
+            return 0;
+        }
+
+        virtual std::size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const std::size_t nblocks) {
+            (void)in;
+            (void)out;
+            (void)nblocks;
+            return 0;
+        }
+
+        /* Expands the master key into the round keys in _key, the default copies it as is */
+        virtual void key_schedule(const uint8_t *key) {
+            std::copy_n(key, _key_size, _key);
+        }
+
+        // the ciphers read the round keys as 16, 32 and 64-bit words
+        alignas(8) uint8_t _key[ROUND_KEYS_SIZE];
+
+    private:
+        const size_t _key_size;
     };
 
 } // namespace
@@ -7,11 +7,33 @@
 
 namespace block {
 
-    void piccolo::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != PICCOLO_KEY_SIZE) {
-            throw std::runtime_error("PICCOLO function only support key size: " + std::to_string(PICCOLO_KEY_SIZE));
+    namespace {
+
+        // PICCOLO_SBOX packed with S(x) in bits 4x..4x+3
+        constexpr uint64_t piccolo_sbox = 0xD5C6F7A190832B4Eull;
+
+        /* RP() on the sliced words: the halves are bytes, so this is moving slices */
+        void rp_bitsliced(bitslice::word<16> &x0, bitslice::word<16> &x1, bitslice::word<16> &x2, bitslice::word<16> &x3) {
+            bitslice::word<16> y0, y1, y2, y3;
+            for (unsigned k = 0; k < 8; ++k) {
+                y0.s[k] = x3.s[k];
+                y0.s[k + 8] = x1.s[k + 8];
+                y1.s[k] = x0.s[k];
+                y1.s[k + 8] = x2.s[k + 8];
+                y2.s[k] = x1.s[k];
+                y2.s[k + 8] = x3.s[k + 8];
+                y3.s[k] = x2.s[k];
+                y3.s[k + 8] = x0.s[k + 8];
+            }
+            x0 = y0;
+            x1 = y1;
+            x2 = y2;
+            x3 = y3;
         }
 
+    } // namespace
+
+    void piccolo::key_schedule(const uint8_t *key) {
         uint8_t i;
         uint8_t m;
         uint16_t *mk = (uint16_t *) key;
@@ -155,4 +177,78 @@ namespace block {
         *x2 = y2;
         *x3 = y3;
     }
+
+    bitslice::word<16> piccolo::F_bitsliced(bitslice::word<16> x) {
+        // the diffusion matrix of F() between its two S-box layers, the tables are the same in every instance
+        static const bitslice::linear_map<16> mix([this](const uint64_t v) {
+            uint8_t inv_sbox[16];
+            for (uint8_t n = 0; n < 16; ++n)
+                inv_sbox[READ_SBOX_BYTE(PICCOLO_SBOX[n])] = n;
+
+            uint16_t u = 0;
+            for (unsigned n = 0; n < 4; ++n)
+                u |= inv_sbox[(v >> (4 * n)) & 0x0f] << (4 * n);
+            const uint16_t y = F(u);
+
+            uint64_t r = 0;
+            for (unsigned n = 0; n < 4; ++n)
+                r |= uint64_t(inv_sbox[(y >> (4 * n)) & 0x0f]) << (4 * n);
+            return r;
+        });
+
+        for (unsigned n = 0; n < 4; ++n)
+            bitslice::sbox4<piccolo_sbox>(x.s + 4 * n);
+        x = mix(x);
+        for (unsigned n = 0; n < 4; ++n)
+            bitslice::sbox4<piccolo_sbox>(x.s + 4 * n);
+        return x;
+    }
+
+    size_t piccolo::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        // out of 1..25 rounds Encrypt() runs off the key schedule
+        if (_rounds < 1 || _rounds > PICCOLO_NUMBER_OF_ROUNDS)
+            return 0;
+
+        const uint16_t *rk = (const uint16_t *)_key;
+        return bitslice::crypt_blocks<PICCOLO_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *x) {
+            // x3 is the first word of the block
+            bitslice::word<16> &x3 = x[0], &x2 = x[1], &x1 = x[2], &x0 = x[3];
+
+            x2 ^= READ_ROUND_KEY_WORD(rk[51]);
+            x0 ^= READ_ROUND_KEY_WORD(rk[50]);
+            for (size_t i = 0; i < _rounds - 1; ++i) {
+                x1 = x1 ^ F_bitsliced(x0) ^ READ_ROUND_KEY_WORD(rk[2 * i]);
+                x3 = x3 ^ F_bitsliced(x2) ^ READ_ROUND_KEY_WORD(rk[2 * i + 1]);
+                rp_bitsliced(x0, x1, x2, x3);
+            }
+            x1 = x1 ^ F_bitsliced(x0) ^ READ_ROUND_KEY_WORD(rk[2*PICCOLO_NUMBER_OF_ROUNDS - 2]);
+            x3 = x3 ^ F_bitsliced(x2) ^ READ_ROUND_KEY_WORD(rk[2*PICCOLO_NUMBER_OF_ROUNDS - 1]);
+            x0 ^= READ_ROUND_KEY_WORD(rk[52]);
+            x2 ^= READ_ROUND_KEY_WORD(rk[53]);
+        });
+    }
+
+    size_t piccolo::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds < 1 || _rounds > PICCOLO_NUMBER_OF_ROUNDS)
+            return 0;
+
+        const uint16_t *rk = (const uint16_t *)_key;
+        return bitslice::crypt_blocks<PICCOLO_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *x) {
+            bitslice::word<16> &x3 = x[0], &x2 = x[1], &x1 = x[2], &x0 = x[3];
+
+            x2 ^= READ_ROUND_KEY_WORD(rk[53]);
+            x0 ^= READ_ROUND_KEY_WORD(rk[52]);
+            for (size_t i = 0; i < _rounds - 1; ++i) {
+                // the round keys of the odd rounds are swapped
+                const size_t k = 2 * PICCOLO_NUMBER_OF_ROUNDS - 2 * i - 2 + (i & 0x01);
+                x1 = x1 ^ F_bitsliced(x0) ^ READ_ROUND_KEY_WORD(rk[k]);
+                x3 = x3 ^ F_bitsliced(x2) ^ READ_ROUND_KEY_WORD(rk[k ^ 1]);
+                rp_bitsliced(x0, x1, x2, x3);
+            }
+            x1 = x1 ^ F_bitsliced(x0) ^ READ_ROUND_KEY_WORD(rk[0]);
+            x3 = x3 ^ F_bitsliced(x2) ^ READ_ROUND_KEY_WORD(rk[1]);
+            x0 ^= READ_ROUND_KEY_WORD(rk[50]);
+            x2 ^= READ_ROUND_KEY_WORD(rk[51]);
+        });
+    }
 }
@@ -6,6 +6,7 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define SBOX_BYTE ROM_DATA_BYTE
 #define READ_SBOX_BYTE READ_ROM_DATA_BYTE
@@ -82,10 +83,16 @@ namespace block {
 
         void RP(uint16_t *x0, uint16_t *x1, uint16_t *x2, uint16_t *x3);
 
-    public:
-        piccolo(size_t rounds) : lightweight(rounds) {}
+        bitslice::word<16> F_bitsliced(bitslice::word<16> x);
+
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        piccolo(size_t rounds) : lightweight(rounds, PICCOLO_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -8,11 +8,7 @@
 
 namespace block {
 
-    void pride::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != PRIDE_KEY_SIZE) {
-            throw std::runtime_error("PRIDE function only support key size: " + std::to_string(PRIDE_KEY_SIZE));
-        }
-
+    void pride::key_schedule(const uint8_t *key) {
         if (_encrypt) {
             uint8_t i, j;
             memcpy((void*)_key,(void*)key,16);
@@ -55,6 +51,47 @@ namespace block {
         for(i=0;i<PRIDE_BLOCK_SIZE;i++) block[i] ^= READ_ROUND_KEY_BYTE(_key[i])^READ_ROUND_KEY_BYTE(_key[160+i]);
     }
 
+    size_t pride::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        // out of 1..20 rounds Encrypt() runs off the key schedule
+        if (_rounds < 1 || _rounds > PRIDE_NUMBER_OF_ROUNDS)
+            return 0;
+
+        // the FELICS macros run unchanged on bitsliced bytes
+        return bitslice::crypt_blocks<PRIDE_BLOCK_SIZE, 8>(in, out, nblocks, [this](bitslice::word<8> *data) {
+            bitslice::word<8> temp[4];
+            size_t i, r;
+
+            for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[i]);
+            for(r=0;r<_rounds - 1;r++) {
+                for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[8*(r+1)+i]);
+                S_layer(data);
+                L_layer(data, temp);
+            }
+            for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[i + 160]);
+            S_layer(data);
+            for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[i]);
+        });
+    }
+
+    size_t pride::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds < 1 || _rounds > PRIDE_NUMBER_OF_ROUNDS)
+            return 0;
+
+        return bitslice::crypt_blocks<PRIDE_BLOCK_SIZE, 8>(in, out, nblocks, [this](bitslice::word<8> *data) {
+            bitslice::word<8> temp[4];
+            size_t i, r;
+
+            for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[i]);
+            S_layer(data);
+            for(r=1;r<_rounds;r++) {
+                for(i=0;i<8;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[PRIDE_BLOCK_SIZE*r+i]);
+                L_layerInv(data, temp);
+                S_layer(data);
+            }
+            for(i=0;i<PRIDE_BLOCK_SIZE;i++) data[i] ^= READ_ROUND_KEY_BYTE(_key[i])^READ_ROUND_KEY_BYTE(_key[160+i]);
+        });
+    }
+
     void pride::encryption_round_function(uint8_t *data, uint8_t *rkey, uint8_t *temp) {
         uint8_t i;
 
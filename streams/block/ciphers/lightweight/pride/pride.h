@@ -5,6 +5,7 @@
 #pragma once
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 #include "pride_functions.h"
 
 #define ROUND_CONSTANT_BYTE ROM_DATA_BYTE
@@ -44,10 +45,14 @@ namespace block {
 
         bool _encrypt;
 
-    public:
-        pride(size_t rounds, bool encrypt) : lightweight(rounds), _encrypt(encrypt) {}
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        pride(size_t rounds, bool encrypt) : lightweight(rounds, PRIDE_KEY_SIZE), _encrypt(encrypt) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -6,6 +6,153 @@
 
 namespace block {
 
+    namespace {
+
+        // S0 and S1 packed with S(x) in bits 4x..4x+3
+        constexpr uint64_t prince_sbox = 0x4D5E087619CA23FBull;
+        constexpr uint64_t prince_inv_sbox = 0x1CE5046A98DF237Bull;
+
+        /*
+         * The linear layers of the rounds, as in Encrypt() and Decrypt(). They are only used
+         * to recover the bitsliced linear maps.
+         */
+        void m_layer(uint8_t *block) {
+            uint8_t temp0;
+            uint8_t temp1;
+
+            /* M0 multiplication */
+            temp1 = (0x07 & (block[7] >> 4)) ^ (0x0B & block[7]) ^ (0x0D & (block[6] >> 4)) ^ (0x0E & block[6]);
+            temp1 = (temp1 << 4) ^ (0x0B & (block[7] >> 4)) ^ (0x0D & block[7]) ^ (0x0E & (block[6] >> 4)) ^
+                    (0x07 & block[6]);
+
+            temp0 = (0x0D & (block[7] >> 4)) ^ (0x0E & block[7]) ^ (0x07 & (block[6] >> 4)) ^ (0x0B & block[6]);
+            temp0 = (temp0 << 4) ^ (0x0E & (block[7] >> 4)) ^ (0x07 & block[7]) ^ (0x0B & (block[6] >> 4)) ^
+                    (0x0D & block[6]);
+
+            block[7] = temp1;
+            block[6] = temp0;
+
+            /* M1 multiplication */
+            temp1 = (0x0B & (block[5] >> 4)) ^ (0x0D & block[5]) ^ (0x0E & (block[4] >> 4)) ^ (0x07 & block[4]);
+            temp1 = (temp1 << 4) ^ (0x0D & (block[5] >> 4)) ^ (0x0E & block[5]) ^ (0x07 & (block[4] >> 4)) ^
+                    (0x0B & block[4]);
+
+            temp0 = (0x0E & (block[5] >> 4)) ^ (0x07 & block[5]) ^ (0x0B & (block[4] >> 4)) ^ (0x0D & block[4]);
+            temp0 = (temp0 << 4) ^ (0x07 & (block[5] >> 4)) ^ (0x0B & block[5]) ^ (0x0D & (block[4] >> 4)) ^
+                    (0x0E & block[4]);
+
+            block[5] = temp1;
+            block[4] = temp0;
+
+            /* M1 multiplication */
+            temp1 = (0x0B & (block[3] >> 4)) ^ (0x0D & block[3]) ^ (0x0E & (block[2] >> 4)) ^ (0x07 & block[2]);
+            temp1 = (temp1 << 4) ^ (0x0D & (block[3] >> 4)) ^ (0x0E & block[3]) ^ (0x07 & (block[2] >> 4)) ^
+                    (0x0B & block[2]);
+
+            temp0 = (0x0E & (block[3] >> 4)) ^ (0x07 & block[3]) ^ (0x0B & (block[2] >> 4)) ^ (0x0D & block[2]);
+            temp0 = (temp0 << 4) ^ (0x07 & (block[3] >> 4)) ^ (0x0B & block[3]) ^ (0x0D & (block[2] >> 4)) ^
+                    (0x0E & block[2]);
+
+            block[3] = temp1;
+            block[2] = temp0;
+
+            /* M0 multiplication */
+            temp1 = (0x07 & (block[1] >> 4)) ^ (0x0B & block[1]) ^ (0x0D & (block[0] >> 4)) ^ (0x0E & block[0]);
+            temp1 = (temp1 << 4) ^ (0x0B & (block[1] >> 4)) ^ (0x0D & block[1]) ^ (0x0E & (block[0] >> 4)) ^
+                    (0x07 & block[0]);
+
+            temp0 = (0x0D & (block[1] >> 4)) ^ (0x0E & block[1]) ^ (0x07 & (block[0] >> 4)) ^ (0x0B & block[0]);
+            temp0 = (temp0 << 4) ^ (0x0E & (block[1] >> 4)) ^ (0x07 & block[1]) ^ (0x0B & (block[0] >> 4)) ^
+                    (0x0D & block[0]);
+
+            block[1] = temp1;
+            block[0] = temp0;
+        }
+
+        void shift_rows(uint8_t *block) {
+            uint8_t temp0;
+            uint8_t temp1;
+
+            /* Shift left column 1 by 1 */
+            temp0 = block[7];
+            block[7] = (block[7] & 0xF0) ^ (block[5] & 0x0F);
+            block[5] = (block[5] & 0xF0) ^ (block[3] & 0x0F);
+            block[3] = (block[3] & 0xF0) ^ (block[1] & 0x0F);
+            block[1] = (block[1] & 0xF0) ^ (temp0 & 0x0F);
+
+            /* Shift left column 2 by 2 and column 3 by 3 */
+            temp0 = block[0];
+            temp1 = block[2];
+
+            block[0] = (block[4] & 0xF0) ^ (block[2] & 0x0F);
+            block[2] = (block[6] & 0xF0) ^ (block[4] & 0x0F);
+            block[4] = (temp0 & 0xF0) ^ (block[6] & 0x0F);
+            block[6] = (temp1 & 0xF0) ^ (temp0 & 0x0F);
+        }
+
+        void inv_shift_rows(uint8_t *block) {
+            uint8_t temp0;
+            uint8_t temp1;
+
+            /* Shift right column 1 by 1 */
+            temp0 = block[1];
+            block[1] = (block[1] & 0xF0) ^ (block[3] & 0x0F);
+            block[3] = (block[3] & 0xF0) ^ (block[5] & 0x0F);
+            block[5] = (block[5] & 0xF0) ^ (block[7] & 0x0F);
+            block[7] = (block[7] & 0xF0) ^ (temp0 & 0x0F);
+
+            /* Shift right column 2 by 2 and column 3 by 3 */
+            temp0 = block[6];
+            temp1 = block[4];
+
+            block[6] = (block[2] & 0xF0) ^ (block[4] & 0x0F);
+            block[4] = (block[0] & 0xF0) ^ (block[2] & 0x0F);
+            block[2] = (temp0 & 0xF0) ^ (block[0] & 0x0F);
+            block[0] = (temp1 & 0xF0) ^ (temp0 & 0x0F);
+        }
+
+        uint64_t load64(const uint8_t *block) {
+            uint64_t x = 0;
+            for (unsigned i = 0; i < PRINCE_BLOCK_SIZE; i++)
+                x |= uint64_t(block[i]) << (8 * i);
+            return x;
+        }
+
+        void store64(const uint64_t x, uint8_t *block) {
+            for (unsigned i = 0; i < PRINCE_BLOCK_SIZE; i++)
+                block[i] = uint8_t(x >> (8 * i));
+        }
+
+        template <typename Layer>
+        uint64_t probe(const uint64_t x, Layer layer) {
+            uint8_t block[PRINCE_BLOCK_SIZE];
+            store64(x, block);
+            layer(block);
+            return load64(block);
+        }
+
+        struct linear_layers {
+            // M then SR of the forward rounds, inverse SR then M of the backward rounds, M of the middle
+            linear_layers()
+                : forward([](const uint64_t x) { return probe(x, [](uint8_t *b) { m_layer(b); shift_rows(b); }); })
+                , backward([](const uint64_t x) { return probe(x, [](uint8_t *b) { inv_shift_rows(b); m_layer(b); }); })
+                , middle([](const uint64_t x) { return probe(x, m_layer); }) {}
+
+            bitslice::linear_map<64> forward, backward, middle;
+        };
+
+        void s_layer(bitslice::word<64> &state) {
+            for (unsigned n = 0; n < 16; n++)
+                bitslice::sbox4<prince_sbox>(state.s + 4 * n);
+        }
+
+        void inv_s_layer(bitslice::word<64> &state) {
+            for (unsigned n = 0; n < 16; n++)
+                bitslice::sbox4<prince_inv_sbox>(state.s + 4 * n);
+        }
+
+    } // namespace
+
     void prince::Encrypt(uint8_t *block) {
             uint8_t temp0;
             uint8_t temp1;
@@ -2406,10 +2553,7 @@ namespace block {
         Block[1] = Block[1] ^ READ_ROUND_KEY_DOUBLE_WORD(RoundKeys[1]);
     }
 
-    void prince::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != PRINCE_KEY_SIZE) {
-            throw std::runtime_error("PRINCE function only support key size: " + std::to_string(PRINCE_KEY_SIZE));
-        }
+    void prince::key_schedule(const uint8_t *key) {
         uint64_t *Key = (uint64_t *) key;
         uint64_t *RoundKeys = (uint64_t *) _key;
 
@@ -2423,4 +2567,54 @@ namespace block {
         /* Generate K0' */
         RoundKeys[1] = ((Key[0] >> 1) ^ (Key[0] << 63)) ^ (Key[0] >> 63);
     }
+
+    size_t prince::crypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks, const bool encrypt) {
+        static const linear_layers layers;
+
+        // 64-bit halves of the round keys: K0, K0', K1
+        const uint64_t k0 = load64(_key), k0p = load64(_key + 8), k1 = load64(_key + 16);
+        uint64_t rc[PRINCE_NUMBER_OF_ROUNDS];
+        for (unsigned r = 0; r < PRINCE_NUMBER_OF_ROUNDS; r++)
+            rc[r] = load64(RC + 8 * r);
+
+        /*
+         * Decrypt() is Encrypt() with K0 and K0' swapped and the round constants taken in
+         * reverse, including which rounds are left out when the round count is reduced
+         */
+        const uint64_t first = encrypt ? k0 : k0p, last = encrypt ? k0p : k0;
+        auto constant = [&](const unsigned r) { return rc[encrypt ? r : PRINCE_NUMBER_OF_ROUNDS - 1 - r]; };
+        auto present = [&](const unsigned r) { return _rounds >= (encrypt ? r : PRINCE_NUMBER_OF_ROUNDS - 1 - r); };
+
+        return bitslice::crypt_blocks<PRINCE_BLOCK_SIZE, 64>(in, out, nblocks, [&](bitslice::word<64> *state) {
+            *state ^= first ^ constant(0) ^ k1;
+            for (unsigned r = 1; r <= 5; r++) {
+                if (present(r)) {
+                    s_layer(*state);
+                    *state = layers.forward(*state);
+                    *state ^= constant(r) ^ k1;
+                }
+            }
+            if (_rounds >= 5) {
+                s_layer(*state);
+                *state = layers.middle(*state);
+                inv_s_layer(*state);
+            }
+            for (unsigned r = 6; r <= 10; r++) {
+                if (present(r)) {
+                    *state ^= constant(r) ^ k1;
+                    *state = layers.backward(*state);
+                    inv_s_layer(*state);
+                }
+            }
+            *state ^= constant(11) ^ k1 ^ last;
+        });
+    }
+
+    size_t prince::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        return crypt_bitsliced(in, out, nblocks, true);
+    }
+
+    size_t prince::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        return crypt_bitsliced(in, out, nblocks, false);
+    }
 }
@@ -6,6 +6,7 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define SBOX_BYTE RAM_DATA_BYTE
 #define READ_SBOX_BYTE READ_RAM_DATA_BYTE
@@ -50,10 +51,17 @@ namespace block {
                         0x99, 0x23, 0x0c, 0xca, 0x99, 0xa3, 0xb5, 0xd3,
                         0xdd, 0x50, 0x7c, 0xc9, 0xb7, 0x29, 0xac, 0xc0
                 };
-    public:
-        prince(size_t rounds) : lightweight(rounds) {}
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        size_t crypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks, const bool encrypt);
+
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        prince(size_t rounds) : lightweight(rounds, PRINCE_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
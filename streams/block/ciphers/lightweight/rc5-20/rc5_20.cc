@@ -7,11 +7,7 @@
 
 namespace block {
 
-    void rc5_20::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != RC5_20_KEY_SIZE) {
-            throw std::runtime_error("RC5_20 function only support key size: " + std::to_string(RC5_20_KEY_SIZE));
-        }
-
+    void rc5_20::key_schedule(const uint8_t *key) {
         uint32_t L[4];
 
         uint32_t *RoundKeys = (uint32_t *) _key;
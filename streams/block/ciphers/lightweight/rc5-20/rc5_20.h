@@ -84,10 +84,10 @@ namespace block {
         uint32_t RC5_ROTL(uint32_t x, uint32_t n);
         uint32_t RC5_ROTR(uint32_t x, uint32_t n);
 
-    public:
-        rc5_20(size_t rounds) : lightweight(rounds) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        rc5_20(size_t rounds) : lightweight(rounds, RC5_20_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -6,50 +6,110 @@
 
 namespace block {
 
+    namespace {
+
+        inline uint16_t rotate_left(const uint16_t x, const unsigned n) {
+            return uint16_t(x << n | x >> (16 - n));
+        }
+
+        using bitslice::rotate_left;
+
+        /*
+         * The cipher on the four 16-bit rows, Word being uint16_t or a bitsliced word with
+         * the same operators, so both paths share one circuit
+         */
+        template <typename Word>
+        void encrypt_rows(Word &w0, Word &w1, Word &w2, Word &w3, const uint16_t *roundKeys16, const size_t rounds) {
+            Word sbox0, sbox1;
+            uint8_t i;
+            for ( i = 0; i < rounds; ++i ) {
+                // AddRoundKey
+                w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
+                w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
+                w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
+                w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
+                roundKeys16 += 4;
+                // SubColumn
+                sbox0 =  w2;
+                w2    ^= w1;
+                w1    =  ~w1;
+                sbox1 =  w0;
+                w0    &= w1;
+                w1    |= w3;
+                w1    ^= sbox1;
+                w3    ^= sbox0;
+                w0    ^= w3;
+                w3    &= w1;
+                w3    ^= w2;
+                w2    |= w0;
+                w2    ^= w1;
+                w1    ^= sbox0;
+                // ShiftRow
+                w1 = rotate_left(w1, 1);
+                w2 = rotate_left(w2, 12);
+                w3 = rotate_left(w3, 13);
+            }
+            // last AddRoundKey
+            w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
+            w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
+            w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
+            w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
+        }
+
+        template <typename Word>
+        void decrypt_rows(Word &w0, Word &w1, Word &w2, Word &w3, const uint16_t *roundKeys16, const size_t rounds) {
+            // point to the start address of round 26
+            roundKeys16 += 100;
+
+            Word sbox0;
+            uint8_t i;
+            for ( i = 0; i < rounds; ++i ) {
+                //Inverse AddRoundKey
+                w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
+                w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
+                w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
+                w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
+                roundKeys16 -= 4;
+                // Inverse ShiftRow
+                w1 = rotate_left(w1, 15);
+                w2 = rotate_left(w2, 4);
+                w3 = rotate_left(w3, 3);
+                // Invert SubColumn
+                sbox0 =  w0;
+                w0    &= w2;
+                w0    ^= w3;
+                w3    |= sbox0;
+                w3    ^= w2;
+                w1    ^= w3;
+                w2    =  w1;
+                w1    ^= sbox0;
+                w1    ^= w0;
+                w3    =  ~w3;
+                sbox0 =  w3;
+                w3    |= w1;
+                w3    ^= w0;
+                w0    &= w1;
+                w0    ^= sbox0;
+            }
+            // last AddRoundKey
+            w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
+            w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
+            w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
+            w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
+        }
+
+    } // namespace
+
     void rectangle::Encrypt(uint8_t *block) {
         uint16_t *block16 = (uint16_t*)block;
-        uint16_t *roundKeys16 = (uint16_t*)_key;
 
         uint16_t w0 = *block16;
         uint16_t w1 = *(block16+1);
         uint16_t w2 = *(block16+2);
         uint16_t w3 = *(block16+3);
 
-        uint16_t sbox0, sbox1;
-        uint8_t i;
-        for ( i = 0; i < _rounds; ++i ) {
-            // AddRoundKey
-            w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
-            w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
-            w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
-            w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
-            roundKeys16 += 4;
-            // SubColumn
-            sbox0 =  w2;
-            w2    ^= w1;
-            w1    =  ~w1;
-            sbox1 =  w0;
-            w0    &= w1;
-            w1    |= w3;
-            w1    ^= sbox1;
-            w3    ^= sbox0;
-            w0    ^= w3;
-            w3    &= w1;
-            w3    ^= w2;
-            w2    |= w0;
-            w2    ^= w1;
-            w1    ^= sbox0;
-            // ShiftRow
-            w1 = (w1<<1  | w1 >> 15);
-            w2 = (w2<<12 | w2 >> 4);
-            w3 = (w3<<13 | w3 >> 3);
-        }
-        // last AddRoundKey
-        w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
-        w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
-        w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
-        w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
-        // store cipher text
+        encrypt_rows(w0, w1, w2, w3, (uint16_t*)_key, _rounds);
+
         *block16 = w0;
         *(block16+1) = w1;
         *(block16+2) = w2;
@@ -58,63 +118,40 @@ namespace block {
 
     void rectangle::Decrypt(uint8_t *block) {
         uint16_t *block16 = (uint16_t*)block;
-        uint16_t *roundKeys16 = (uint16_t*)_key;
-        // point to the start address of round 26
-        roundKeys16 += 100;
 
         uint16_t w0 = *block16;
         uint16_t w1 = *(block16+1);
         uint16_t w2 = *(block16+2);
         uint16_t w3 = *(block16+3);
 
-        uint16_t sbox0;
-        uint8_t i;
-        for ( i = 0; i < _rounds; ++i ) {
-            //Inverse AddRoundKey
-            w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
-            w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
-            w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
-            w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
-            roundKeys16 -= 4;
-            // Inverse ShiftRow
-            w1 = (w1>>1  | w1 << 15);
-            w2 = (w2>>12 | w2 << 4);
-            w3 = (w3>>13 | w3 << 3);
-            // Invert SubColumn
-            sbox0 =  w0;
-            w0    &= w2;
-            w0    ^= w3;
-            w3    |= sbox0;
-            w3    ^= w2;
-            w1    ^= w3;
-            w2    =  w1;
-            w1    ^= sbox0;
-            w1    ^= w0;
-            w3    =  ~w3;
-            sbox0 =  w3;
-            w3    |= w1;
-            w3    ^= w0;
-            w0    &= w1;
-            w0    ^= sbox0;
-        }
-        // last AddRoundKey
-        w0 ^= READ_ROUND_KEY_WORD(*(roundKeys16));
-        w1 ^= READ_ROUND_KEY_WORD(*(roundKeys16+1));
-        w2 ^= READ_ROUND_KEY_WORD(*(roundKeys16+2));
-        w3 ^= READ_ROUND_KEY_WORD(*(roundKeys16+3));
-        // store plain text
+        decrypt_rows(w0, w1, w2, w3, (uint16_t*)_key, _rounds);
+
         *block16 = w0;
         *(block16+1) = w1;
         *(block16+2) = w2;
         *(block16+3) = w3;
     }
 
-    void rectangle_k80::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != RECTANGLE_KEY_SIZE_80) {
-            throw std::runtime_error("RECTANGLE_K80 function only support key size: "
-                                     + std::to_string(RECTANGLE_KEY_SIZE_80));
-        }
+    size_t rectangle::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        // more rounds than the schedule has keys are left to Encrypt()
+        if (_rounds > RECTANGLE_NUMBER_OF_ROUNDS)
+            return 0;
+        const uint16_t *roundKeys16 = (uint16_t*)_key;
+        return bitslice::crypt_blocks<RECTANGLE_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *w) {
+            encrypt_rows(w[0], w[1], w[2], w[3], roundKeys16, _rounds);
+        });
+    }
+
+    size_t rectangle::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > RECTANGLE_NUMBER_OF_ROUNDS)
+            return 0;
+        const uint16_t *roundKeys16 = (uint16_t*)_key;
+        return bitslice::crypt_blocks<RECTANGLE_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *w) {
+            decrypt_rows(w[0], w[1], w[2], w[3], roundKeys16, _rounds);
+        });
+    }
 
+    void rectangle_k80::key_schedule(const uint8_t *key) {
         uint8_t key8[10];
         uint8_t i;
         for ( i = 0; i < RECTANGLE_KEY_SIZE_80; ++i) {
@@ -177,7 +214,7 @@ namespace block {
 
     }
 
-    void rectangle_k128::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
+    void rectangle_k128::key_schedule(const uint8_t *key) {
         uint8_t key8[16];
         uint8_t i;
         for (i = 0; i < RECTANGLE_KEY_SIZE_128; ++i) {
@@ -6,6 +6,7 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define RC_BYTE ROM_DATA_BYTE
 #define READ_RC_BYTE READ_ROM_DATA_BYTE
@@ -30,8 +31,12 @@ namespace block {
                 0x18, 0x11, 0x03, 0x06, 0x0d, 0x1b, 0x17, 0x0e,
                 0x1d };
 
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
     public:
-        rectangle(size_t rounds) : lightweight(rounds) {}
+        rectangle(size_t rounds, size_t key_size) : lightweight(rounds, key_size) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -40,17 +45,17 @@ namespace block {
     };
 
     class rectangle_k80 : public rectangle {
-    public:
-        rectangle_k80(size_t rounds) : rectangle(rounds) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        rectangle_k80(size_t rounds) : rectangle(rounds, RECTANGLE_KEY_SIZE_80) {}
     };
 
     class rectangle_k128 : public rectangle {
-    public:
-        rectangle_k128(size_t rounds) : rectangle(rounds) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        rectangle_k128(size_t rounds) : rectangle(rounds, RECTANGLE_KEY_SIZE_128) {}
     };
 
 }
@@ -7,13 +7,7 @@
 
 namespace block {
 
-    void road_runner_k128::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != ROAD_RUNNER_KEY_SIZE128) {
-            throw std::runtime_error("ROAD-RUNNER function only support key sizes: "
-                                     + std::to_string(ROAD_RUNNER_KEY_SIZE128) + ", "
-                                     + std::to_string(ROAD_RUNNER_KEY_SIZE80));
-        }
-
+    void road_runner_k128::key_schedule(const uint8_t *key) {
         if (_encrypt) {
             uint8_t i;
             memcpy((void*)_key,(void*)key, ROAD_RUNNER_KEY_SIZE128);
@@ -60,13 +54,7 @@ namespace block {
         for(i=0;i<4;i++) block[i+4] = temp[i];
     }
 
-    void road_runner_k80::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != ROAD_RUNNER_KEY_SIZE80) {
-            throw std::runtime_error("ROAD-RUNNER function only support key sizes: "
-                                     + std::to_string(ROAD_RUNNER_KEY_SIZE128) + ", "
-                                     + std::to_string(ROAD_RUNNER_KEY_SIZE80));
-        }
-
+    void road_runner_k80::key_schedule(const uint8_t *key) {
         if (_encrypt) {
             uint8_t i;
             memcpy((void*)_key,(void*)key, ROAD_RUNNER_KEY_SIZE80);
@@ -75,7 +75,7 @@ namespace block {
         }
 
     public:
-        road_runner(size_t rounds, bool _encrypt) : lightweight<ROAD_RUNNER_KEY_SIZE, ROAD_RUNNER_BLOCK_SIZE>(rounds), _encrypt(_encrypt) {}
+        road_runner(size_t rounds, bool _encrypt, size_t key_size) : lightweight<ROAD_RUNNER_KEY_SIZE, ROAD_RUNNER_BLOCK_SIZE>(rounds, key_size), _encrypt(_encrypt) {}
 
 
     };
@@ -84,10 +84,10 @@ namespace block {
      * RoadRunner with 16B key size
      */
     class road_runner_k128 : public road_runner<ROAD_RUNNER_ROUND_KEYS_SIZE128> {
-    public:
-        road_runner_k128(size_t rounds, bool encrypt) : road_runner(rounds, encrypt) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        road_runner_k128(size_t rounds, bool encrypt) : road_runner(rounds, encrypt, ROAD_RUNNER_KEY_SIZE128) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -100,10 +100,10 @@ namespace block {
      */
     class road_runner_k80 : public road_runner<ROAD_RUNNER_ROUND_KEYS_SIZE80> {
 
-    public:
-        road_runner_k80(size_t rounds, bool encrypt) : road_runner(rounds, encrypt) {}
+        void key_schedule(const uint8_t *key) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+    public:
+        road_runner_k80(size_t rounds, bool encrypt) : road_runner(rounds, encrypt, ROAD_RUNNER_KEY_SIZE80) {}
 
         void Encrypt(uint8_t *block) override;
 
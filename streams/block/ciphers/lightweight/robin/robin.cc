@@ -87,4 +87,59 @@ namespace block {
             data[0] ^= READ_LBOX_WORD(LBox1[i]);
         }
     }
-}
\ No newline at end of file
+
+    size_t robin::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        // Encrypt() counts rounds in a byte and takes the round constants from LBox1
+        if (_rounds > 255)
+            return 0;
+
+        // the L-box tables are the same in every instance
+        static const bitslice::linear_map<16> lbox([this](const uint64_t x) {
+            return uint64_t(READ_LBOX_WORD(LBox2[x >> 8]) ^ READ_LBOX_WORD(LBox1[x & 0xff]));
+        });
+        const uint16_t *key = (const uint16_t *)_key;
+
+        return bitslice::crypt_blocks<ROBIN_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *data) {
+            size_t i, j;
+
+            for (j = 0; j < 8; j++)
+                data[j] ^= READ_ROUND_KEY_WORD(key[j]);
+
+            for (i = 0; i < _rounds; i++)
+            {
+                data[0] ^= READ_LBOX_WORD(LBox1[i + 1]);
+                SBOX(data);
+                for (j = 0; j < 8; j++)
+                    data[j] = lbox(data[j]) ^ READ_ROUND_KEY_WORD(key[j]);
+            }
+        });
+    }
+
+    size_t robin::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > 255)
+            return 0;
+
+        // S-box and L-box are involutions, Decrypt() uses the same ones
+        static const bitslice::linear_map<16> lbox([this](const uint64_t x) {
+            return uint64_t(READ_LBOX_WORD(LBox2[x >> 8]) ^ READ_LBOX_WORD(LBox1[x & 0xff]));
+        });
+        const uint16_t *key = (const uint16_t *)_key;
+
+        return bitslice::crypt_blocks<ROBIN_BLOCK_SIZE, 16>(in, out, nblocks, [&](bitslice::word<16> *data) {
+            size_t i, j;
+
+            for (j = 0; j < 8; j++)
+                data[j] ^= READ_ROUND_KEY_WORD(key[j]);
+
+            for (i = _rounds; i > 0; i--)
+            {
+                for (j = 0; j < 8; j++)
+                    data[j] = lbox(data[j]);
+                SBOX(data);
+                for (j = 0; j < 8; j++)
+                    data[j] ^= READ_ROUND_KEY_WORD(key[j]);
+                data[0] ^= READ_LBOX_WORD(LBox1[i]);
+            }
+        });
+    }
+}
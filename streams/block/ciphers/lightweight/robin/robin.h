@@ -6,12 +6,14 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
+#include <type_traits>
 
 #define LBOX_WORD RAM_DATA_WORD
 #define READ_LBOX_WORD READ_RAM_DATA_WORD
 
 #define Class13(A,B,C,D,X,Y,Z,T) do {  \
-  uint16_t __a, __b, __c, __d;         \
+  std::remove_reference<decltype(A)>::type __a, __b, __c, __d; \
   __a  = A & B;                        \
   __a ^= C;                            \
   __c  = B | C;                        \
@@ -120,6 +122,10 @@ namespace block {
         };
 
 
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
     public:
         robin(size_t rounds) : lightweight(rounds) {}
 
@@ -7,12 +7,7 @@
 
 namespace block {
 
-    void sparx_b64::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
-        if (keysize != SPARX_KEY_SIZE) {
-            throw std::runtime_error("ROAD-RUNNER function only support key size: "
-                                     + std::to_string(SPARX_KEY_SIZE));
-        }
-
+    void sparx_b64::key_schedule(const uint8_t *key) {
         uint8_t i;
         uint16_t temp[2];
 
@@ -102,7 +97,7 @@ namespace block {
         }
     }
 
-    void sparx_b128::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
+    void sparx_b128::key_schedule(const uint8_t *key) {
         uint8_t i;
         uint16_t temp[2];
 
@@ -44,7 +44,7 @@ namespace block {
         }
 
     public:
-        sparx(size_t rounds) : lightweight<KEY_SIZE, BLOCK_SIZE>(rounds) {}
+        sparx(size_t rounds) : lightweight<KEY_SIZE, BLOCK_SIZE>(rounds, SPARX_KEY_SIZE) {}
     };
 
     class sparx_b128 : public sparx<SPARX_ROUND_KEYS_SIZE128, SPARX_BLOCK_SIZE128> {
@@ -358,9 +358,9 @@ namespace block {
         }
 
 
-    public:
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        void key_schedule(const uint8_t *key) override;
 
+    public:
         void Encrypt(uint8_t *block) override;
 
         void Decrypt(uint8_t *block) override;
@@ -452,11 +452,11 @@ namespace block {
         }
 
 
+        void key_schedule(const uint8_t *key) override;
+
     public:
         sparx_b64(size_t rounds) : sparx(rounds) {}
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
-
         void Encrypt(uint8_t *block) override;
 
         void Decrypt(uint8_t *block) override;
@@ -6,7 +6,26 @@
 
 namespace block {
 
-    void twine::keysetup(const std::uint8_t *key, const std::uint64_t keysize) {
+    namespace {
+
+        // Sbox packed with S(x) in bits 4x..4x+3
+        constexpr uint64_t twine_sbox = 0x46E17D3859B2AF0Cull;
+
+        uint64_t load64(const uint8_t *block) {
+            uint64_t x = 0;
+            for (unsigned i = 0; i < TWINE_BLOCK_SIZE; i++)
+                x |= uint64_t(block[i]) << (8 * i);
+            return x;
+        }
+
+        void store64(const uint64_t x, uint8_t *block) {
+            for (unsigned i = 0; i < TWINE_BLOCK_SIZE; i++)
+                block[i] = uint8_t(x >> (8 * i));
+        }
+
+    } // namespace
+
+    void twine::key_schedule(const uint8_t *key) {
         uint8_t KeyR[20];
 
         uint8_t i;
@@ -94,75 +113,7 @@ namespace block {
                 ) << 4;
             }
 
-            /* Output */
-            i = block[0];
-
-            /*0 <-1 */
-            block[0] &= 0xF0;
-            block[0] ^= block[0] >> 4;
-
-            /*1 <-2 */
-            block[0] &= 0x0F;
-            block[0] ^= block[1] << 4;
-
-            /* 2 <-11 */
-            block[1] &= 0xF0;
-            block[1] ^= block[5] >>4;
-
-            /* 11 <-14 */
-            block[5] &= 0x0F;
-            block[5] ^= block[7] << 4;
-
-            /* 14 <-15 */
-            block[7] &= 0xF0;
-            block[7] ^= block[7] >> 4;
-
-            /* 15 <-12 */
-            block[7] &= 0x0F;
-            block[7] ^= block[6] << 4;
-
-            /* 12 <-5 */
-            block[6] &= 0xF0;
-            block[6] ^= block[2] >> 4;
-
-            /* 5 <-0 */
-            block[2] &= 0x0F;
-            block[2] ^=i << 4;
-
-            i = block[1];
-
-            /*3 <-6 */
-            block[1] &= 0x0F;
-            block[1] ^= block[3] << 4;
-
-            /*6 <-9 */
-            block[3] &= 0xF0;
-            block[3] ^= block[4] >> 4;
-
-            /*9 <-10 */
-            block[4] &= 0x0F;
-            block[4] ^= block[5] << 4;
-
-            /* 10 <-13 */
-            block[5] &= 0xF0;
-            block[5] ^= block[6] >> 4;
-
-            /* 13 <-8 */
-            block[6] &= 0x0F;
-            block[6] ^= block[4] << 4;
-
-            /* 8 <-7 */
-            block[4] &= 0xF0;
-            block[4] ^= block[3] >> 4;
-
-            /* 7 <-4 */
-            block[3] &= 0x0F;
-            block[3] ^= block[2] << 4;
-
-            /* 4 <-3 */
-            block[2] &= 0xF0;
-            block[2] ^= i >> 4;
-
+            shuffle(block);
         }
 
         /* F-function */
@@ -198,88 +149,222 @@ namespace block {
                 ) << 4;
             }
 
-            /* Output */
-            i = block[0];
+            inv_shuffle(block);
+        }
 
-            /* 0 <-5 */
-            block[0] &= 0xF0;
-            block[0] ^= block[2] >> 4;
+        for (i = 0; i < 8; i++)
+        {
+            block[i] ^= READ_SBOX_BYTE(
+                    Sbox[
+                            block[i] & 0x0F ^
+                            0x0F & READ_ROUND_KEY_BYTE(
+                                    _key[i / 2]
+                            ) >> (4 * (i % 2))
+                    ]
+            ) << 4;
+        }
 
-            /* 5 <-12 */
-            block[2] &= 0x0F;
-            block[2] ^= block[6] << 4;
+    }
 
-            /* 12 <-15 */
-            block[6] &= 0xF0;
-            block[6] ^= block[7] >> 4;
+    void twine::shuffle(uint8_t *block) {
+        uint8_t i;
 
-            /* 15 <-14  */
-            block[7] &= 0xF;
-            block[7] ^= block[7] << 4;
+        /* Output */
+        i = block[0];
 
-            /* 14 <-11 */
-            block[7] &= 0xF0;
-            block[7] ^= block[5] >> 4;
+        /*0 <-1 */
+        block[0] &= 0xF0;
+        block[0] ^= block[0] >> 4;
 
-            /* 11 <-2 */
-            block[5] &= 0x0F;
-            block[5] ^= block[1] << 4;
+        /*1 <-2 */
+        block[0] &= 0x0F;
+        block[0] ^= block[1] << 4;
 
-            /* 2 <-1 */
-            block[1] &= 0xF0;
-            block[1] ^= block[0] >> 4;
+        /* 2 <-11 */
+        block[1] &= 0xF0;
+        block[1] ^= block[5] >>4;
 
-            /* 1 <-0  */
-            block[0] &= 0x0F;
-            block[0] ^= i << 4;
+        /* 11 <-14 */
+        block[5] &= 0x0F;
+        block[5] ^= block[7] << 4;
 
-            i = block[1];
+        /* 14 <-15 */
+        block[7] &= 0xF0;
+        block[7] ^= block[7] >> 4;
 
-            /* 3 <-4 */
-            block[1] &= 0x0F;
-            block[1] ^= block[2] << 4;
+        /* 15 <-12 */
+        block[7] &= 0x0F;
+        block[7] ^= block[6] << 4;
 
-            /* 4 <-7 */
-            block[2] &= 0xF0;
-            block[2] ^= block[3] >> 4;
+        /* 12 <-5 */
+        block[6] &= 0xF0;
+        block[6] ^= block[2] >> 4;
 
-            /* 7 <-8 */
-            block[3] &= 0x0F;
-            block[3] ^= block[4] << 4;
+        /* 5 <-0 */
+        block[2] &= 0x0F;
+        block[2] ^=i << 4;
 
-            /* 8 <-13 */
-            block[4] &= 0xF0;
-            block[4] ^= block[6] >> 4;
+        i = block[1];
 
-            /* 13 <-10 */
-            block[6] &= 0x0F;
-            block[6] ^= block[5] << 4;
+        /*3 <-6 */
+        block[1] &= 0x0F;
+        block[1] ^= block[3] << 4;
 
-            /* 10 <-9 */
-            block[5] &= 0xF0;
-            block[5] ^= block[4] >> 4;
+        /*6 <-9 */
+        block[3] &= 0xF0;
+        block[3] ^= block[4] >> 4;
 
-            /* 9 <-6 */
-            block[4] &= 0x0F;
-            block[4] ^= block[3] << 4;
+        /*9 <-10 */
+        block[4] &= 0x0F;
+        block[4] ^= block[5] << 4;
 
-            /* 6 <-3 */
-            block[3] &= 0xF0;
-            block[3] ^= i >> 4;
+        /* 10 <-13 */
+        block[5] &= 0xF0;
+        block[5] ^= block[6] >> 4;
 
-        }
+        /* 13 <-8 */
+        block[6] &= 0x0F;
+        block[6] ^= block[4] << 4;
 
-        for (i = 0; i < 8; i++)
-        {
-            block[i] ^= READ_SBOX_BYTE(
-                    Sbox[
-                            block[i] & 0x0F ^
-                            0x0F & READ_ROUND_KEY_BYTE(
-                                    _key[i / 2]
-                            ) >> (4 * (i % 2))
-                    ]
-            ) << 4;
+        /* 8 <-7 */
+        block[4] &= 0xF0;
+        block[4] ^= block[3] >> 4;
+
+        /* 7 <-4 */
+        block[3] &= 0x0F;
+        block[3] ^= block[2] << 4;
+
+        /* 4 <-3 */
+        block[2] &= 0xF0;
+        block[2] ^= i >> 4;
+    }
+
+    void twine::inv_shuffle(uint8_t *block) {
+        uint8_t i;
+
+        /* Output */
+        i = block[0];
+
+        /* 0 <-5 */
+        block[0] &= 0xF0;
+        block[0] ^= block[2] >> 4;
+
+        /* 5 <-12 */
+        block[2] &= 0x0F;
+        block[2] ^= block[6] << 4;
+
+        /* 12 <-15 */
+        block[6] &= 0xF0;
+        block[6] ^= block[7] >> 4;
+
+        /* 15 <-14  */
+        block[7] &= 0xF;
+        block[7] ^= block[7] << 4;
+
+        /* 14 <-11 */
+        block[7] &= 0xF0;
+        block[7] ^= block[5] >> 4;
+
+        /* 11 <-2 */
+        block[5] &= 0x0F;
+        block[5] ^= block[1] << 4;
+
+        /* 2 <-1 */
+        block[1] &= 0xF0;
+        block[1] ^= block[0] >> 4;
+
+        /* 1 <-0  */
+        block[0] &= 0x0F;
+        block[0] ^= i << 4;
+
+        i = block[1];
+
+        /* 3 <-4 */
+        block[1] &= 0x0F;
+        block[1] ^= block[2] << 4;
+
+        /* 4 <-7 */
+        block[2] &= 0xF0;
+        block[2] ^= block[3] >> 4;
+
+        /* 7 <-8 */
+        block[3] &= 0x0F;
+        block[3] ^= block[4] << 4;
+
+        /* 8 <-13 */
+        block[4] &= 0xF0;
+        block[4] ^= block[6] >> 4;
+
+        /* 13 <-10 */
+        block[6] &= 0x0F;
+        block[6] ^= block[5] << 4;
+
+        /* 10 <-9 */
+        block[5] &= 0xF0;
+        block[5] ^= block[4] >> 4;
+
+        /* 9 <-6 */
+        block[4] &= 0x0F;
+        block[4] ^= block[3] << 4;
+
+        /* 6 <-3 */
+        block[3] &= 0xF0;
+        block[3] ^= i >> 4;
+    }
+
+    void twine::F_bitsliced(bitslice::word<64> &state, const size_t r) const {
+        for (unsigned i = 0; i < 8; ++i) {
+            const uint8_t k = 0x0F & READ_ROUND_KEY_BYTE(_key[r * 4 + i / 2]) >> (4 * (i % 2));
+
+            // S-box of the low nibble and the key, XORed onto the high nibble
+            bitslice::slice x[4];
+            for (unsigned b = 0; b < 4; ++b)
+                x[b] = state.s[8 * i + b] ^ bitslice::broadcast(k >> b);
+            bitslice::sbox4<twine_sbox>(x);
+            for (unsigned b = 0; b < 4; ++b)
+                state.s[8 * i + 4 + b] ^= x[b];
         }
+    }
 
+    size_t twine::encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > TWINE_NUMBER_OF_ROUNDS)
+            return 0;
+
+        // the nibble shuffle is a bit permutation
+        static const bitslice::linear_map<64> perm([](const uint64_t x) {
+            uint8_t block[TWINE_BLOCK_SIZE];
+            store64(x, block);
+            shuffle(block);
+            return load64(block);
+        });
+
+        return bitslice::crypt_blocks<TWINE_BLOCK_SIZE, 64>(in, out, nblocks, [this](bitslice::word<64> *state) {
+            size_t r;
+            for (r = 0; r < _rounds; r++) {
+                F_bitsliced(*state, r);
+                *state = perm(*state);
+            }
+            F_bitsliced(*state, r);
+        });
+    }
+
+    size_t twine::decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) {
+        if (_rounds > TWINE_NUMBER_OF_ROUNDS)
+            return 0;
+
+        static const bitslice::linear_map<64> inv_perm([](const uint64_t x) {
+            uint8_t block[TWINE_BLOCK_SIZE];
+            store64(x, block);
+            inv_shuffle(block);
+            return load64(block);
+        });
+
+        return bitslice::crypt_blocks<TWINE_BLOCK_SIZE, 64>(in, out, nblocks, [this](bitslice::word<64> *state) {
+            for (size_t r = _rounds; r > 0; r--) {
+                F_bitsliced(*state, r);
+                *state = inv_perm(*state);
+            }
+            F_bitsliced(*state, 0);
+        });
     }
-}
\ No newline at end of file
+}
@@ -7,6 +7,7 @@
 
 #include <streams/block/ciphers/lightweight/lightweight.h>
 #include <streams/block/ciphers/lightweight/common/cipher.h>
+#include <streams/block/ciphers/lightweight/common/bitslice.h>
 
 #define DATA_SBOX_BYTE RAM_DATA_BYTE
 #define READ_SBOX_BYTE READ_RAM_DATA_BYTE
@@ -45,10 +46,22 @@ namespace block {
             0x09, 0x12, 0x24
         };
 
-    public:
-        twine(size_t rounds) : lightweight(rounds) {}
+        /* nibble permutation at the end of an encryption round, and its inverse */
+        static void shuffle(uint8_t *block);
+
+        static void inv_shuffle(uint8_t *block);
+
+        /* F-function of round r on the sliced state */
+        void F_bitsliced(bitslice::word<64> &state, const size_t r) const;
+
+        size_t encrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
 
-        void keysetup(const std::uint8_t *key, const std::uint64_t keysize) override;
+        size_t decrypt_bitsliced(const uint8_t *in, uint8_t *out, const size_t nblocks) override;
+
+        void key_schedule(const uint8_t *key) override;
+
+    public:
+        twine(size_t rounds) : lightweight(rounds, TWINE_KEY_SIZE) {}
 
         void Encrypt(uint8_t *block) override;
 
@@ -34,8 +34,6 @@
 namespace block {
 namespace mars {
 
-static unsigned MARS_N_ROUNDS;
-
 /* The low level mars routines are completely WORD oriented, and 
  * endian neutral. The high level NIST routines provide BYTE oriented
  * inputs and outputs, thus raising the endian issue when converting
@@ -457,7 +455,7 @@ void backwards_mix_round(WORD data[], int src, int dst1, int dst2, int dst3)
 
 
 /* The basic mars encryption: */
-void mars_encrypt(WORD *in, WORD *out, WORD *key)
+void mars_encrypt(WORD *in, WORD *out, WORD *key, unsigned rounds)
 {
     int i;
     IVT_DEBUG(in[0],in[1],in[2],in[3]);
@@ -484,7 +482,7 @@ void mars_encrypt(WORD *in, WORD *out, WORD *key)
     }
 
     /* then sixteen mars encrypting rounds  */
-    for (i = 0; i < 16 and i < MARS_N_ROUNDS; i++) {
+    for (i = 0; i < 16 and i < rounds; i++) {
         WORD L, M, R;
 	int src = i % 4;
 	int dst1 = (i+1) % 4; 
@@ -531,7 +529,7 @@ void mars_encrypt(WORD *in, WORD *out, WORD *key)
 
 
 /* mars decryption is simply encryption in reverse */
-void mars_decrypt(WORD *in, WORD *out, WORD *key)
+void mars_decrypt(WORD *in, WORD *out, WORD *key, unsigned rounds)
 {
     int i;
     IVT_DEBUG(in[0],in[1],in[2],in[3]);
@@ -558,7 +556,7 @@ void mars_decrypt(WORD *in, WORD *out, WORD *key)
     }
     
     /* then sixteen mars decrypting rounds         */
-    int x = MARS_N_ROUNDS < 16 ? MARS_N_ROUNDS : 16; // min
+    int x = rounds < 16 ? rounds : 16; // min
     for (i = x - 1; i >= 0; i--) {
         WORD L, M, R;
 	int src = i % 4;
@@ -690,7 +688,7 @@ int cipherInit(cipherInstance *cipher, BYTE mode, char *IV)
 int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input, 
                  int inputLen, BYTE *outBuffer, unsigned rounds)
 {
-    MARS_N_ROUNDS = rounds;
+    cipher->rounds = rounds;
     WORD tmp[4];
     int i;
 
@@ -701,13 +699,13 @@ int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 tmp[1] = BSWAP(*(WORD *)(input+i+4)); 
                 tmp[2] = BSWAP(*(WORD *)(input+i+8)); 
                 tmp[3] = BSWAP(*(WORD *)(input+i+12)); 
-                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E);
+                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 *(WORD *)(outBuffer+i+0) = BSWAP(*(WORD *)(outBuffer+i+0)); 
                 *(WORD *)(outBuffer+i+4) = BSWAP(*(WORD *)(outBuffer+i+4)); 
                 *(WORD *)(outBuffer+i+8) = BSWAP(*(WORD *)(outBuffer+i+8)); 
                 *(WORD *)(outBuffer+i+12) = BSWAP(*(WORD *)(outBuffer+i+12)); 
 #           else
-                mars_encrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E);
+                mars_encrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E,cipher->rounds);
 #           endif
         }
     }
@@ -718,7 +716,7 @@ int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 tmp[1] = BSWAP(*(WORD *)(input+i+4)) ^ cipher->CIV[1]; 
                 tmp[2] = BSWAP(*(WORD *)(input+i+8)) ^ cipher->CIV[2]; 
                 tmp[3] = BSWAP(*(WORD *)(input+i+12)) ^ cipher->CIV[3]; 
-                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E);
+                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 cipher->CIV[0] = *(WORD *)(outBuffer+i+0);
                 cipher->CIV[1] = *(WORD *)(outBuffer+i+4);
                 cipher->CIV[2] = *(WORD *)(outBuffer+i+8);
@@ -732,7 +730,7 @@ int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 tmp[1] = *(WORD *)(input+i+4) ^ cipher->CIV[1]; 
                 tmp[2] = *(WORD *)(input+i+8) ^ cipher->CIV[2]; 
                 tmp[3] = *(WORD *)(input+i+12) ^ cipher->CIV[3]; 
-                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E);
+                mars_encrypt(tmp,(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 cipher->CIV[0] = *(WORD *)(outBuffer+i+0);
                 cipher->CIV[1] = *(WORD *)(outBuffer+i+4);
                 cipher->CIV[2] = *(WORD *)(outBuffer+i+8);
@@ -750,7 +748,7 @@ int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
         if(inputLen != 1)
             return(BAD_CIPHER_MODE);
 
-        mars_encrypt(cipher->CIV, ECIV, key->E);
+        mars_encrypt(cipher->CIV, ECIV,key->E,cipher->rounds);
         outBuffer[0] = (input[0] & 1)^(ECIV[0]>>31);
         cipher->CIV[0] = (cipher->CIV[0]<<1)|(cipher->CIV[1] & 0x80000000);
         cipher->CIV[1] = (cipher->CIV[1]<<1)|(cipher->CIV[2] & 0x80000000);
@@ -766,7 +764,7 @@ int blockEncrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
 int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                  int inputLen, BYTE *outBuffer, unsigned rounds)
 {
-    MARS_N_ROUNDS = rounds;
+    cipher->rounds = rounds;
     int i;
 
     if (cipher->mode == MODE_ECB) {
@@ -777,13 +775,13 @@ int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 tmp[1] = BSWAP(*(WORD *)(input+i+4)); 
                 tmp[2] = BSWAP(*(WORD *)(input+i+8)); 
                 tmp[3] = BSWAP(*(WORD *)(input+i+12)); 
-                mars_decrypt(tmp,(WORD *)(outBuffer+i),key->E);
+                mars_decrypt(tmp,(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 *(WORD *)(outBuffer+i+0) = BSWAP(*(WORD *)(outBuffer+i+0)); 
                 *(WORD *)(outBuffer+i+4) = BSWAP(*(WORD *)(outBuffer+i+4)); 
                 *(WORD *)(outBuffer+i+8) = BSWAP(*(WORD *)(outBuffer+i+8)); 
                 *(WORD *)(outBuffer+i+12) = BSWAP(*(WORD *)(outBuffer+i+12)); 
 #           else
-                mars_decrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E);
+                mars_decrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E,cipher->rounds);
 #           endif
         }
     }
@@ -795,7 +793,7 @@ int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 tmp[1] = BSWAP(*(WORD *)(input+i+4)); 
                 tmp[2] = BSWAP(*(WORD *)(input+i+8)); 
                 tmp[3] = BSWAP(*(WORD *)(input+i+12)); 
-                mars_decrypt(tmp,(WORD *)(outBuffer+i),key->E);
+                mars_decrypt(tmp,(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 *(WORD *)(outBuffer+i+0) = BSWAP(*(WORD *)(outBuffer+i+0)
                     ^ cipher->CIV[0]); 
                 *(WORD *)(outBuffer+i+4) = BSWAP(*(WORD *)(outBuffer+i+4)
@@ -809,7 +807,7 @@ int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
                 cipher->CIV[2] = tmp[2];
                 cipher->CIV[3] = tmp[3];
 #           else
-                mars_decrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E);
+                mars_decrypt((WORD *)(input+i),(WORD *)(outBuffer+i),key->E,cipher->rounds);
                 *(WORD *)(outBuffer+i+0) ^= cipher->CIV[0];
                 *(WORD *)(outBuffer+i+4) ^= cipher->CIV[1];
                 *(WORD *)(outBuffer+i+8) ^= cipher->CIV[2];
@@ -831,7 +829,7 @@ int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
         if(inputLen != 1)
             return(BAD_CIPHER_MODE);
 
-        mars_encrypt(cipher->CIV, ECIV, key->E);
+        mars_encrypt(cipher->CIV, ECIV,key->E,cipher->rounds);
         outBuffer[0] = (input[0] & 1)^(ECIV[0]>>31);
         cipher->CIV[0] = (cipher->CIV[0]<<1)|(cipher->CIV[1] & 0x80000000);
         cipher->CIV[1] = (cipher->CIV[1]<<1)|(cipher->CIV[2] & 0x80000000);
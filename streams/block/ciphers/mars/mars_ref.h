@@ -71,6 +71,7 @@ typedef struct {
     BYTE mode;             /*  MODE_ECB, MODE_CBC, or MODE_CFB1             */
     BYTE IV[MAX_IV_SIZE];  /*  initial binary IV BYTE for chaining          */
     WORD CIV[NUM_DATA];    /*  IBM addition: current IV in binary WORDs     */
+    unsigned rounds;       /*  number of core rounds used by blockEn/Decrypt */
 } cipherInstance;
 
 /*  NIST High level function protoypes  */
@@ -99,10 +100,10 @@ int blockDecrypt(cipherInstance *cipher, keyInstance *key, BYTE *input,
 int mars_setup(int k, WORD *kp, WORD *ep);        
 
 /* The basic mars encryption of one block (of NUM_DATA WORDS) */
-void mars_encrypt(WORD *in, WORD *out, WORD *ep);         
+void mars_encrypt(WORD *in, WORD *out, WORD *ep, unsigned rounds);         
 
 /* mars decryption is simply encryption in reverse */
-void mars_decrypt(WORD *in, WORD *out, WORD *ep);                       
+void mars_decrypt(WORD *in, WORD *out, WORD *ep, unsigned rounds);                       
 
 
 } // namespace mars
@@ -7,7 +7,7 @@
 
 #include "misty1.h"
 
-const int BLOCK_SIZE = 64;
+const int BLOCK_SIZE = 8; // in bytes, used as the stride between blocks
 
 /**
 * Load a big-endian word
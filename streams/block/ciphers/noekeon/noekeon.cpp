@@ -7,7 +7,7 @@
  
  #include "noekeon.h"
 
- const int BLOCK_SIZE = 128;
+ const int BLOCK_SIZE = 16; // in bytes, used as the stride between blocks
 
  /**
  * Bit rotation left by a compile-time constant amount
@@ -8,6 +8,8 @@ namespace block {
     class noekeon_factory : public block_cipher {
 
     public:
+        static const std::size_t block_len = 16;
+
         noekeon_factory(unsigned int rounds)
                 : block_cipher(rounds)
         {}
@@ -21,6 +23,16 @@ namespace block {
 
         void decrypt(const std::uint8_t* ciphertext,
                      std::uint8_t* plaintext) override;
+
+        void encrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
+
+        void decrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
     private:
         Botan::Noekeon _noekeon;
     };
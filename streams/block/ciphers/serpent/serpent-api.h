@@ -196,6 +196,7 @@ typedef struct {
   /*  Add any algorithm specific parameters needed here  */
   int   blockSize;    	/* Sample: Handles non-128 bit block sizes
                            (if available) */
+  unsigned rounds;      /* Number of rounds, set by blockEncrypt/blockDecrypt */
 } cipherInstance;
 
 
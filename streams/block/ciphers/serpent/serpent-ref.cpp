@@ -31,8 +31,6 @@
 namespace block {
 namespace serpent {
 
-static unsigned SERPENT_N_ROUNDS = 32; /* # of rounds */
-
 /* -------------------------------------------------- */
 EMBED_RCS(serpent_ref_c,
           "$Id: serpent-ref.c,v 1.42 1998/06/10 13:50:31 fms Exp $")
@@ -151,7 +149,7 @@ int cipherInit(cipherInstance* cipher, BYTE mode, char* IV) {
 
 int blockEncrypt(cipherInstance* cipher, keyInstance* key, BYTE* input, int
                  inputLen, BYTE* outBuffer, unsigned rounds) {
-    SERPENT_N_ROUNDS = rounds;
+    cipher->rounds = rounds;
   /* Uses the cipherInstance object and the keyInstance object to encrypt
     one block of data in the input buffer. The output (the encrypted data)
     is returned in outBuffer, which is the same size as inputLen. The
@@ -194,7 +192,7 @@ int blockEncrypt(cipherInstance* cipher, keyInstance* key, BYTE* input, int
 
 int blockDecrypt(cipherInstance* cipher, keyInstance* key, BYTE* input, int
                  inputLen, BYTE* outBuffer, unsigned rounds) {
-    SERPENT_N_ROUNDS = rounds;
+    cipher->rounds = rounds;
   /* Uses the cipherInstance object and the keyInstance object to decrypt
      one block of data in the input buffer. The output (the decrypted data)
      is returned in outBuffer, which is the same size as inputLen. The
@@ -241,8 +239,8 @@ int blockEncryptOrDecrypt(cipherInstance* cipher, keyInstance* key, BYTE*
      same as inputLen). */
   
   for (i=0; i<numBlocks; i++) {
-    result = doOneBlock((WORD*)(input + i*WORDS_PER_BLOCK), 
-               (WORD*)(outBuffer + i*WORDS_PER_BLOCK), cipher, key);
+    result = doOneBlock((WORD*)(input + i*BYTES_PER_BLOCK), 
+               (WORD*)(outBuffer + i*BYTES_PER_BLOCK), cipher, key);
     if (result != TRUE) {
       return BAD_CIPHER_STATE;
     }
@@ -268,13 +266,13 @@ int doOneBlock(BLOCK input, BLOCK output,
     case DIR_ENCRYPT:
       switch (cipher->mode) {
         case MODE_ECB: 
-          encryptGivenKHat(input, key->KHat, output);
+          encryptGivenKHat(input, key->KHat, output, cipher->rounds);
           break;
         case MODE_CBC:
           for (i=0; i < WORDS_PER_BLOCK; i++) {
             temp[i] = input[i] ^ ((WORD*) cipher->IV)[i];
           }
-          encryptGivenKHat(temp, key->KHat, output);
+          encryptGivenKHat(temp, key->KHat, output, cipher->rounds);
           for (i=0; i < WORDS_PER_BLOCK; i++) {
             ((WORD*) (cipher->IV))[i] = output[i];
           }
@@ -297,7 +295,7 @@ int doOneBlock(BLOCK input, BLOCK output,
              could also encrypt a non-round number of bits. */
 
           for (i=0; i<BITS_PER_BLOCK; i++) {
-            encryptGivenKHat((WORD*)(cipher->IV), key->KHat, temp);
+            encryptGivenKHat((WORD*)(cipher->IV), key->KHat, temp, cipher->rounds);
             plainTextBit = getBit(input, i);
             cipherTextBit = getBit(temp, BITS_PER_BLOCK-1) ^ plainTextBit;
             setBit(output, i, cipherTextBit);
@@ -311,10 +309,10 @@ int doOneBlock(BLOCK input, BLOCK output,
     case DIR_DECRYPT: 
       switch (cipher->mode) {
         case MODE_ECB: 
-          decryptGivenKHat(input, key->KHat, output);
+          decryptGivenKHat(input, key->KHat, output, cipher->rounds);
           break;
         case MODE_CBC:
-          decryptGivenKHat(input, key->KHat, temp);
+          decryptGivenKHat(input, key->KHat, temp, cipher->rounds);
           for (i=0; i < WORDS_PER_BLOCK; i++) {
             output[i] = temp[i] ^ ((WORD*) cipher->IV)[i];
           }
@@ -325,7 +323,7 @@ int doOneBlock(BLOCK input, BLOCK output,
         case MODE_CFB1:
           /* The comments on the encryption side apply. See above. */
           for (i=0; i<BITS_PER_BLOCK; i++) {
-            encryptGivenKHat((WORD*)(cipher->IV), key->KHat, temp);
+            encryptGivenKHat((WORD*)(cipher->IV), key->KHat, temp, cipher->rounds);
             /* NB: yes, in CFB the cipher is used in encryption mode even
                when decrypting. */
             cipherTextBit = getBit(input, i);
@@ -537,7 +535,7 @@ void LTInverse(BLOCK output, BLOCK input) {
   applyXorTable(LTTableInverse, output, input);
 }
 
-void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1) {
+void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1, unsigned rounds) {
   /* Apply round 'i' to 'BHati', yielding 'BHatiPlus1'. Do this using the
     appropriately numbered subkey(s) from 'KHat'. NB: it is allowed for
     BHatiPlus1 to point to the same memory as BHati. */
@@ -546,12 +544,12 @@ void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1) {
 
   xorBlock(BHati, KHat[i], xored);
   SHat(i, xored, SHati);
-  if ( (0 <= i) && (i <= SERPENT_N_ROUNDS-2) ) {
+  if ( (0 <= i) && (i <= rounds-2) ) {
     LT(SHati, BHatiPlus1);
-  } else if (i == SERPENT_N_ROUNDS-1) {
-    xorBlock(SHati, KHat[SERPENT_N_ROUNDS], BHatiPlus1);
+  } else if (i == rounds-1) {
+    xorBlock(SHati, KHat[rounds], BHatiPlus1);
   } else {
-    printf("ERROR: round %d is out of 0..%d range", i, SERPENT_N_ROUNDS-1);
+    printf("ERROR: round %d is out of 0..%d range", i, rounds-1);
     exit(1);
     /* Printf and exit is disgusting--if we were programming in a sensible
        language, we'd have exceptions. Shall I make the code less readable
@@ -565,19 +563,19 @@ void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1) {
 #endif
 }
 
-void RInverse(int i, BLOCK BHatiPlus1, keySchedule KHat, BLOCK BHati) {
+void RInverse(int i, BLOCK BHatiPlus1, keySchedule KHat, BLOCK BHati, unsigned rounds) {
   /* Apply round 'i' in reverse to 'BHatiPlus1', yielding 'BHati'. Do this
     using the appropriately numbered subkey(s) from 'KHat'. NB: it is
     allowed for BHati to point to the same memory as BHatiPlus1. */
 
   BLOCK xored, SHati;
 
-  if ( (0 <= i) && (i <= SERPENT_N_ROUNDS-2) ) {
+  if ( (0 <= i) && (i <= rounds-2) ) {
     LTInverse(BHatiPlus1, SHati);
-  } else if (i == SERPENT_N_ROUNDS-1) {
-    xorBlock(BHatiPlus1, KHat[SERPENT_N_ROUNDS], SHati);
+  } else if (i == rounds-1) {
+    xorBlock(BHatiPlus1, KHat[rounds], SHati);
   } else {
-    printf("ERROR: round %d is out of 0..%d range", i, SERPENT_N_ROUNDS-1);
+    printf("ERROR: round %d is out of 0..%d range", i, rounds-1);
     exit(1);
   }
   SHatInverse(i, SHati, xored);
@@ -678,7 +676,7 @@ void makeSubkeys(KEY userKey, keySchedule KHat) {
 }
 
 
-void encryptGivenKHat(BLOCK plainText, keySchedule KHat, BLOCK cipherText) {
+void encryptGivenKHat(BLOCK plainText, keySchedule KHat, BLOCK cipherText, unsigned rounds) {
   /* Encrypt 'plainText' with 'KHat', using the normal (non-bitslice)
      algorithm, yielding 'cipherText'. */
 
@@ -686,13 +684,13 @@ void encryptGivenKHat(BLOCK plainText, keySchedule KHat, BLOCK cipherText) {
   int i;
 
   IP(plainText, BHat);
-  for (i = 0; i < SERPENT_N_ROUNDS; i++) {
-    R(i, BHat, KHat, BHat);
+  for (i = 0; i < rounds; i++) {
+    R(i, BHat, KHat, BHat, rounds);
   }
   FP(BHat, cipherText);
 }
 
-void decryptGivenKHat(BLOCK cipherText, keySchedule KHat, BLOCK plainText) {
+void decryptGivenKHat(BLOCK cipherText, keySchedule KHat, BLOCK plainText, unsigned rounds) {
   /* Decrypt 'cipherText' with 'KHat', using the normal (non-bitslice)
      algorithm, yielding 'plainText'. */
 
@@ -700,8 +698,8 @@ void decryptGivenKHat(BLOCK cipherText, keySchedule KHat, BLOCK plainText) {
   int i;
 
   FPInverse(cipherText, BHat);
-  for (i = SERPENT_N_ROUNDS-1; i >=0; i--) {
-    RInverse(i, BHat, KHat, BHat);
+  for (i = rounds-1; i >=0; i--) {
+    RInverse(i, BHat, KHat, BHat, rounds);
   }
   IPInverse(BHat, plainText);
 }
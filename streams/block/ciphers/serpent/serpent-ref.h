@@ -46,12 +46,12 @@ void SHat(int box, BLOCK input, BLOCK output);
 void SHatInverse(int box, BLOCK output, BLOCK input);
 void LT(BLOCK input, BLOCK output);
 void LTInverse(BLOCK output, BLOCK input);
-void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1);
-void RInverse(int i, BLOCK BHatiPlus1, keySchedule KHat, BLOCK BHati);
+void R(int i, BLOCK BHati, keySchedule KHat, BLOCK BHatiPlus1, unsigned rounds);
+void RInverse(int i, BLOCK BHatiPlus1, keySchedule KHat, BLOCK BHati, unsigned rounds);
 void makeSubkeysBitslice(KEY userKey, keySchedule K);
 void makeSubkeys(KEY userKey, keySchedule KHat);
-void encryptGivenKHat(BLOCK plainText, keySchedule KHat, BLOCK cipherText);
-void decryptGivenKHat(BLOCK cipherText, keySchedule KHat, BLOCK plainText);
+void encryptGivenKHat(BLOCK plainText, keySchedule KHat, BLOCK cipherText, unsigned rounds);
+void decryptGivenKHat(BLOCK cipherText, keySchedule KHat, BLOCK plainText, unsigned rounds);
 
 void shortToLongKey(KEY key, int bitsInShortKey);
 
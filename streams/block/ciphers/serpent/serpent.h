@@ -66,6 +66,30 @@ namespace serpent {
                          mutable_ciphertext, block_len * 8,
                          plaintext, _rounds);
         }
+
+        // the NIST API takes any number of whole blocks; it does not write its input,
+        // and every block is read into a temporary first, so in == out is fine
+        void encrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override {
+            if (block_size != BYTES_PER_BLOCK)
+                return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+            blockEncrypt(&_ctx.cipher, &_ctx.key,
+                         const_cast<std::uint8_t*>(in), int(nblocks * BITS_PER_BLOCK),
+                         out, _rounds);
+        }
+
+        void decrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override {
+            if (block_size != BYTES_PER_BLOCK)
+                return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+            blockDecrypt(&_ctx.cipher, &_ctx.key,
+                         const_cast<std::uint8_t*>(in), int(nblocks * BITS_PER_BLOCK),
+                         out, _rounds);
+        }
     };
 
 } // namespace serpent
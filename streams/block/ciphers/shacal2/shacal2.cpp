@@ -10,7 +10,7 @@
 #include <cstring>
 #include "shacal2.h"
 
-const int BLOCK_SIZE = 256;
+const int BLOCK_SIZE = 32; // in bytes, used as the stride between blocks
 
 /**
 * Zero out some bytes
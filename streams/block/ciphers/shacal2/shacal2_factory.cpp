@@ -24,4 +24,22 @@ namespace block {
         _shacal2.decrypt_n(ciphertext, plaintext, 1, _rounds);
     }
 
-}
\ No newline at end of file
+    void shacal2_factory::encrypt_blocks(const std::uint8_t* in,
+                                         std::uint8_t* out,
+                                         const std::size_t nblocks,
+                                         const std::size_t block_size) {
+        if (block_size != block_len)
+            return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+        _shacal2.encrypt_n(in, out, nblocks, _rounds);
+    }
+
+    void shacal2_factory::decrypt_blocks(const std::uint8_t* in,
+                                         std::uint8_t* out,
+                                         const std::size_t nblocks,
+                                         const std::size_t block_size) {
+        if (block_size != block_len)
+            return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+        _shacal2.decrypt_n(in, out, nblocks, _rounds);
+    }
+
+}
@@ -163,6 +163,23 @@ public:
     void decrypt(const std::uint8_t* ciphertext,
                  std::uint8_t* plaintext) override;
 
+    void encrypt_blocks(const std::uint8_t* in,
+                        std::uint8_t* out,
+                        const std::size_t nblocks,
+                        const std::size_t block_size) override;
+
+    void decrypt_blocks(const std::uint8_t* in,
+                        std::uint8_t* out,
+                        const std::size_t nblocks,
+                        const std::size_t block_size) override;
+
+    bool encrypt_round_sweep(const std::uint8_t* in,
+                             std::uint8_t* const* out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size,
+                             const std::size_t* rounds,
+                             const std::size_t count) override;
+
 private:
     //Functions
     void keySchedule();
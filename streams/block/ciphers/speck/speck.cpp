@@ -319,6 +319,15 @@ void speck::keysetup(const std::uint8_t* key, const uint64_t keysize) {
     endianity_flip(key, rev_key, keysize);
     Speck_Init(_ctx.cipher_object.get(), _ctx.cipher_config, mode_t(ECB), rev_key, nullptr, nullptr);
     _ctx.cipher_object->round_limit = uint8_t(_rounds);
+
+    const Speck_Cipher& cipher = *_ctx.cipher_object;
+    const std::size_t word_bytes = cipher.block_size / 16;
+    const std::size_t stored_keys = sizeof(cipher.key_schedule) / word_bytes;
+    _ctx.round_keys.assign(cipher.round_limit, 0);
+    for (std::size_t i = 0; i < cipher.round_limit && i < stored_keys; ++i) {
+        for (std::size_t j = word_bytes; j-- > 0;)
+            _ctx.round_keys[i] = (_ctx.round_keys[i] << 8) | cipher.key_schedule[i * word_bytes + j];
+    }
 }
 
 void speck::ivsetup(const std::uint8_t* iv, const std::uint64_t ivsize) {
@@ -341,6 +350,160 @@ void speck::decrypt(const std::uint8_t* ciphertext, std::uint8_t* plaintext) {
     endianity_flip(rev_plaintext, plaintext, _ctx.cipher_object->block_size/8);
 }
 
+/**
+ * Multi-block SPECK on native words of Bits bits stored in Word, with the rotation amounts
+ * of the parameter set. Up to `lanes` blocks are processed together with the round loop
+ * outside and the lane loop inside, which the compiler turns into SIMD code (one 256-bit
+ * register per half-block with AVX2).
+ */
+template <typename Word, unsigned Bits, unsigned Alpha, unsigned Beta>
+struct speck_lanes {
+    static const std::size_t lanes = 32 / sizeof(Word);
+    static const std::size_t word_bytes = Bits / 8;
+    static const Word mask = Word(~Word(0) >> (8 * sizeof(Word) - Bits));
+
+    static Word rotl(const Word x, const unsigned r) {
+        return Word(((x << r) | (x >> (Bits - r))) & mask);
+    }
+
+    static Word rotr(const Word x, const unsigned r) {
+        return Word(((x >> r) | (x << (Bits - r))) & mask);
+    }
+
+    // speck::encrypt() reverses the whole block, so x is the big-endian first word
+    static void load(const std::uint8_t* src, Word& x, Word& y) {
+        x = y = 0;
+        for (std::size_t i = 0; i < word_bytes; ++i) {
+            x = Word((x << 8) | src[i]);
+            y = Word((y << 8) | src[word_bytes + i]);
+        }
+    }
+
+    static void store(std::uint8_t* dst, const Word x, const Word y) {
+        for (std::size_t i = 0; i < word_bytes; ++i) {
+            dst[i] = std::uint8_t(x >> (8 * (word_bytes - 1 - i)));
+            dst[word_bytes + i] = std::uint8_t(y >> (8 * (word_bytes - 1 - i)));
+        }
+    }
+
+    static void encrypt(const std::uint64_t* keys, const std::size_t rounds,
+                        const std::uint8_t* in, std::uint8_t* out, const std::size_t nblocks) {
+        encrypt_sweep(keys, &rounds, 1, in, &out, nblocks);
+    }
+
+    // the state after rounds[i] rounds goes to out[i], rounds ascending
+    static void encrypt_sweep(const std::uint64_t* keys, const std::size_t* rounds, const std::size_t count,
+                              const std::uint8_t* in, std::uint8_t* const* out, const std::size_t nblocks) {
+        for (std::size_t b = 0; b < nblocks; b += lanes) {
+            const std::size_t n = nblocks - b < lanes ? nblocks - b : lanes;
+            Word x[lanes] = {0};
+            Word y[lanes] = {0};
+            for (std::size_t l = 0; l < n; ++l)
+                load(in + (b + l) * 2 * word_bytes, x[l], y[l]);
+
+            std::size_t next = 0;
+            for (std::size_t r = 0;; ++r) {
+                for (; next < count && rounds[next] == r; ++next) {
+                    for (std::size_t l = 0; l < n; ++l)
+                        store(out[next] + (b + l) * 2 * word_bytes, x[l], y[l]);
+                }
+                if (next == count)
+                    break;
+
+                const Word k = Word(keys[r]);
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    x[l] = Word(((rotr(x[l], Alpha) + y[l]) ^ k) & mask);
+                    y[l] = Word(rotl(y[l], Beta) ^ x[l]);
+                }
+            }
+        }
+    }
+
+    static void decrypt(const std::uint64_t* keys, const std::size_t rounds,
+                        const std::uint8_t* in, std::uint8_t* out, const std::size_t nblocks) {
+        for (std::size_t b = 0; b < nblocks; b += lanes) {
+            const std::size_t n = nblocks - b < lanes ? nblocks - b : lanes;
+            Word x[lanes] = {0};
+            Word y[lanes] = {0};
+            for (std::size_t l = 0; l < n; ++l)
+                load(in + (b + l) * 2 * word_bytes, x[l], y[l]);
+
+            for (std::size_t r = rounds; r-- > 0;) {
+                const Word k = Word(keys[r]);
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    y[l] = rotr(Word(y[l] ^ x[l]), Beta);
+                    x[l] = rotl(Word(((x[l] ^ k) - y[l]) & mask), Alpha);
+                }
+            }
+
+            for (std::size_t l = 0; l < n; ++l)
+                store(out + (b + l) * 2 * word_bytes, x[l], y[l]);
+        }
+    }
+};
+
+void speck::encrypt_blocks(const std::uint8_t* in,
+                           std::uint8_t* out,
+                           const std::size_t nblocks,
+                           const std::size_t block_size) {
+    const Speck_Cipher& cipher = *_ctx.cipher_object;
+    if (block_size != std::size_t(cipher.block_size / 8))
+        return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+
+    const std::uint64_t* keys = _ctx.round_keys.data();
+    const std::size_t rounds = cipher.round_limit;
+    switch (cipher.block_size) {
+    case 32: return speck_lanes<std::uint16_t, 16, 7, 2>::encrypt(keys, rounds, in, out, nblocks);
+    case 48: return speck_lanes<std::uint32_t, 24, 8, 3>::encrypt(keys, rounds, in, out, nblocks);
+    case 64: return speck_lanes<std::uint32_t, 32, 8, 3>::encrypt(keys, rounds, in, out, nblocks);
+    case 96: return speck_lanes<std::uint64_t, 48, 8, 3>::encrypt(keys, rounds, in, out, nblocks);
+    case 128: return speck_lanes<std::uint64_t, 64, 8, 3>::encrypt(keys, rounds, in, out, nblocks);
+    default: return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+    }
+}
+
+void speck::decrypt_blocks(const std::uint8_t* in,
+                           std::uint8_t* out,
+                           const std::size_t nblocks,
+                           const std::size_t block_size) {
+    const Speck_Cipher& cipher = *_ctx.cipher_object;
+    if (block_size != std::size_t(cipher.block_size / 8))
+        return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+
+    const std::uint64_t* keys = _ctx.round_keys.data();
+    const std::size_t rounds = cipher.round_limit;
+    switch (cipher.block_size) {
+    case 32: return speck_lanes<std::uint16_t, 16, 7, 2>::decrypt(keys, rounds, in, out, nblocks);
+    case 48: return speck_lanes<std::uint32_t, 24, 8, 3>::decrypt(keys, rounds, in, out, nblocks);
+    case 64: return speck_lanes<std::uint32_t, 32, 8, 3>::decrypt(keys, rounds, in, out, nblocks);
+    case 96: return speck_lanes<std::uint64_t, 48, 8, 3>::decrypt(keys, rounds, in, out, nblocks);
+    case 128: return speck_lanes<std::uint64_t, 64, 8, 3>::decrypt(keys, rounds, in, out, nblocks);
+    default: return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+    }
+}
+
+bool speck::encrypt_round_sweep(const std::uint8_t* in,
+                                std::uint8_t* const* out,
+                                const std::size_t nblocks,
+                                const std::size_t block_size,
+                                const std::size_t* rounds,
+                                const std::size_t count) {
+    // every round uses the next word of the same schedule, fewer rounds is a prefix
+    const Speck_Cipher& cipher = *_ctx.cipher_object;
+    if (block_size != std::size_t(cipher.block_size / 8))
+        return false;
+
+    const std::uint64_t* keys = _ctx.round_keys.data();
+    switch (cipher.block_size) {
+    case 32: speck_lanes<std::uint16_t, 16, 7, 2>::encrypt_sweep(keys, rounds, count, in, out, nblocks); return true;
+    case 48: speck_lanes<std::uint32_t, 24, 8, 3>::encrypt_sweep(keys, rounds, count, in, out, nblocks); return true;
+    case 64: speck_lanes<std::uint32_t, 32, 8, 3>::encrypt_sweep(keys, rounds, count, in, out, nblocks); return true;
+    case 96: speck_lanes<std::uint64_t, 48, 8, 3>::encrypt_sweep(keys, rounds, count, in, out, nblocks); return true;
+    case 128: speck_lanes<std::uint64_t, 64, 8, 3>::encrypt_sweep(keys, rounds, count, in, out, nblocks); return true;
+    default: return false;
+    }
+}
+
 void speck::endianity_flip(const uint8_t *source, uint8_t *destination, const size_t length)
 {
     for (size_t i = 0; i < length; ++i)
@@ -7,6 +7,7 @@
 #include "../../block_cipher.h"
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace block {
 
@@ -125,6 +126,8 @@ class speck : public block_cipher {
 
          std::unique_ptr<Speck_Cipher> cipher_object;
          speck_cipher_config_t cipher_config;
+         // key_schedule decoded to words at keysetup, used by the multi-block kernels
+         std::vector<std::uint64_t> round_keys;
     } _ctx;
 
 public:
@@ -142,6 +145,23 @@ public:
     void decrypt(const std::uint8_t* ciphertext,
                  std::uint8_t* plaintext) override;
 
+    void encrypt_blocks(const std::uint8_t* in,
+                        std::uint8_t* out,
+                        const std::size_t nblocks,
+                        const std::size_t block_size) override;
+
+    void decrypt_blocks(const std::uint8_t* in,
+                        std::uint8_t* out,
+                        const std::size_t nblocks,
+                        const std::size_t block_size) override;
+
+    bool encrypt_round_sweep(const std::uint8_t* in,
+                             std::uint8_t* const* out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size,
+                             const std::size_t* rounds,
+                             const std::size_t count) override;
+
 private:
     void endianity_flip(const std::uint8_t* source, std::uint8_t* destination, const size_t length);
 };
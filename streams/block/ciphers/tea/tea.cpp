@@ -59,4 +59,78 @@ namespace block {
         for (int j = 0; j < 2; j++)
                 u32_to_u8_copy(plaintext + 4 * j, input[j]);
     }
+
+    void tea::encrypt_blocks(const std::uint8_t* in,
+                             std::uint8_t* out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size) {
+        if (block_size != block_len)
+            return block_cipher::encrypt_blocks(in, out, nblocks, block_size);
+
+        std::size_t i = 0;
+        for (; i + lanes <= nblocks; i += lanes) {
+            const std::uint8_t* src = in + i * block_len;
+            std::uint8_t* dst = out + i * block_len;
+            std::uint32_t v0[lanes], v1[lanes];
+            for (std::size_t l = 0; l < lanes; l++) {
+                v0[l] = u8_to_u32_copy(src + block_len * l);
+                v1[l] = u8_to_u32_copy(src + block_len * l + 4);
+            }
+
+            std::uint32_t sum = 0;
+            for (unsigned j = 0; j < _rounds; j++) {
+                sum += _delta;
+                for (std::size_t l = 0; l < lanes; l++)
+                    v0[l] += ((v1[l] << 4) + _ctx.key[0]) ^ (v1[l] + sum) ^
+                             ((v1[l] >> 5) + _ctx.key[1]);
+                for (std::size_t l = 0; l < lanes; l++)
+                    v1[l] += ((v0[l] << 4) + _ctx.key[2]) ^ (v0[l] + sum) ^
+                             ((v0[l] >> 5) + _ctx.key[3]);
+            }
+
+            for (std::size_t l = 0; l < lanes; l++) {
+                u32_to_u8_copy(dst + block_len * l, v0[l]);
+                u32_to_u8_copy(dst + block_len * l + 4, v1[l]);
+            }
+        }
+        for (; i < nblocks; i++)
+            tea::encrypt(in + i * block_len, out + i * block_len);
+    }
+
+    void tea::decrypt_blocks(const std::uint8_t* in,
+                             std::uint8_t* out,
+                             const std::size_t nblocks,
+                             const std::size_t block_size) {
+        if (block_size != block_len)
+            return block_cipher::decrypt_blocks(in, out, nblocks, block_size);
+
+        std::size_t i = 0;
+        for (; i + lanes <= nblocks; i += lanes) {
+            const std::uint8_t* src = in + i * block_len;
+            std::uint8_t* dst = out + i * block_len;
+            std::uint32_t v0[lanes], v1[lanes];
+            for (std::size_t l = 0; l < lanes; l++) {
+                v0[l] = u8_to_u32_copy(src + block_len * l);
+                v1[l] = u8_to_u32_copy(src + block_len * l + 4);
+            }
+
+            std::uint32_t sum = _delta * _rounds;
+            for (unsigned j = 0; j < _rounds; j++) {
+                for (std::size_t l = 0; l < lanes; l++)
+                    v1[l] -= ((v0[l] << 4) + _ctx.key[2]) ^ (v0[l] + sum) ^
+                             ((v0[l] >> 5) + _ctx.key[3]);
+                for (std::size_t l = 0; l < lanes; l++)
+                    v0[l] -= ((v1[l] << 4) + _ctx.key[0]) ^ (v1[l] + sum) ^
+                             ((v1[l] >> 5) + _ctx.key[1]);
+                sum -= _delta;
+            }
+
+            for (std::size_t l = 0; l < lanes; l++) {
+                u32_to_u8_copy(dst + block_len * l, v0[l]);
+                u32_to_u8_copy(dst + block_len * l + 4, v1[l]);
+            }
+        }
+        for (; i < nblocks; i++)
+            tea::decrypt(in + i * block_len, out + i * block_len);
+    }
 }
@@ -21,6 +21,14 @@ namespace block {
         } _ctx;
 
     public:
+        static const std::size_t block_len = 8;
+
+        /**
+         * Number of independent blocks advanced together by encrypt_blocks() and
+         * decrypt_blocks(), the lane loops are vectorised by the compiler.
+         */
+        static const std::size_t lanes = 4;
+
         tea(std::size_t rounds)
             : block_cipher(rounds) {}
 
@@ -33,5 +41,15 @@ namespace block {
 
         void decrypt(const std::uint8_t* ciphertext,
                      std::uint8_t* plaintext) override;
+
+        void encrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
+
+        void decrypt_blocks(const std::uint8_t* in,
+                            std::uint8_t* out,
+                            const std::size_t nblocks,
+                            const std::size_t block_size) override;
     };
 }
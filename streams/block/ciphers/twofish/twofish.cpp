@@ -43,8 +43,6 @@ Mean:          378 cycles =    67.8 mbits/sec
 namespace block {
 namespace twofish {
 
-static unsigned TWOFISH_N_ROUNDS = 16;
-
 #define Q_TABLES
 #define M_TABLE
 #define MK_TABLE
@@ -57,10 +55,6 @@ char **cipher_name()
     return alg_name;
 }
 
-u4byte  k_len;
-u4byte  l_key[40];
-u4byte  s_key[4];
-
 /* finite field arithmetic for GF(2**8) with the modular    */
 /* polynomial x^8 + x^6 + x^5 + x^3 + 1 (0x169)             */
 
@@ -109,7 +103,6 @@ u1byte qp(const u4byte n, const u1byte x)
 
 #ifdef  Q_TABLES
 
-u4byte  qt_gen = 0;
 u1byte  q_tab[2][256];
 
 #define q(n,x)  q_tab[n][x]
@@ -132,7 +125,6 @@ void gen_qtab(void)
 
 #ifdef  M_TABLE
 
-u4byte  mt_gen = 0;
 u4byte  m_tab[4][256];
 
 void gen_mtab(void)
@@ -187,7 +179,7 @@ void gen_mtab(void)
 
 #endif
 
-u4byte h_fun(const u4byte x, const u4byte key[])
+u4byte h_fun(const u4byte x, const u4byte key[], const u4byte k_len)
 {   u4byte  b0, b1, b2, b3;
 
 #ifndef M_TABLE
@@ -231,10 +223,8 @@ u4byte h_fun(const u4byte x, const u4byte key[])
 
 #ifdef  MK_TABLE
 
-#ifdef  ONE_STEP
-u4byte  mk_tab[4][256];
-#else
-u1byte  sb[4][256];
+#ifndef ONE_STEP
+#error "only the ONE_STEP variant keeps the key dependent tables in twofish_ctx"
 #endif
 
 #define q20(x)  q(0,q(0,x) ^ byte(key[1],0)) ^ byte(key[0],0)
@@ -252,18 +242,18 @@ u1byte  sb[4][256];
 #define q42(x)  q(1,q(0,q(0, q(0, x) ^ byte(key[3],2)) ^ byte(key[2],2)) ^ byte(key[1],2)) ^ byte(key[0],2)
 #define q43(x)  q(1,q(1,q(0, q(1, x) ^ byte(key[3],3)) ^ byte(key[2],3)) ^ byte(key[1],3)) ^ byte(key[0],3)
 
-void gen_mk_tab(u4byte key[])
+void gen_mk_tab(twofish_ctx *ctx, u4byte key[])
 {   u4byte  i;
     u1byte  by;
 
-    switch(k_len)
+    switch(ctx->k_len)
     {
     case 2: for(i = 0; i < 256; ++i)
             {
                 by = (u1byte)i;
 #ifdef ONE_STEP
-                mk_tab[0][i] = mds(0, q20(by)); mk_tab[1][i] = mds(1, q21(by));
-                mk_tab[2][i] = mds(2, q22(by)); mk_tab[3][i] = mds(3, q23(by));
+                ctx->mk_tab[0][i] = mds(0, q20(by)); ctx->mk_tab[1][i] = mds(1, q21(by));
+                ctx->mk_tab[2][i] = mds(2, q22(by)); ctx->mk_tab[3][i] = mds(3, q23(by));
 #else
                 sb[0][i] = q20(by); sb[1][i] = q21(by); 
                 sb[2][i] = q22(by); sb[3][i] = q23(by);
@@ -275,8 +265,8 @@ void gen_mk_tab(u4byte key[])
             {
                 by = (u1byte)i;
 #ifdef ONE_STEP
-                mk_tab[0][i] = mds(0, q30(by)); mk_tab[1][i] = mds(1, q31(by));
-                mk_tab[2][i] = mds(2, q32(by)); mk_tab[3][i] = mds(3, q33(by));
+                ctx->mk_tab[0][i] = mds(0, q30(by)); ctx->mk_tab[1][i] = mds(1, q31(by));
+                ctx->mk_tab[2][i] = mds(2, q32(by)); ctx->mk_tab[3][i] = mds(3, q33(by));
 #else
                 sb[0][i] = q30(by); sb[1][i] = q31(by); 
                 sb[2][i] = q32(by); sb[3][i] = q33(by);
@@ -288,8 +278,8 @@ void gen_mk_tab(u4byte key[])
             {
                 by = (u1byte)i;
 #ifdef ONE_STEP
-                mk_tab[0][i] = mds(0, q40(by)); mk_tab[1][i] = mds(1, q41(by));
-                mk_tab[2][i] = mds(2, q42(by)); mk_tab[3][i] = mds(3, q43(by));
+                ctx->mk_tab[0][i] = mds(0, q40(by)); ctx->mk_tab[1][i] = mds(1, q41(by));
+                ctx->mk_tab[2][i] = mds(2, q42(by)); ctx->mk_tab[3][i] = mds(3, q43(by));
 #else
                 sb[0][i] = q40(by); sb[1][i] = q41(by); 
                 sb[2][i] = q42(by); sb[3][i] = q43(by);
@@ -299,10 +289,10 @@ void gen_mk_tab(u4byte key[])
 };
 
 #  ifdef ONE_STEP
-#    define g0_fun(x) ( mk_tab[0][byte(x,0)] ^ mk_tab[1][byte(x,1)] \
-                      ^ mk_tab[2][byte(x,2)] ^ mk_tab[3][byte(x,3)] )
-#    define g1_fun(x) ( mk_tab[0][byte(x,3)] ^ mk_tab[1][byte(x,0)] \
-                      ^ mk_tab[2][byte(x,1)] ^ mk_tab[3][byte(x,2)] )
+#    define g0_fun(x) ( ctx->mk_tab[0][byte(x,0)] ^ ctx->mk_tab[1][byte(x,1)] \
+                      ^ ctx->mk_tab[2][byte(x,2)] ^ ctx->mk_tab[3][byte(x,3)] )
+#    define g1_fun(x) ( ctx->mk_tab[0][byte(x,3)] ^ ctx->mk_tab[1][byte(x,0)] \
+                      ^ ctx->mk_tab[2][byte(x,1)] ^ ctx->mk_tab[3][byte(x,2)] )
 #  else
 #    define g0_fun(x) ( mds(0, sb[0][byte(x,0)]) ^ mds(1, sb[1][byte(x,1)]) \
                       ^ mds(2, sb[2][byte(x,2)]) ^ mds(3, sb[3][byte(x,3)]) )
@@ -312,8 +302,8 @@ void gen_mk_tab(u4byte key[])
 
 #else
 
-#define g0_fun(x)   h_fun(x,s_key)
-#define g1_fun(x)   h_fun(rotl(x,8),s_key)
+#define g0_fun(x)   h_fun(x,ctx->s_key,ctx->k_len)
+#define g1_fun(x)   h_fun(rotl(x,8),ctx->s_key,ctx->k_len)
 
 #endif
 
@@ -380,65 +370,69 @@ u4byte mds_rem(u4byte p0, u4byte p1)
 
 /* initialise the key schedule from the user supplied key   */
 
-u4byte *set_key(const u4byte in_key[], const u4byte key_len)
-{   u4byte  i, a, b, me_key[4], mo_key[4];
+/* the key independent tables are generated once, thread-safe by the static initialisation */
 
-#ifdef Q_TABLES
-    if(!qt_gen)
+struct gen_tables
+{
+    gen_tables()
     {
-        gen_qtab(); qt_gen = 1;
-    }
+#ifdef Q_TABLES
+        gen_qtab();
 #endif
-
 #ifdef M_TABLE
-    if(!mt_gen)
-    {
-        gen_mtab(); mt_gen = 1;
-    }
+        gen_mtab();
 #endif
+    }
+};
+
+u4byte *set_key(twofish_ctx *ctx, const u4byte in_key[], const u4byte key_len)
+{   u4byte  i, a, b, me_key[4], mo_key[4];
+
+    static const gen_tables tables;
+    (void) tables;
 
-    k_len = key_len / 64;   /* 2, 3 or 4 */
+    ctx->k_len = key_len / 64;   /* 2, 3 or 4 */
 
-    for(i = 0; i < k_len; ++i)
+    for(i = 0; i < ctx->k_len; ++i)
     {
         a = in_key[i + i];     me_key[i] = a;
         b = in_key[i + i + 1]; mo_key[i] = b;
-        s_key[k_len - i - 1] = mds_rem(a, b);
+        ctx->s_key[ctx->k_len - i - 1] = mds_rem(a, b);
     }
 
     for(i = 0; i < 40; i += 2)
     {
         a = 0x01010101 * i; b = a + 0x01010101;
-        a = h_fun(a, me_key);
-        b = rotl(h_fun(b, mo_key), 8);
-        l_key[i] = a + b;
-        l_key[i + 1] = rotl(a + 2 * b, 9);
+        a = h_fun(a, me_key, ctx->k_len);
+        b = rotl(h_fun(b, mo_key, ctx->k_len), 8);
+        ctx->l_key[i] = a + b;
+        ctx->l_key[i + 1] = rotl(a + 2 * b, 9);
     }
 
 #ifdef MK_TABLE
-    gen_mk_tab(s_key);
+    gen_mk_tab(ctx, ctx->s_key);
 #endif
 
-    return l_key;
+    return ctx->l_key;
 };
 
 /* encrypt a block of text  */
 
 #define f_rnd(i)                                                        \
-    if (2*i < TWOFISH_N_ROUNDS) {                                       \
+    if (2*i < rounds) {                                       \
         t1 = g1_fun(blk[1]); t0 = g0_fun(blk[0]);                       \
         blk[2] = rotr(blk[2] ^ (t0 + t1 + l_key[4 * (i) + 8]), 1);      \
         blk[3] = rotl(blk[3], 1) ^ (t0 + 2 * t1 + l_key[4 * (i) + 9]);  \
     }                                                                   \
-    if (2*i + 1 < TWOFISH_N_ROUNDS) {                                   \
+    if (2*i + 1 < rounds) {                                   \
         t1 = g1_fun(blk[3]); t0 = g0_fun(blk[2]);                       \
         blk[0] = rotr(blk[0] ^ (t0 + t1 + l_key[4 * (i) + 10]), 1);     \
         blk[1] = rotl(blk[1], 1) ^ (t0 + 2 * t1 + l_key[4 * (i) + 11]); \
     }
 
-void twofish_encrypt(const u4byte in_blk[4], u4byte out_blk[], unsigned rounds)
+void twofish_encrypt(const twofish_ctx *ctx, const u4byte in_blk[4], u4byte out_blk[], unsigned rounds)
 {   u4byte  t0, t1, blk[4];
-    TWOFISH_N_ROUNDS = rounds;
+    const u4byte *l_key = ctx->l_key;
 
     blk[0] = in_blk[0] ^ l_key[0];
     blk[1] = in_blk[1] ^ l_key[1];
@@ -457,20 +451,20 @@ void twofish_encrypt(const u4byte in_blk[4], u4byte out_blk[], unsigned rounds)
 /* decrypt a block of text  */
 
 #define i_rnd(i)                                                        \
-    if (2*i < TWOFISH_N_ROUNDS) {                                       \
+    if (2*i < rounds) {                                       \
         t1 = g1_fun(blk[1]); t0 = g0_fun(blk[0]);                       \
         blk[2] = rotl(blk[2], 1) ^ (t0 + t1 + l_key[4 * (i) + 10]);     \
         blk[3] = rotr(blk[3] ^ (t0 + 2 * t1 + l_key[4 * (i) + 11]), 1); \
     }                                                                   \
-    if (2*i + 1 < TWOFISH_N_ROUNDS) {                                   \
+    if (2*i + 1 < rounds) {                                   \
         t1 = g1_fun(blk[3]); t0 = g0_fun(blk[2]);                       \
         blk[0] = rotl(blk[0], 1) ^ (t0 + t1 + l_key[4 * (i) +  8]);     \
         blk[1] = rotr(blk[1] ^ (t0 + 2 * t1 + l_key[4 * (i) +  9]), 1); \
     }
 
-void twofish_decrypt(const u4byte in_blk[4], u4byte out_blk[4], unsigned rounds)
+void twofish_decrypt(const twofish_ctx *ctx, const u4byte in_blk[4], u4byte out_blk[4], unsigned rounds)
 {   u4byte  t0, t1, blk[4];
-    TWOFISH_N_ROUNDS = rounds;
+    const u4byte *l_key = ctx->l_key;
 
     blk[0] = in_blk[0] ^ l_key[4];
     blk[1] = in_blk[1] ^ l_key[5];
@@ -0,0 +1,43 @@
+#include "keyed_cipher_cache.h"
+#include <iterator>
+#include <stdexcept>
+
+namespace block {
+
+keyed_cipher_cache::keyed_cipher_cache(const std::size_t capacity, factory make)
+    : _capacity(capacity)
+    , _make(std::move(make))
+    , _hits(0)
+    , _misses(0) {
+    if (_capacity == 0)
+        throw std::runtime_error("The key cache has to hold at least one key");
+}
+
+block_cipher &keyed_cipher_cache::get(const std::uint8_t *key, const std::size_t keysize) {
+    std::vector<std::uint8_t> k(key, key + keysize);
+
+    auto found = _index.find(k);
+    if (found != _index.end()) {
+        ++_hits;
+        _entries.splice(_entries.begin(), _entries, found->second);
+        return *_entries.front().cipher;
+    }
+
+    ++_misses;
+    if (_entries.size() < _capacity) {
+        _entries.push_front(entry{{}, _make()});
+    } else {
+        _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+        _index.erase(_entries.front().key);
+    }
+
+    entry &e = _entries.front();
+    // not indexed under any key until keysetup succeeds
+    e.key.clear();
+    e.cipher->keysetup(key, keysize);
+    e.key = k;
+    _index.emplace(std::move(k), _entries.begin());
+    return *e.cipher;
+}
+
+} // namespace block
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "block_cipher.h"
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace block {
+
+/**
+ * Bounded cache of keyed cipher instances, for key streams that repeat keys. A key seen
+ * before costs a lookup instead of a key schedule; when the cache is full, the least
+ * recently used instance is rekeyed.
+ */
+class keyed_cipher_cache {
+public:
+    using factory = std::function<std::unique_ptr<block_cipher>()>;
+
+    /* make creates a fresh, not yet keyed instance of the cipher */
+    keyed_cipher_cache(const std::size_t capacity, factory make);
+
+    /* Returns the instance keyed with key, valid until the next call */
+    block_cipher &get(const std::uint8_t *key, const std::size_t keysize);
+
+    std::size_t hits() const { return _hits; }
+    std::size_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        std::vector<std::uint8_t> key;
+        std::unique_ptr<block_cipher> cipher;
+    };
+
+    const std::size_t _capacity;
+    const factory _make;
+
+    // most recently used first
+    std::list<entry> _entries;
+    std::map<std::vector<std::uint8_t>, std::list<entry>::iterator> _index;
+
+    std::size_t _hits;
+    std::size_t _misses;
+};
+
+} // namespace block
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace hash {
@@ -16,6 +17,119 @@ struct hash_interface {
 
     virtual int
     Hash(int hash_bitsize, const BitSequence *data, DataLength data_bitsize, BitSequence *hash) = 0;
+
+    /**
+     * Hashes `count` messages of `data_bitsize` bits each, stored in `data` one after
+     * another, each starting on a byte boundary.
+     * The digests are stored `hash_bitsize / 8` bytes apart in `hash`. The default runs
+     * Init once and, for hashes that can snapshot their state, only restores it before each
+     * further message, also in later calls; hashes with a multi-buffer backend override it.
+     * After SetPrefix(), every message is the prefix followed by its `data_bitsize` bits.
+     */
+    virtual int HashBatch(int hash_bitsize,
+                          const BitSequence *data,
+                          DataLength data_bitsize,
+                          std::size_t count,
+                          BitSequence *hash) {
+        if (count == 0)
+            return 0;
+
+        int status = 0;
+        bool fresh = false;
+        if (_prefix_bytes == 0 && _init_saved != hash_bitsize) {
+            if ((status = Init(hash_bitsize)) != 0)
+                return status;
+            _init_saved = SaveState() ? hash_bitsize : 0;
+            fresh = true;
+        }
+        const bool saved = _prefix_bytes != 0 || _init_saved == hash_bitsize;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i > 0 || !fresh) {
+                if (saved)
+                    RestoreState();
+                else if ((status = Init(hash_bitsize)) != 0)
+                    return status;
+            }
+            status = Update(data + i * ((data_bitsize + 7) / 8), data_bitsize);
+            if (status == 0)
+                status = Final(hash + i * std::size_t(hash_bitsize / 8));
+            if (status != 0)
+                return status;
+        }
+        return 0;
+    }
+
+    /**
+     * Absorbs the whole compression blocks of `prefix` once, the following HashBatch()
+     * calls with the same `hash_bitsize` continue from that midstate. Returns the number
+     * of bytes absorbed, 0 when the hash cannot keep a midstate (nothing changes then).
+     */
+    std::size_t SetPrefix(int hash_bitsize, const BitSequence *prefix, std::size_t prefix_bytes) {
+        ClearPrefix();
+        _init_saved = 0;
+
+        const std::size_t block = BlockBytes(hash_bitsize);
+        if (block == 0)
+            return 0;
+        prefix_bytes -= prefix_bytes % block;
+        if (prefix_bytes == 0)
+            return 0;
+
+        if (Init(hash_bitsize) != 0 || Update(prefix, 8 * DataLength(prefix_bytes)) != 0 ||
+            !SaveState())
+            return 0;
+        _prefix_bytes = prefix_bytes;
+        return prefix_bytes;
+    }
+
+    void ClearPrefix() { _prefix_bytes = 0; }
+
+    /**
+     * True for hashes that take whole bytes only, their Update() ignores the bits of a
+     * partial last byte.
+     */
+    virtual bool WholeBytesOnly() const { return false; }
+
+    /**
+     * True for hashes whose HashBatch() runs several messages at once; for the others,
+     * gathering the messages into one buffer first gains nothing.
+     */
+    virtual bool MultiBuffer() const { return false; }
+
+    /**
+     * Bytes that the data of every Update() call but the last of a message has to be a
+     * multiple of, 1 (the default) for hashes that buffer any input. 0 when the whole
+     * message has to come in a single Update().
+     */
+    virtual std::size_t UpdateBytes(int hash_bitsize) const {
+        (void)hash_bitsize;
+        return 1;
+    }
+
+protected:
+    /**
+     * Bytes of one compression block, the granularity a midstate can be kept at. 0 (the
+     * default) disables SetPrefix().
+     */
+    virtual std::size_t BlockBytes(int hash_bitsize) const {
+        (void)hash_bitsize;
+        return 0;
+    }
+
+    /**
+     * Keeps a copy of the current state, either as left by Init() (for hashes whose Init()
+     * derives the IV by compression or similar work) or after whole blocks of a prefix.
+     * Returns false when not supported.
+     */
+    virtual bool SaveState() { return false; }
+
+    /** Brings back the state kept by SaveState() */
+    virtual void RestoreState() {}
+
+    std::size_t _prefix_bytes = 0;
+    // hash_bitsize whose Init() state SaveState() currently holds, 0 for none
+    int _init_saved = 0;
 };
 
 } // namespace hash
@@ -3,28 +3,12 @@
 #include "hash_interface.h"
 #include "streams.h"
 #include <algorithm>
+#include <cstring>
 
 namespace hash {
 
-template <typename I>
-void hash_data(hash_interface &hasher,
-               const I &data,
-               std::uint8_t *hash,
-               const std::size_t hash_size) {
-    using std::to_string;
-
-    int status = hasher.Init(int(hash_size * 8));
-    if (status != 0)
-        throw std::runtime_error("cannot initialize hash (code: " + to_string(status) + ")");
-
-    status = hasher.Update(&(*data.begin()), 8 * (data.size()));
-    if (status != 0)
-        throw std::runtime_error("cannot update the hash (code: " + to_string(status) + ")");
-
-    status = hasher.Final(hash);
-    if (status != 0)
-        throw std::runtime_error("cannot finalize the hash (code: " + to_string(status) + ")");
-}
+// messages handed to hash_interface::HashBatch() at once, a multiple of the lane counts
+static const std::size_t hash_batch_size = 16;
 
 hash_stream::hash_stream(
     const json &config,
@@ -34,29 +18,211 @@ hash_stream::hash_stream(
     : stream(osize) // round osize to multiple of _hash_input_size
     , _round(config.at("round"))
     , _hash_size(std::size_t(config.at("hash_size")))
-    , _source(make_stream(
-          config.at("source"),
-          seeder,
-          pipes,
-          config.value("input_size", _hash_size))) // if input size is not defined, use hash-size
-    , _hasher(hash_factory::create(config.at("algorithm"), unsigned(_round))) {
+    // if input size is not defined, use the bytes of input_bits or hash-size
+    , _input_size(config.value(
+          "input_size",
+          config.count("input_bits") ? (std::size_t(config.at("input_bits")) + 7) / 8 : _hash_size))
+    , _input_bits(config.value("input_bits", 8 * _input_size))
+    , _chunk_size(config.value("chunk_size", _input_size))
+    // bytes every input starts with, hashed once into a midstate when the hash can keep one
+    , _constant_prefix(std::min(std::size_t(config.value("constant_prefix", 0)), _input_bits / 8))
+    , _chain(config.value("mode", "") == "chain")
+    , _emit_every(config.value("emit_every", 1))
+    , _source(_chain ? nullptr : make_stream(config.at("source"), seeder, pipes, _chunk_size))
+    , _hasher(hash_factory::create(config.at("algorithm"), unsigned(_round)))
+    // only the multi-buffer hashes are given several inputs at once, the others hash the
+    // source output in place
+    , _batch(_chain ? _input_size
+                    : _chunk_size < _input_size || !_hasher->MultiBuffer()
+                              ? 0
+                              : hash_batch_size * _input_size) {
     if (osize % _hash_size != 0) {
         // not necessary wrong, but we never needed this, we always did
         // this by mistake. Change to warning if needed
         throw std::runtime_error("Output size is not multiple of hash size");
     }
+    if ((_input_bits + 7) / 8 != _input_size)
+        throw std::runtime_error("hash input_bits do not fill the input_size bytes");
+    if (_chunk_size == 0 || _input_size % _chunk_size != 0)
+        throw std::runtime_error("hash input_size is not a multiple of chunk_size");
+    if (_chunk_size < _input_size && _constant_prefix != 0)
+        throw std::runtime_error("chunked hash inputs have no constant prefix");
+    if (_chunk_size < _input_size) {
+        const std::size_t update_bytes = _hasher->UpdateBytes(int(_hash_size * 8));
+        if (update_bytes == 0)
+            throw std::runtime_error("hash " + config.at("algorithm").get<std::string>() +
+                                     " takes each input in one Update, it cannot be chunked");
+        if (_chunk_size % update_bytes != 0)
+            throw std::runtime_error("hash " + config.at("algorithm").get<std::string>() +
+                                     " needs chunk_size to be a multiple of " +
+                                     std::to_string(update_bytes) + " bytes");
+    }
+    if (_input_bits % 8 != 0 && _hasher->WholeBytesOnly())
+        throw std::runtime_error("hash " + config.at("algorithm").get<std::string>() +
+                                 " takes whole bytes only, input_bits has to be a multiple of 8");
+    if (_chain) {
+        if (_input_size < _hash_size)
+            throw std::runtime_error("chained hash needs input_size of at least hash_size");
+        if (_emit_every == 0)
+            throw std::runtime_error("chained hash cannot emit every 0th value");
+        if (_constant_prefix != 0)
+            throw std::runtime_error("chained hash has no constant prefix");
+
+        // h_0 is taken once from the source, the remaining input bytes count the steps from 0
+        std::unique_ptr<stream> start =
+            config.count("source") ? make_stream(config.at("source"), seeder, pipes, _hash_size)
+                                   : std::make_unique<pcg32_stream>(seeder, _hash_size);
+        vec_cview h0 = start->next();
+        std::copy(h0.begin(), h0.end(), _batch.begin());
+    }
     logger::info() << "stream source is hash function: " << config.at("algorithm") << std::endl;
 }
 
 hash_stream::hash_stream(hash_stream &&) = default;
 hash_stream::~hash_stream() = default;
 
+void hash_stream::next_chain() {
+    using std::to_string;
+
+    for (auto hash = _data.begin(); hash != _data.end(); hash += std::ptrdiff_t(_hash_size)) {
+        for (std::size_t k = 0; k < _emit_every; ++k) {
+            int status =
+                _hasher->Hash(int(_hash_size * 8), _batch.data(), _input_bits, &(*hash));
+            if (status != 0)
+                throw std::runtime_error("cannot hash the data (code: " + to_string(status) + ")");
+
+            std::copy_n(hash, _hash_size, _batch.begin());
+            for (auto it = _batch.begin() + std::ptrdiff_t(_hash_size);
+                 it != _batch.end() && ++*it == 0;
+                 ++it) {
+            }
+        }
+    }
+}
+
+void hash_stream::next_chunked() {
+    using std::to_string;
+
+    for (auto hash = _data.begin(); hash != _data.end(); hash += std::ptrdiff_t(_hash_size)) {
+        int status = _hasher->Init(int(_hash_size * 8));
+        if (status != 0)
+            throw std::runtime_error("cannot initialize hash (code: " + to_string(status) + ")");
+
+        for (std::size_t done = 0; done < _input_size; done += _chunk_size) {
+            vec_cview view = _source->next();
+            if (view.size() != _chunk_size)
+                throw std::runtime_error("hash source returned " + to_string(view.size()) +
+                                         " bytes instead of " + to_string(_chunk_size));
+            // the unused bits of the last byte are cut from the last chunk
+            const std::size_t bits = done + _chunk_size == _input_size
+                                         ? _input_bits - 8 * done
+                                         : 8 * _chunk_size;
+            status = _hasher->Update(view.data(), bits);
+            if (status != 0)
+                throw std::runtime_error("cannot update the hash (code: " + to_string(status) +
+                                         ")");
+        }
+
+        status = _hasher->Final(&(*hash));
+        if (status != 0)
+            throw std::runtime_error("cannot finalize the hash (code: " + to_string(status) + ")");
+    }
+}
+
+void hash_stream::set_prefix(const std::uint8_t *input) {
+    const std::size_t absorbed = _hasher->SetPrefix(int(_hash_size * 8), input, _constant_prefix);
+    _prefix.assign(input, input + absorbed);
+    _constant_prefix = 0;
+    if (absorbed == 0)
+        logger::warning() << "hash function cannot keep a midstate of the constant prefix"
+                          << std::endl;
+}
+
+bool hash_stream::check_prefix(const std::uint8_t *input) {
+    if (std::equal(_prefix.begin(), _prefix.end(), input))
+        return true;
+    logger::warning() << "hash input does not start with the constant prefix, "
+                      << "hashing whole inputs from now on" << std::endl;
+    _hasher->ClearPrefix();
+    _prefix.clear();
+    return false;
+}
+
+vec_cview hash_stream::source_input() {
+    using std::to_string;
+
+    vec_cview view = _source->next();
+    if (view.size() != _input_size)
+        throw std::runtime_error("hash source returned " + to_string(view.size()) +
+                                 " bytes instead of " + to_string(_input_size));
+    return view;
+}
+
+void hash_stream::next_single() {
+    using std::to_string;
+
+    for (auto hash = _data.begin(); hash != _data.end(); hash += std::ptrdiff_t(_hash_size)) {
+        vec_cview view = source_input();
+        if (_constant_prefix != 0)
+            set_prefix(view.data());
+
+        std::size_t skip = _prefix.size();
+        if (skip != 0 && !check_prefix(view.data()))
+            skip = 0;
+
+        int status = _hasher->HashBatch(
+                int(_hash_size * 8), view.data() + skip, _input_bits - 8 * skip, 1, &(*hash));
+        if (status != 0)
+            throw std::runtime_error("cannot hash the data (code: " + to_string(status) + ")");
+    }
+}
+
 vec_cview hash_stream::next() {
+    using std::to_string;
+
+    if (_chain) {
+        next_chain();
+        return make_view(_data.cbegin(), osize());
+    }
+    if (_chunk_size < _input_size) {
+        next_chunked();
+        return make_view(_data.cbegin(), osize());
+    }
+    if (_batch.empty()) {
+        next_single();
+        return make_view(_data.cbegin(), osize());
+    }
+
     auto hash = _data.data();
-    for (std::size_t i = 0; i < _data.size(); i += _hash_size) {
-        vec_cview view = _source->next();
+    const std::size_t count = _data.size() / _hash_size;
+    for (std::size_t i = 0; i < count; i += hash_batch_size) {
+        const std::size_t n = std::min(hash_batch_size, count - i);
+        for (std::size_t j = 0; j < n; ++j) {
+            vec_cview view = source_input();
+            std::copy(view.begin(), view.end(), _batch.begin() + std::ptrdiff_t(j * _input_size));
+        }
+
+        if (_constant_prefix != 0)
+            set_prefix(_batch.data());
+
+        std::size_t skip = _prefix.size();
+        for (std::size_t j = 0; j < n && skip != 0; ++j) {
+            if (!check_prefix(_batch.data() + j * _input_size))
+                skip = 0;
+        }
+        // the hasher continues from the prefix midstate, pack the suffixes back to back
+        for (std::size_t j = 0; j < n && skip != 0; ++j)
+            std::memmove(_batch.data() + j * (_input_size - skip),
+                         _batch.data() + j * _input_size + skip,
+                         _input_size - skip);
 
-        hash_data(*_hasher, view, &hash[i], _hash_size);
+        int status = _hasher->HashBatch(int(_hash_size * 8),
+                                        _batch.data(),
+                                        _input_bits - 8 * skip,
+                                        n,
+                                        &hash[i * _hash_size]);
+        if (status != 0)
+            throw std::runtime_error("cannot hash the data (code: " + to_string(status) + ")");
     }
 
     return make_view(_data.cbegin(), osize());
@@ -5,17 +5,12 @@
 #include <eacirc-core/optional.h>
 #include <eacirc-core/random.h>
 #include <memory>
+#include <vector>
 
 namespace hash {
 
 struct hash_interface;
 
-template <typename I>
-void hash_data(hash_interface &hasher,
-               const I &data,
-               std::uint8_t *hash,
-               const std::size_t hash_size);
-
 struct hash_stream : stream {
     hash_stream(const json &config,
                 default_seed_source &seeder,
@@ -27,12 +22,34 @@ struct hash_stream : stream {
     vec_cview next() override;
 
 private:
+    void next_chain();
+    void next_chunked();
+    void next_single();
+    vec_cview source_input();
+    // absorbs the constant prefix of input into a midstate, once
+    void set_prefix(const std::uint8_t *input);
+    // false, and back to whole inputs, when input does not start with the absorbed prefix
+    bool check_prefix(const std::uint8_t *input);
+
     const std::size_t _round;
     const std::size_t _hash_size;
+    const std::size_t _input_size;
+    // exact message length, the last byte of each input may be used only in part
+    const std::size_t _input_bits;
+    // bytes pulled from the source per Update call, long inputs are never held whole;
+    // a multiple of the hash's hash_interface::UpdateBytes()
+    const std::size_t _chunk_size;
+    std::size_t _constant_prefix;
+    // iterate h_{i+1} = H(h_i || step counter) instead of hashing a source stream
+    const bool _chain;
+    const std::size_t _emit_every;
 
     std::unique_ptr<stream> _source;
     stream *_prepared_stream_source;
     std::unique_ptr<hash_interface> _hasher;
+    // inputs gathered for a multi-buffer HashBatch(), h_i in chain mode, empty otherwise
+    std::vector<std::uint8_t> _batch;
+    std::vector<std::uint8_t> _prefix;
 };
 
 } // namespace hash
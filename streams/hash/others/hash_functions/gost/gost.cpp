@@ -65,37 +65,46 @@ void rhash_gost_cryptopro_init(gost_ctx *ctx)
 	r ^= (sbox)[tmp & 0xff] ^ ((sbox) + 256)[(tmp >> 8) & 0xff] ^ \
 		((sbox) + 512)[(tmp >> 16) & 0xff] ^ ((sbox) + 768)[tmp >> 24];
 
-# define GOST_ENCRYPT_ROUND_L(key1, key2, sbox) \
-	tmp = (key1) + r; \
-	l ^= (sbox)[tmp & 0xff] ^ ((sbox) + 256)[(tmp >> 8) & 0xff] ^ \
-		((sbox) + 512)[(tmp >> 16) & 0xff] ^ ((sbox) + 768)[tmp >> 24]; \
-
-# define GOST_ENCRYPT_ROUND_R(key1, key2, sbox) \
-	tmp = (key2) + l; \
-	r ^= (sbox)[tmp & 0xff] ^ ((sbox) + 256)[(tmp >> 8) & 0xff] ^ \
-		((sbox) + 512)[(tmp >> 16) & 0xff] ^ ((sbox) + 768)[tmp >> 24];
+/* GOST 28147-89 round function on the rotated S-Box lookup table */
+#define GOST_F(x, sbox) \
+	((sbox)[(x) & 0xff] ^ ((sbox) + 256)[((x) >> 8) & 0xff] ^ \
+	 ((sbox) + 512)[((x) >> 16) & 0xff] ^ ((sbox) + 768)[(x) >> 24])
+
+/* key words used by the rounds: three times k0..k7, then k7..k0 */
+static const unsigned char gost_key_index[32] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7, 7, 6, 5, 4, 3, 2, 1, 0
+};
 
-/* encrypt a block with the given key */
-/* ph4r05: round reduced version from the GOST_ENCRYPT macro */
-void gost_encrypt_fnc(unsigned int * result, unsigned int i, const unsigned int * key, const unsigned int * hash,
-                      const unsigned int * sbox, unsigned nr)
+/* encrypt the four 64-bit words of hash with the four keys */
+/* ph4r05: round reduced, the first nr rounds of GOST_ENCRYPT are applied */
+/* the four encryptions are independent and run interleaved */
+static void gost_encrypt4(unsigned * result, const unsigned key[4][8], const unsigned * hash,
+                          const unsigned * sbox, unsigned nr)
 {
-    unsigned l, r, tmp, jj;
-    r = hash[i], l = hash[i + 1];
-    for(jj = 0; jj < 12 && 2*jj < nr; ++jj){
-        GOST_ENCRYPT_ROUND_L(key[(2 * jj + 0) % 8], key[(2 * jj + 1) % 8], sbox)
-        if (2*jj + 1 < nr) {
-            GOST_ENCRYPT_ROUND_R(key[(2 * jj + 0) % 8], key[(2 * jj + 1) % 8], sbox)
+    unsigned l[4], r[4], k, jj;
+    for (k = 0; k < 4; k++)
+        r[k] = hash[2 * k], l[k] = hash[2 * k + 1];
+
+    for (jj = 0; jj + 1 < nr; jj += 2) {
+        for (k = 0; k < 4; k++) {
+            unsigned tmp = key[k][gost_key_index[jj]] + r[k];
+            l[k] ^= GOST_F(tmp, sbox);
+        }
+        for (k = 0; k < 4; k++) {
+            unsigned tmp = key[k][gost_key_index[jj + 1]] + l[k];
+            r[k] ^= GOST_F(tmp, sbox);
         }
     }
-    for(jj = 12; jj < 16 && 2*jj < nr; ++jj){
-        GOST_ENCRYPT_ROUND_L(key[2 * (16 - jj) - 1], key[2 * (16 - jj) - 2], sbox)
-        if (2*jj + 1 < nr) {
-            GOST_ENCRYPT_ROUND_R(key[2 * (16 - jj) - 1], key[2 * (16 - jj) - 2], sbox)
+    if (jj < nr) {
+        for (k = 0; k < 4; k++) {
+            unsigned tmp = key[k][gost_key_index[jj]] + r[k];
+            l[k] ^= GOST_F(tmp, sbox);
         }
     }
 
-    result[i] = l, result[i + 1] = r;
+    for (k = 0; k < 4; k++)
+        result[2 * k] = l[k], result[2 * k + 1] = r[k];
 }
 
 /* encrypt a block with the given key */
@@ -130,7 +139,7 @@ void gost_encrypt_fnc(unsigned int * result, unsigned int i, const unsigned int
 static void rhash_gost_block_compress(gost_ctx *ctx, const unsigned* block, unsigned nr)
 {
     unsigned i;
-    unsigned key[8], u[8], v[8], w[8], s[8];
+    unsigned key[4][8], u[8], v[8], w[8], s[8];
     unsigned *sbox = (ctx->cryptpro ? (unsigned*)rhash_gost_sbox_cryptpro : (unsigned*)rhash_gost_sbox);
 
     /* u := hash, v := <256-bit message block> */
@@ -143,24 +152,17 @@ static void rhash_gost_block_compress(gost_ctx *ctx, const unsigned* block, unsi
     w[4] = u[4] ^ v[4], w[5] = u[5] ^ v[5];
     w[6] = u[6] ^ v[6], w[7] = u[7] ^ v[7];
 
-    /* calculate keys, encrypt hash and store result to the s[] array */
+    /* calculate the keys, the encryption below does not change u, v or w */
     for (i = 0;; i += 2) {
         /* key generation: key_i := P(w) */
-        key[0] = (w[0] & 0x000000ff) | ((w[2] & 0x000000ff) << 8) | ((w[4] & 0x000000ff) << 16) | ((w[6] & 0x000000ff) << 24);
-        key[1] = ((w[0] & 0x0000ff00) >> 8) | (w[2] & 0x0000ff00) | ((w[4] & 0x0000ff00) << 8)  | ((w[6] & 0x0000ff00) << 16);
-        key[2] = ((w[0] & 0x00ff0000) >> 16) | ((w[2] & 0x00ff0000) >> 8) | (w[4] & 0x00ff0000) | ((w[6] & 0x00ff0000) << 8);
-        key[3] = ((w[0] & 0xff000000) >> 24) | ((w[2] & 0xff000000) >> 16) | ((w[4] & 0xff000000) >> 8) | (w[6] & 0xff000000);
-        key[4] = (w[1] & 0x000000ff) | ((w[3] & 0x000000ff) << 8) | ((w[5] & 0x000000ff) << 16) | ((w[7] & 0x000000ff) << 24);
-        key[5] = ((w[1] & 0x0000ff00) >> 8) | (w[3] & 0x0000ff00) | ((w[5] & 0x0000ff00) << 8)  | ((w[7] & 0x0000ff00) << 16);
-        key[6] = ((w[1] & 0x00ff0000) >> 16) | ((w[3] & 0x00ff0000) >> 8) | (w[5] & 0x00ff0000) | ((w[7] & 0x00ff0000) << 8);
-        key[7] = ((w[1] & 0xff000000) >> 24) | ((w[3] & 0xff000000) >> 16) | ((w[5] & 0xff000000) >> 8) | (w[7] & 0xff000000);
-
-        /* encryption: s_i := E_{key_i} (h_i) */
-        {
-//             unsigned l, r, tmp;
-//             GOST_ENCRYPT(s, i, key, ctx->hash, sbox);
-            gost_encrypt_fnc(s, i, key, ctx->hash, sbox, nr);
-        }
+        key[i / 2][0] = (w[0] & 0x000000ff) | ((w[2] & 0x000000ff) << 8) | ((w[4] & 0x000000ff) << 16) | ((w[6] & 0x000000ff) << 24);
+        key[i / 2][1] = ((w[0] & 0x0000ff00) >> 8) | (w[2] & 0x0000ff00) | ((w[4] & 0x0000ff00) << 8)  | ((w[6] & 0x0000ff00) << 16);
+        key[i / 2][2] = ((w[0] & 0x00ff0000) >> 16) | ((w[2] & 0x00ff0000) >> 8) | (w[4] & 0x00ff0000) | ((w[6] & 0x00ff0000) << 8);
+        key[i / 2][3] = ((w[0] & 0xff000000) >> 24) | ((w[2] & 0xff000000) >> 16) | ((w[4] & 0xff000000) >> 8) | (w[6] & 0xff000000);
+        key[i / 2][4] = (w[1] & 0x000000ff) | ((w[3] & 0x000000ff) << 8) | ((w[5] & 0x000000ff) << 16) | ((w[7] & 0x000000ff) << 24);
+        key[i / 2][5] = ((w[1] & 0x0000ff00) >> 8) | (w[3] & 0x0000ff00) | ((w[5] & 0x0000ff00) << 8)  | ((w[7] & 0x0000ff00) << 16);
+        key[i / 2][6] = ((w[1] & 0x00ff0000) >> 16) | ((w[3] & 0x00ff0000) >> 8) | (w[5] & 0x00ff0000) | ((w[7] & 0x00ff0000) << 8);
+        key[i / 2][7] = ((w[1] & 0xff000000) >> 24) | ((w[3] & 0xff000000) >> 16) | ((w[5] & 0xff000000) >> 8) | (w[7] & 0xff000000);
 
         if (i == 0) {
             /* w:= A(u) ^ A^2(v) */
@@ -204,6 +206,9 @@ static void rhash_gost_block_compress(gost_ctx *ctx, const unsigned* block, unsi
         }
     }
 
+    /* encryption: s_i := E_{key_i} (h_i) */
+    gost_encrypt4(s, key, ctx->hash, sbox, nr);
+
     /* step hash function: x(block, hash) := psi^61(hash xor psi(block xor psi^12(S))) */
 
     /* 12 rounds of the LFSR and xor in <message block> */
@@ -47,4 +47,8 @@ namespace others {
         result = Gost::Final(hashval);
         return result;
     }
+
+    bool Gost::WholeBytesOnly() const {
+        return true;
+    }
 }
@@ -18,6 +18,7 @@ namespace others {
         int Final(hash::BitSequence *hashval);
 
         int Hash(int hashbitlen, const hash::BitSequence *data, hash::DataLength databitlen, hash::BitSequence *hashval);
+        bool WholeBytesOnly() const;
 
     };
 }
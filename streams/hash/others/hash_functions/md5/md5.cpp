@@ -14,6 +14,7 @@
 #include <memory.h>
 #include <algorithm>
 #include "md5.h"
+#include "../md_lanes.h"
 
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) ((a << b) | (a >> (32-b)))
@@ -227,3 +228,119 @@ void md5_final(MD5_CTX *ctx, BYTE hash[], unsigned int rounds)
 		hash[i + 12] = (ctx->state[3] >> (i * 8)) & 0x000000ff;
 	}
 }
+
+/*********************** MULTI-BUFFER HASHING ***********************/
+#define LANES others::md_lanes::lanes
+
+static const unsigned int md5_index[64] = { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+					    1,  6, 11,  0,  5, 10, 15,  4,  9, 14,  3,  8, 13,  2,  7, 12,
+					    5,  8, 11, 14,  1,  4,  7, 10, 13,  0,  3,  6,  9, 12, 15,  2,
+					    0,  7, 14,  5, 12,  3, 10,  1,  8, 15,  6, 13,  4, 11,  2,  9};
+static const unsigned int md5_shift[64] = { 7, 12, 17, 22,  7, 12, 17, 22,  7, 12, 17, 22,  7, 12, 17, 22,
+					    5,  9, 14, 20,  5,  9, 14, 20,  5,  9, 14, 20,  5,  9, 14, 20,
+					    4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,
+					    6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21};
+static const WORD md5_table[64] = { 0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+				    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+				    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+				    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+				    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+				    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+				    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+				    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+// one step of all lanes, then (a, b, c, d) = (d, a, b, c) like the swaps of md5_transform()
+#define MD5_LANES_STEP(STEP, i) do {                                     \
+	const WORD *mi = m[md5_index[i]];                                \
+	for (l = 0; l < LANES; ++l) {                                    \
+		WORD x = a[l];                                           \
+		STEP(x,bb[l],c[l],d[l],mi[l],md5_shift[i],md5_table[i]); \
+		a[l] = d[l];                                             \
+		d[l] = c[l];                                             \
+		c[l] = bb[l];                                            \
+		bb[l] = x;                                               \
+	}                                                                \
+} while (0)
+
+/*
+ * md5_transform() of block b of all lanes, with the lane loop innermost so that the
+ * compiler keeps each working variable of all the messages in one SIMD register.
+ */
+static void md5_transform_lanes(WORD state[4][LANES], const others::md_lanes &msgs, size_t b,
+                                unsigned int rounds)
+{
+	WORD a[LANES], bb[LANES], c[LANES], d[LANES];
+	WORD m[16][LANES];
+	size_t i, l;
+
+	for (l = 0; l < LANES; ++l) {
+		const BYTE *data = msgs.block(l, b);
+		for (i = 0; i < 16; ++i)
+			m[i][l] = (data[4 * i]) + (data[4 * i + 1] << 8) + (data[4 * i + 2] << 16) + (data[4 * i + 3] << 24);
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		a[l] = state[0][l];
+		bb[l] = state[1][l];
+		c[l] = state[2][l];
+		d[l] = state[3][l];
+	}
+
+	// rounds above 64 only keep rotating the working variables, as in md5_transform()
+	for (i = 0; i < rounds; ++i) {
+		if (i < 16)
+			MD5_LANES_STEP(FF, i);
+		else if (i < 32)
+			MD5_LANES_STEP(GG, i);
+		else if (i < 48)
+			MD5_LANES_STEP(HH, i);
+		else if (i < 64)
+			MD5_LANES_STEP(II, i);
+		else {
+			for (l = 0; l < LANES; ++l) {
+				const WORD x = a[l];
+				a[l] = d[l];
+				d[l] = c[l];
+				c[l] = bb[l];
+				bb[l] = x;
+			}
+		}
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		state[0][l] += a[l];
+		state[1][l] += bb[l];
+		state[2][l] += c[l];
+		state[3][l] += d[l];
+	}
+}
+
+void md5_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                   unsigned int rounds, const MD5_CTX *midstate)
+{
+	static const WORD iv[4] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476};
+	const WORD *init = midstate ? midstate->state : iv;
+	const unsigned long long prefix_len = midstate ? midstate->bitlen / 8 : 0;
+	const size_t out_len = hash_len < MD5_BLOCK_SIZE ? hash_len : MD5_BLOCK_SIZE;
+	size_t n, b, i, l;
+
+	for (n = 0; n < count; n += LANES) {
+		const size_t used = count - n < LANES ? count - n : LANES;
+		const others::md_lanes msgs(data + n * len, len, used, false, prefix_len);
+		WORD state[4][LANES];
+
+		for (i = 0; i < 4; ++i) {
+			for (l = 0; l < LANES; ++l)
+				state[i][l] = init[i];
+		}
+		for (b = 0; b < msgs.blocks(); ++b)
+			md5_transform_lanes(state, msgs, b, rounds);
+
+		for (l = 0; l < used; ++l) {
+			BYTE digest[MD5_BLOCK_SIZE];
+			for (i = 0; i < MD5_BLOCK_SIZE; ++i)
+				digest[i] = (state[i / 4][l] >> ((i % 4) * 8)) & 0x000000ff;
+			memcpy(hash + (n + l) * hash_len, digest, out_len);
+		}
+	}
+}
@@ -37,4 +37,10 @@ void md5_init(MD5_CTX *ctx);
 void md5_update(MD5_CTX *ctx, const BYTE data[], size_t len, unsigned int rounds);
 void md5_final(MD5_CTX *ctx, BYTE hash[], unsigned int rounds);
 
+// Hashes count messages of len bytes stored back to back, the digests are stored hash_len
+// bytes apart (truncated to hash_len when shorter than the digest). A non-NULL midstate,
+// left by md5_update() on whole blocks, is the common prefix the messages continue.
+void md5_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                   unsigned int rounds, const MD5_CTX *midstate);
+
 #endif   // MD5_H
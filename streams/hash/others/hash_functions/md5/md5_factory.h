@@ -19,9 +19,23 @@ namespace others {
 
         int Hash(int hash_bitsize, const hash::BitSequence* data, hash::DataLength data_bitsize, hash::BitSequence* hash) override;
 
+        int HashBatch(int hash_bitsize, const hash::BitSequence* data, hash::DataLength data_bitsize, std::size_t count, hash::BitSequence* hash) override;
+
+        bool WholeBytesOnly() const override;
+
+        bool MultiBuffer() const override;
+
+    protected:
+        std::size_t BlockBytes(int hash_bitsize) const override;
+
+        bool SaveState() override;
+
+        void RestoreState() override;
+
     private:
         unsigned int _rounds;
         MD5_CTX _ctx;
+        MD5_CTX _saved_ctx;
     };
 
 } // namespace others
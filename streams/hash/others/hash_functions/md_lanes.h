@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+namespace others {
+
+/**
+ * Blocks of up to `lanes` equally long messages hashed side by side by the multi-buffer
+ * backends of the Merkle-Damgard hashes (MD5, SHA-1, SHA-256). Message l starts at
+ * data + l * len; its last one or two blocks, holding the padding and the 64-bit bit
+ * length, are built once here. Unused lanes repeat the first message, their digests are
+ * dropped by the caller. `prefix_len` bytes already absorbed into the starting state count
+ * towards the encoded length.
+ */
+class md_lanes {
+public:
+    // 32-bit words of 8 messages fill one 256-bit SIMD register
+    static const std::size_t lanes = 8;
+    static const std::size_t block_size = 64;
+
+    md_lanes(const unsigned char *data,
+             const std::size_t len,
+             const std::size_t count,
+             const bool big_endian_length,
+             const unsigned long long prefix_len = 0)
+        : _full(len / block_size)
+        , _tail_blocks(len % block_size < block_size - 8 ? 1 : 2) {
+        const std::size_t rest = len % block_size;
+        const unsigned long long bitlen = (prefix_len + len) * 8;
+
+        for (std::size_t l = 0; l < lanes; ++l) {
+            _msg[l] = data + (l < count ? l : 0) * len;
+
+            std::memset(_tail[l], 0, sizeof(_tail[l]));
+            if (rest != 0)
+                std::memcpy(_tail[l], _msg[l] + _full * block_size, rest);
+            _tail[l][rest] = 0x80;
+
+            unsigned char *length = _tail[l] + _tail_blocks * block_size - 8;
+            for (unsigned i = 0; i < 8; ++i)
+                length[big_endian_length ? 7 - i : i] = (unsigned char)(bitlen >> (8 * i));
+        }
+    }
+
+    std::size_t blocks() const { return _full + _tail_blocks; }
+
+    const unsigned char *block(const std::size_t lane, const std::size_t b) const {
+        return b < _full ? _msg[lane] + b * block_size : _tail[lane] + (b - _full) * block_size;
+    }
+
+private:
+    const std::size_t _full;
+    const std::size_t _tail_blocks;
+    const unsigned char *_msg[lanes];
+    unsigned char _tail[lanes][2 * block_size];
+};
+
+} // namespace others
@@ -47,4 +47,21 @@ namespace others {
         result = Ripemd160::Final(hashval);
         return result;
     }
+
+    bool Ripemd160::WholeBytesOnly() const {
+        return true;
+    }
+
+    std::size_t Ripemd160::BlockBytes(int) const {
+        return ripemd160_block_size;
+    }
+
+    bool Ripemd160::SaveState() {
+        m_saved_state = m_state;
+        return true;
+    }
+
+    void Ripemd160::RestoreState() {
+        m_state = m_saved_state;
+    }
 }
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <memory.h>
 #include "sha1.h"
+#include "../md_lanes.h"
 
 /****************************** MACROS ******************************/
 #define ROTLEFT(a, b) ((a << b) | (a >> (32 - b)))
@@ -136,3 +137,102 @@ void sha1_final(SHA1_CTX *ctx, BYTE hash[], unsigned int rounds)
 		hash[i + 16] = (ctx->state[4] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+/*********************** MULTI-BUFFER HASHING ***********************/
+#define LANES others::md_lanes::lanes
+
+#define SHA1_LANES_STEP(F, K) do {                                            \
+	for (l = 0; l < LANES; ++l) {                                         \
+		const WORD t = ROTLEFT(a[l], 5) + (F) + e[l] + (K) + m[i][l]; \
+		e[l] = d[l];                                                  \
+		d[l] = c[l];                                                  \
+		c[l] = ROTLEFT(bb[l], 30);                                    \
+		bb[l] = a[l];                                                 \
+		a[l] = t;                                                     \
+	}                                                                     \
+} while (0)
+
+/*
+ * sha1_transform() of block b of all lanes, with the lane loop innermost so that the
+ * compiler keeps each working variable of all the messages in one SIMD register.
+ */
+static void sha1_transform_lanes(WORD state[5][LANES], const others::md_lanes &msgs, size_t b,
+                                 unsigned int rounds)
+{
+	static const WORD k[4] = {0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6};
+	WORD a[LANES], bb[LANES], c[LANES], d[LANES], e[LANES];
+	WORD m[80][LANES];
+	size_t i, l;
+
+	// max 80 rounds
+	rounds = (rounds > 80 ? 80 : rounds);
+
+	for (l = 0; l < LANES; ++l) {
+		const BYTE *data = msgs.block(l, b);
+		for (i = 0; i < 16; ++i)
+			m[i][l] = (data[4 * i] << 24) + (data[4 * i + 1] << 16) + (data[4 * i + 2] << 8) + (data[4 * i + 3]);
+	}
+	for (i = 16; i < rounds; ++i) {
+		for (l = 0; l < LANES; ++l) {
+			const WORD t = m[i - 3][l] ^ m[i - 8][l] ^ m[i - 14][l] ^ m[i - 16][l];
+			m[i][l] = (t << 1) | (t >> 31);
+		}
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		a[l] = state[0][l];
+		bb[l] = state[1][l];
+		c[l] = state[2][l];
+		d[l] = state[3][l];
+		e[l] = state[4][l];
+	}
+
+	for (i = 0; i < rounds; ++i) {
+		if (i < 20)
+			SHA1_LANES_STEP((bb[l] & c[l]) ^ (~bb[l] & d[l]), k[0]);
+		else if (i < 40)
+			SHA1_LANES_STEP(bb[l] ^ c[l] ^ d[l], k[1]);
+		else if (i < 60)
+			SHA1_LANES_STEP((bb[l] & c[l]) ^ (bb[l] & d[l]) ^ (c[l] & d[l]), k[2]);
+		else
+			SHA1_LANES_STEP(bb[l] ^ c[l] ^ d[l], k[3]);
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		state[0][l] += a[l];
+		state[1][l] += bb[l];
+		state[2][l] += c[l];
+		state[3][l] += d[l];
+		state[4][l] += e[l];
+	}
+}
+
+void sha1_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                    unsigned int rounds, const SHA1_CTX *midstate)
+{
+	static const WORD iv[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xc3d2e1f0};
+	const WORD *init = midstate ? midstate->state : iv;
+	const unsigned long long prefix_len = midstate ? midstate->bitlen / 8 : 0;
+	const size_t out_len = hash_len < SHA1_BLOCK_SIZE ? hash_len : SHA1_BLOCK_SIZE;
+	size_t n, b, i, l;
+
+	for (n = 0; n < count; n += LANES) {
+		const size_t used = count - n < LANES ? count - n : LANES;
+		const others::md_lanes msgs(data + n * len, len, used, true, prefix_len);
+		WORD state[5][LANES];
+
+		for (i = 0; i < 5; ++i) {
+			for (l = 0; l < LANES; ++l)
+				state[i][l] = init[i];
+		}
+		for (b = 0; b < msgs.blocks(); ++b)
+			sha1_transform_lanes(state, msgs, b, rounds);
+
+		for (l = 0; l < used; ++l) {
+			BYTE digest[SHA1_BLOCK_SIZE];
+			for (i = 0; i < SHA1_BLOCK_SIZE; ++i)
+				digest[i] = (state[i / 4][l] >> (24 - (i % 4) * 8)) & 0x000000ff;
+			memcpy(hash + (n + l) * hash_len, digest, out_len);
+		}
+	}
+}
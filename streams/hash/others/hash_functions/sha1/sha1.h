@@ -38,4 +38,10 @@ void sha1_init(SHA1_CTX *ctx);
 void sha1_update(SHA1_CTX *ctx, const BYTE data[], size_t len, unsigned int rounds);
 void sha1_final(SHA1_CTX *ctx, BYTE hash[], unsigned int rounds);
 
+// Hashes count messages of len bytes stored back to back, the digests are stored hash_len
+// bytes apart (truncated to hash_len when shorter than the digest). A non-NULL midstate,
+// left by sha1_update() on whole blocks, is the common prefix the messages continue.
+void sha1_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                    unsigned int rounds, const SHA1_CTX *midstate);
+
 #endif   // SHA1_H
@@ -21,6 +21,38 @@ int sha1_factory::Hash(int hash_bitsize, const hash::BitSequence *data, hash::Da
     Init(hash_bitsize);
     Update(data, data_bitsize);
     Final(hash);
+    return 0;
+}
+
+bool sha1_factory::WholeBytesOnly() const {
+    return true;
+}
+
+bool sha1_factory::MultiBuffer() const {
+    return true;
+}
+
+int sha1_factory::HashBatch(int hash_bitsize, const hash::BitSequence *data, hash::DataLength data_bitsize,
+                            std::size_t count, hash::BitSequence *hash) {
+    // the lanes take whole bytes, a partial last byte goes through Update() like in Hash()
+    if (data_bitsize % 8 != 0)
+        return hash::hash_interface::HashBatch(hash_bitsize, data, data_bitsize, count, hash);
+    sha1_hash_many(data, data_bitsize/8, count, hash, std::size_t(hash_bitsize/8), _rounds,
+                   _prefix_bytes != 0 ? &_saved_ctx : NULL);
+    return 0;
+}
+
+std::size_t sha1_factory::BlockBytes(int) const {
+    return 64;
+}
+
+bool sha1_factory::SaveState() {
+    _saved_ctx = _ctx;
+    return true;
+}
+
+void sha1_factory::RestoreState() {
+    _ctx = _saved_ctx;
 }
 
 }
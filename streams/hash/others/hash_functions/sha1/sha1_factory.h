@@ -16,9 +16,18 @@ namespace others {
         int Update(const hash::BitSequence* data, hash::DataLength data_bitsize) override;
         int Final(hash::BitSequence* others) override;
         int Hash(int hash_bitsize, const hash::BitSequence* data, hash::DataLength data_bitsize, hash::BitSequence* hash) override;
+        int HashBatch(int hash_bitsize, const hash::BitSequence* data, hash::DataLength data_bitsize, std::size_t count, hash::BitSequence* hash) override;
+        bool WholeBytesOnly() const override;
+        bool MultiBuffer() const override;
+
+    protected:
+        std::size_t BlockBytes(int hash_bitsize) const override;
+        bool SaveState() override;
+        void RestoreState() override;
 
     private:
         unsigned int _rounds;
         SHA1_CTX _ctx;
+        SHA1_CTX _saved_ctx;
     };
 } // namespace others
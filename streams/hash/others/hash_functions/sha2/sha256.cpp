@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <memory.h>
 #include "sha256.h"
+#include "../md_lanes.h"
 
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
@@ -158,3 +159,98 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[], unsigned int rounds)
 		hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+/*********************** MULTI-BUFFER HASHING ***********************/
+#define LANES others::md_lanes::lanes
+
+/*
+ * sha256_transform() of block b of all lanes, with the lane loop innermost so that the
+ * compiler keeps each working variable of all the messages in one SIMD register.
+ */
+static void sha256_transform_lanes(WORD state[8][LANES], const others::md_lanes &msgs, size_t b,
+                                   unsigned int rounds)
+{
+	WORD a[LANES], bb[LANES], c[LANES], d[LANES], e[LANES], f[LANES], g[LANES], h[LANES];
+	WORD m[64][LANES];
+	size_t i, l;
+
+	rounds = (rounds > 64 ? 64 : rounds);
+
+	for (l = 0; l < LANES; ++l) {
+		const BYTE *data = msgs.block(l, b);
+		for (i = 0; i < 16; ++i)
+			m[i][l] = (data[4 * i] << 24) | (data[4 * i + 1] << 16) | (data[4 * i + 2] << 8) | (data[4 * i + 3]);
+	}
+	for (i = 16; i < rounds; ++i) {
+		for (l = 0; l < LANES; ++l)
+			m[i][l] = SIG1(m[i - 2][l]) + m[i - 7][l] + SIG0(m[i - 15][l]) + m[i - 16][l];
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		a[l] = state[0][l];
+		bb[l] = state[1][l];
+		c[l] = state[2][l];
+		d[l] = state[3][l];
+		e[l] = state[4][l];
+		f[l] = state[5][l];
+		g[l] = state[6][l];
+		h[l] = state[7][l];
+	}
+
+	for (i = 0; i < rounds; ++i) {
+		for (l = 0; l < LANES; ++l) {
+			const WORD t1 = h[l] + EP1(e[l]) + CH(e[l],f[l],g[l]) + k[i] + m[i][l];
+			const WORD t2 = EP0(a[l]) + MAJ(a[l],bb[l],c[l]);
+			h[l] = g[l];
+			g[l] = f[l];
+			f[l] = e[l];
+			e[l] = d[l] + t1;
+			d[l] = c[l];
+			c[l] = bb[l];
+			bb[l] = a[l];
+			a[l] = t1 + t2;
+		}
+	}
+
+	for (l = 0; l < LANES; ++l) {
+		state[0][l] += a[l];
+		state[1][l] += bb[l];
+		state[2][l] += c[l];
+		state[3][l] += d[l];
+		state[4][l] += e[l];
+		state[5][l] += f[l];
+		state[6][l] += g[l];
+		state[7][l] += h[l];
+	}
+}
+
+void sha256_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                      unsigned int rounds, const SHA256_CTX *midstate)
+{
+	static const WORD iv[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	                             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+	const WORD *init = midstate ? midstate->state : iv;
+	const unsigned long long prefix_len = midstate ? midstate->bitlen / 8 : 0;
+	const size_t out_len = hash_len < SHA256_BLOCK_SIZE ? hash_len : SHA256_BLOCK_SIZE;
+	size_t n, b, i, l;
+
+	for (n = 0; n < count; n += LANES) {
+		const size_t used = count - n < LANES ? count - n : LANES;
+		const others::md_lanes msgs(data + n * len, len, used, true, prefix_len);
+		WORD state[8][LANES];
+
+		for (i = 0; i < 8; ++i) {
+			for (l = 0; l < LANES; ++l)
+				state[i][l] = init[i];
+		}
+		for (b = 0; b < msgs.blocks(); ++b)
+			sha256_transform_lanes(state, msgs, b, rounds);
+
+		for (l = 0; l < used; ++l) {
+			BYTE digest[SHA256_BLOCK_SIZE];
+			for (i = 0; i < SHA256_BLOCK_SIZE; ++i)
+				digest[i] = (state[i / 4][l] >> (24 - (i % 4) * 8)) & 0x000000ff;
+			memcpy(hash + (n + l) * hash_len, digest, out_len);
+		}
+	}
+}
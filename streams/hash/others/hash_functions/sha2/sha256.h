@@ -37,4 +37,10 @@ void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len, unsigned int rounds);
 void sha256_final(SHA256_CTX *ctx, BYTE hash[], unsigned int rounds);
 
+// Hashes count messages of len bytes stored back to back, the digests are stored hash_len
+// bytes apart (truncated to hash_len when shorter than the digest). A non-NULL midstate,
+// left by sha256_update() on whole blocks, is the common prefix the messages continue.
+void sha256_hash_many(const BYTE data[], size_t len, size_t count, BYTE hash[], size_t hash_len,
+                      unsigned int rounds, const SHA256_CTX *midstate);
+
 #endif   // SHA256_H
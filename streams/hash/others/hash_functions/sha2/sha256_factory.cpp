@@ -25,4 +25,35 @@ namespace others{
         return 0;
     }
 
+    bool sha256_factory::WholeBytesOnly() const {
+        return true;
+    }
+
+    bool sha256_factory::MultiBuffer() const {
+        return true;
+    }
+
+    int sha256_factory::HashBatch(int hash_bitsize, const hash::BitSequence *data, hash::DataLength data_bitsize,
+                                  std::size_t count, hash::BitSequence *hash) {
+        // the lanes take whole bytes, a partial last byte goes through Update() like in Hash()
+        if (data_bitsize % 8 != 0)
+            return hash::hash_interface::HashBatch(hash_bitsize, data, data_bitsize, count, hash);
+        sha256_hash_many(data, data_bitsize/8, count, hash, std::size_t(hash_bitsize/8), _rounds,
+                         _prefix_bytes != 0 ? &_saved_ctx : NULL);
+        return 0;
+    }
+
+    std::size_t sha256_factory::BlockBytes(int) const {
+        return 64;
+    }
+
+    bool sha256_factory::SaveState() {
+        _saved_ctx = _ctx;
+        return true;
+    }
+
+    void sha256_factory::RestoreState() {
+        _ctx = _saved_ctx;
+    }
+
 } // namespace others
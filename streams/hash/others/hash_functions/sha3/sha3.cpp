@@ -21,19 +21,9 @@
 #include <string.h>
 #include "byte_order.h"
 #include "sha3.h"
-
-/* constants */
-#define NumberOfRounds 24
-
-/* SHA3 (Keccak) constants for 24 rounds */
-static uint64_t keccak_round_constants[NumberOfRounds] = {
-    I64(0x0000000000000001), I64(0x0000000000008082), I64(0x800000000000808A), I64(0x8000000080008000),
-    I64(0x000000000000808B), I64(0x0000000080000001), I64(0x8000000080008081), I64(0x8000000000008009),
-    I64(0x000000000000008A), I64(0x0000000000000088), I64(0x0000000080008009), I64(0x000000008000000A),
-    I64(0x000000008000808B), I64(0x800000000000008B), I64(0x8000000000008089), I64(0x8000000000008003),
-    I64(0x8000000000008002), I64(0x8000000000000080), I64(0x000000000000800A), I64(0x800000008000000A),
-    I64(0x8000000080008081), I64(0x8000000000008080), I64(0x0000000080000001), I64(0x8000000080008008)
-};
+extern "C" {
+#include <streams/hash/sha3/hash_functions/Keccak/KeccakF-1600-interface.h>
+}
 
 /* Initializing a sha3 context for given number of output bits */
 static void rhash_keccak_init(sha3_ctx *ctx, unsigned bits)
@@ -42,6 +32,8 @@ static void rhash_keccak_init(sha3_ctx *ctx, unsigned bits)
     unsigned rate = 1600 - bits * 2;
 
     memset(ctx, 0, sizeof(sha3_ctx));
+    /* the state is kept the way the Keccak candidate's permutation wants it */
+    KeccakInitializeState((unsigned char*)ctx->hash);
     ctx->block_size = rate / 8;
     assert(rate <= 1600 && (rate % 64) == 0);
 }
@@ -86,121 +78,18 @@ void rhash_sha3_512_init(sha3_ctx *ctx)
     rhash_keccak_init(ctx, 512);
 }
 
-#define XORED_A(i) A[(i)] ^ A[(i) + 5] ^ A[(i) + 10] ^ A[(i) + 15] ^ A[(i) + 20]
-#define THETA_STEP(i) \
-    A[(i)]      ^= D[(i)]; \
-    A[(i) + 5]  ^= D[(i)]; \
-    A[(i) + 10] ^= D[(i)]; \
-    A[(i) + 15] ^= D[(i)]; \
-    A[(i) + 20] ^= D[(i)] \
-
-/* Keccak theta() transformation */
-static void keccak_theta(uint64_t *A)
-{
-    uint64_t D[5];
-    D[0] = ROTL64(XORED_A(1), 1) ^ XORED_A(4);
-    D[1] = ROTL64(XORED_A(2), 1) ^ XORED_A(0);
-    D[2] = ROTL64(XORED_A(3), 1) ^ XORED_A(1);
-    D[3] = ROTL64(XORED_A(4), 1) ^ XORED_A(2);
-    D[4] = ROTL64(XORED_A(0), 1) ^ XORED_A(3);
-    THETA_STEP(0);
-    THETA_STEP(1);
-    THETA_STEP(2);
-    THETA_STEP(3);
-    THETA_STEP(4);
-}
-
-/* Keccak pi() transformation */
-static void keccak_pi(uint64_t *A)
-{
-    uint64_t A1;
-    A1 = A[1];
-    A[ 1] = A[ 6];
-    A[ 6] = A[ 9];
-    A[ 9] = A[22];
-    A[22] = A[14];
-    A[14] = A[20];
-    A[20] = A[ 2];
-    A[ 2] = A[12];
-    A[12] = A[13];
-    A[13] = A[19];
-    A[19] = A[23];
-    A[23] = A[15];
-    A[15] = A[ 4];
-    A[ 4] = A[24];
-    A[24] = A[21];
-    A[21] = A[ 8];
-    A[ 8] = A[16];
-    A[16] = A[ 5];
-    A[ 5] = A[ 3];
-    A[ 3] = A[18];
-    A[18] = A[17];
-    A[17] = A[11];
-    A[11] = A[ 7];
-    A[ 7] = A[10];
-    A[10] = A1;
-    /* note: A[ 0] is left as is */
-}
-
-#define CHI_STEP(i) \
-    A0 = A[0 + (i)]; \
-    A1 = A[1 + (i)]; \
-    A[0 + (i)] ^= ~A1 & A[2 + (i)]; \
-    A[1 + (i)] ^= ~A[2 + (i)] & A[3 + (i)]; \
-    A[2 + (i)] ^= ~A[3 + (i)] & A[4 + (i)]; \
-    A[3 + (i)] ^= ~A[4 + (i)] & A0; \
-    A[4 + (i)] ^= ~A0 & A1 \
-
-/* Keccak chi() transformation */
-static void keccak_chi(uint64_t *A)
+/* Keccak-f[1600] reduced to the first `rounds` rounds, shared with the Keccak candidate */
+static void rhash_sha3_permutation(uint64_t *state, unsigned rounds)
 {
-    uint64_t A0, A1;
-    CHI_STEP(0);
-    CHI_STEP(5);
-    CHI_STEP(10);
-    CHI_STEP(15);
-    CHI_STEP(20);
+    KeccakPermutation((unsigned char*)state, rounds);
 }
 
-static void rhash_sha3_permutation(uint64_t *state, unsigned rounds)
+/* Store the first digest_length bytes of the state */
+static void rhash_sha3_extract(const sha3_ctx *ctx, unsigned char* result, size_t digest_length)
 {
-    int round;
-    for (round = 0; round < int(rounds); round++)
-    {
-        keccak_theta(state);
-
-        /* apply Keccak rho() transformation */
-        state[ 1] = ROTL64(state[ 1],  1);
-        state[ 2] = ROTL64(state[ 2], 62);
-        state[ 3] = ROTL64(state[ 3], 28);
-        state[ 4] = ROTL64(state[ 4], 27);
-        state[ 5] = ROTL64(state[ 5], 36);
-        state[ 6] = ROTL64(state[ 6], 44);
-        state[ 7] = ROTL64(state[ 7],  6);
-        state[ 8] = ROTL64(state[ 8], 55);
-        state[ 9] = ROTL64(state[ 9], 20);
-        state[10] = ROTL64(state[10],  3);
-        state[11] = ROTL64(state[11], 10);
-        state[12] = ROTL64(state[12], 43);
-        state[13] = ROTL64(state[13], 25);
-        state[14] = ROTL64(state[14], 39);
-        state[15] = ROTL64(state[15], 41);
-        state[16] = ROTL64(state[16], 45);
-        state[17] = ROTL64(state[17], 15);
-        state[18] = ROTL64(state[18], 21);
-        state[19] = ROTL64(state[19],  8);
-        state[20] = ROTL64(state[20], 18);
-        state[21] = ROTL64(state[21],  2);
-        state[22] = ROTL64(state[22], 61);
-        state[23] = ROTL64(state[23], 56);
-        state[24] = ROTL64(state[24], 14);
-
-        keccak_pi(state);
-        keccak_chi(state);
-
-        /* apply iota(state, round) */
-        *state ^= keccak_round_constants[round];
-    }
+    unsigned char lanes[sha3_512_hash_size];
+    KeccakExtract((const unsigned char*)ctx->hash, lanes, (unsigned)((digest_length + 7) / 8));
+    memcpy(result, lanes, digest_length);
 }
 
 /**
@@ -329,7 +218,7 @@ void rhash_sha3_final(sha3_ctx *ctx, unsigned char* result, unsigned rounds)
     }
 
     assert(block_size > digest_length);
-    if (result) me64_to_le_str(result, ctx->hash, digest_length);
+    if (result) rhash_sha3_extract(ctx, result, digest_length);
 }
 
 #ifdef USE_KECCAK
@@ -357,6 +246,6 @@ void rhash_keccak_final(sha3_ctx *ctx, unsigned char* result)
     }
 
     assert(block_size > digest_length);
-    if (result) me64_to_le_str(result, ctx->hash, digest_length);
+    if (result) rhash_sha3_extract(ctx, result, digest_length);
 }
 #endif /* USE_KECCAK */
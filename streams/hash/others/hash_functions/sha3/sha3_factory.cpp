@@ -48,4 +48,8 @@ int sha3_factory::Hash(int hash_bitsize,
     return 0;
 }
 
+bool sha3_factory::WholeBytesOnly() const {
+    return true;
+}
+
 } // namespace others
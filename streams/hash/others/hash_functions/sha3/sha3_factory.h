@@ -15,6 +15,7 @@ public:
     int Update(const hash::BitSequence* data, hash::DataLength data_bitsize) override;
     int Final(hash::BitSequence* hash) override;
     int Hash(int hash_bitsize, const hash::BitSequence* data, hash::DataLength data_bitsize, hash::BitSequence* hash) override;
+    bool WholeBytesOnly() const override;
 
 private:
     unsigned int _rounds;
@@ -155,11 +155,19 @@ static void rhash_tiger_process_block(uint64_t state[3], uint64_t* block, unsign
         b = tmp;
     }
 #else
-    pass_rr(a, b, c, 5, 0, nr);
-	key_schedule;
-    pass_rr(c, a, b, 7, 1, nr);
-	key_schedule;
-    pass_rr(b, c, a, 9, 2, nr);
+    if (nr >= tiger_full_rounds) {
+        pass(a, b, c, 5);
+        key_schedule;
+        pass(c, a, b, 7);
+        key_schedule;
+        pass(b, c, a, 9);
+    } else {
+        pass_rr(a, b, c, 5, 0, nr);
+        key_schedule;
+        pass_rr(c, a, b, 7, 1, nr);
+        key_schedule;
+        pass_rr(b, c, a, 9, 2, nr);
+    }
 #endif
 
     /* feedforward operation */
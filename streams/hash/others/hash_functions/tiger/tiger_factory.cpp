@@ -47,4 +47,21 @@ namespace others {
         result = Tiger::Final(hashval);
         return result;
     }
+
+    bool Tiger::WholeBytesOnly() const {
+        return true;
+    }
+
+    std::size_t Tiger::BlockBytes(int) const {
+        return tiger_block_size;
+    }
+
+    bool Tiger::SaveState() {
+        m_saved_state = m_state;
+        return true;
+    }
+
+    void Tiger::RestoreState() {
+        m_state = m_saved_state;
+    }
 }
@@ -8,6 +8,7 @@ namespace others {
 
     private:
         tiger_ctx m_state;
+        tiger_ctx m_saved_state;
         unsigned m_rounds;
 
     public:
@@ -18,6 +19,12 @@ namespace others {
         int Final(hash::BitSequence *hashval);
 
         int Hash(int hashbitlen, const hash::BitSequence *data, hash::DataLength databitlen, hash::BitSequence *hashval);
+        bool WholeBytesOnly() const;
+
+    protected:
+        std::size_t BlockBytes(int hash_bitsize) const;
+        bool SaveState();
+        void RestoreState();
 
     };
 }
@@ -56,20 +56,36 @@ extern uint64_t rhash_whirlpool_sbox[8][256];
 	rhash_whirlpool_sbox[6][(int)(src[(shift + 2) & 7] >>  8) & 0xff] ^ \
 	rhash_whirlpool_sbox[7][(int)(src[(shift + 1) & 7]      ) & 0xff])
 
+/* dst := the round function applied to src, without the key addition */
+#define WHIRLPOOL_LAYER(dst, src) \
+    dst[0] = WHIRLPOOL_OP(src, 0); \
+    dst[1] = WHIRLPOOL_OP(src, 1); \
+    dst[2] = WHIRLPOOL_OP(src, 2); \
+    dst[3] = WHIRLPOOL_OP(src, 3); \
+    dst[4] = WHIRLPOOL_OP(src, 4); \
+    dst[5] = WHIRLPOOL_OP(src, 5); \
+    dst[6] = WHIRLPOOL_OP(src, 6); \
+    dst[7] = WHIRLPOOL_OP(src, 7);
+
+/* the i-th round: key K -> L, state S -> T */
+#define WHIRLPOOL_ROUND(K, L, S, T, i) \
+    WHIRLPOOL_LAYER(L, K) \
+    L[0] ^= rc[i]; \
+    WHIRLPOOL_LAYER(T, S) \
+    for (j = 0; j < 8; j++) \
+        T[j] ^= L[j];
+
 /**
  * The core transformation. Process a 512-bit block.
  *
  * @param hash algorithm state
  * @param block the message block to process
  */
-static void rhash_whirlpool_process_block(uint64_t *hash, uint64_t* p_block, unsigned nr)
+static void rhash_whirlpool_process_block(uint64_t *hash, const unsigned char* block, unsigned nr)
 {
-    int i;                /* loop counter */
-    uint64_t K[2][8];       /* key */
-    uint64_t state[2][8];   /* state */
-
-    /* alternating binary flags */
-    unsigned int m = 0;
+    int i, j;             /* loop counters */
+    uint64_t K[8], L[8];  /* key */
+    uint64_t S[8], T[8];  /* state */
 
     /* the number of rounds of the internal dedicated block cipher */
     const int number_of_rounds = nr;
@@ -89,48 +105,28 @@ static void rhash_whirlpool_process_block(uint64_t *hash, uint64_t* p_block, uns
     };
 
     /* map the message buffer to a block */
+    memcpy(S, block, sizeof(S));
     for (i = 0; i < 8; i++) {
         /* store K^0 and xor it with the intermediate hash state */
-        K[0][i] = hash[i];
-        state[0][i] = be2me_64(p_block[i]) ^ hash[i];
-        hash[i] = state[0][i];
+        K[i] = hash[i];
+        S[i] = be2me_64(S[i]) ^ hash[i];
+        hash[i] = S[i];
     }
 
-    /* iterate over algorithm rounds */
-    for (i = 0; i < number_of_rounds; i++)
-    {
-        /* compute K^i from K^{i-1} */
-        K[m ^ 1][0] = WHIRLPOOL_OP(K[m], 0) ^ rc[i];
-        K[m ^ 1][1] = WHIRLPOOL_OP(K[m], 1);
-        K[m ^ 1][2] = WHIRLPOOL_OP(K[m], 2);
-        K[m ^ 1][3] = WHIRLPOOL_OP(K[m], 3);
-        K[m ^ 1][4] = WHIRLPOOL_OP(K[m], 4);
-        K[m ^ 1][5] = WHIRLPOOL_OP(K[m], 5);
-        K[m ^ 1][6] = WHIRLPOOL_OP(K[m], 6);
-        K[m ^ 1][7] = WHIRLPOOL_OP(K[m], 7);
-
-        /* apply the i-th round transformation */
-        state[m ^ 1][0] = WHIRLPOOL_OP(state[m], 0) ^ K[m ^ 1][0];
-        state[m ^ 1][1] = WHIRLPOOL_OP(state[m], 1) ^ K[m ^ 1][1];
-        state[m ^ 1][2] = WHIRLPOOL_OP(state[m], 2) ^ K[m ^ 1][2];
-        state[m ^ 1][3] = WHIRLPOOL_OP(state[m], 3) ^ K[m ^ 1][3];
-        state[m ^ 1][4] = WHIRLPOOL_OP(state[m], 4) ^ K[m ^ 1][4];
-        state[m ^ 1][5] = WHIRLPOOL_OP(state[m], 5) ^ K[m ^ 1][5];
-        state[m ^ 1][6] = WHIRLPOOL_OP(state[m], 6) ^ K[m ^ 1][6];
-        state[m ^ 1][7] = WHIRLPOOL_OP(state[m], 7) ^ K[m ^ 1][7];
-
-        m = m ^ 1;
+    /* iterate over algorithm rounds, two at a time so that the
+       key and state arrays keep fixed places */
+    for (i = 0; i + 1 < number_of_rounds; i += 2) {
+        WHIRLPOOL_ROUND(K, L, S, T, i)
+        WHIRLPOOL_ROUND(L, K, T, S, i + 1)
+    }
+    if (i < number_of_rounds) {
+        WHIRLPOOL_ROUND(K, L, S, T, i)
+        memcpy(S, T, sizeof(S));
     }
 
     /* apply the Miyaguchi-Preneel compression function */
-    hash[0] ^= state[m][0];
-    hash[1] ^= state[m][1];
-    hash[2] ^= state[m][2];
-    hash[3] ^= state[m][3];
-    hash[4] ^= state[m][4];
-    hash[5] ^= state[m][5];
-    hash[6] ^= state[m][6];
-    hash[7] ^= state[m][7];
+    for (i = 0; i < 8; i++)
+        hash[i] ^= S[i];
 }
 
 /**
@@ -154,22 +150,13 @@ void rhash_whirlpool_update(whirlpool_ctx *ctx, const unsigned char* msg, size_t
         if (size < left) return;
 
         /* process partial block */
-        rhash_whirlpool_process_block(ctx->hash, (uint64_t*)ctx->message, nr);
+        rhash_whirlpool_process_block(ctx->hash, ctx->message, nr);
         msg  += left;
         size -= left;
     }
     while (size >= whirlpool_block_size) {
-        uint64_t* aligned_message_block;
-        if (IS_ALIGNED_64(msg)) {
-            /* the most common case is processing of an already aligned message
-            without copying it */
-            aligned_message_block = (uint64_t*)msg;
-        } else {
-            memcpy(ctx->message, msg, whirlpool_block_size);
-            aligned_message_block = (uint64_t*)ctx->message;
-        }
-
-        rhash_whirlpool_process_block(ctx->hash, aligned_message_block, nr);
+        /* the block is loaded with memcpy, no aligned copy is needed */
+        rhash_whirlpool_process_block(ctx->hash, msg, nr);
         msg += whirlpool_block_size;
         size -= whirlpool_block_size;
     }
@@ -199,7 +186,7 @@ void rhash_whirlpool_final(whirlpool_ctx *ctx, unsigned char* result, unsigned n
         while (index < 64) {
             ctx->message[index++] = 0;
         }
-        rhash_whirlpool_process_block(ctx->hash, msg64, nr);
+        rhash_whirlpool_process_block(ctx->hash, ctx->message, nr);
         index = 0;
     }
     /* due to optimization actually only 64-bit of message length are stored */
@@ -207,7 +194,7 @@ void rhash_whirlpool_final(whirlpool_ctx *ctx, unsigned char* result, unsigned n
         ctx->message[index++] = 0;
     }
     msg64[7] = be2me_64(ctx->length << 3);
-    rhash_whirlpool_process_block(ctx->hash, msg64, nr);
+    rhash_whirlpool_process_block(ctx->hash, ctx->message, nr);
 
     /* save result hash */
     be64_copy(result, 0, ctx->hash, 64);
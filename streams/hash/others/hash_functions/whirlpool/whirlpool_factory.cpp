@@ -47,4 +47,21 @@ namespace others {
         result = Whirlpool::Final(hashval);
         return result;
     }
+
+    bool Whirlpool::WholeBytesOnly() const {
+        return true;
+    }
+
+    std::size_t Whirlpool::BlockBytes(int) const {
+        return whirlpool_block_size;
+    }
+
+    bool Whirlpool::SaveState() {
+        m_saved_state = m_state;
+        return true;
+    }
+
+    void Whirlpool::RestoreState() {
+        m_state = m_saved_state;
+    }
 }
@@ -7,6 +7,11 @@ extern "C" {
 
 namespace sha3 {
 
+/* the S-box and MDS tables are constant, build them once before any Init() */
+static const struct arirang_tables {
+	arirang_tables() { arirang_gen_tabs(); }
+} tables;
+
 
 Arirang::Arirang(int numRounds) {
 	if (numRounds == -1) {
@@ -51,7 +56,6 @@ int Arirang::Init(int hashbitlen)
 	if ((hashbitlen != 224) && (hashbitlen != 256) && (hashbitlen != 384) && (hashbitlen != 512))
 		return BAD_HASHLEN;
 
-	arirang_gen_tabs();
 	// Setting the Hash Length
 	arirangState.hashbitlen = hashbitlen;
 	
@@ -1542,4 +1542,8 @@ BMW::BMW(const int numRounds) {
 	}
 }
 
+std::size_t BMW::UpdateBytes(int hashbitlen) const {
+	return hashbitlen <= 256 ? 64 : 128;
+}
+
 } // namespace sha3
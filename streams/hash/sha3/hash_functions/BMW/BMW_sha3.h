@@ -96,6 +96,7 @@ int Init(int hashbitlen);
 int Update(const BitSequence *data, DataLength databitlen);
 int Final(BitSequence *hashval);
 int Hash(int hashbitlen, const BitSequence *data, DataLength databitlen, BitSequence *hashval);
+std::size_t UpdateBytes(int hashbitlen) const override;
 
 };
 
@@ -117,18 +117,33 @@ int Blake::compress32( const BitSequence * datablock ) {
 #define BLAKE_ADD32(x,y)   ((unsigned int)((x) + (y)))
 #define BLAKE_XOR32(x,y)    ((unsigned int)((x) ^ (y)))
 
-#define G32(a,b,c,d,i) \
+#define G32(a,b,c,d,r,i) \
   do {\
-    v[a] = BLAKE_XOR32(m[blake_sigma[round][i]], blake_c32[blake_sigma[round][i+1]])+BLAKE_ADD32(v[a],v[b]);\
+    v[a] = BLAKE_XOR32(m[blake_sigma[r][i]], blake_c32[blake_sigma[r][i+1]])+BLAKE_ADD32(v[a],v[b]);\
     v[d] = BLAKE_ROT32(BLAKE_XOR32(v[d],v[a]),16);\
     v[c] = BLAKE_ADD32(v[c],v[d]);\
     v[b] = BLAKE_ROT32(BLAKE_XOR32(v[b],v[c]),12);\
-    v[a] = BLAKE_XOR32(m[blake_sigma[round][i+1]], blake_c32[blake_sigma[round][i]])+BLAKE_ADD32(v[a],v[b]); \
+    v[a] = BLAKE_XOR32(m[blake_sigma[r][i+1]], blake_c32[blake_sigma[r][i]])+BLAKE_ADD32(v[a],v[b]); \
     v[d] = BLAKE_ROT32(BLAKE_XOR32(v[d],v[a]), 8);\
     v[c] = BLAKE_ADD32(v[c],v[d]);\
     v[b] = BLAKE_ROT32(BLAKE_XOR32(v[b],v[c]), 7);\
   } while (0)
 
+/* the permutations repeat every 10 rounds, round r of a group of 10 uses
+   constant indices so that the message words and constants it reads are
+   resolved at compile time */
+#define BLAKE_ROUND32(r) \
+  if (round + (r) < blakeNumRounds32) {\
+    G32( 0, 4, 8,12,r, 0);\
+    G32( 1, 5, 9,13,r, 2);\
+    G32( 2, 6,10,14,r, 4);\
+    G32( 3, 7,11,15,r, 6);\
+    G32( 3, 4, 9,14,r,14);\
+    G32( 2, 7, 8,13,r,12);\
+    G32( 0, 5,10,15,r, 8);\
+    G32( 1, 6,11,12,r,10);\
+  }
+
   unsigned int v[16];
   unsigned int m[16];
   int round;
@@ -180,18 +195,17 @@ int Blake::compress32( const BitSequence * datablock ) {
     v[15] ^= blakeState.t32[1];
   }
 
-  for(round=0; round<blakeNumRounds32; ++round) {
-
-    G32( 0, 4, 8,12, 0);
-    G32( 1, 5, 9,13, 2);
-    G32( 2, 6,10,14, 4);
-    G32( 3, 7,11,15, 6);
-
-    G32( 3, 4, 9,14,14);   
-    G32( 2, 7, 8,13,12);
-    G32( 0, 5,10,15, 8);
-    G32( 1, 6,11,12,10);
-
+  for(round=0; round<blakeNumRounds32; round+=10) {
+    BLAKE_ROUND32(0);
+    BLAKE_ROUND32(1);
+    BLAKE_ROUND32(2);
+    BLAKE_ROUND32(3);
+    BLAKE_ROUND32(4);
+    BLAKE_ROUND32(5);
+    BLAKE_ROUND32(6);
+    BLAKE_ROUND32(7);
+    BLAKE_ROUND32(8);
+    BLAKE_ROUND32(9);
   }
 
   blakeState.h32[0] ^= v[ 0]; 
@@ -229,18 +243,30 @@ int Blake::compress64( const BitSequence * datablock ) {
 #define BLAKE_ADD64(x,y)   ((unsigned long long)((x) + (y)))
 #define BLAKE_XOR64(x,y)    ((unsigned long long)((x) ^ (y)))
   
-#define G64(a,b,c,d,i)\
+#define G64(a,b,c,d,r,i)\
   do { \
-    v[a] = BLAKE_ADD64(v[a],v[b])+BLAKE_XOR64(m[blake_sigma[round][i]], blake_c64[blake_sigma[round][i+1]]);\
+    v[a] = BLAKE_ADD64(v[a],v[b])+BLAKE_XOR64(m[blake_sigma[r][i]], blake_c64[blake_sigma[r][i+1]]);\
     v[d] = BLAKE_ROT64(BLAKE_XOR64(v[d],v[a]),32);\
     v[c] = BLAKE_ADD64(v[c],v[d]);\
     v[b] = BLAKE_ROT64(BLAKE_XOR64(v[b],v[c]),25);\
-    v[a] = BLAKE_ADD64(v[a],v[b])+BLAKE_XOR64(m[blake_sigma[round][i+1]], blake_c64[blake_sigma[round][i]]);\
+    v[a] = BLAKE_ADD64(v[a],v[b])+BLAKE_XOR64(m[blake_sigma[r][i+1]], blake_c64[blake_sigma[r][i]]);\
     v[d] = BLAKE_ROT64(BLAKE_XOR64(v[d],v[a]),16);\
     v[c] = BLAKE_ADD64(v[c],v[d]);\
     v[b] = BLAKE_ROT64(BLAKE_XOR64(v[b],v[c]),11);\
   } while (0)
 
+#define BLAKE_ROUND64(r) \
+  if (round + (r) < blakeNumRounds64) {\
+    G64( 0, 4, 8,12,r, 0);\
+    G64( 1, 5, 9,13,r, 2);\
+    G64( 2, 6,10,14,r, 4);\
+    G64( 3, 7,11,15,r, 6);\
+    G64( 3, 4, 9,14,r,14);\
+    G64( 2, 7, 8,13,r,12);\
+    G64( 0, 5,10,15,r, 8);\
+    G64( 1, 6,11,12,r,10);\
+  }
+
   unsigned long long v[16];
   unsigned long long m[16];
   int round;
@@ -296,18 +322,17 @@ int Blake::compress64( const BitSequence * datablock ) {
     v[15] ^= blakeState.t64[1];
   }
 
-  for(round=0; round<blakeNumRounds64; ++round) {
-    
-    G64( 0, 4, 8,12, 0);
-    G64( 1, 5, 9,13, 2);
-    G64( 2, 6,10,14, 4);
-    G64( 3, 7,11,15, 6);    
-
-    G64( 3, 4, 9,14,14);   
-    G64( 2, 7, 8,13,12);
-    G64( 0, 5,10,15, 8);
-    G64( 1, 6,11,12,10);
-
+  for(round=0; round<blakeNumRounds64; round+=10) {
+    BLAKE_ROUND64(0);
+    BLAKE_ROUND64(1);
+    BLAKE_ROUND64(2);
+    BLAKE_ROUND64(3);
+    BLAKE_ROUND64(4);
+    BLAKE_ROUND64(5);
+    BLAKE_ROUND64(6);
+    BLAKE_ROUND64(7);
+    BLAKE_ROUND64(8);
+    BLAKE_ROUND64(9);
   }
 
   blakeState.h64[0] ^= v[ 0]; 
@@ -542,6 +567,25 @@ int Blake::Update(const BitSequence * data, DataLength databitlen ) {
 }
 
 
+std::size_t Blake::BlockBytes( int hashbitlen ) const {
+
+  return hashbitlen < 384 ? 64 : 128;
+}
+
+
+bool Blake::SaveState() {
+
+  blakeSavedState = blakeState;
+  return true;
+}
+
+
+void Blake::RestoreState() {
+
+  blakeState = blakeSavedState;
+}
+
+
 int Blake::Final32( BitSequence * hashval ) {
 
 
@@ -71,6 +71,7 @@ private:
 int blakeNumRounds32;
 int blakeNumRounds64;
 hashState blakeState;
+hashState blakeSavedState; /* after the whole blocks of a constant prefix */
 
 public:
 Blake( const int numRounds );
@@ -80,6 +81,11 @@ int Final( BitSequence * hashval );
 int Hash( int hashbitlen, const BitSequence * data, DataLength databitlen, 
 		 BitSequence * hashval );
 
+protected:
+std::size_t BlockBytes( int hashbitlen ) const override;
+bool SaveState() override;
+void RestoreState() override;
+
 private:
 int AddSalt( const BitSequence * salt );
 int compress32( const BitSequence * datablock );
@@ -53,6 +53,23 @@ int Cubehash::Init(int hashbitlen)
   return SUCCESS;
 }
 
+std::size_t Cubehash::BlockBytes(int hashbitlen) const
+{
+  (void)hashbitlen;
+  return CUBEHASH_BLOCKBYTES;
+}
+
+bool Cubehash::SaveState()
+{
+  cubehashSavedState = cubehashState;
+  return true;
+}
+
+void Cubehash::RestoreState()
+{
+  cubehashState = cubehashSavedState;
+}
+
 int Cubehash::Update(const BitSequence *data,
                   DataLength databitlen)
 {
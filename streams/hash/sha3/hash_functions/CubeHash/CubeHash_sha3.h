@@ -26,6 +26,7 @@ typedef struct {
 private:
 int cubehashNumRounds;
 hashState cubehashState;
+hashState cubehashSavedState; /* after Init() (the IV costs 10 transforms) or a prefix */
 
 public:
 Cubehash(const int numRounds);
@@ -36,6 +37,11 @@ int Final(BitSequence *hashval);
 int Hash(int hashbitlen, const BitSequence *data,
                 DataLength databitlen, BitSequence *hashval);
 
+protected:
+std::size_t BlockBytes(int hashbitlen) const override;
+bool SaveState() override;
+void RestoreState() override;
+
 private:
 void transform();
 
@@ -652,4 +652,9 @@ int Edon::Hash(int hashbitlen, const BitSequence *data, DataLength databitlen, B
 	return(qq);
 }
 
+std::size_t Edon::UpdateBytes(int hashbitlen) const {
+	// the 224 and 256 bit versions lose data when Update() is called again
+	return hashbitlen <= 256 ? 0 : EdonR512_BLOCK_SIZE;
+}
+
 } // namespace sha3
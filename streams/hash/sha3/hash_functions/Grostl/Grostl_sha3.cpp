@@ -1,3 +1,4 @@
+#include <string.h>
 #include "Grostl_sha3.h"
 #include "tables.h"
 
@@ -10,274 +11,200 @@ namespace sha3 {
     GROSTL_T[1*256+GROSTL_EXT_BYTE(x[c1], 1)]^					\
     GROSTL_T[2*256+GROSTL_EXT_BYTE(x[c2], 2)]^					\
     GROSTL_T[3*256+GROSTL_EXT_BYTE(x[c3], 3)]^					\
-    GROSTL_T[4*256+GROSTL_EXT_BYTE(x[c4], 0)]^					\
-    GROSTL_T[5*256+GROSTL_EXT_BYTE(x[c5], 1)]^					\
-    GROSTL_T[6*256+GROSTL_EXT_BYTE(x[c6], 2)]^					\
-    GROSTL_T[7*256+GROSTL_EXT_BYTE(x[c7], 3)]
+    GROSTL_T[4*256+GROSTL_EXT_BYTE(x[c4], 4)]^					\
+    GROSTL_T[5*256+GROSTL_EXT_BYTE(x[c5], 5)]^					\
+    GROSTL_T[6*256+GROSTL_EXT_BYTE(x[c6], 6)]^					\
+    GROSTL_T[7*256+GROSTL_EXT_BYTE(x[c7], 7)]
 
 /* compute one round of P (short variants) */
-void GROSTL_RND512P(grostl_u32 *x, grostl_u32 *y, grostl_u32 r) {
-  x[ 0] ^= GROSTL_U32BIG((grostl_u32)0x00000000u)^r;
-  x[ 2] ^= GROSTL_U32BIG((grostl_u32)0x10000000u)^r;
-  x[ 4] ^= GROSTL_U32BIG((grostl_u32)0x20000000u)^r;
-  x[ 6] ^= GROSTL_U32BIG((grostl_u32)0x30000000u)^r;
-  x[ 8] ^= GROSTL_U32BIG((grostl_u32)0x40000000u)^r;
-  x[10] ^= GROSTL_U32BIG((grostl_u32)0x50000000u)^r;
-  x[12] ^= GROSTL_U32BIG((grostl_u32)0x60000000u)^r;
-  x[14] ^= GROSTL_U32BIG((grostl_u32)0x70000000u)^r;
-  GROSTL_COLUMN(x,y, 0,  0,  2,  4,  6,  9, 11, 13, 15);
-  GROSTL_COLUMN(x,y, 1,  9, 11, 13, 15,  0,  2,  4,  6);
-  GROSTL_COLUMN(x,y, 2,  2,  4,  6,  8, 11, 13, 15,  1);
-  GROSTL_COLUMN(x,y, 3, 11, 13, 15,  1,  2,  4,  6,  8);
-  GROSTL_COLUMN(x,y, 4,  4,  6,  8, 10, 13, 15,  1,  3);
-  GROSTL_COLUMN(x,y, 5, 13, 15,  1,  3,  4,  6,  8, 10);
-  GROSTL_COLUMN(x,y, 6,  6,  8, 10, 12, 15,  1,  3,  5);
-  GROSTL_COLUMN(x,y, 7, 15,  1,  3,  5,  6,  8, 10, 12);
-  GROSTL_COLUMN(x,y, 8,  8, 10, 12, 14,  1,  3,  5,  7);
-  GROSTL_COLUMN(x,y, 9,  1,  3,  5,  7,  8, 10, 12, 14);
-  GROSTL_COLUMN(x,y,10, 10, 12, 14,  0,  3,  5,  7,  9);
-  GROSTL_COLUMN(x,y,11,  3,  5,  7,  9, 10, 12, 14,  0);
-  GROSTL_COLUMN(x,y,12, 12, 14,  0,  2,  5,  7,  9, 11);
-  GROSTL_COLUMN(x,y,13,  5,  7,  9, 11, 12, 14,  0,  2);
-  GROSTL_COLUMN(x,y,14, 14,  0,  2,  4,  7,  9, 11, 13);
-  GROSTL_COLUMN(x,y,15,  7,  9, 11, 13, 14,  0,  2,  4);
+static void GROSTL_RND512P(grostl_u64 *x, grostl_u64 *y, grostl_u64 r) {
+  x[ 0] ^= GROSTL_PCONST(0x00, r);
+  x[ 1] ^= GROSTL_PCONST(0x10, r);
+  x[ 2] ^= GROSTL_PCONST(0x20, r);
+  x[ 3] ^= GROSTL_PCONST(0x30, r);
+  x[ 4] ^= GROSTL_PCONST(0x40, r);
+  x[ 5] ^= GROSTL_PCONST(0x50, r);
+  x[ 6] ^= GROSTL_PCONST(0x60, r);
+  x[ 7] ^= GROSTL_PCONST(0x70, r);
+  GROSTL_COLUMN(x,y, 0,  0,  1,  2,  3,  4,  5,  6,  7);
+  GROSTL_COLUMN(x,y, 1,  1,  2,  3,  4,  5,  6,  7,  0);
+  GROSTL_COLUMN(x,y, 2,  2,  3,  4,  5,  6,  7,  0,  1);
+  GROSTL_COLUMN(x,y, 3,  3,  4,  5,  6,  7,  0,  1,  2);
+  GROSTL_COLUMN(x,y, 4,  4,  5,  6,  7,  0,  1,  2,  3);
+  GROSTL_COLUMN(x,y, 5,  5,  6,  7,  0,  1,  2,  3,  4);
+  GROSTL_COLUMN(x,y, 6,  6,  7,  0,  1,  2,  3,  4,  5);
+  GROSTL_COLUMN(x,y, 7,  7,  0,  1,  2,  3,  4,  5,  6);
 }
 
 /* compute one round of Q (short variants) */
-void GROSTL_RND512Q(grostl_u32 *x, grostl_u32 *y, grostl_u32 r) {
-  x[ 0] = ~x[ 0];
-  x[ 1] ^= GROSTL_U32BIG((grostl_u32)0xffffffffu)^r;
-  x[ 2] = ~x[ 2];
-  x[ 3] ^= GROSTL_U32BIG((grostl_u32)0xffffffefu)^r;
-  x[ 4] = ~x[ 4];
-  x[ 5] ^= GROSTL_U32BIG((grostl_u32)0xffffffdfu)^r;
-  x[ 6] = ~x[ 6];
-  x[ 7] ^= GROSTL_U32BIG((grostl_u32)0xffffffcfu)^r;
-  x[ 8] = ~x[ 8];
-  x[ 9] ^= GROSTL_U32BIG((grostl_u32)0xffffffbfu)^r;
-  x[10] = ~x[10];
-  x[11] ^= GROSTL_U32BIG((grostl_u32)0xffffffafu)^r;
-  x[12] = ~x[12];
-  x[13] ^= GROSTL_U32BIG((grostl_u32)0xffffff9fu)^r;
-  x[14] = ~x[14];
-  x[15] ^= GROSTL_U32BIG((grostl_u32)0xffffff8fu)^r;
-  GROSTL_COLUMN(x,y, 0,  2,  6, 10, 14,  1,  5,  9, 13);
-  GROSTL_COLUMN(x,y, 1,  1,  5,  9, 13,  2,  6, 10, 14);
-  GROSTL_COLUMN(x,y, 2,  4,  8, 12,  0,  3,  7, 11, 15);
-  GROSTL_COLUMN(x,y, 3,  3,  7, 11, 15,  4,  8, 12,  0);
-  GROSTL_COLUMN(x,y, 4,  6, 10, 14,  2,  5,  9, 13,  1);
-  GROSTL_COLUMN(x,y, 5,  5,  9, 13,  1,  6, 10, 14,  2);
-  GROSTL_COLUMN(x,y, 6,  8, 12,  0,  4,  7, 11, 15,  3);
-  GROSTL_COLUMN(x,y, 7,  7, 11, 15,  3,  8, 12,  0,  4);
-  GROSTL_COLUMN(x,y, 8, 10, 14,  2,  6,  9, 13,  1,  5);
-  GROSTL_COLUMN(x,y, 9,  9, 13,  1,  5, 10, 14,  2,  6);
-  GROSTL_COLUMN(x,y,10, 12,  0,  4,  8, 11, 15,  3,  7);
-  GROSTL_COLUMN(x,y,11, 11, 15,  3,  7, 12,  0,  4,  8);
-  GROSTL_COLUMN(x,y,12, 14,  2,  6, 10, 13,  1,  5,  9);
-  GROSTL_COLUMN(x,y,13, 13,  1,  5,  9, 14,  2,  6, 10);
-  GROSTL_COLUMN(x,y,14,  0,  4,  8, 12, 15,  3,  7, 11);
-  GROSTL_COLUMN(x,y,15, 15,  3,  7, 11,  0,  4,  8, 12);
+static void GROSTL_RND512Q(grostl_u64 *x, grostl_u64 *y, grostl_u64 r) {
+  x[ 0] ^= GROSTL_QCONST(0x00, r);
+  x[ 1] ^= GROSTL_QCONST(0x10, r);
+  x[ 2] ^= GROSTL_QCONST(0x20, r);
+  x[ 3] ^= GROSTL_QCONST(0x30, r);
+  x[ 4] ^= GROSTL_QCONST(0x40, r);
+  x[ 5] ^= GROSTL_QCONST(0x50, r);
+  x[ 6] ^= GROSTL_QCONST(0x60, r);
+  x[ 7] ^= GROSTL_QCONST(0x70, r);
+  GROSTL_COLUMN(x,y, 0,  1,  3,  5,  7,  0,  2,  4,  6);
+  GROSTL_COLUMN(x,y, 1,  2,  4,  6,  0,  1,  3,  5,  7);
+  GROSTL_COLUMN(x,y, 2,  3,  5,  7,  1,  2,  4,  6,  0);
+  GROSTL_COLUMN(x,y, 3,  4,  6,  0,  2,  3,  5,  7,  1);
+  GROSTL_COLUMN(x,y, 4,  5,  7,  1,  3,  4,  6,  0,  2);
+  GROSTL_COLUMN(x,y, 5,  6,  0,  2,  4,  5,  7,  1,  3);
+  GROSTL_COLUMN(x,y, 6,  7,  1,  3,  5,  6,  0,  2,  4);
+  GROSTL_COLUMN(x,y, 7,  0,  2,  4,  6,  7,  1,  3,  5);
 }
 
-/* compute one round of P (short variants) */
-void GROSTL_RND1024P(grostl_u32 *x, grostl_u32 *y, grostl_u32 r) {
-  x[ 0] ^= GROSTL_U32BIG((grostl_u32)0x00000000u)^r;
-  x[ 2] ^= GROSTL_U32BIG((grostl_u32)0x10000000u)^r;
-  x[ 4] ^= GROSTL_U32BIG((grostl_u32)0x20000000u)^r;
-  x[ 6] ^= GROSTL_U32BIG((grostl_u32)0x30000000u)^r;
-  x[ 8] ^= GROSTL_U32BIG((grostl_u32)0x40000000u)^r;
-  x[10] ^= GROSTL_U32BIG((grostl_u32)0x50000000u)^r;
-  x[12] ^= GROSTL_U32BIG((grostl_u32)0x60000000u)^r;
-  x[14] ^= GROSTL_U32BIG((grostl_u32)0x70000000u)^r;
-  x[16] ^= GROSTL_U32BIG((grostl_u32)0x80000000u)^r;
-  x[18] ^= GROSTL_U32BIG((grostl_u32)0x90000000u)^r;
-  x[20] ^= GROSTL_U32BIG((grostl_u32)0xa0000000u)^r;
-  x[22] ^= GROSTL_U32BIG((grostl_u32)0xb0000000u)^r;
-  x[24] ^= GROSTL_U32BIG((grostl_u32)0xc0000000u)^r;
-  x[26] ^= GROSTL_U32BIG((grostl_u32)0xd0000000u)^r;
-  x[28] ^= GROSTL_U32BIG((grostl_u32)0xe0000000u)^r;
-  x[30] ^= GROSTL_U32BIG((grostl_u32)0xf0000000u)^r;
-
-  GROSTL_COLUMN(x,y, 0, 0, 2, 4, 6, 9,11,13,23);
-  GROSTL_COLUMN(x,y, 2, 2, 4, 6, 8,11,13,15,25);
-  GROSTL_COLUMN(x,y, 4, 4, 6, 8,10,13,15,17,27);
-  GROSTL_COLUMN(x,y, 6, 6, 8,10,12,15,17,19,29);
-  GROSTL_COLUMN(x,y, 8, 8,10,12,14,17,19,21,31);
-  GROSTL_COLUMN(x,y,10,10,12,14,16,19,21,23, 1);
-  GROSTL_COLUMN(x,y,12,12,14,16,18,21,23,25, 3);
-  GROSTL_COLUMN(x,y,14,14,16,18,20,23,25,27, 5);
-  GROSTL_COLUMN(x,y,16,16,18,20,22,25,27,29, 7);
-  GROSTL_COLUMN(x,y,18,18,20,22,24,27,29,31, 9);
-  GROSTL_COLUMN(x,y,20,20,22,24,26,29,31, 1,11);
-  GROSTL_COLUMN(x,y,22,22,24,26,28,31, 1, 3,13);
-  GROSTL_COLUMN(x,y,24,24,26,28,30, 1, 3, 5,15);
-  GROSTL_COLUMN(x,y,26,26,28,30, 0, 3, 5, 7,17);
-  GROSTL_COLUMN(x,y,28,28,30, 0, 2, 5, 7, 9,19);
-  GROSTL_COLUMN(x,y,30,30, 0, 2, 4, 7, 9,11,21);
-
-  GROSTL_COLUMN(x,y, 1, 9,11,13,23, 0, 2, 4, 6);
-  GROSTL_COLUMN(x,y, 3,11,13,15,25, 2, 4, 6, 8);
-  GROSTL_COLUMN(x,y, 5,13,15,17,27, 4, 6, 8,10);
-  GROSTL_COLUMN(x,y, 7,15,17,19,29, 6, 8,10,12);
-  GROSTL_COLUMN(x,y, 9,17,19,21,31, 8,10,12,14);
-  GROSTL_COLUMN(x,y,11,19,21,23, 1,10,12,14,16);
-  GROSTL_COLUMN(x,y,13,21,23,25, 3,12,14,16,18);
-  GROSTL_COLUMN(x,y,15,23,25,27, 5,14,16,18,20);
-  GROSTL_COLUMN(x,y,17,25,27,29, 7,16,18,20,22);
-  GROSTL_COLUMN(x,y,19,27,29,31, 9,18,20,22,24);
-  GROSTL_COLUMN(x,y,21,29,31, 1,11,20,22,24,26);
-  GROSTL_COLUMN(x,y,23,31, 1, 3,13,22,24,26,28);
-  GROSTL_COLUMN(x,y,25, 1, 3, 5,15,24,26,28,30);
-  GROSTL_COLUMN(x,y,27, 3, 5, 7,17,26,28,30, 0);
-  GROSTL_COLUMN(x,y,29, 5, 7, 9,19,28,30, 0, 2);
-  GROSTL_COLUMN(x,y,31, 7, 9,11,21,30, 0, 2, 4);
+/* compute one round of P (long variants) */
+static void GROSTL_RND1024P(grostl_u64 *x, grostl_u64 *y, grostl_u64 r) {
+  x[ 0] ^= GROSTL_PCONST(0x00, r);
+  x[ 1] ^= GROSTL_PCONST(0x10, r);
+  x[ 2] ^= GROSTL_PCONST(0x20, r);
+  x[ 3] ^= GROSTL_PCONST(0x30, r);
+  x[ 4] ^= GROSTL_PCONST(0x40, r);
+  x[ 5] ^= GROSTL_PCONST(0x50, r);
+  x[ 6] ^= GROSTL_PCONST(0x60, r);
+  x[ 7] ^= GROSTL_PCONST(0x70, r);
+  x[ 8] ^= GROSTL_PCONST(0x80, r);
+  x[ 9] ^= GROSTL_PCONST(0x90, r);
+  x[10] ^= GROSTL_PCONST(0xa0, r);
+  x[11] ^= GROSTL_PCONST(0xb0, r);
+  x[12] ^= GROSTL_PCONST(0xc0, r);
+  x[13] ^= GROSTL_PCONST(0xd0, r);
+  x[14] ^= GROSTL_PCONST(0xe0, r);
+  x[15] ^= GROSTL_PCONST(0xf0, r);
+  GROSTL_COLUMN(x,y, 0,  0,  1,  2,  3,  4,  5,  6, 11);
+  GROSTL_COLUMN(x,y, 1,  1,  2,  3,  4,  5,  6,  7, 12);
+  GROSTL_COLUMN(x,y, 2,  2,  3,  4,  5,  6,  7,  8, 13);
+  GROSTL_COLUMN(x,y, 3,  3,  4,  5,  6,  7,  8,  9, 14);
+  GROSTL_COLUMN(x,y, 4,  4,  5,  6,  7,  8,  9, 10, 15);
+  GROSTL_COLUMN(x,y, 5,  5,  6,  7,  8,  9, 10, 11,  0);
+  GROSTL_COLUMN(x,y, 6,  6,  7,  8,  9, 10, 11, 12,  1);
+  GROSTL_COLUMN(x,y, 7,  7,  8,  9, 10, 11, 12, 13,  2);
+  GROSTL_COLUMN(x,y, 8,  8,  9, 10, 11, 12, 13, 14,  3);
+  GROSTL_COLUMN(x,y, 9,  9, 10, 11, 12, 13, 14, 15,  4);
+  GROSTL_COLUMN(x,y,10, 10, 11, 12, 13, 14, 15,  0,  5);
+  GROSTL_COLUMN(x,y,11, 11, 12, 13, 14, 15,  0,  1,  6);
+  GROSTL_COLUMN(x,y,12, 12, 13, 14, 15,  0,  1,  2,  7);
+  GROSTL_COLUMN(x,y,13, 13, 14, 15,  0,  1,  2,  3,  8);
+  GROSTL_COLUMN(x,y,14, 14, 15,  0,  1,  2,  3,  4,  9);
+  GROSTL_COLUMN(x,y,15, 15,  0,  1,  2,  3,  4,  5, 10);
 }
 
-/* compute one round of Q (short variants) */
-void GROSTL_RND1024Q(grostl_u32 *x, grostl_u32 *y, grostl_u32 r) {
-  x[ 0] = ~x[ 0];
-  x[ 1] ^= GROSTL_U32BIG((grostl_u32)0xffffffffu)^r;
-  x[ 2] = ~x[ 2];
-  x[ 3] ^= GROSTL_U32BIG((grostl_u32)0xffffffefu)^r;
-  x[ 4] = ~x[ 4];
-  x[ 5] ^= GROSTL_U32BIG((grostl_u32)0xffffffdfu)^r;
-  x[ 6] = ~x[ 6];
-  x[ 7] ^= GROSTL_U32BIG((grostl_u32)0xffffffcfu)^r;
-  x[ 8] = ~x[ 8];
-  x[ 9] ^= GROSTL_U32BIG((grostl_u32)0xffffffbfu)^r;
-  x[10] = ~x[10];
-  x[11] ^= GROSTL_U32BIG((grostl_u32)0xffffffafu)^r;
-  x[12] = ~x[12];
-  x[13] ^= GROSTL_U32BIG((grostl_u32)0xffffff9fu)^r;
-  x[14] = ~x[14];
-  x[15] ^= GROSTL_U32BIG((grostl_u32)0xffffff8fu)^r;
-  x[16] = ~x[16];
-  x[17] ^= GROSTL_U32BIG((grostl_u32)0xffffff7fu)^r;
-  x[18] = ~x[18];
-  x[19] ^= GROSTL_U32BIG((grostl_u32)0xffffff6fu)^r;
-  x[20] = ~x[20];
-  x[21] ^= GROSTL_U32BIG((grostl_u32)0xffffff5fu)^r;
-  x[22] = ~x[22];
-  x[23] ^= GROSTL_U32BIG((grostl_u32)0xffffff4fu)^r;
-  x[24] = ~x[24];
-  x[25] ^= GROSTL_U32BIG((grostl_u32)0xffffff3fu)^r;
-  x[26] = ~x[26];
-  x[27] ^= GROSTL_U32BIG((grostl_u32)0xffffff2fu)^r;
-  x[28] = ~x[28];
-  x[29] ^= GROSTL_U32BIG((grostl_u32)0xffffff1fu)^r;
-  x[30] = ~x[30];
-  x[31] ^= GROSTL_U32BIG((grostl_u32)0xffffff0fu)^r;
-
-  GROSTL_COLUMN(x,y, 0,  2,  6, 10, 22,  1,  5,  9, 13);
-  GROSTL_COLUMN(x,y, 1,  1,  5,  9, 13,  2,  6, 10, 22);
-  GROSTL_COLUMN(x,y, 2,  4,  8, 12, 24,  3,  7, 11, 15);
-  GROSTL_COLUMN(x,y, 3,  3,  7, 11, 15,  4,  8, 12, 24);
-  GROSTL_COLUMN(x,y, 4,  6, 10, 14, 26,  5,  9, 13, 17);
-  GROSTL_COLUMN(x,y, 5,  5,  9, 13, 17,  6, 10, 14, 26);
-  GROSTL_COLUMN(x,y, 6,  8, 12, 16, 28,  7, 11, 15, 19);
-  GROSTL_COLUMN(x,y, 7,  7, 11, 15, 19,  8, 12, 16, 28);
-  GROSTL_COLUMN(x,y, 8, 10, 14, 18, 30,  9, 13, 17, 21);
-  GROSTL_COLUMN(x,y, 9,  9, 13, 17, 21, 10, 14, 18, 30);
-  GROSTL_COLUMN(x,y,10, 12, 16, 20,  0, 11, 15, 19, 23);
-  GROSTL_COLUMN(x,y,11, 11, 15, 19, 23, 12, 16, 20,  0);
-  GROSTL_COLUMN(x,y,12, 14, 18, 22,  2, 13, 17, 21, 25);
-  GROSTL_COLUMN(x,y,13, 13, 17, 21, 25, 14, 18, 22,  2);
-  GROSTL_COLUMN(x,y,14, 16, 20, 24,  4, 15, 19, 23, 27);
-  GROSTL_COLUMN(x,y,15, 15, 19, 23, 27, 16, 20, 24,  4);
-
-  GROSTL_COLUMN(x,y,16, 18, 22, 26,  6, 17, 21, 25, 29);
-  GROSTL_COLUMN(x,y,17, 17, 21, 25, 29, 18, 22, 26,  6);
-  GROSTL_COLUMN(x,y,18, 20, 24, 28,  8, 19, 23, 27, 31);
-  GROSTL_COLUMN(x,y,19, 19, 23, 27, 31, 20, 24, 28,  8);
-  GROSTL_COLUMN(x,y,20, 22, 26, 30, 10, 21, 25, 29,  1);
-  GROSTL_COLUMN(x,y,21, 21, 25, 29,  1, 22, 26, 30, 10);
-  GROSTL_COLUMN(x,y,22, 24, 28,  0, 12, 23, 27, 31,  3);
-  GROSTL_COLUMN(x,y,23, 23, 27, 31,  3, 24, 28,  0, 12);
-  GROSTL_COLUMN(x,y,24, 26, 30,  2, 14, 25, 29,  1,  5);
-  GROSTL_COLUMN(x,y,25, 25, 29,  1,  5, 26, 30,  2, 14);
-  GROSTL_COLUMN(x,y,26, 28,  0,  4, 16, 27, 31,  3,  7);
-  GROSTL_COLUMN(x,y,27, 27, 31,  3,  7, 28,  0,  4, 16);
-  GROSTL_COLUMN(x,y,28, 30,  2,  6, 18, 29,  1,  5,  9);
-  GROSTL_COLUMN(x,y,29, 29,  1,  5,  9, 30,  2,  6, 18);
-  GROSTL_COLUMN(x,y,30,  0,  4,  8, 20, 31,  3,  7, 11);
-  GROSTL_COLUMN(x,y,31, 31,  3,  7, 11,  0,  4,  8, 20);
+/* compute one round of Q (long variants) */
+static void GROSTL_RND1024Q(grostl_u64 *x, grostl_u64 *y, grostl_u64 r) {
+  x[ 0] ^= GROSTL_QCONST(0x00, r);
+  x[ 1] ^= GROSTL_QCONST(0x10, r);
+  x[ 2] ^= GROSTL_QCONST(0x20, r);
+  x[ 3] ^= GROSTL_QCONST(0x30, r);
+  x[ 4] ^= GROSTL_QCONST(0x40, r);
+  x[ 5] ^= GROSTL_QCONST(0x50, r);
+  x[ 6] ^= GROSTL_QCONST(0x60, r);
+  x[ 7] ^= GROSTL_QCONST(0x70, r);
+  x[ 8] ^= GROSTL_QCONST(0x80, r);
+  x[ 9] ^= GROSTL_QCONST(0x90, r);
+  x[10] ^= GROSTL_QCONST(0xa0, r);
+  x[11] ^= GROSTL_QCONST(0xb0, r);
+  x[12] ^= GROSTL_QCONST(0xc0, r);
+  x[13] ^= GROSTL_QCONST(0xd0, r);
+  x[14] ^= GROSTL_QCONST(0xe0, r);
+  x[15] ^= GROSTL_QCONST(0xf0, r);
+  GROSTL_COLUMN(x,y, 0,  1,  3,  5, 11,  0,  2,  4,  6);
+  GROSTL_COLUMN(x,y, 1,  2,  4,  6, 12,  1,  3,  5,  7);
+  GROSTL_COLUMN(x,y, 2,  3,  5,  7, 13,  2,  4,  6,  8);
+  GROSTL_COLUMN(x,y, 3,  4,  6,  8, 14,  3,  5,  7,  9);
+  GROSTL_COLUMN(x,y, 4,  5,  7,  9, 15,  4,  6,  8, 10);
+  GROSTL_COLUMN(x,y, 5,  6,  8, 10,  0,  5,  7,  9, 11);
+  GROSTL_COLUMN(x,y, 6,  7,  9, 11,  1,  6,  8, 10, 12);
+  GROSTL_COLUMN(x,y, 7,  8, 10, 12,  2,  7,  9, 11, 13);
+  GROSTL_COLUMN(x,y, 8,  9, 11, 13,  3,  8, 10, 12, 14);
+  GROSTL_COLUMN(x,y, 9, 10, 12, 14,  4,  9, 11, 13, 15);
+  GROSTL_COLUMN(x,y,10, 11, 13, 15,  5, 10, 12, 14,  0);
+  GROSTL_COLUMN(x,y,11, 12, 14,  0,  6, 11, 13, 15,  1);
+  GROSTL_COLUMN(x,y,12, 13, 15,  1,  7, 12, 14,  0,  2);
+  GROSTL_COLUMN(x,y,13, 14,  0,  2,  8, 13, 15,  1,  3);
+  GROSTL_COLUMN(x,y,14, 15,  1,  3,  9, 14,  0,  2,  4);
+  GROSTL_COLUMN(x,y,15,  0,  2,  4, 10, 15,  1,  3,  5);
 }
 
-
-/* compute compression function (short variants) */
-void GROSTL_F512(grostl_u32 *h, const grostl_u32 *m, const int rounds512) {
+/* run rounds-1 rounds with round constants 0, 1, ... followed by one
+   round with constant 'last', result is left in x (y is scratch) */
+template <void (*RND)(grostl_u64*, grostl_u64*, grostl_u64), int COLS>
+static inline void GROSTL_PERMUTATION(grostl_u64 *x, grostl_u64 *y, const int rounds, const grostl_u64 last) {
   int i;
-  grostl_u32 Ptmp[2*GROSTL_COLS512];
-  grostl_u32 Qtmp[2*GROSTL_COLS512];
-  grostl_u32 y[2*GROSTL_COLS512];
-  grostl_u32 z[2*GROSTL_COLS512];
+  if (rounds < 1) return;
 
-  for (i = 0; i < 2*GROSTL_COLS512; i++) {
-    z[i] = m[i];
+  for (i = 0; i + 2 < rounds; i += 2) {
+    RND(x, y, i);
+    RND(y, x, i+1);
+  }
+  if (i + 1 < rounds) {
+    RND(x, y, i);
+    RND(y, x, last);
+  }
+  else {
+    RND(x, y, last);
+    memcpy(x, y, COLS*sizeof(grostl_u64));
+  }
+}
+
+/* the short variants run at most 10 rounds */
+static inline int GROSTL_SHORT_ROUNDS(const int rounds512) {
+  return rounds512 < GROSTL_ROUNDS512 ? rounds512 : GROSTL_ROUNDS512;
+}
+
+/* the long variants run rounds in pairs (at least one pair), the last
+   round of Q always uses constant 13 and the last round of P uses
+   rounds1024-1 */
+static inline int GROSTL_LONG_ROUNDS(const int rounds1024) {
+  return rounds1024 <= 2 ? 2 : (rounds1024 + 1) & ~1;
+}
+
+/* compute compression function (short variants) */
+static void GROSTL_F512(grostl_u64 *h, const grostl_u64 *m, const int rounds512) {
+  int i, rounds = GROSTL_SHORT_ROUNDS(rounds512);
+  grostl_u64 Ptmp[GROSTL_COLS512];
+  grostl_u64 Qtmp[GROSTL_COLS512];
+  grostl_u64 y[GROSTL_COLS512];
+
+  for (i = 0; i < GROSTL_COLS512; i++) {
+    Qtmp[i] = m[i];
     Ptmp[i] = h[i]^m[i];
   }
 
   /* compute Q(m) */
-  if (rounds512 >= 1) GROSTL_RND512Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000000u));
-  if (rounds512 >= 2) GROSTL_RND512Q(y, z, GROSTL_U32BIG((grostl_u32)0x00000001u));
-  if (rounds512 >= 3) GROSTL_RND512Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000002u));
-  if (rounds512 >= 4) GROSTL_RND512Q(y, z, GROSTL_U32BIG((grostl_u32)0x00000003u));
-  if (rounds512 >= 5) GROSTL_RND512Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000004u));
-  if (rounds512 >= 6) GROSTL_RND512Q(y, z, GROSTL_U32BIG((grostl_u32)0x00000005u));
-  if (rounds512 >= 7) GROSTL_RND512Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000006u));
-  if (rounds512 >= 8) GROSTL_RND512Q(y, z, GROSTL_U32BIG((grostl_u32)0x00000007u));
-  if (rounds512 >= 9) GROSTL_RND512Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000008u));
-  if (rounds512 >= 10) GROSTL_RND512Q(y, Qtmp, GROSTL_U32BIG((grostl_u32)0x00000009u));
+  GROSTL_PERMUTATION<GROSTL_RND512Q, GROSTL_COLS512>(Qtmp, y, rounds, rounds-1);
 
   /* compute P(h+m) */
-  if (rounds512 >= 1) GROSTL_RND512P(Ptmp, y, GROSTL_U32BIG((grostl_u32)0x00000000u));
-  if (rounds512 >= 2) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x01000000u));
-  if (rounds512 >= 3) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x02000000u));
-  if (rounds512 >= 4) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x03000000u));
-  if (rounds512 >= 5) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x04000000u));
-  if (rounds512 >= 6) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x05000000u));
-  if (rounds512 >= 7) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x06000000u));
-  if (rounds512 >= 8) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x07000000u));
-  if (rounds512 >= 9) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x08000000u));
-  if (rounds512 >= 10) GROSTL_RND512P(y, Ptmp, GROSTL_U32BIG((grostl_u32)0x09000000u));
+  GROSTL_PERMUTATION<GROSTL_RND512P, GROSTL_COLS512>(Ptmp, y, rounds, rounds-1);
 
   /* compute P(h+m) + Q(m) + h */
-  for (i = 0; i < 2*GROSTL_COLS512; i++) {
+  for (i = 0; i < GROSTL_COLS512; i++) {
     h[i] ^= Ptmp[i]^Qtmp[i];
   }
 }
 
 /* compute compression function (long variants) */
-void GROSTL_F1024(grostl_u32 *h, const grostl_u32 *m, const int rounds1024) {
-  int i;
-  grostl_u32 Ptmp[2*GROSTL_COLS1024];
-  grostl_u32 Qtmp[2*GROSTL_COLS1024];
-  grostl_u32 y[2*GROSTL_COLS1024];
-  grostl_u32 z[2*GROSTL_COLS1024];
-
-  for (i = 0; i < 2*GROSTL_COLS1024; i++) {
-    z[i] = m[i];
+static void GROSTL_F1024(grostl_u64 *h, const grostl_u64 *m, const int rounds1024) {
+  int i, rounds = GROSTL_LONG_ROUNDS(rounds1024);
+  grostl_u64 Ptmp[GROSTL_COLS1024];
+  grostl_u64 Qtmp[GROSTL_COLS1024];
+  grostl_u64 y[GROSTL_COLS1024];
+
+  for (i = 0; i < GROSTL_COLS1024; i++) {
+    Qtmp[i] = m[i];
     Ptmp[i] = h[i]^m[i];
   }
 
   /* compute Q(m) */
-  GROSTL_RND1024Q(z, y, GROSTL_U32BIG((grostl_u32)0x00000000u));
-  for (i = 1; i < rounds1024-1; i += 2) {
-    GROSTL_RND1024Q(y, z, GROSTL_U32BIG((grostl_u32)i));
-    GROSTL_RND1024Q(z, y, GROSTL_U32BIG((grostl_u32)i+1));
-  }
-  GROSTL_RND1024Q(y, Qtmp, GROSTL_U32BIG((grostl_u32)0x0000000du));
+  GROSTL_PERMUTATION<GROSTL_RND1024Q, GROSTL_COLS1024>(Qtmp, y, rounds, 0x0d);
 
   /* compute P(h+m) */
-  GROSTL_RND1024P(Ptmp, y, GROSTL_U32BIG((grostl_u32)0x00000000u));
-  for (i = 1; i < rounds1024-1; i += 2) {
-    GROSTL_RND1024P(y, z, GROSTL_U32BIG((grostl_u32)i<<24));
-    GROSTL_RND1024P(z, y, GROSTL_U32BIG(((grostl_u32)i+1)<<24));
-  }
-  GROSTL_RND1024P(y, Ptmp, GROSTL_U32BIG(((grostl_u32)rounds1024-1)<<24));
+  GROSTL_PERMUTATION<GROSTL_RND1024P, GROSTL_COLS1024>(Ptmp, y, rounds, (grostl_u8)(rounds1024-1));
 
   /* compute P(h+m) + Q(m) + h */
-  for (i = 0; i < 2*GROSTL_COLS1024; i++) {
+  for (i = 0; i < GROSTL_COLS1024; i++) {
     h[i] ^= Ptmp[i]^Qtmp[i];
   }
 }
@@ -289,8 +216,9 @@ void Grostl::Transform(hashState *ctx,
 	       int msglen, const int rounds512, const int rounds1024) {
   /* determine variant, SHORT or LONG, and select underlying
      compression function based on the variant */
-  void (*F)(grostl_u32*,const grostl_u32*, const int);
+  void (*F)(grostl_u64*,const grostl_u64*, const int);
   int selectedRounds;
+  grostl_u64 m[GROSTL_COLS1024];
   switch ( ctx->v ) {
   case SHORT : { F = &GROSTL_F512; selectedRounds = rounds512; break; }
   case LONG  : 
@@ -300,7 +228,8 @@ void Grostl::Transform(hashState *ctx,
   /* digest message, one block at a time */
   for (; msglen >= ctx->statesize; 
        msglen -= ctx->statesize, input += ctx->statesize) {
-    F(ctx->chaining,(grostl_u32*)input, selectedRounds);
+    memcpy(m, input, ctx->statesize);
+    F(ctx->chaining, m, selectedRounds);
 
     /* increment block counter */
     ctx->block_counter1++;
@@ -311,50 +240,26 @@ void Grostl::Transform(hashState *ctx,
 /* given state h, do h <- P(h)+h */
 void Grostl::OutputTransformation(hashState *ctx, const int rounds512, const int rounds1024) {
   int j;
-  grostl_u32 *temp, *y, *z;
-  temp = (grostl_uint_32t *) malloc(2*ctx->columns*sizeof(grostl_u32));
-  y    = (grostl_uint_32t *) malloc(2*ctx->columns*sizeof(grostl_u32));
-  z    = (grostl_uint_32t *) malloc(2*ctx->columns*sizeof(grostl_u32));
+  grostl_u64 temp[GROSTL_COLS1024];
+  grostl_u64 y[GROSTL_COLS1024];
+
+  for (j = 0; j < ctx->columns; j++) {
+    temp[j] = ctx->chaining[j];
+  }
 
   /* determine variant */
   switch (ctx->v) {
   case SHORT :
-    for (j = 0; j < 2*GROSTL_COLS512; j++) {
-      temp[j] = ctx->chaining[j];
-    }
-	if (rounds512 >= 1) GROSTL_RND512P(temp, y, GROSTL_U32BIG((grostl_u32)0x00000000u));
-    if (rounds512 >= 2) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x01000000u));
-    if (rounds512 >= 3) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x02000000u));
-    if (rounds512 >= 4) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x03000000u));
-    if (rounds512 >= 5) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x04000000u));
-    if (rounds512 >= 6) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x05000000u));
-    if (rounds512 >= 7) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x06000000u));
-    if (rounds512 >= 8) GROSTL_RND512P(y, z, GROSTL_U32BIG((grostl_u32)0x07000000u));
-    if (rounds512 >= 9) GROSTL_RND512P(z, y, GROSTL_U32BIG((grostl_u32)0x08000000u));
-    /*if (rounds512 >= 10)*/ GROSTL_RND512P(y, temp, GROSTL_U32BIG((grostl_u32)0x09000000u));
-    for (j = 0; j < 2*GROSTL_COLS512; j++) {
-      ctx->chaining[j] ^= temp[j];
-    }
+    GROSTL_PERMUTATION<GROSTL_RND512P, GROSTL_COLS512>(temp, y, GROSTL_SHORT_ROUNDS(rounds512), GROSTL_SHORT_ROUNDS(rounds512)-1);
     break;
   case LONG  :
-    for (j = 0; j < 2*GROSTL_COLS1024; j++) {
-      temp[j] = ctx->chaining[j];
-    }
-    GROSTL_RND1024P(temp,y,GROSTL_U32BIG((grostl_u32)0x00000000u));
-    for (j = 1; j < rounds1024-1; j += 2) {
-      GROSTL_RND1024P(y,z,GROSTL_U32BIG((grostl_u32)j<<24));
-      GROSTL_RND1024P(z,y,GROSTL_U32BIG(((grostl_u32)j+1)<<24));
-    }
-    GROSTL_RND1024P(y,temp,GROSTL_U32BIG(((grostl_u32)rounds1024-1)<<24));
-    for (j = 0; j < 2*GROSTL_COLS1024; j++) {
-      ctx->chaining[j] ^= temp[j];
-    }
+    GROSTL_PERMUTATION<GROSTL_RND1024P, GROSTL_COLS1024>(temp, y, GROSTL_LONG_ROUNDS(rounds1024), (grostl_u8)(rounds1024-1));
     break;
   }
 
-  free(temp);
-  free(y);
-  free(z);
+  for (j = 0; j < ctx->columns; j++) {
+    ctx->chaining[j] ^= temp[j];
+  }
 }
 
 /* initialise context */
@@ -377,14 +282,10 @@ int Grostl::Init(int hashbitlen) {
     grostlState.v = LONG;
   }
 
-  /* allocate memory for state and data buffer */
-  grostlState.chaining = (grostl_uint_32t *) calloc(grostlState.statesize,1);
-  grostlState.buffer = (BitSequence *) malloc(grostlState.statesize);
-  if (grostlState.chaining == NULL || grostlState.buffer == NULL)
-    return FAIL;
-
-  /* set initial value */
-  grostlState.chaining[2*grostlState.columns-1] = GROSTL_U32BIG((grostl_u32)hashbitlen);
+  /* set initial value, the output length in the last two bytes */
+  memset(grostlState.chaining, 0, sizeof(grostlState.chaining));
+  ((grostl_u8*)grostlState.chaining)[grostlState.statesize-2] = (grostl_u8)(hashbitlen >> 8);
+  ((grostl_u8*)grostlState.chaining)[grostlState.statesize-1] = (grostl_u8)hashbitlen;
 
   /* set other variables */
   grostlState.hashbitlen = hashbitlen;
@@ -500,15 +401,9 @@ int Grostl::Final(BitSequence* output) {
     output[j] = s[i];
   }
 
-  /* zeroise relevant variables and deallocate memory */
-  for (i = 0; i < grostlState.columns; i++) {
-    grostlState.chaining[i] = 0;
-  }
-  for (i = 0; i < grostlState.statesize; i++) {
-    grostlState.buffer[i] = 0;
-  }
-  free(grostlState.chaining);
-  free(grostlState.buffer);
+  /* zeroise relevant variables */
+  memset(grostlState.chaining, 0, sizeof(grostlState.chaining));
+  memset(grostlState.buffer, 0, sizeof(grostlState.buffer));
 
   return SUCCESS;
 }
@@ -23,18 +23,16 @@ class Grostl : public sha3_interface {
 #define GROSTL_ROUNDS512 10
 #define GROSTL_ROUNDS1024 14
 
-#define GROSTL_ROTL32(v, n) ((((v)<<(n))|((v)>>(32-(n))))&li_32(ffffffff))
-
 #if (PLATFORM_BYTE_ORDER == IS_BIG_ENDIAN)
-#define GROSTL_EXT_BYTE(var,n) ((grostl_u8)((grostl_u32)(var) >> (8*(3-(n)))))
-#define GROSTL_U32BIG(a) (a)
+#define GROSTL_EXT_BYTE(var,n) ((grostl_u8)((grostl_u64)(var) >> (8*(7-(n)))))
+#define GROSTL_PCONST(c,r) ((grostl_u64)((c)^(r)) << 56)
+#define GROSTL_QCONST(c,r) (~(grostl_u64)((c)^(r)))
 #endif /* IS_BIG_ENDIAN */
 
 #if (PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
-#define GROSTL_EXT_BYTE(var,n) ((grostl_u8)((grostl_u32)(var) >> (8*n)))
-#define GROSTL_U32BIG(a)				\
-  ((GROSTL_ROTL32(a,8) & li_32(00FF00FF)) |		\
-   (GROSTL_ROTL32(a,24) & li_32(FF00FF00)))
+#define GROSTL_EXT_BYTE(var,n) ((grostl_u8)((grostl_u64)(var) >> (8*(n))))
+#define GROSTL_PCONST(c,r) ((grostl_u64)((c)^(r)))
+#define GROSTL_QCONST(c,r) (~((grostl_u64)((c)^(r)) << 56))
 #endif /* IS_LITTLE_ENDIAN */
 
 typedef enum { LONG, SHORT } Var;
@@ -43,11 +41,11 @@ typedef enum { LONG, SHORT } Var;
 /* NIST API begin */
 typedef enum { SUCCESS = 0, FAIL = 1, BAD_HASHLEN = 2 } HashReturn;
 typedef struct {
-  grostl_u32 *chaining;            /* actual state */
+  grostl_u64 chaining[GROSTL_COLS1024]; /* actual state, one 64-bit word per column */
   grostl_u32 block_counter1,
     block_counter2;         /* message block counter(s) */
   int hashbitlen;           /* output length in bits */
-  BitSequence *buffer;      /* data buffer */
+  BitSequence buffer[GROSTL_SIZE1024]; /* data buffer */
   int buf_ptr;              /* data buffer pointer */
   int bits_in_last_byte;    /* no. of message bits in last byte of
 			       data buffer */
@@ -5,27 +5,27 @@
 #include "brg_types.h"
 
 #if (PLATFORM_BYTE_ORDER == IS_BIG_ENDIAN)
-const grostl_u32 GROSTL_T[8*256]  /*__attribute__((aligned(64)))*/ = {
-  0xc632f4a5UL,0xf86f9784UL,0xee5eb099UL,0xf67a8c8dUL,0xffe8170dUL,0xd60adcbdUL,0xde16c8b1UL,0x916dfc54UL,0x6090f050UL,0x02070503UL,0xce2ee0a9UL,0x56d1877dUL,0xe7cc2b19UL,0xb513a662UL,0x4d7c31e6UL,0xec59b59aUL,0x8f40cf45UL,0x1fa3bc9dUL,0x8949c040UL,0xfa689287UL,0xefd03f15UL,0xb29426ebUL,0x8ece40c9UL,0xfbe61d0bUL,0x416e2fecUL,0xb31aa967UL,0x5f431cfdUL,0x456025eaUL,0x23f9dabfUL,0x535102f7UL,0xe445a196UL,0x9b76ed5bUL,0x75285dc2UL,0xe1c5241cUL,0x3dd4e9aeUL,0x4cf2be6aUL,0x6c82ee5aUL,0x7ebdc341UL,0xf5f30602UL,0x8352d14fUL,0x688ce45cUL,0x515607f4UL,0xd18d5c34UL,0xf9e11808UL,0xe24cae93UL,0xab3e9573UL,0x6297f553UL,0x2a6b413fUL,0x081c140cUL,0x9563f652UL,0x46e9af65UL,0x9d7fe25eUL,0x30487828UL,0x37cff8a1UL,0x0a1b110fUL,0x2febc4b5UL,0x0e151b09UL,0x247e5a36UL,0x1badb69bUL,0xdf98473dUL,0xcda76a26UL,0x4ef5bb69UL,0x7f334ccdUL,0xea50ba9fUL,0x123f2d1bUL,0x1da4b99eUL,0x58c49c74UL,0x3446722eUL,0x3641772dUL,0xdc11cdb2UL,0xb49d29eeUL,0x5b4d16fbUL,0xa4a501f6UL,0x76a1d74dUL,0xb714a361UL,0x7d3449ceUL,0x52df8d7bUL,0xdd9f423eUL,0x5ecd9371UL,0x13b1a297UL,0xa6a204f5UL,0xb901b868UL,0x00000000UL,0xc1b5742cUL,0x40e0a060UL,0xe3c2211fUL,0x793a43c8UL,0xb69a2cedUL,0xd40dd9beUL,0x8d47ca46UL,0x671770d9UL,0x72afdd4bUL,0x94ed79deUL,0x98ff67d4UL,0xb09323e8UL,0x855bde4aUL,0xbb06bd6bUL,0xc5bb7e2aUL,0x4f7b34e5UL,0xedd73a16UL,0x86d254c5UL,0x9af862d7UL,0x6699ff55UL,0x11b6a794UL,0x8ac04acfUL,0xe9d93010UL,0x040e0a06UL,0xfe669881UL,0xa0ab0bf0UL,0x78b4cc44UL,0x25f0d5baUL,0x4b753ee3UL,0xa2ac0ef3UL,0x5d4419feUL,0x80db5bc0UL,0x0580858aUL,0x3fd3ecadUL,0x21fedfbcUL,0x70a8d848UL,0xf1fd0c04UL,0x63197adfUL,0x772f58c1UL,0xaf309f75UL,0x42e7a563UL,0x20705030UL,0xe5cb2e1aUL,0xfdef120eUL,0xbf08b76dUL,0x8155d44cUL,0x18243c14UL,0x26795f35UL,0xc3b2712fUL,0xbe8638e1UL,0x35c8fda2UL,0x88c74fccUL,0x2e654b39UL,0x936af957UL,0x55580df2UL,0xfc619d82UL,0x7ab3c947UL,0xc827efacUL,0xba8832e7UL,0x324f7d2bUL,0xe642a495UL,0xc03bfba0UL,0x19aab398UL,0x9ef668d1UL,0xa322817fUL,0x44eeaa66UL,0x54d6827eUL,0x3bdde6abUL,0x0b959e83UL,0x8cc945caUL,0xc7bc7b29UL,0x6b056ed3UL,0x286c443cUL,0xa72c8b79UL,0xbc813de2UL,0x1631271dUL,0xad379a76UL,0xdb964d3bUL,0x649efa56UL,0x74a6d24eUL,0x1436221eUL,0x92e476dbUL,0x0c121e0aUL,0x48fcb46cUL,0xb88f37e4UL,0x9f78e75dUL,0xbd0fb26eUL,0x43692aefUL,0xc435f1a6UL,0x39dae3a8UL,0x31c6f7a4UL,0xd38a5937UL,0xf274868bUL,0xd5835632UL,0x8b4ec543UL,0x6e85eb59UL,0xda18c2b7UL,0x018e8f8cUL,0xb11dac64UL,0x9cf16dd2UL,0x49723be0UL,0xd81fc7b4UL,0xacb915faUL,0xf3fa0907UL,0xcfa06f25UL,0xca20eaafUL,0xf47d898eUL,0x476720e9UL,0x10382818UL,0x6f0b64d5UL,0xf0738388UL,0x4afbb16fUL,0x5cca9672UL,0x38546c24UL,0x575f08f1UL,0x732152c7UL,0x9764f351UL,0xcbae6523UL,0xa125847cUL,0xe857bf9cUL,0x3e5d6321UL,0x96ea7cddUL,0x611e7fdcUL,0x0d9c9186UL,0x0f9b9485UL,0xe04bab90UL,0x7cbac642UL,0x712657c4UL,0xcc29e5aaUL,0x90e373d8UL,0x06090f05UL,0xf7f40301UL,0x1c2a3612UL,0xc23cfea3UL,0x6a8be15fUL,0xaebe10f9UL,0x69026bd0UL,0x17bfa891UL,0x9971e858UL,0x3a536927UL,0x27f7d0b9UL,0xd9914838UL,0xebde3513UL,0x2be5ceb3UL,0x22775533UL,0xd204d6bbUL,0xa9399070UL,0x07878089UL,0x33c1f2a7UL,0x2decc1b6UL,0x3c5a6622UL,0x15b8ad92UL,0xc9a96020UL,0x875cdb49UL,0xaab01affUL,0x50d88878UL,0xa52b8e7aUL,0x03898a8fUL,0x594a13f8UL,0x09929b80UL,0x1a233917UL,0x651075daUL,0xd7845331UL,0x84d551c6UL,0xd003d3b8UL,0x82dc5ec3UL,0x29e2cbb0UL,0x5ac39977UL,0x1e2d3311UL,0x7b3d46cbUL,0xa8b71ffcUL,0x6d0c61d6UL,0x2c624e3aUL,
-  0xc6c632f4UL,0xf8f86f97UL,0xeeee5eb0UL,0xf6f67a8cUL,0xffffe817UL,0xd6d60adcUL,0xdede16c8UL,0x91916dfcUL,0x606090f0UL,0x02020705UL,0xcece2ee0UL,0x5656d187UL,0xe7e7cc2bUL,0xb5b513a6UL,0x4d4d7c31UL,0xecec59b5UL,0x8f8f40cfUL,0x1f1fa3bcUL,0x898949c0UL,0xfafa6892UL,0xefefd03fUL,0xb2b29426UL,0x8e8ece40UL,0xfbfbe61dUL,0x41416e2fUL,0xb3b31aa9UL,0x5f5f431cUL,0x45456025UL,0x2323f9daUL,0x53535102UL,0xe4e445a1UL,0x9b9b76edUL,0x7575285dUL,0xe1e1c524UL,0x3d3dd4e9UL,0x4c4cf2beUL,0x6c6c82eeUL,0x7e7ebdc3UL,0xf5f5f306UL,0x838352d1UL,0x68688ce4UL,0x51515607UL,0xd1d18d5cUL,0xf9f9e118UL,0xe2e24caeUL,0xabab3e95UL,0x626297f5UL,0x2a2a6b41UL,0x08081c14UL,0x959563f6UL,0x4646e9afUL,0x9d9d7fe2UL,0x30304878UL,0x3737cff8UL,0x0a0a1b11UL,0x2f2febc4UL,0x0e0e151bUL,0x24247e5aUL,0x1b1badb6UL,0xdfdf9847UL,0xcdcda76aUL,0x4e4ef5bbUL,0x7f7f334cUL,0xeaea50baUL,0x12123f2dUL,0x1d1da4b9UL,0x5858c49cUL,0x34344672UL,0x36364177UL,0xdcdc11cdUL,0xb4b49d29UL,0x5b5b4d16UL,0xa4a4a501UL,0x7676a1d7UL,0xb7b714a3UL,0x7d7d3449UL,0x5252df8dUL,0xdddd9f42UL,0x5e5ecd93UL,0x1313b1a2UL,0xa6a6a204UL,0xb9b901b8UL,0x00000000UL,0xc1c1b574UL,0x4040e0a0UL,0xe3e3c221UL,0x79793a43UL,0xb6b69a2cUL,0xd4d40dd9UL,0x8d8d47caUL,0x67671770UL,0x7272afddUL,0x9494ed79UL,0x9898ff67UL,0xb0b09323UL,0x85855bdeUL,0xbbbb06bdUL,0xc5c5bb7eUL,0x4f4f7b34UL,0xededd73aUL,0x8686d254UL,0x9a9af862UL,0x666699ffUL,0x1111b6a7UL,0x8a8ac04aUL,0xe9e9d930UL,0x04040e0aUL,0xfefe6698UL,0xa0a0ab0bUL,0x7878b4ccUL,0x2525f0d5UL,0x4b4b753eUL,0xa2a2ac0eUL,0x5d5d4419UL,0x8080db5bUL,0x05058085UL,0x3f3fd3ecUL,0x2121fedfUL,0x7070a8d8UL,0xf1f1fd0cUL,0x6363197aUL,0x77772f58UL,0xafaf309fUL,0x4242e7a5UL,0x20207050UL,0xe5e5cb2eUL,0xfdfdef12UL,0xbfbf08b7UL,0x818155d4UL,0x1818243cUL,0x2626795fUL,0xc3c3b271UL,0xbebe8638UL,0x3535c8fdUL,0x8888c74fUL,0x2e2e654bUL,0x93936af9UL,0x5555580dUL,0xfcfc619dUL,0x7a7ab3c9UL,0xc8c827efUL,0xbaba8832UL,0x32324f7dUL,0xe6e642a4UL,0xc0c03bfbUL,0x1919aab3UL,0x9e9ef668UL,0xa3a32281UL,0x4444eeaaUL,0x5454d682UL,0x3b3bdde6UL,0x0b0b959eUL,0x8c8cc945UL,0xc7c7bc7bUL,0x6b6b056eUL,0x28286c44UL,0xa7a72c8bUL,0xbcbc813dUL,0x16163127UL,0xadad379aUL,0xdbdb964dUL,0x64649efaUL,0x7474a6d2UL,0x14143622UL,0x9292e476UL,0x0c0c121eUL,0x4848fcb4UL,0xb8b88f37UL,0x9f9f78e7UL,0xbdbd0fb2UL,0x4343692aUL,0xc4c435f1UL,0x3939dae3UL,0x3131c6f7UL,0xd3d38a59UL,0xf2f27486UL,0xd5d58356UL,0x8b8b4ec5UL,0x6e6e85ebUL,0xdada18c2UL,0x01018e8fUL,0xb1b11dacUL,0x9c9cf16dUL,0x4949723bUL,0xd8d81fc7UL,0xacacb915UL,0xf3f3fa09UL,0xcfcfa06fUL,0xcaca20eaUL,0xf4f47d89UL,0x47476720UL,0x10103828UL,0x6f6f0b64UL,0xf0f07383UL,0x4a4afbb1UL,0x5c5cca96UL,0x3838546cUL,0x57575f08UL,0x73732152UL,0x979764f3UL,0xcbcbae65UL,0xa1a12584UL,0xe8e857bfUL,0x3e3e5d63UL,0x9696ea7cUL,0x61611e7fUL,0x0d0d9c91UL,0x0f0f9b94UL,0xe0e04babUL,0x7c7cbac6UL,0x71712657UL,0xcccc29e5UL,0x9090e373UL,0x0606090fUL,0xf7f7f403UL,0x1c1c2a36UL,0xc2c23cfeUL,0x6a6a8be1UL,0xaeaebe10UL,0x6969026bUL,0x1717bfa8UL,0x999971e8UL,0x3a3a5369UL,0x2727f7d0UL,0xd9d99148UL,0xebebde35UL,0x2b2be5ceUL,0x22227755UL,0xd2d204d6UL,0xa9a93990UL,0x07078780UL,0x3333c1f2UL,0x2d2decc1UL,0x3c3c5a66UL,0x1515b8adUL,0xc9c9a960UL,0x87875cdbUL,0xaaaab01aUL,0x5050d888UL,0xa5a52b8eUL,0x0303898aUL,0x59594a13UL,0x0909929bUL,0x1a1a2339UL,0x65651075UL,0xd7d78453UL,0x8484d551UL,0xd0d003d3UL,0x8282dc5eUL,0x2929e2cbUL,0x5a5ac399UL,0x1e1e2d33UL,0x7b7b3d46UL,0xa8a8b71fUL,0x6d6d0c61UL,0x2c2c624eUL,
-  0xa5c6c632UL,0x84f8f86fUL,0x99eeee5eUL,0x8df6f67aUL,0x0dffffe8UL,0xbdd6d60aUL,0xb1dede16UL,0x5491916dUL,0x50606090UL,0x03020207UL,0xa9cece2eUL,0x7d5656d1UL,0x19e7e7ccUL,0x62b5b513UL,0xe64d4d7cUL,0x9aecec59UL,0x458f8f40UL,0x9d1f1fa3UL,0x40898949UL,0x87fafa68UL,0x15efefd0UL,0xebb2b294UL,0xc98e8eceUL,0x0bfbfbe6UL,0xec41416eUL,0x67b3b31aUL,0xfd5f5f43UL,0xea454560UL,0xbf2323f9UL,0xf7535351UL,0x96e4e445UL,0x5b9b9b76UL,0xc2757528UL,0x1ce1e1c5UL,0xae3d3dd4UL,0x6a4c4cf2UL,0x5a6c6c82UL,0x417e7ebdUL,0x02f5f5f3UL,0x4f838352UL,0x5c68688cUL,0xf4515156UL,0x34d1d18dUL,0x08f9f9e1UL,0x93e2e24cUL,0x73abab3eUL,0x53626297UL,0x3f2a2a6bUL,0x0c08081cUL,0x52959563UL,0x654646e9UL,0x5e9d9d7fUL,0x28303048UL,0xa13737cfUL,0x0f0a0a1bUL,0xb52f2febUL,0x090e0e15UL,0x3624247eUL,0x9b1b1badUL,0x3ddfdf98UL,0x26cdcda7UL,0x694e4ef5UL,0xcd7f7f33UL,0x9feaea50UL,0x1b12123fUL,0x9e1d1da4UL,0x745858c4UL,0x2e343446UL,0x2d363641UL,0xb2dcdc11UL,0xeeb4b49dUL,0xfb5b5b4dUL,0xf6a4a4a5UL,0x4d7676a1UL,0x61b7b714UL,0xce7d7d34UL,0x7b5252dfUL,0x3edddd9fUL,0x715e5ecdUL,0x971313b1UL,0xf5a6a6a2UL,0x68b9b901UL,0x00000000UL,0x2cc1c1b5UL,0x604040e0UL,0x1fe3e3c2UL,0xc879793aUL,0xedb6b69aUL,0xbed4d40dUL,0x468d8d47UL,0xd9676717UL,0x4b7272afUL,0xde9494edUL,0xd49898ffUL,0xe8b0b093UL,0x4a85855bUL,0x6bbbbb06UL,0x2ac5c5bbUL,0xe54f4f7bUL,0x16ededd7UL,0xc58686d2UL,0xd79a9af8UL,0x55666699UL,0x941111b6UL,0xcf8a8ac0UL,0x10e9e9d9UL,0x0604040eUL,0x81fefe66UL,0xf0a0a0abUL,0x447878b4UL,0xba2525f0UL,0xe34b4b75UL,0xf3a2a2acUL,0xfe5d5d44UL,0xc08080dbUL,0x8a050580UL,0xad3f3fd3UL,0xbc2121feUL,0x487070a8UL,0x04f1f1fdUL,0xdf636319UL,0xc177772fUL,0x75afaf30UL,0x634242e7UL,0x30202070UL,0x1ae5e5cbUL,0x0efdfdefUL,0x6dbfbf08UL,0x4c818155UL,0x14181824UL,0x35262679UL,0x2fc3c3b2UL,0xe1bebe86UL,0xa23535c8UL,0xcc8888c7UL,0x392e2e65UL,0x5793936aUL,0xf2555558UL,0x82fcfc61UL,0x477a7ab3UL,0xacc8c827UL,0xe7baba88UL,0x2b32324fUL,0x95e6e642UL,0xa0c0c03bUL,0x981919aaUL,0xd19e9ef6UL,0x7fa3a322UL,0x664444eeUL,0x7e5454d6UL,0xab3b3bddUL,0x830b0b95UL,0xca8c8cc9UL,0x29c7c7bcUL,0xd36b6b05UL,0x3c28286cUL,0x79a7a72cUL,0xe2bcbc81UL,0x1d161631UL,0x76adad37UL,0x3bdbdb96UL,0x5664649eUL,0x4e7474a6UL,0x1e141436UL,0xdb9292e4UL,0x0a0c0c12UL,0x6c4848fcUL,0xe4b8b88fUL,0x5d9f9f78UL,0x6ebdbd0fUL,0xef434369UL,0xa6c4c435UL,0xa83939daUL,0xa43131c6UL,0x37d3d38aUL,0x8bf2f274UL,0x32d5d583UL,0x438b8b4eUL,0x596e6e85UL,0xb7dada18UL,0x8c01018eUL,0x64b1b11dUL,0xd29c9cf1UL,0xe0494972UL,0xb4d8d81fUL,0xfaacacb9UL,0x07f3f3faUL,0x25cfcfa0UL,0xafcaca20UL,0x8ef4f47dUL,0xe9474767UL,0x18101038UL,0xd56f6f0bUL,0x88f0f073UL,0x6f4a4afbUL,0x725c5ccaUL,0x24383854UL,0xf157575fUL,0xc7737321UL,0x51979764UL,0x23cbcbaeUL,0x7ca1a125UL,0x9ce8e857UL,0x213e3e5dUL,0xdd9696eaUL,0xdc61611eUL,0x860d0d9cUL,0x850f0f9bUL,0x90e0e04bUL,0x427c7cbaUL,0xc4717126UL,0xaacccc29UL,0xd89090e3UL,0x05060609UL,0x01f7f7f4UL,0x121c1c2aUL,0xa3c2c23cUL,0x5f6a6a8bUL,0xf9aeaebeUL,0xd0696902UL,0x911717bfUL,0x58999971UL,0x273a3a53UL,0xb92727f7UL,0x38d9d991UL,0x13ebebdeUL,0xb32b2be5UL,0x33222277UL,0xbbd2d204UL,0x70a9a939UL,0x89070787UL,0xa73333c1UL,0xb62d2decUL,0x223c3c5aUL,0x921515b8UL,0x20c9c9a9UL,0x4987875cUL,0xffaaaab0UL,0x785050d8UL,0x7aa5a52bUL,0x8f030389UL,0xf859594aUL,0x80090992UL,0x171a1a23UL,0xda656510UL,0x31d7d784UL,0xc68484d5UL,0xb8d0d003UL,0xc38282dcUL,0xb02929e2UL,0x775a5ac3UL,0x111e1e2dUL,0xcb7b7b3dUL,0xfca8a8b7UL,0xd66d6d0cUL,0x3a2c2c62UL,
-  0x97a5c6c6UL,0xeb84f8f8UL,0xc799eeeeUL,0xf78df6f6UL,0xe50dffffUL,0xb7bdd6d6UL,0xa7b1dedeUL,0x39549191UL,0xc0506060UL,0x04030202UL,0x87a9ceceUL,0xac7d5656UL,0xd519e7e7UL,0x7162b5b5UL,0x9ae64d4dUL,0xc39aececUL,0x05458f8fUL,0x3e9d1f1fUL,0x09408989UL,0xef87fafaUL,0xc515efefUL,0x7febb2b2UL,0x07c98e8eUL,0xed0bfbfbUL,0x82ec4141UL,0x7d67b3b3UL,0xbefd5f5fUL,0x8aea4545UL,0x46bf2323UL,0xa6f75353UL,0xd396e4e4UL,0x2d5b9b9bUL,0xeac27575UL,0xd91ce1e1UL,0x7aae3d3dUL,0x986a4c4cUL,0xd85a6c6cUL,0xfc417e7eUL,0xf102f5f5UL,0x1d4f8383UL,0xd05c6868UL,0xa2f45151UL,0xb934d1d1UL,0xe908f9f9UL,0xdf93e2e2UL,0x4d73ababUL,0xc4536262UL,0x543f2a2aUL,0x100c0808UL,0x31529595UL,0x8c654646UL,0x215e9d9dUL,0x60283030UL,0x6ea13737UL,0x140f0a0aUL,0x5eb52f2fUL,0x1c090e0eUL,0x48362424UL,0x369b1b1bUL,0xa53ddfdfUL,0x8126cdcdUL,0x9c694e4eUL,0xfecd7f7fUL,0xcf9feaeaUL,0x241b1212UL,0x3a9e1d1dUL,0xb0745858UL,0x682e3434UL,0x6c2d3636UL,0xa3b2dcdcUL,0x73eeb4b4UL,0xb6fb5b5bUL,0x53f6a4a4UL,0xec4d7676UL,0x7561b7b7UL,0xface7d7dUL,0xa47b5252UL,0xa13eddddUL,0xbc715e5eUL,0x26971313UL,0x57f5a6a6UL,0x6968b9b9UL,0x00000000UL,0x992cc1c1UL,0x80604040UL,0xdd1fe3e3UL,0xf2c87979UL,0x77edb6b6UL,0xb3bed4d4UL,0x01468d8dUL,0xced96767UL,0xe44b7272UL,0x33de9494UL,0x2bd49898UL,0x7be8b0b0UL,0x114a8585UL,0x6d6bbbbbUL,0x912ac5c5UL,0x9ee54f4fUL,0xc116ededUL,0x17c58686UL,0x2fd79a9aUL,0xcc556666UL,0x22941111UL,0x0fcf8a8aUL,0xc910e9e9UL,0x08060404UL,0xe781fefeUL,0x5bf0a0a0UL,0xf0447878UL,0x4aba2525UL,0x96e34b4bUL,0x5ff3a2a2UL,0xbafe5d5dUL,0x1bc08080UL,0x0a8a0505UL,0x7ead3f3fUL,0x42bc2121UL,0xe0487070UL,0xf904f1f1UL,0xc6df6363UL,0xeec17777UL,0x4575afafUL,0x84634242UL,0x40302020UL,0xd11ae5e5UL,0xe10efdfdUL,0x656dbfbfUL,0x194c8181UL,0x30141818UL,0x4c352626UL,0x9d2fc3c3UL,0x67e1bebeUL,0x6aa23535UL,0x0bcc8888UL,0x5c392e2eUL,0x3d579393UL,0xaaf25555UL,0xe382fcfcUL,0xf4477a7aUL,0x8bacc8c8UL,0x6fe7babaUL,0x642b3232UL,0xd795e6e6UL,0x9ba0c0c0UL,0x32981919UL,0x27d19e9eUL,0x5d7fa3a3UL,0x88664444UL,0xa87e5454UL,0x76ab3b3bUL,0x16830b0bUL,0x03ca8c8cUL,0x9529c7c7UL,0xd6d36b6bUL,0x503c2828UL,0x5579a7a7UL,0x63e2bcbcUL,0x2c1d1616UL,0x4176adadUL,0xad3bdbdbUL,0xc8566464UL,0xe84e7474UL,0x281e1414UL,0x3fdb9292UL,0x180a0c0cUL,0x906c4848UL,0x6be4b8b8UL,0x255d9f9fUL,0x616ebdbdUL,0x86ef4343UL,0x93a6c4c4UL,0x72a83939UL,0x62a43131UL,0xbd37d3d3UL,0xff8bf2f2UL,0xb132d5d5UL,0x0d438b8bUL,0xdc596e6eUL,0xafb7dadaUL,0x028c0101UL,0x7964b1b1UL,0x23d29c9cUL,0x92e04949UL,0xabb4d8d8UL,0x43faacacUL,0xfd07f3f3UL,0x8525cfcfUL,0x8fafcacaUL,0xf38ef4f4UL,0x8ee94747UL,0x20181010UL,0xded56f6fUL,0xfb88f0f0UL,0x946f4a4aUL,0xb8725c5cUL,0x70243838UL,0xaef15757UL,0xe6c77373UL,0x35519797UL,0x8d23cbcbUL,0x597ca1a1UL,0xcb9ce8e8UL,0x7c213e3eUL,0x37dd9696UL,0xc2dc6161UL,0x1a860d0dUL,0x1e850f0fUL,0xdb90e0e0UL,0xf8427c7cUL,0xe2c47171UL,0x83aaccccUL,0x3bd89090UL,0x0c050606UL,0xf501f7f7UL,0x38121c1cUL,0x9fa3c2c2UL,0xd45f6a6aUL,0x47f9aeaeUL,0xd2d06969UL,0x2e911717UL,0x29589999UL,0x74273a3aUL,0x4eb92727UL,0xa938d9d9UL,0xcd13ebebUL,0x56b32b2bUL,0x44332222UL,0xbfbbd2d2UL,0x4970a9a9UL,0x0e890707UL,0x66a73333UL,0x5ab62d2dUL,0x78223c3cUL,0x2a921515UL,0x8920c9c9UL,0x15498787UL,0x4fffaaaaUL,0xa0785050UL,0x517aa5a5UL,0x068f0303UL,0xb2f85959UL,0x12800909UL,0x34171a1aUL,0xcada6565UL,0xb531d7d7UL,0x13c68484UL,0xbbb8d0d0UL,0x1fc38282UL,0x52b02929UL,0xb4775a5aUL,0x3c111e1eUL,0xf6cb7b7bUL,0x4bfca8a8UL,0xdad66d6dUL,0x583a2c2cUL,
-  0xf497a5c6UL,0x97eb84f8UL,0xb0c799eeUL,0x8cf78df6UL,0x17e50dffUL,0xdcb7bdd6UL,0xc8a7b1deUL,0xfc395491UL,0xf0c05060UL,0x05040302UL,0xe087a9ceUL,0x87ac7d56UL,0x2bd519e7UL,0xa67162b5UL,0x319ae64dUL,0xb5c39aecUL,0xcf05458fUL,0xbc3e9d1fUL,0xc0094089UL,0x92ef87faUL,0x3fc515efUL,0x267febb2UL,0x4007c98eUL,0x1ded0bfbUL,0x2f82ec41UL,0xa97d67b3UL,0x1cbefd5fUL,0x258aea45UL,0xda46bf23UL,0x02a6f753UL,0xa1d396e4UL,0xed2d5b9bUL,0x5deac275UL,0x24d91ce1UL,0xe97aae3dUL,0xbe986a4cUL,0xeed85a6cUL,0xc3fc417eUL,0x06f102f5UL,0xd11d4f83UL,0xe4d05c68UL,0x07a2f451UL,0x5cb934d1UL,0x18e908f9UL,0xaedf93e2UL,0x954d73abUL,0xf5c45362UL,0x41543f2aUL,0x14100c08UL,0xf6315295UL,0xaf8c6546UL,0xe2215e9dUL,0x78602830UL,0xf86ea137UL,0x11140f0aUL,0xc45eb52fUL,0x1b1c090eUL,0x5a483624UL,0xb6369b1bUL,0x47a53ddfUL,0x6a8126cdUL,0xbb9c694eUL,0x4cfecd7fUL,0xbacf9feaUL,0x2d241b12UL,0xb93a9e1dUL,0x9cb07458UL,0x72682e34UL,0x776c2d36UL,0xcda3b2dcUL,0x2973eeb4UL,0x16b6fb5bUL,0x0153f6a4UL,0xd7ec4d76UL,0xa37561b7UL,0x49face7dUL,0x8da47b52UL,0x42a13eddUL,0x93bc715eUL,0xa2269713UL,0x0457f5a6UL,0xb86968b9UL,0x00000000UL,0x74992cc1UL,0xa0806040UL,0x21dd1fe3UL,0x43f2c879UL,0x2c77edb6UL,0xd9b3bed4UL,0xca01468dUL,0x70ced967UL,0xdde44b72UL,0x7933de94UL,0x672bd498UL,0x237be8b0UL,0xde114a85UL,0xbd6d6bbbUL,0x7e912ac5UL,0x349ee54fUL,0x3ac116edUL,0x5417c586UL,0x622fd79aUL,0xffcc5566UL,0xa7229411UL,0x4a0fcf8aUL,0x30c910e9UL,0x0a080604UL,0x98e781feUL,0x0b5bf0a0UL,0xccf04478UL,0xd54aba25UL,0x3e96e34bUL,0x0e5ff3a2UL,0x19bafe5dUL,0x5b1bc080UL,0x850a8a05UL,0xec7ead3fUL,0xdf42bc21UL,0xd8e04870UL,0x0cf904f1UL,0x7ac6df63UL,0x58eec177UL,0x9f4575afUL,0xa5846342UL,0x50403020UL,0x2ed11ae5UL,0x12e10efdUL,0xb7656dbfUL,0xd4194c81UL,0x3c301418UL,0x5f4c3526UL,0x719d2fc3UL,0x3867e1beUL,0xfd6aa235UL,0x4f0bcc88UL,0x4b5c392eUL,0xf93d5793UL,0x0daaf255UL,0x9de382fcUL,0xc9f4477aUL,0xef8bacc8UL,0x326fe7baUL,0x7d642b32UL,0xa4d795e6UL,0xfb9ba0c0UL,0xb3329819UL,0x6827d19eUL,0x815d7fa3UL,0xaa886644UL,0x82a87e54UL,0xe676ab3bUL,0x9e16830bUL,0x4503ca8cUL,0x7b9529c7UL,0x6ed6d36bUL,0x44503c28UL,0x8b5579a7UL,0x3d63e2bcUL,0x272c1d16UL,0x9a4176adUL,0x4dad3bdbUL,0xfac85664UL,0xd2e84e74UL,0x22281e14UL,0x763fdb92UL,0x1e180a0cUL,0xb4906c48UL,0x376be4b8UL,0xe7255d9fUL,0xb2616ebdUL,0x2a86ef43UL,0xf193a6c4UL,0xe372a839UL,0xf762a431UL,0x59bd37d3UL,0x86ff8bf2UL,0x56b132d5UL,0xc50d438bUL,0xebdc596eUL,0xc2afb7daUL,0x8f028c01UL,0xac7964b1UL,0x6d23d29cUL,0x3b92e049UL,0xc7abb4d8UL,0x1543faacUL,0x09fd07f3UL,0x6f8525cfUL,0xea8fafcaUL,0x89f38ef4UL,0x208ee947UL,0x28201810UL,0x64ded56fUL,0x83fb88f0UL,0xb1946f4aUL,0x96b8725cUL,0x6c702438UL,0x08aef157UL,0x52e6c773UL,0xf3355197UL,0x658d23cbUL,0x84597ca1UL,0xbfcb9ce8UL,0x637c213eUL,0x7c37dd96UL,0x7fc2dc61UL,0x911a860dUL,0x941e850fUL,0xabdb90e0UL,0xc6f8427cUL,0x57e2c471UL,0xe583aaccUL,0x733bd890UL,0x0f0c0506UL,0x03f501f7UL,0x3638121cUL,0xfe9fa3c2UL,0xe1d45f6aUL,0x1047f9aeUL,0x6bd2d069UL,0xa82e9117UL,0xe8295899UL,0x6974273aUL,0xd04eb927UL,0x48a938d9UL,0x35cd13ebUL,0xce56b32bUL,0x55443322UL,0xd6bfbbd2UL,0x904970a9UL,0x800e8907UL,0xf266a733UL,0xc15ab62dUL,0x6678223cUL,0xad2a9215UL,0x608920c9UL,0xdb154987UL,0x1a4fffaaUL,0x88a07850UL,0x8e517aa5UL,0x8a068f03UL,0x13b2f859UL,0x9b128009UL,0x3934171aUL,0x75cada65UL,0x53b531d7UL,0x5113c684UL,0xd3bbb8d0UL,0x5e1fc382UL,0xcb52b029UL,0x99b4775aUL,0x333c111eUL,0x46f6cb7bUL,0x1f4bfca8UL,0x61dad66dUL,0x4e583a2cUL,
-  0xa5f497a5UL,0x8497eb84UL,0x99b0c799UL,0x8d8cf78dUL,0x0d17e50dUL,0xbddcb7bdUL,0xb1c8a7b1UL,0x54fc3954UL,0x50f0c050UL,0x03050403UL,0xa9e087a9UL,0x7d87ac7dUL,0x192bd519UL,0x62a67162UL,0xe6319ae6UL,0x9ab5c39aUL,0x45cf0545UL,0x9dbc3e9dUL,0x40c00940UL,0x8792ef87UL,0x153fc515UL,0xeb267febUL,0xc94007c9UL,0x0b1ded0bUL,0xec2f82ecUL,0x67a97d67UL,0xfd1cbefdUL,0xea258aeaUL,0xbfda46bfUL,0xf702a6f7UL,0x96a1d396UL,0x5bed2d5bUL,0xc25deac2UL,0x1c24d91cUL,0xaee97aaeUL,0x6abe986aUL,0x5aeed85aUL,0x41c3fc41UL,0x0206f102UL,0x4fd11d4fUL,0x5ce4d05cUL,0xf407a2f4UL,0x345cb934UL,0x0818e908UL,0x93aedf93UL,0x73954d73UL,0x53f5c453UL,0x3f41543fUL,0x0c14100cUL,0x52f63152UL,0x65af8c65UL,0x5ee2215eUL,0x28786028UL,0xa1f86ea1UL,0x0f11140fUL,0xb5c45eb5UL,0x091b1c09UL,0x365a4836UL,0x9bb6369bUL,0x3d47a53dUL,0x266a8126UL,0x69bb9c69UL,0xcd4cfecdUL,0x9fbacf9fUL,0x1b2d241bUL,0x9eb93a9eUL,0x749cb074UL,0x2e72682eUL,0x2d776c2dUL,0xb2cda3b2UL,0xee2973eeUL,0xfb16b6fbUL,0xf60153f6UL,0x4dd7ec4dUL,0x61a37561UL,0xce49faceUL,0x7b8da47bUL,0x3e42a13eUL,0x7193bc71UL,0x97a22697UL,0xf50457f5UL,0x68b86968UL,0x00000000UL,0x2c74992cUL,0x60a08060UL,0x1f21dd1fUL,0xc843f2c8UL,0xed2c77edUL,0xbed9b3beUL,0x46ca0146UL,0xd970ced9UL,0x4bdde44bUL,0xde7933deUL,0xd4672bd4UL,0xe8237be8UL,0x4ade114aUL,0x6bbd6d6bUL,0x2a7e912aUL,0xe5349ee5UL,0x163ac116UL,0xc55417c5UL,0xd7622fd7UL,0x55ffcc55UL,0x94a72294UL,0xcf4a0fcfUL,0x1030c910UL,0x060a0806UL,0x8198e781UL,0xf00b5bf0UL,0x44ccf044UL,0xbad54abaUL,0xe33e96e3UL,0xf30e5ff3UL,0xfe19bafeUL,0xc05b1bc0UL,0x8a850a8aUL,0xadec7eadUL,0xbcdf42bcUL,0x48d8e048UL,0x040cf904UL,0xdf7ac6dfUL,0xc158eec1UL,0x759f4575UL,0x63a58463UL,0x30504030UL,0x1a2ed11aUL,0x0e12e10eUL,0x6db7656dUL,0x4cd4194cUL,0x143c3014UL,0x355f4c35UL,0x2f719d2fUL,0xe13867e1UL,0xa2fd6aa2UL,0xcc4f0bccUL,0x394b5c39UL,0x57f93d57UL,0xf20daaf2UL,0x829de382UL,0x47c9f447UL,0xacef8bacUL,0xe7326fe7UL,0x2b7d642bUL,0x95a4d795UL,0xa0fb9ba0UL,0x98b33298UL,0xd16827d1UL,0x7f815d7fUL,0x66aa8866UL,0x7e82a87eUL,0xabe676abUL,0x839e1683UL,0xca4503caUL,0x297b9529UL,0xd36ed6d3UL,0x3c44503cUL,0x798b5579UL,0xe23d63e2UL,0x1d272c1dUL,0x769a4176UL,0x3b4dad3bUL,0x56fac856UL,0x4ed2e84eUL,0x1e22281eUL,0xdb763fdbUL,0x0a1e180aUL,0x6cb4906cUL,0xe4376be4UL,0x5de7255dUL,0x6eb2616eUL,0xef2a86efUL,0xa6f193a6UL,0xa8e372a8UL,0xa4f762a4UL,0x3759bd37UL,0x8b86ff8bUL,0x3256b132UL,0x43c50d43UL,0x59ebdc59UL,0xb7c2afb7UL,0x8c8f028cUL,0x64ac7964UL,0xd26d23d2UL,0xe03b92e0UL,0xb4c7abb4UL,0xfa1543faUL,0x0709fd07UL,0x256f8525UL,0xafea8fafUL,0x8e89f38eUL,0xe9208ee9UL,0x18282018UL,0xd564ded5UL,0x8883fb88UL,0x6fb1946fUL,0x7296b872UL,0x246c7024UL,0xf108aef1UL,0xc752e6c7UL,0x51f33551UL,0x23658d23UL,0x7c84597cUL,0x9cbfcb9cUL,0x21637c21UL,0xdd7c37ddUL,0xdc7fc2dcUL,0x86911a86UL,0x85941e85UL,0x90abdb90UL,0x42c6f842UL,0xc457e2c4UL,0xaae583aaUL,0xd8733bd8UL,0x050f0c05UL,0x0103f501UL,0x12363812UL,0xa3fe9fa3UL,0x5fe1d45fUL,0xf91047f9UL,0xd06bd2d0UL,0x91a82e91UL,0x58e82958UL,0x27697427UL,0xb9d04eb9UL,0x3848a938UL,0x1335cd13UL,0xb3ce56b3UL,0x33554433UL,0xbbd6bfbbUL,0x70904970UL,0x89800e89UL,0xa7f266a7UL,0xb6c15ab6UL,0x22667822UL,0x92ad2a92UL,0x20608920UL,0x49db1549UL,0xff1a4fffUL,0x7888a078UL,0x7a8e517aUL,0x8f8a068fUL,0xf813b2f8UL,0x809b1280UL,0x17393417UL,0xda75cadaUL,0x3153b531UL,0xc65113c6UL,0xb8d3bbb8UL,0xc35e1fc3UL,0xb0cb52b0UL,0x7799b477UL,0x11333c11UL,0xcb46f6cbUL,0xfc1f4bfcUL,0xd661dad6UL,0x3a4e583aUL,
-  0xf4a5f497UL,0x978497ebUL,0xb099b0c7UL,0x8c8d8cf7UL,0x170d17e5UL,0xdcbddcb7UL,0xc8b1c8a7UL,0xfc54fc39UL,0xf050f0c0UL,0x05030504UL,0xe0a9e087UL,0x877d87acUL,0x2b192bd5UL,0xa662a671UL,0x31e6319aUL,0xb59ab5c3UL,0xcf45cf05UL,0xbc9dbc3eUL,0xc040c009UL,0x928792efUL,0x3f153fc5UL,0x26eb267fUL,0x40c94007UL,0x1d0b1dedUL,0x2fec2f82UL,0xa967a97dUL,0x1cfd1cbeUL,0x25ea258aUL,0xdabfda46UL,0x02f702a6UL,0xa196a1d3UL,0xed5bed2dUL,0x5dc25deaUL,0x241c24d9UL,0xe9aee97aUL,0xbe6abe98UL,0xee5aeed8UL,0xc341c3fcUL,0x060206f1UL,0xd14fd11dUL,0xe45ce4d0UL,0x07f407a2UL,0x5c345cb9UL,0x180818e9UL,0xae93aedfUL,0x9573954dUL,0xf553f5c4UL,0x413f4154UL,0x140c1410UL,0xf652f631UL,0xaf65af8cUL,0xe25ee221UL,0x78287860UL,0xf8a1f86eUL,0x110f1114UL,0xc4b5c45eUL,0x1b091b1cUL,0x5a365a48UL,0xb69bb636UL,0x473d47a5UL,0x6a266a81UL,0xbb69bb9cUL,0x4ccd4cfeUL,0xba9fbacfUL,0x2d1b2d24UL,0xb99eb93aUL,0x9c749cb0UL,0x722e7268UL,0x772d776cUL,0xcdb2cda3UL,0x29ee2973UL,0x16fb16b6UL,0x01f60153UL,0xd74dd7ecUL,0xa361a375UL,0x49ce49faUL,0x8d7b8da4UL,0x423e42a1UL,0x937193bcUL,0xa297a226UL,0x04f50457UL,0xb868b869UL,0x00000000UL,0x742c7499UL,0xa060a080UL,0x211f21ddUL,0x43c843f2UL,0x2ced2c77UL,0xd9bed9b3UL,0xca46ca01UL,0x70d970ceUL,0xdd4bdde4UL,0x79de7933UL,0x67d4672bUL,0x23e8237bUL,0xde4ade11UL,0xbd6bbd6dUL,0x7e2a7e91UL,0x34e5349eUL,0x3a163ac1UL,0x54c55417UL,0x62d7622fUL,0xff55ffccUL,0xa794a722UL,0x4acf4a0fUL,0x301030c9UL,0x0a060a08UL,0x988198e7UL,0x0bf00b5bUL,0xcc44ccf0UL,0xd5bad54aUL,0x3ee33e96UL,0x0ef30e5fUL,0x19fe19baUL,0x5bc05b1bUL,0x858a850aUL,0xecadec7eUL,0xdfbcdf42UL,0xd848d8e0UL,0x0c040cf9UL,0x7adf7ac6UL,0x58c158eeUL,0x9f759f45UL,0xa563a584UL,0x50305040UL,0x2e1a2ed1UL,0x120e12e1UL,0xb76db765UL,0xd44cd419UL,0x3c143c30UL,0x5f355f4cUL,0x712f719dUL,0x38e13867UL,0xfda2fd6aUL,0x4fcc4f0bUL,0x4b394b5cUL,0xf957f93dUL,0x0df20daaUL,0x9d829de3UL,0xc947c9f4UL,0xefacef8bUL,0x32e7326fUL,0x7d2b7d64UL,0xa495a4d7UL,0xfba0fb9bUL,0xb398b332UL,0x68d16827UL,0x817f815dUL,0xaa66aa88UL,0x827e82a8UL,0xe6abe676UL,0x9e839e16UL,0x45ca4503UL,0x7b297b95UL,0x6ed36ed6UL,0x443c4450UL,0x8b798b55UL,0x3de23d63UL,0x271d272cUL,0x9a769a41UL,0x4d3b4dadUL,0xfa56fac8UL,0xd24ed2e8UL,0x221e2228UL,0x76db763fUL,0x1e0a1e18UL,0xb46cb490UL,0x37e4376bUL,0xe75de725UL,0xb26eb261UL,0x2aef2a86UL,0xf1a6f193UL,0xe3a8e372UL,0xf7a4f762UL,0x593759bdUL,0x868b86ffUL,0x563256b1UL,0xc543c50dUL,0xeb59ebdcUL,0xc2b7c2afUL,0x8f8c8f02UL,0xac64ac79UL,0x6dd26d23UL,0x3be03b92UL,0xc7b4c7abUL,0x15fa1543UL,0x090709fdUL,0x6f256f85UL,0xeaafea8fUL,0x898e89f3UL,0x20e9208eUL,0x28182820UL,0x64d564deUL,0x838883fbUL,0xb16fb194UL,0x967296b8UL,0x6c246c70UL,0x08f108aeUL,0x52c752e6UL,0xf351f335UL,0x6523658dUL,0x847c8459UL,0xbf9cbfcbUL,0x6321637cUL,0x7cdd7c37UL,0x7fdc7fc2UL,0x9186911aUL,0x9485941eUL,0xab90abdbUL,0xc642c6f8UL,0x57c457e2UL,0xe5aae583UL,0x73d8733bUL,0x0f050f0cUL,0x030103f5UL,0x36123638UL,0xfea3fe9fUL,0xe15fe1d4UL,0x10f91047UL,0x6bd06bd2UL,0xa891a82eUL,0xe858e829UL,0x69276974UL,0xd0b9d04eUL,0x483848a9UL,0x351335cdUL,0xceb3ce56UL,0x55335544UL,0xd6bbd6bfUL,0x90709049UL,0x8089800eUL,0xf2a7f266UL,0xc1b6c15aUL,0x66226678UL,0xad92ad2aUL,0x60206089UL,0xdb49db15UL,0x1aff1a4fUL,0x887888a0UL,0x8e7a8e51UL,0x8a8f8a06UL,0x13f813b2UL,0x9b809b12UL,0x39173934UL,0x75da75caUL,0x533153b5UL,0x51c65113UL,0xd3b8d3bbUL,0x5ec35e1fUL,0xcbb0cb52UL,0x997799b4UL,0x3311333cUL,0x46cb46f6UL,0x1ffc1f4bUL,0x61d661daUL,0x4e3a4e58UL,
-  0x32f4a5f4UL,0x6f978497UL,0x5eb099b0UL,0x7a8c8d8cUL,0xe8170d17UL,0x0adcbddcUL,0x16c8b1c8UL,0x6dfc54fcUL,0x90f050f0UL,0x07050305UL,0x2ee0a9e0UL,0xd1877d87UL,0xcc2b192bUL,0x13a662a6UL,0x7c31e631UL,0x59b59ab5UL,0x40cf45cfUL,0xa3bc9dbcUL,0x49c040c0UL,0x68928792UL,0xd03f153fUL,0x9426eb26UL,0xce40c940UL,0xe61d0b1dUL,0x6e2fec2fUL,0x1aa967a9UL,0x431cfd1cUL,0x6025ea25UL,0xf9dabfdaUL,0x5102f702UL,0x45a196a1UL,0x76ed5bedUL,0x285dc25dUL,0xc5241c24UL,0xd4e9aee9UL,0xf2be6abeUL,0x82ee5aeeUL,0xbdc341c3UL,0xf3060206UL,0x52d14fd1UL,0x8ce45ce4UL,0x5607f407UL,0x8d5c345cUL,0xe1180818UL,0x4cae93aeUL,0x3e957395UL,0x97f553f5UL,0x6b413f41UL,0x1c140c14UL,0x63f652f6UL,0xe9af65afUL,0x7fe25ee2UL,0x48782878UL,0xcff8a1f8UL,0x1b110f11UL,0xebc4b5c4UL,0x151b091bUL,0x7e5a365aUL,0xadb69bb6UL,0x98473d47UL,0xa76a266aUL,0xf5bb69bbUL,0x334ccd4cUL,0x50ba9fbaUL,0x3f2d1b2dUL,0xa4b99eb9UL,0xc49c749cUL,0x46722e72UL,0x41772d77UL,0x11cdb2cdUL,0x9d29ee29UL,0x4d16fb16UL,0xa501f601UL,0xa1d74dd7UL,0x14a361a3UL,0x3449ce49UL,0xdf8d7b8dUL,0x9f423e42UL,0xcd937193UL,0xb1a297a2UL,0xa204f504UL,0x01b868b8UL,0x00000000UL,0xb5742c74UL,0xe0a060a0UL,0xc2211f21UL,0x3a43c843UL,0x9a2ced2cUL,0x0dd9bed9UL,0x47ca46caUL,0x1770d970UL,0xafdd4bddUL,0xed79de79UL,0xff67d467UL,0x9323e823UL,0x5bde4adeUL,0x06bd6bbdUL,0xbb7e2a7eUL,0x7b34e534UL,0xd73a163aUL,0xd254c554UL,0xf862d762UL,0x99ff55ffUL,0xb6a794a7UL,0xc04acf4aUL,0xd9301030UL,0x0e0a060aUL,0x66988198UL,0xab0bf00bUL,0xb4cc44ccUL,0xf0d5bad5UL,0x753ee33eUL,0xac0ef30eUL,0x4419fe19UL,0xdb5bc05bUL,0x80858a85UL,0xd3ecadecUL,0xfedfbcdfUL,0xa8d848d8UL,0xfd0c040cUL,0x197adf7aUL,0x2f58c158UL,0x309f759fUL,0xe7a563a5UL,0x70503050UL,0xcb2e1a2eUL,0xef120e12UL,0x08b76db7UL,0x55d44cd4UL,0x243c143cUL,0x795f355fUL,0xb2712f71UL,0x8638e138UL,0xc8fda2fdUL,0xc74fcc4fUL,0x654b394bUL,0x6af957f9UL,0x580df20dUL,0x619d829dUL,0xb3c947c9UL,0x27efacefUL,0x8832e732UL,0x4f7d2b7dUL,0x42a495a4UL,0x3bfba0fbUL,0xaab398b3UL,0xf668d168UL,0x22817f81UL,0xeeaa66aaUL,0xd6827e82UL,0xdde6abe6UL,0x959e839eUL,0xc945ca45UL,0xbc7b297bUL,0x056ed36eUL,0x6c443c44UL,0x2c8b798bUL,0x813de23dUL,0x31271d27UL,0x379a769aUL,0x964d3b4dUL,0x9efa56faUL,0xa6d24ed2UL,0x36221e22UL,0xe476db76UL,0x121e0a1eUL,0xfcb46cb4UL,0x8f37e437UL,0x78e75de7UL,0x0fb26eb2UL,0x692aef2aUL,0x35f1a6f1UL,0xdae3a8e3UL,0xc6f7a4f7UL,0x8a593759UL,0x74868b86UL,0x83563256UL,0x4ec543c5UL,0x85eb59ebUL,0x18c2b7c2UL,0x8e8f8c8fUL,0x1dac64acUL,0xf16dd26dUL,0x723be03bUL,0x1fc7b4c7UL,0xb915fa15UL,0xfa090709UL,0xa06f256fUL,0x20eaafeaUL,0x7d898e89UL,0x6720e920UL,0x38281828UL,0x0b64d564UL,0x73838883UL,0xfbb16fb1UL,0xca967296UL,0x546c246cUL,0x5f08f108UL,0x2152c752UL,0x64f351f3UL,0xae652365UL,0x25847c84UL,0x57bf9cbfUL,0x5d632163UL,0xea7cdd7cUL,0x1e7fdc7fUL,0x9c918691UL,0x9b948594UL,0x4bab90abUL,0xbac642c6UL,0x2657c457UL,0x29e5aae5UL,0xe373d873UL,0x090f050fUL,0xf4030103UL,0x2a361236UL,0x3cfea3feUL,0x8be15fe1UL,0xbe10f910UL,0x026bd06bUL,0xbfa891a8UL,0x71e858e8UL,0x53692769UL,0xf7d0b9d0UL,0x91483848UL,0xde351335UL,0xe5ceb3ceUL,0x77553355UL,0x04d6bbd6UL,0x39907090UL,0x87808980UL,0xc1f2a7f2UL,0xecc1b6c1UL,0x5a662266UL,0xb8ad92adUL,0xa9602060UL,0x5cdb49dbUL,0xb01aff1aUL,0xd8887888UL,0x2b8e7a8eUL,0x898a8f8aUL,0x4a13f813UL,0x929b809bUL,0x23391739UL,0x1075da75UL,0x84533153UL,0xd551c651UL,0x03d3b8d3UL,0xdc5ec35eUL,0xe2cbb0cbUL,0xc3997799UL,0x2d331133UL,0x3d46cb46UL,0xb71ffc1fUL,0x0c61d661UL,0x624e3a4eUL};
+const grostl_u64 GROSTL_T[8*256]  /*__attribute__((aligned(64)))*/ = {
+0xc632f4a5f497a5c6ULL,0xf86f978497eb84f8ULL,0xee5eb099b0c799eeULL,0xf67a8c8d8cf78df6ULL,0xffe8170d17e50dffULL,0xd60adcbddcb7bdd6ULL,0xde16c8b1c8a7b1deULL,0x916dfc54fc395491ULL,0x6090f050f0c05060ULL,0x0207050305040302ULL,0xce2ee0a9e087a9ceULL,0x56d1877d87ac7d56ULL,0xe7cc2b192bd519e7ULL,0xb513a662a67162b5ULL,0x4d7c31e6319ae64dULL,0xec59b59ab5c39aecULL,0x8f40cf45cf05458fULL,0x1fa3bc9dbc3e9d1fULL,0x8949c040c0094089ULL,0xfa68928792ef87faULL,0xefd03f153fc515efULL,0xb29426eb267febb2ULL,0x8ece40c94007c98eULL,0xfbe61d0b1ded0bfbULL,0x416e2fec2f82ec41ULL,0xb31aa967a97d67b3ULL,0x5f431cfd1cbefd5fULL,0x456025ea258aea45ULL,0x23f9dabfda46bf23ULL,0x535102f702a6f753ULL,0xe445a196a1d396e4ULL,0x9b76ed5bed2d5b9bULL,0x75285dc25deac275ULL,0xe1c5241c24d91ce1ULL,0x3dd4e9aee97aae3dULL,0x4cf2be6abe986a4cULL,0x6c82ee5aeed85a6cULL,0x7ebdc341c3fc417eULL,0xf5f3060206f102f5ULL,0x8352d14fd11d4f83ULL,0x688ce45ce4d05c68ULL,0x515607f407a2f451ULL,0xd18d5c345cb934d1ULL,0xf9e1180818e908f9ULL,0xe24cae93aedf93e2ULL,0xab3e9573954d73abULL,0x6297f553f5c45362ULL,0x2a6b413f41543f2aULL,0x081c140c14100c08ULL,0x9563f652f6315295ULL,0x46e9af65af8c6546ULL,0x9d7fe25ee2215e9dULL,0x3048782878602830ULL,0x37cff8a1f86ea137ULL,0x0a1b110f11140f0aULL,0x2febc4b5c45eb52fULL,0x0e151b091b1c090eULL,0x247e5a365a483624ULL,0x1badb69bb6369b1bULL,0xdf98473d47a53ddfULL,0xcda76a266a8126cdULL,0x4ef5bb69bb9c694eULL,0x7f334ccd4cfecd7fULL,0xea50ba9fbacf9feaULL,0x123f2d1b2d241b12ULL,0x1da4b99eb93a9e1dULL,0x58c49c749cb07458ULL,0x3446722e72682e34ULL,0x3641772d776c2d36ULL,0xdc11cdb2cda3b2dcULL,0xb49d29ee2973eeb4ULL,0x5b4d16fb16b6fb5bULL,0xa4a501f60153f6a4ULL,0x76a1d74dd7ec4d76ULL,0xb714a361a37561b7ULL,0x7d3449ce49face7dULL,0x52df8d7b8da47b52ULL,0xdd9f423e42a13eddULL,0x5ecd937193bc715eULL,0x13b1a297a2269713ULL,0xa6a204f50457f5a6ULL,0xb901b868b86968b9ULL,0x0000000000000000ULL,0xc1b5742c74992cc1ULL,0x40e0a060a0806040ULL,0xe3c2211f21dd1fe3ULL,0x793a43c843f2c879ULL,0xb69a2ced2c77edb6ULL,0xd40dd9bed9b3bed4ULL,0x8d47ca46ca01468dULL,0x671770d970ced967ULL,0x72afdd4bdde44b72ULL,0x94ed79de7933de94ULL,0x98ff67d4672bd498ULL,0xb09323e8237be8b0ULL,0x855bde4ade114a85ULL,0xbb06bd6bbd6d6bbbULL,0xc5bb7e2a7e912ac5ULL,0x4f7b34e5349ee54fULL,0xedd73a163ac116edULL,0x86d254c55417c586ULL,0x9af862d7622fd79aULL,0x6699ff55ffcc5566ULL,0x11b6a794a7229411ULL,0x8ac04acf4a0fcf8aULL,0xe9d9301030c910e9ULL,0x040e0a060a080604ULL,0xfe66988198e781feULL,0xa0ab0bf00b5bf0a0ULL,0x78b4cc44ccf04478ULL,0x25f0d5bad54aba25ULL,0x4b753ee33e96e34bULL,0xa2ac0ef30e5ff3a2ULL,0x5d4419fe19bafe5dULL,0x80db5bc05b1bc080ULL,0x0580858a850a8a05ULL,0x3fd3ecadec7ead3fULL,0x21fedfbcdf42bc21ULL,0x70a8d848d8e04870ULL,0xf1fd0c040cf904f1ULL,0x63197adf7ac6df63ULL,0x772f58c158eec177ULL,0xaf309f759f4575afULL,0x42e7a563a5846342ULL,0x2070503050403020ULL,0xe5cb2e1a2ed11ae5ULL,0xfdef120e12e10efdULL,0xbf08b76db7656dbfULL,0x8155d44cd4194c81ULL,0x18243c143c301418ULL,0x26795f355f4c3526ULL,0xc3b2712f719d2fc3ULL,0xbe8638e13867e1beULL,0x35c8fda2fd6aa235ULL,0x88c74fcc4f0bcc88ULL,0x2e654b394b5c392eULL,0x936af957f93d5793ULL,0x55580df20daaf255ULL,0xfc619d829de382fcULL,0x7ab3c947c9f4477aULL,0xc827efacef8bacc8ULL,0xba8832e7326fe7baULL,0x324f7d2b7d642b32ULL,0xe642a495a4d795e6ULL,0xc03bfba0fb9ba0c0ULL,0x19aab398b3329819ULL,0x9ef668d16827d19eULL,0xa322817f815d7fa3ULL,0x44eeaa66aa886644ULL,0x54d6827e82a87e54ULL,0x3bdde6abe676ab3bULL,0x0b959e839e16830bULL,0x8cc945ca4503ca8cULL,0xc7bc7b297b9529c7ULL,0x6b056ed36ed6d36bULL,0x286c443c44503c28ULL,0xa72c8b798b5579a7ULL,0xbc813de23d63e2bcULL,0x1631271d272c1d16ULL,0xad379a769a4176adULL,0xdb964d3b4dad3bdbULL,0x649efa56fac85664ULL,0x74a6d24ed2e84e74ULL,0x1436221e22281e14ULL,0x92e476db763fdb92ULL,0x0c121e0a1e180a0cULL,0x48fcb46cb4906c48ULL,0xb88f37e4376be4b8ULL,0x9f78e75de7255d9fULL,0xbd0fb26eb2616ebdULL,0x43692aef2a86ef43ULL,0xc435f1a6f193a6c4ULL,0x39dae3a8e372a839ULL,0x31c6f7a4f762a431ULL,0xd38a593759bd37d3ULL,0xf274868b86ff8bf2ULL,0xd583563256b132d5ULL,0x8b4ec543c50d438bULL,0x6e85eb59ebdc596eULL,0xda18c2b7c2afb7daULL,0x018e8f8c8f028c01ULL,0xb11dac64ac7964b1ULL,0x9cf16dd26d23d29cULL,0x49723be03b92e049ULL,0xd81fc7b4c7abb4d8ULL,0xacb915fa1543faacULL,0xf3fa090709fd07f3ULL,0xcfa06f256f8525cfULL,0xca20eaafea8fafcaULL,0xf47d898e89f38ef4ULL,0x476720e9208ee947ULL,0x1038281828201810ULL,0x6f0b64d564ded56fULL,0xf073838883fb88f0ULL,0x4afbb16fb1946f4aULL,0x5cca967296b8725cULL,0x38546c246c702438ULL,0x575f08f108aef157ULL,0x732152c752e6c773ULL,0x9764f351f3355197ULL,0xcbae6523658d23cbULL,0xa125847c84597ca1ULL,0xe857bf9cbfcb9ce8ULL,0x3e5d6321637c213eULL,0x96ea7cdd7c37dd96ULL,0x611e7fdc7fc2dc61ULL,0x0d9c9186911a860dULL,0x0f9b9485941e850fULL,0xe04bab90abdb90e0ULL,0x7cbac642c6f8427cULL,0x712657c457e2c471ULL,0xcc29e5aae583aaccULL,0x90e373d8733bd890ULL,0x06090f050f0c0506ULL,0xf7f4030103f501f7ULL,0x1c2a36123638121cULL,0xc23cfea3fe9fa3c2ULL,0x6a8be15fe1d45f6aULL,0xaebe10f91047f9aeULL,0x69026bd06bd2d069ULL,0x17bfa891a82e9117ULL,0x9971e858e8295899ULL,0x3a5369276974273aULL,0x27f7d0b9d04eb927ULL,0xd991483848a938d9ULL,0xebde351335cd13ebULL,0x2be5ceb3ce56b32bULL,0x2277553355443322ULL,0xd204d6bbd6bfbbd2ULL,0xa9399070904970a9ULL,0x07878089800e8907ULL,0x33c1f2a7f266a733ULL,0x2decc1b6c15ab62dULL,0x3c5a66226678223cULL,0x15b8ad92ad2a9215ULL,0xc9a96020608920c9ULL,0x875cdb49db154987ULL,0xaab01aff1a4fffaaULL,0x50d8887888a07850ULL,0xa52b8e7a8e517aa5ULL,0x03898a8f8a068f03ULL,0x594a13f813b2f859ULL,0x09929b809b128009ULL,0x1a2339173934171aULL,0x651075da75cada65ULL,0xd784533153b531d7ULL,0x84d551c65113c684ULL,0xd003d3b8d3bbb8d0ULL,0x82dc5ec35e1fc382ULL,0x29e2cbb0cb52b029ULL,0x5ac3997799b4775aULL,0x1e2d3311333c111eULL,0x7b3d46cb46f6cb7bULL,0xa8b71ffc1f4bfca8ULL,0x6d0c61d661dad66dULL,0x2c624e3a4e583a2cULL,
+0xc6c632f4a5f497a5ULL,0xf8f86f978497eb84ULL,0xeeee5eb099b0c799ULL,0xf6f67a8c8d8cf78dULL,0xffffe8170d17e50dULL,0xd6d60adcbddcb7bdULL,0xdede16c8b1c8a7b1ULL,0x91916dfc54fc3954ULL,0x606090f050f0c050ULL,0x0202070503050403ULL,0xcece2ee0a9e087a9ULL,0x5656d1877d87ac7dULL,0xe7e7cc2b192bd519ULL,0xb5b513a662a67162ULL,0x4d4d7c31e6319ae6ULL,0xecec59b59ab5c39aULL,0x8f8f40cf45cf0545ULL,0x1f1fa3bc9dbc3e9dULL,0x898949c040c00940ULL,0xfafa68928792ef87ULL,0xefefd03f153fc515ULL,0xb2b29426eb267febULL,0x8e8ece40c94007c9ULL,0xfbfbe61d0b1ded0bULL,0x41416e2fec2f82ecULL,0xb3b31aa967a97d67ULL,0x5f5f431cfd1cbefdULL,0x45456025ea258aeaULL,0x2323f9dabfda46bfULL,0x53535102f702a6f7ULL,0xe4e445a196a1d396ULL,0x9b9b76ed5bed2d5bULL,0x7575285dc25deac2ULL,0xe1e1c5241c24d91cULL,0x3d3dd4e9aee97aaeULL,0x4c4cf2be6abe986aULL,0x6c6c82ee5aeed85aULL,0x7e7ebdc341c3fc41ULL,0xf5f5f3060206f102ULL,0x838352d14fd11d4fULL,0x68688ce45ce4d05cULL,0x51515607f407a2f4ULL,0xd1d18d5c345cb934ULL,0xf9f9e1180818e908ULL,0xe2e24cae93aedf93ULL,0xabab3e9573954d73ULL,0x626297f553f5c453ULL,0x2a2a6b413f41543fULL,0x08081c140c14100cULL,0x959563f652f63152ULL,0x4646e9af65af8c65ULL,0x9d9d7fe25ee2215eULL,0x3030487828786028ULL,0x3737cff8a1f86ea1ULL,0x0a0a1b110f11140fULL,0x2f2febc4b5c45eb5ULL,0x0e0e151b091b1c09ULL,0x24247e5a365a4836ULL,0x1b1badb69bb6369bULL,0xdfdf98473d47a53dULL,0xcdcda76a266a8126ULL,0x4e4ef5bb69bb9c69ULL,0x7f7f334ccd4cfecdULL,0xeaea50ba9fbacf9fULL,0x12123f2d1b2d241bULL,0x1d1da4b99eb93a9eULL,0x5858c49c749cb074ULL,0x343446722e72682eULL,0x363641772d776c2dULL,0xdcdc11cdb2cda3b2ULL,0xb4b49d29ee2973eeULL,0x5b5b4d16fb16b6fbULL,0xa4a4a501f60153f6ULL,0x7676a1d74dd7ec4dULL,0xb7b714a361a37561ULL,0x7d7d3449ce49faceULL,0x5252df8d7b8da47bULL,0xdddd9f423e42a13eULL,0x5e5ecd937193bc71ULL,0x1313b1a297a22697ULL,0xa6a6a204f50457f5ULL,0xb9b901b868b86968ULL,0x0000000000000000ULL,0xc1c1b5742c74992cULL,0x4040e0a060a08060ULL,0xe3e3c2211f21dd1fULL,0x79793a43c843f2c8ULL,0xb6b69a2ced2c77edULL,0xd4d40dd9bed9b3beULL,0x8d8d47ca46ca0146ULL,0x67671770d970ced9ULL,0x7272afdd4bdde44bULL,0x9494ed79de7933deULL,0x9898ff67d4672bd4ULL,0xb0b09323e8237be8ULL,0x85855bde4ade114aULL,0xbbbb06bd6bbd6d6bULL,0xc5c5bb7e2a7e912aULL,0x4f4f7b34e5349ee5ULL,0xededd73a163ac116ULL,0x8686d254c55417c5ULL,0x9a9af862d7622fd7ULL,0x666699ff55ffcc55ULL,0x1111b6a794a72294ULL,0x8a8ac04acf4a0fcfULL,0xe9e9d9301030c910ULL,0x04040e0a060a0806ULL,0xfefe66988198e781ULL,0xa0a0ab0bf00b5bf0ULL,0x7878b4cc44ccf044ULL,0x2525f0d5bad54abaULL,0x4b4b753ee33e96e3ULL,0xa2a2ac0ef30e5ff3ULL,0x5d5d4419fe19bafeULL,0x8080db5bc05b1bc0ULL,0x050580858a850a8aULL,0x3f3fd3ecadec7eadULL,0x2121fedfbcdf42bcULL,0x7070a8d848d8e048ULL,0xf1f1fd0c040cf904ULL,0x6363197adf7ac6dfULL,0x77772f58c158eec1ULL,0xafaf309f759f4575ULL,0x4242e7a563a58463ULL,0x2020705030504030ULL,0xe5e5cb2e1a2ed11aULL,0xfdfdef120e12e10eULL,0xbfbf08b76db7656dULL,0x818155d44cd4194cULL,0x1818243c143c3014ULL,0x2626795f355f4c35ULL,0xc3c3b2712f719d2fULL,0xbebe8638e13867e1ULL,0x3535c8fda2fd6aa2ULL,0x8888c74fcc4f0bccULL,0x2e2e654b394b5c39ULL,0x93936af957f93d57ULL,0x5555580df20daaf2ULL,0xfcfc619d829de382ULL,0x7a7ab3c947c9f447ULL,0xc8c827efacef8bacULL,0xbaba8832e7326fe7ULL,0x32324f7d2b7d642bULL,0xe6e642a495a4d795ULL,0xc0c03bfba0fb9ba0ULL,0x1919aab398b33298ULL,0x9e9ef668d16827d1ULL,0xa3a322817f815d7fULL,0x4444eeaa66aa8866ULL,0x5454d6827e82a87eULL,0x3b3bdde6abe676abULL,0x0b0b959e839e1683ULL,0x8c8cc945ca4503caULL,0xc7c7bc7b297b9529ULL,0x6b6b056ed36ed6d3ULL,0x28286c443c44503cULL,0xa7a72c8b798b5579ULL,0xbcbc813de23d63e2ULL,0x161631271d272c1dULL,0xadad379a769a4176ULL,0xdbdb964d3b4dad3bULL,0x64649efa56fac856ULL,0x7474a6d24ed2e84eULL,0x141436221e22281eULL,0x9292e476db763fdbULL,0x0c0c121e0a1e180aULL,0x4848fcb46cb4906cULL,0xb8b88f37e4376be4ULL,0x9f9f78e75de7255dULL,0xbdbd0fb26eb2616eULL,0x4343692aef2a86efULL,0xc4c435f1a6f193a6ULL,0x3939dae3a8e372a8ULL,0x3131c6f7a4f762a4ULL,0xd3d38a593759bd37ULL,0xf2f274868b86ff8bULL,0xd5d583563256b132ULL,0x8b8b4ec543c50d43ULL,0x6e6e85eb59ebdc59ULL,0xdada18c2b7c2afb7ULL,0x01018e8f8c8f028cULL,0xb1b11dac64ac7964ULL,0x9c9cf16dd26d23d2ULL,0x4949723be03b92e0ULL,0xd8d81fc7b4c7abb4ULL,0xacacb915fa1543faULL,0xf3f3fa090709fd07ULL,0xcfcfa06f256f8525ULL,0xcaca20eaafea8fafULL,0xf4f47d898e89f38eULL,0x47476720e9208ee9ULL,0x1010382818282018ULL,0x6f6f0b64d564ded5ULL,0xf0f073838883fb88ULL,0x4a4afbb16fb1946fULL,0x5c5cca967296b872ULL,0x3838546c246c7024ULL,0x57575f08f108aef1ULL,0x73732152c752e6c7ULL,0x979764f351f33551ULL,0xcbcbae6523658d23ULL,0xa1a125847c84597cULL,0xe8e857bf9cbfcb9cULL,0x3e3e5d6321637c21ULL,0x9696ea7cdd7c37ddULL,0x61611e7fdc7fc2dcULL,0x0d0d9c9186911a86ULL,0x0f0f9b9485941e85ULL,0xe0e04bab90abdb90ULL,0x7c7cbac642c6f842ULL,0x71712657c457e2c4ULL,0xcccc29e5aae583aaULL,0x9090e373d8733bd8ULL,0x0606090f050f0c05ULL,0xf7f7f4030103f501ULL,0x1c1c2a3612363812ULL,0xc2c23cfea3fe9fa3ULL,0x6a6a8be15fe1d45fULL,0xaeaebe10f91047f9ULL,0x6969026bd06bd2d0ULL,0x1717bfa891a82e91ULL,0x999971e858e82958ULL,0x3a3a536927697427ULL,0x2727f7d0b9d04eb9ULL,0xd9d991483848a938ULL,0xebebde351335cd13ULL,0x2b2be5ceb3ce56b3ULL,0x2222775533554433ULL,0xd2d204d6bbd6bfbbULL,0xa9a9399070904970ULL,0x0707878089800e89ULL,0x3333c1f2a7f266a7ULL,0x2d2decc1b6c15ab6ULL,0x3c3c5a6622667822ULL,0x1515b8ad92ad2a92ULL,0xc9c9a96020608920ULL,0x87875cdb49db1549ULL,0xaaaab01aff1a4fffULL,0x5050d8887888a078ULL,0xa5a52b8e7a8e517aULL,0x0303898a8f8a068fULL,0x59594a13f813b2f8ULL,0x0909929b809b1280ULL,0x1a1a233917393417ULL,0x65651075da75cadaULL,0xd7d784533153b531ULL,0x8484d551c65113c6ULL,0xd0d003d3b8d3bbb8ULL,0x8282dc5ec35e1fc3ULL,0x2929e2cbb0cb52b0ULL,0x5a5ac3997799b477ULL,0x1e1e2d3311333c11ULL,0x7b7b3d46cb46f6cbULL,0xa8a8b71ffc1f4bfcULL,0x6d6d0c61d661dad6ULL,0x2c2c624e3a4e583aULL,
+0xa5c6c632f4a5f497ULL,0x84f8f86f978497ebULL,0x99eeee5eb099b0c7ULL,0x8df6f67a8c8d8cf7ULL,0x0dffffe8170d17e5ULL,0xbdd6d60adcbddcb7ULL,0xb1dede16c8b1c8a7ULL,0x5491916dfc54fc39ULL,0x50606090f050f0c0ULL,0x0302020705030504ULL,0xa9cece2ee0a9e087ULL,0x7d5656d1877d87acULL,0x19e7e7cc2b192bd5ULL,0x62b5b513a662a671ULL,0xe64d4d7c31e6319aULL,0x9aecec59b59ab5c3ULL,0x458f8f40cf45cf05ULL,0x9d1f1fa3bc9dbc3eULL,0x40898949c040c009ULL,0x87fafa68928792efULL,0x15efefd03f153fc5ULL,0xebb2b29426eb267fULL,0xc98e8ece40c94007ULL,0x0bfbfbe61d0b1dedULL,0xec41416e2fec2f82ULL,0x67b3b31aa967a97dULL,0xfd5f5f431cfd1cbeULL,0xea45456025ea258aULL,0xbf2323f9dabfda46ULL,0xf753535102f702a6ULL,0x96e4e445a196a1d3ULL,0x5b9b9b76ed5bed2dULL,0xc27575285dc25deaULL,0x1ce1e1c5241c24d9ULL,0xae3d3dd4e9aee97aULL,0x6a4c4cf2be6abe98ULL,0x5a6c6c82ee5aeed8ULL,0x417e7ebdc341c3fcULL,0x02f5f5f3060206f1ULL,0x4f838352d14fd11dULL,0x5c68688ce45ce4d0ULL,0xf451515607f407a2ULL,0x34d1d18d5c345cb9ULL,0x08f9f9e1180818e9ULL,0x93e2e24cae93aedfULL,0x73abab3e9573954dULL,0x53626297f553f5c4ULL,0x3f2a2a6b413f4154ULL,0x0c08081c140c1410ULL,0x52959563f652f631ULL,0x654646e9af65af8cULL,0x5e9d9d7fe25ee221ULL,0x2830304878287860ULL,0xa13737cff8a1f86eULL,0x0f0a0a1b110f1114ULL,0xb52f2febc4b5c45eULL,0x090e0e151b091b1cULL,0x3624247e5a365a48ULL,0x9b1b1badb69bb636ULL,0x3ddfdf98473d47a5ULL,0x26cdcda76a266a81ULL,0x694e4ef5bb69bb9cULL,0xcd7f7f334ccd4cfeULL,0x9feaea50ba9fbacfULL,0x1b12123f2d1b2d24ULL,0x9e1d1da4b99eb93aULL,0x745858c49c749cb0ULL,0x2e343446722e7268ULL,0x2d363641772d776cULL,0xb2dcdc11cdb2cda3ULL,0xeeb4b49d29ee2973ULL,0xfb5b5b4d16fb16b6ULL,0xf6a4a4a501f60153ULL,0x4d7676a1d74dd7ecULL,0x61b7b714a361a375ULL,0xce7d7d3449ce49faULL,0x7b5252df8d7b8da4ULL,0x3edddd9f423e42a1ULL,0x715e5ecd937193bcULL,0x971313b1a297a226ULL,0xf5a6a6a204f50457ULL,0x68b9b901b868b869ULL,0x0000000000000000ULL,0x2cc1c1b5742c7499ULL,0x604040e0a060a080ULL,0x1fe3e3c2211f21ddULL,0xc879793a43c843f2ULL,0xedb6b69a2ced2c77ULL,0xbed4d40dd9bed9b3ULL,0x468d8d47ca46ca01ULL,0xd967671770d970ceULL,0x4b7272afdd4bdde4ULL,0xde9494ed79de7933ULL,0xd49898ff67d4672bULL,0xe8b0b09323e8237bULL,0x4a85855bde4ade11ULL,0x6bbbbb06bd6bbd6dULL,0x2ac5c5bb7e2a7e91ULL,0xe54f4f7b34e5349eULL,0x16ededd73a163ac1ULL,0xc58686d254c55417ULL,0xd79a9af862d7622fULL,0x55666699ff55ffccULL,0x941111b6a794a722ULL,0xcf8a8ac04acf4a0fULL,0x10e9e9d9301030c9ULL,0x0604040e0a060a08ULL,0x81fefe66988198e7ULL,0xf0a0a0ab0bf00b5bULL,0x447878b4cc44ccf0ULL,0xba2525f0d5bad54aULL,0xe34b4b753ee33e96ULL,0xf3a2a2ac0ef30e5fULL,0xfe5d5d4419fe19baULL,0xc08080db5bc05b1bULL,0x8a050580858a850aULL,0xad3f3fd3ecadec7eULL,0xbc2121fedfbcdf42ULL,0x487070a8d848d8e0ULL,0x04f1f1fd0c040cf9ULL,0xdf6363197adf7ac6ULL,0xc177772f58c158eeULL,0x75afaf309f759f45ULL,0x634242e7a563a584ULL,0x3020207050305040ULL,0x1ae5e5cb2e1a2ed1ULL,0x0efdfdef120e12e1ULL,0x6dbfbf08b76db765ULL,0x4c818155d44cd419ULL,0x141818243c143c30ULL,0x352626795f355f4cULL,0x2fc3c3b2712f719dULL,0xe1bebe8638e13867ULL,0xa23535c8fda2fd6aULL,0xcc8888c74fcc4f0bULL,0x392e2e654b394b5cULL,0x5793936af957f93dULL,0xf25555580df20daaULL,0x82fcfc619d829de3ULL,0x477a7ab3c947c9f4ULL,0xacc8c827efacef8bULL,0xe7baba8832e7326fULL,0x2b32324f7d2b7d64ULL,0x95e6e642a495a4d7ULL,0xa0c0c03bfba0fb9bULL,0x981919aab398b332ULL,0xd19e9ef668d16827ULL,0x7fa3a322817f815dULL,0x664444eeaa66aa88ULL,0x7e5454d6827e82a8ULL,0xab3b3bdde6abe676ULL,0x830b0b959e839e16ULL,0xca8c8cc945ca4503ULL,0x29c7c7bc7b297b95ULL,0xd36b6b056ed36ed6ULL,0x3c28286c443c4450ULL,0x79a7a72c8b798b55ULL,0xe2bcbc813de23d63ULL,0x1d161631271d272cULL,0x76adad379a769a41ULL,0x3bdbdb964d3b4dadULL,0x5664649efa56fac8ULL,0x4e7474a6d24ed2e8ULL,0x1e141436221e2228ULL,0xdb9292e476db763fULL,0x0a0c0c121e0a1e18ULL,0x6c4848fcb46cb490ULL,0xe4b8b88f37e4376bULL,0x5d9f9f78e75de725ULL,0x6ebdbd0fb26eb261ULL,0xef4343692aef2a86ULL,0xa6c4c435f1a6f193ULL,0xa83939dae3a8e372ULL,0xa43131c6f7a4f762ULL,0x37d3d38a593759bdULL,0x8bf2f274868b86ffULL,0x32d5d583563256b1ULL,0x438b8b4ec543c50dULL,0x596e6e85eb59ebdcULL,0xb7dada18c2b7c2afULL,0x8c01018e8f8c8f02ULL,0x64b1b11dac64ac79ULL,0xd29c9cf16dd26d23ULL,0xe04949723be03b92ULL,0xb4d8d81fc7b4c7abULL,0xfaacacb915fa1543ULL,0x07f3f3fa090709fdULL,0x25cfcfa06f256f85ULL,0xafcaca20eaafea8fULL,0x8ef4f47d898e89f3ULL,0xe947476720e9208eULL,0x1810103828182820ULL,0xd56f6f0b64d564deULL,0x88f0f073838883fbULL,0x6f4a4afbb16fb194ULL,0x725c5cca967296b8ULL,0x243838546c246c70ULL,0xf157575f08f108aeULL,0xc773732152c752e6ULL,0x51979764f351f335ULL,0x23cbcbae6523658dULL,0x7ca1a125847c8459ULL,0x9ce8e857bf9cbfcbULL,0x213e3e5d6321637cULL,0xdd9696ea7cdd7c37ULL,0xdc61611e7fdc7fc2ULL,0x860d0d9c9186911aULL,0x850f0f9b9485941eULL,0x90e0e04bab90abdbULL,0x427c7cbac642c6f8ULL,0xc471712657c457e2ULL,0xaacccc29e5aae583ULL,0xd89090e373d8733bULL,0x050606090f050f0cULL,0x01f7f7f4030103f5ULL,0x121c1c2a36123638ULL,0xa3c2c23cfea3fe9fULL,0x5f6a6a8be15fe1d4ULL,0xf9aeaebe10f91047ULL,0xd06969026bd06bd2ULL,0x911717bfa891a82eULL,0x58999971e858e829ULL,0x273a3a5369276974ULL,0xb92727f7d0b9d04eULL,0x38d9d991483848a9ULL,0x13ebebde351335cdULL,0xb32b2be5ceb3ce56ULL,0x3322227755335544ULL,0xbbd2d204d6bbd6bfULL,0x70a9a93990709049ULL,0x890707878089800eULL,0xa73333c1f2a7f266ULL,0xb62d2decc1b6c15aULL,0x223c3c5a66226678ULL,0x921515b8ad92ad2aULL,0x20c9c9a960206089ULL,0x4987875cdb49db15ULL,0xffaaaab01aff1a4fULL,0x785050d8887888a0ULL,0x7aa5a52b8e7a8e51ULL,0x8f0303898a8f8a06ULL,0xf859594a13f813b2ULL,0x800909929b809b12ULL,0x171a1a2339173934ULL,0xda65651075da75caULL,0x31d7d784533153b5ULL,0xc68484d551c65113ULL,0xb8d0d003d3b8d3bbULL,0xc38282dc5ec35e1fULL,0xb02929e2cbb0cb52ULL,0x775a5ac3997799b4ULL,0x111e1e2d3311333cULL,0xcb7b7b3d46cb46f6ULL,0xfca8a8b71ffc1f4bULL,0xd66d6d0c61d661daULL,0x3a2c2c624e3a4e58ULL,
+0x97a5c6c632f4a5f4ULL,0xeb84f8f86f978497ULL,0xc799eeee5eb099b0ULL,0xf78df6f67a8c8d8cULL,0xe50dffffe8170d17ULL,0xb7bdd6d60adcbddcULL,0xa7b1dede16c8b1c8ULL,0x395491916dfc54fcULL,0xc050606090f050f0ULL,0x0403020207050305ULL,0x87a9cece2ee0a9e0ULL,0xac7d5656d1877d87ULL,0xd519e7e7cc2b192bULL,0x7162b5b513a662a6ULL,0x9ae64d4d7c31e631ULL,0xc39aecec59b59ab5ULL,0x05458f8f40cf45cfULL,0x3e9d1f1fa3bc9dbcULL,0x0940898949c040c0ULL,0xef87fafa68928792ULL,0xc515efefd03f153fULL,0x7febb2b29426eb26ULL,0x07c98e8ece40c940ULL,0xed0bfbfbe61d0b1dULL,0x82ec41416e2fec2fULL,0x7d67b3b31aa967a9ULL,0xbefd5f5f431cfd1cULL,0x8aea45456025ea25ULL,0x46bf2323f9dabfdaULL,0xa6f753535102f702ULL,0xd396e4e445a196a1ULL,0x2d5b9b9b76ed5bedULL,0xeac27575285dc25dULL,0xd91ce1e1c5241c24ULL,0x7aae3d3dd4e9aee9ULL,0x986a4c4cf2be6abeULL,0xd85a6c6c82ee5aeeULL,0xfc417e7ebdc341c3ULL,0xf102f5f5f3060206ULL,0x1d4f838352d14fd1ULL,0xd05c68688ce45ce4ULL,0xa2f451515607f407ULL,0xb934d1d18d5c345cULL,0xe908f9f9e1180818ULL,0xdf93e2e24cae93aeULL,0x4d73abab3e957395ULL,0xc453626297f553f5ULL,0x543f2a2a6b413f41ULL,0x100c08081c140c14ULL,0x3152959563f652f6ULL,0x8c654646e9af65afULL,0x215e9d9d7fe25ee2ULL,0x6028303048782878ULL,0x6ea13737cff8a1f8ULL,0x140f0a0a1b110f11ULL,0x5eb52f2febc4b5c4ULL,0x1c090e0e151b091bULL,0x483624247e5a365aULL,0x369b1b1badb69bb6ULL,0xa53ddfdf98473d47ULL,0x8126cdcda76a266aULL,0x9c694e4ef5bb69bbULL,0xfecd7f7f334ccd4cULL,0xcf9feaea50ba9fbaULL,0x241b12123f2d1b2dULL,0x3a9e1d1da4b99eb9ULL,0xb0745858c49c749cULL,0x682e343446722e72ULL,0x6c2d363641772d77ULL,0xa3b2dcdc11cdb2cdULL,0x73eeb4b49d29ee29ULL,0xb6fb5b5b4d16fb16ULL,0x53f6a4a4a501f601ULL,0xec4d7676a1d74dd7ULL,0x7561b7b714a361a3ULL,0xface7d7d3449ce49ULL,0xa47b5252df8d7b8dULL,0xa13edddd9f423e42ULL,0xbc715e5ecd937193ULL,0x26971313b1a297a2ULL,0x57f5a6a6a204f504ULL,0x6968b9b901b868b8ULL,0x0000000000000000ULL,0x992cc1c1b5742c74ULL,0x80604040e0a060a0ULL,0xdd1fe3e3c2211f21ULL,0xf2c879793a43c843ULL,0x77edb6b69a2ced2cULL,0xb3bed4d40dd9bed9ULL,0x01468d8d47ca46caULL,0xced967671770d970ULL,0xe44b7272afdd4bddULL,0x33de9494ed79de79ULL,0x2bd49898ff67d467ULL,0x7be8b0b09323e823ULL,0x114a85855bde4adeULL,0x6d6bbbbb06bd6bbdULL,0x912ac5c5bb7e2a7eULL,0x9ee54f4f7b34e534ULL,0xc116ededd73a163aULL,0x17c58686d254c554ULL,0x2fd79a9af862d762ULL,0xcc55666699ff55ffULL,0x22941111b6a794a7ULL,0x0fcf8a8ac04acf4aULL,0xc910e9e9d9301030ULL,0x080604040e0a060aULL,0xe781fefe66988198ULL,0x5bf0a0a0ab0bf00bULL,0xf0447878b4cc44ccULL,0x4aba2525f0d5bad5ULL,0x96e34b4b753ee33eULL,0x5ff3a2a2ac0ef30eULL,0xbafe5d5d4419fe19ULL,0x1bc08080db5bc05bULL,0x0a8a050580858a85ULL,0x7ead3f3fd3ecadecULL,0x42bc2121fedfbcdfULL,0xe0487070a8d848d8ULL,0xf904f1f1fd0c040cULL,0xc6df6363197adf7aULL,0xeec177772f58c158ULL,0x4575afaf309f759fULL,0x84634242e7a563a5ULL,0x4030202070503050ULL,0xd11ae5e5cb2e1a2eULL,0xe10efdfdef120e12ULL,0x656dbfbf08b76db7ULL,0x194c818155d44cd4ULL,0x30141818243c143cULL,0x4c352626795f355fULL,0x9d2fc3c3b2712f71ULL,0x67e1bebe8638e138ULL,0x6aa23535c8fda2fdULL,0x0bcc8888c74fcc4fULL,0x5c392e2e654b394bULL,0x3d5793936af957f9ULL,0xaaf25555580df20dULL,0xe382fcfc619d829dULL,0xf4477a7ab3c947c9ULL,0x8bacc8c827efacefULL,0x6fe7baba8832e732ULL,0x642b32324f7d2b7dULL,0xd795e6e642a495a4ULL,0x9ba0c0c03bfba0fbULL,0x32981919aab398b3ULL,0x27d19e9ef668d168ULL,0x5d7fa3a322817f81ULL,0x88664444eeaa66aaULL,0xa87e5454d6827e82ULL,0x76ab3b3bdde6abe6ULL,0x16830b0b959e839eULL,0x03ca8c8cc945ca45ULL,0x9529c7c7bc7b297bULL,0xd6d36b6b056ed36eULL,0x503c28286c443c44ULL,0x5579a7a72c8b798bULL,0x63e2bcbc813de23dULL,0x2c1d161631271d27ULL,0x4176adad379a769aULL,0xad3bdbdb964d3b4dULL,0xc85664649efa56faULL,0xe84e7474a6d24ed2ULL,0x281e141436221e22ULL,0x3fdb9292e476db76ULL,0x180a0c0c121e0a1eULL,0x906c4848fcb46cb4ULL,0x6be4b8b88f37e437ULL,0x255d9f9f78e75de7ULL,0x616ebdbd0fb26eb2ULL,0x86ef4343692aef2aULL,0x93a6c4c435f1a6f1ULL,0x72a83939dae3a8e3ULL,0x62a43131c6f7a4f7ULL,0xbd37d3d38a593759ULL,0xff8bf2f274868b86ULL,0xb132d5d583563256ULL,0x0d438b8b4ec543c5ULL,0xdc596e6e85eb59ebULL,0xafb7dada18c2b7c2ULL,0x028c01018e8f8c8fULL,0x7964b1b11dac64acULL,0x23d29c9cf16dd26dULL,0x92e04949723be03bULL,0xabb4d8d81fc7b4c7ULL,0x43faacacb915fa15ULL,0xfd07f3f3fa090709ULL,0x8525cfcfa06f256fULL,0x8fafcaca20eaafeaULL,0xf38ef4f47d898e89ULL,0x8ee947476720e920ULL,0x2018101038281828ULL,0xded56f6f0b64d564ULL,0xfb88f0f073838883ULL,0x946f4a4afbb16fb1ULL,0xb8725c5cca967296ULL,0x70243838546c246cULL,0xaef157575f08f108ULL,0xe6c773732152c752ULL,0x3551979764f351f3ULL,0x8d23cbcbae652365ULL,0x597ca1a125847c84ULL,0xcb9ce8e857bf9cbfULL,0x7c213e3e5d632163ULL,0x37dd9696ea7cdd7cULL,0xc2dc61611e7fdc7fULL,0x1a860d0d9c918691ULL,0x1e850f0f9b948594ULL,0xdb90e0e04bab90abULL,0xf8427c7cbac642c6ULL,0xe2c471712657c457ULL,0x83aacccc29e5aae5ULL,0x3bd89090e373d873ULL,0x0c050606090f050fULL,0xf501f7f7f4030103ULL,0x38121c1c2a361236ULL,0x9fa3c2c23cfea3feULL,0xd45f6a6a8be15fe1ULL,0x47f9aeaebe10f910ULL,0xd2d06969026bd06bULL,0x2e911717bfa891a8ULL,0x2958999971e858e8ULL,0x74273a3a53692769ULL,0x4eb92727f7d0b9d0ULL,0xa938d9d991483848ULL,0xcd13ebebde351335ULL,0x56b32b2be5ceb3ceULL,0x4433222277553355ULL,0xbfbbd2d204d6bbd6ULL,0x4970a9a939907090ULL,0x0e89070787808980ULL,0x66a73333c1f2a7f2ULL,0x5ab62d2decc1b6c1ULL,0x78223c3c5a662266ULL,0x2a921515b8ad92adULL,0x8920c9c9a9602060ULL,0x154987875cdb49dbULL,0x4fffaaaab01aff1aULL,0xa0785050d8887888ULL,0x517aa5a52b8e7a8eULL,0x068f0303898a8f8aULL,0xb2f859594a13f813ULL,0x12800909929b809bULL,0x34171a1a23391739ULL,0xcada65651075da75ULL,0xb531d7d784533153ULL,0x13c68484d551c651ULL,0xbbb8d0d003d3b8d3ULL,0x1fc38282dc5ec35eULL,0x52b02929e2cbb0cbULL,0xb4775a5ac3997799ULL,0x3c111e1e2d331133ULL,0xf6cb7b7b3d46cb46ULL,0x4bfca8a8b71ffc1fULL,0xdad66d6d0c61d661ULL,0x583a2c2c624e3a4eULL,
+0xf497a5c6c632f4a5ULL,0x97eb84f8f86f9784ULL,0xb0c799eeee5eb099ULL,0x8cf78df6f67a8c8dULL,0x17e50dffffe8170dULL,0xdcb7bdd6d60adcbdULL,0xc8a7b1dede16c8b1ULL,0xfc395491916dfc54ULL,0xf0c050606090f050ULL,0x0504030202070503ULL,0xe087a9cece2ee0a9ULL,0x87ac7d5656d1877dULL,0x2bd519e7e7cc2b19ULL,0xa67162b5b513a662ULL,0x319ae64d4d7c31e6ULL,0xb5c39aecec59b59aULL,0xcf05458f8f40cf45ULL,0xbc3e9d1f1fa3bc9dULL,0xc00940898949c040ULL,0x92ef87fafa689287ULL,0x3fc515efefd03f15ULL,0x267febb2b29426ebULL,0x4007c98e8ece40c9ULL,0x1ded0bfbfbe61d0bULL,0x2f82ec41416e2fecULL,0xa97d67b3b31aa967ULL,0x1cbefd5f5f431cfdULL,0x258aea45456025eaULL,0xda46bf2323f9dabfULL,0x02a6f753535102f7ULL,0xa1d396e4e445a196ULL,0xed2d5b9b9b76ed5bULL,0x5deac27575285dc2ULL,0x24d91ce1e1c5241cULL,0xe97aae3d3dd4e9aeULL,0xbe986a4c4cf2be6aULL,0xeed85a6c6c82ee5aULL,0xc3fc417e7ebdc341ULL,0x06f102f5f5f30602ULL,0xd11d4f838352d14fULL,0xe4d05c68688ce45cULL,0x07a2f451515607f4ULL,0x5cb934d1d18d5c34ULL,0x18e908f9f9e11808ULL,0xaedf93e2e24cae93ULL,0x954d73abab3e9573ULL,0xf5c453626297f553ULL,0x41543f2a2a6b413fULL,0x14100c08081c140cULL,0xf63152959563f652ULL,0xaf8c654646e9af65ULL,0xe2215e9d9d7fe25eULL,0x7860283030487828ULL,0xf86ea13737cff8a1ULL,0x11140f0a0a1b110fULL,0xc45eb52f2febc4b5ULL,0x1b1c090e0e151b09ULL,0x5a483624247e5a36ULL,0xb6369b1b1badb69bULL,0x47a53ddfdf98473dULL,0x6a8126cdcda76a26ULL,0xbb9c694e4ef5bb69ULL,0x4cfecd7f7f334ccdULL,0xbacf9feaea50ba9fULL,0x2d241b12123f2d1bULL,0xb93a9e1d1da4b99eULL,0x9cb0745858c49c74ULL,0x72682e343446722eULL,0x776c2d363641772dULL,0xcda3b2dcdc11cdb2ULL,0x2973eeb4b49d29eeULL,0x16b6fb5b5b4d16fbULL,0x0153f6a4a4a501f6ULL,0xd7ec4d7676a1d74dULL,0xa37561b7b714a361ULL,0x49face7d7d3449ceULL,0x8da47b5252df8d7bULL,0x42a13edddd9f423eULL,0x93bc715e5ecd9371ULL,0xa226971313b1a297ULL,0x0457f5a6a6a204f5ULL,0xb86968b9b901b868ULL,0x0000000000000000ULL,0x74992cc1c1b5742cULL,0xa080604040e0a060ULL,0x21dd1fe3e3c2211fULL,0x43f2c879793a43c8ULL,0x2c77edb6b69a2cedULL,0xd9b3bed4d40dd9beULL,0xca01468d8d47ca46ULL,0x70ced967671770d9ULL,0xdde44b7272afdd4bULL,0x7933de9494ed79deULL,0x672bd49898ff67d4ULL,0x237be8b0b09323e8ULL,0xde114a85855bde4aULL,0xbd6d6bbbbb06bd6bULL,0x7e912ac5c5bb7e2aULL,0x349ee54f4f7b34e5ULL,0x3ac116ededd73a16ULL,0x5417c58686d254c5ULL,0x622fd79a9af862d7ULL,0xffcc55666699ff55ULL,0xa722941111b6a794ULL,0x4a0fcf8a8ac04acfULL,0x30c910e9e9d93010ULL,0x0a080604040e0a06ULL,0x98e781fefe669881ULL,0x0b5bf0a0a0ab0bf0ULL,0xccf0447878b4cc44ULL,0xd54aba2525f0d5baULL,0x3e96e34b4b753ee3ULL,0x0e5ff3a2a2ac0ef3ULL,0x19bafe5d5d4419feULL,0x5b1bc08080db5bc0ULL,0x850a8a050580858aULL,0xec7ead3f3fd3ecadULL,0xdf42bc2121fedfbcULL,0xd8e0487070a8d848ULL,0x0cf904f1f1fd0c04ULL,0x7ac6df6363197adfULL,0x58eec177772f58c1ULL,0x9f4575afaf309f75ULL,0xa584634242e7a563ULL,0x5040302020705030ULL,0x2ed11ae5e5cb2e1aULL,0x12e10efdfdef120eULL,0xb7656dbfbf08b76dULL,0xd4194c818155d44cULL,0x3c30141818243c14ULL,0x5f4c352626795f35ULL,0x719d2fc3c3b2712fULL,0x3867e1bebe8638e1ULL,0xfd6aa23535c8fda2ULL,0x4f0bcc8888c74fccULL,0x4b5c392e2e654b39ULL,0xf93d5793936af957ULL,0x0daaf25555580df2ULL,0x9de382fcfc619d82ULL,0xc9f4477a7ab3c947ULL,0xef8bacc8c827efacULL,0x326fe7baba8832e7ULL,0x7d642b32324f7d2bULL,0xa4d795e6e642a495ULL,0xfb9ba0c0c03bfba0ULL,0xb332981919aab398ULL,0x6827d19e9ef668d1ULL,0x815d7fa3a322817fULL,0xaa88664444eeaa66ULL,0x82a87e5454d6827eULL,0xe676ab3b3bdde6abULL,0x9e16830b0b959e83ULL,0x4503ca8c8cc945caULL,0x7b9529c7c7bc7b29ULL,0x6ed6d36b6b056ed3ULL,0x44503c28286c443cULL,0x8b5579a7a72c8b79ULL,0x3d63e2bcbc813de2ULL,0x272c1d161631271dULL,0x9a4176adad379a76ULL,0x4dad3bdbdb964d3bULL,0xfac85664649efa56ULL,0xd2e84e7474a6d24eULL,0x22281e141436221eULL,0x763fdb9292e476dbULL,0x1e180a0c0c121e0aULL,0xb4906c4848fcb46cULL,0x376be4b8b88f37e4ULL,0xe7255d9f9f78e75dULL,0xb2616ebdbd0fb26eULL,0x2a86ef4343692aefULL,0xf193a6c4c435f1a6ULL,0xe372a83939dae3a8ULL,0xf762a43131c6f7a4ULL,0x59bd37d3d38a5937ULL,0x86ff8bf2f274868bULL,0x56b132d5d5835632ULL,0xc50d438b8b4ec543ULL,0xebdc596e6e85eb59ULL,0xc2afb7dada18c2b7ULL,0x8f028c01018e8f8cULL,0xac7964b1b11dac64ULL,0x6d23d29c9cf16dd2ULL,0x3b92e04949723be0ULL,0xc7abb4d8d81fc7b4ULL,0x1543faacacb915faULL,0x09fd07f3f3fa0907ULL,0x6f8525cfcfa06f25ULL,0xea8fafcaca20eaafULL,0x89f38ef4f47d898eULL,0x208ee947476720e9ULL,0x2820181010382818ULL,0x64ded56f6f0b64d5ULL,0x83fb88f0f0738388ULL,0xb1946f4a4afbb16fULL,0x96b8725c5cca9672ULL,0x6c70243838546c24ULL,0x08aef157575f08f1ULL,0x52e6c773732152c7ULL,0xf33551979764f351ULL,0x658d23cbcbae6523ULL,0x84597ca1a125847cULL,0xbfcb9ce8e857bf9cULL,0x637c213e3e5d6321ULL,0x7c37dd9696ea7cddULL,0x7fc2dc61611e7fdcULL,0x911a860d0d9c9186ULL,0x941e850f0f9b9485ULL,0xabdb90e0e04bab90ULL,0xc6f8427c7cbac642ULL,0x57e2c471712657c4ULL,0xe583aacccc29e5aaULL,0x733bd89090e373d8ULL,0x0f0c050606090f05ULL,0x03f501f7f7f40301ULL,0x3638121c1c2a3612ULL,0xfe9fa3c2c23cfea3ULL,0xe1d45f6a6a8be15fULL,0x1047f9aeaebe10f9ULL,0x6bd2d06969026bd0ULL,0xa82e911717bfa891ULL,0xe82958999971e858ULL,0x6974273a3a536927ULL,0xd04eb92727f7d0b9ULL,0x48a938d9d9914838ULL,0x35cd13ebebde3513ULL,0xce56b32b2be5ceb3ULL,0x5544332222775533ULL,0xd6bfbbd2d204d6bbULL,0x904970a9a9399070ULL,0x800e890707878089ULL,0xf266a73333c1f2a7ULL,0xc15ab62d2decc1b6ULL,0x6678223c3c5a6622ULL,0xad2a921515b8ad92ULL,0x608920c9c9a96020ULL,0xdb154987875cdb49ULL,0x1a4fffaaaab01affULL,0x88a0785050d88878ULL,0x8e517aa5a52b8e7aULL,0x8a068f0303898a8fULL,0x13b2f859594a13f8ULL,0x9b12800909929b80ULL,0x3934171a1a233917ULL,0x75cada65651075daULL,0x53b531d7d7845331ULL,0x5113c68484d551c6ULL,0xd3bbb8d0d003d3b8ULL,0x5e1fc38282dc5ec3ULL,0xcb52b02929e2cbb0ULL,0x99b4775a5ac39977ULL,0x333c111e1e2d3311ULL,0x46f6cb7b7b3d46cbULL,0x1f4bfca8a8b71ffcULL,0x61dad66d6d0c61d6ULL,0x4e583a2c2c624e3aULL,
+0xa5f497a5c6c632f4ULL,0x8497eb84f8f86f97ULL,0x99b0c799eeee5eb0ULL,0x8d8cf78df6f67a8cULL,0x0d17e50dffffe817ULL,0xbddcb7bdd6d60adcULL,0xb1c8a7b1dede16c8ULL,0x54fc395491916dfcULL,0x50f0c050606090f0ULL,0x0305040302020705ULL,0xa9e087a9cece2ee0ULL,0x7d87ac7d5656d187ULL,0x192bd519e7e7cc2bULL,0x62a67162b5b513a6ULL,0xe6319ae64d4d7c31ULL,0x9ab5c39aecec59b5ULL,0x45cf05458f8f40cfULL,0x9dbc3e9d1f1fa3bcULL,0x40c00940898949c0ULL,0x8792ef87fafa6892ULL,0x153fc515efefd03fULL,0xeb267febb2b29426ULL,0xc94007c98e8ece40ULL,0x0b1ded0bfbfbe61dULL,0xec2f82ec41416e2fULL,0x67a97d67b3b31aa9ULL,0xfd1cbefd5f5f431cULL,0xea258aea45456025ULL,0xbfda46bf2323f9daULL,0xf702a6f753535102ULL,0x96a1d396e4e445a1ULL,0x5bed2d5b9b9b76edULL,0xc25deac27575285dULL,0x1c24d91ce1e1c524ULL,0xaee97aae3d3dd4e9ULL,0x6abe986a4c4cf2beULL,0x5aeed85a6c6c82eeULL,0x41c3fc417e7ebdc3ULL,0x0206f102f5f5f306ULL,0x4fd11d4f838352d1ULL,0x5ce4d05c68688ce4ULL,0xf407a2f451515607ULL,0x345cb934d1d18d5cULL,0x0818e908f9f9e118ULL,0x93aedf93e2e24caeULL,0x73954d73abab3e95ULL,0x53f5c453626297f5ULL,0x3f41543f2a2a6b41ULL,0x0c14100c08081c14ULL,0x52f63152959563f6ULL,0x65af8c654646e9afULL,0x5ee2215e9d9d7fe2ULL,0x2878602830304878ULL,0xa1f86ea13737cff8ULL,0x0f11140f0a0a1b11ULL,0xb5c45eb52f2febc4ULL,0x091b1c090e0e151bULL,0x365a483624247e5aULL,0x9bb6369b1b1badb6ULL,0x3d47a53ddfdf9847ULL,0x266a8126cdcda76aULL,0x69bb9c694e4ef5bbULL,0xcd4cfecd7f7f334cULL,0x9fbacf9feaea50baULL,0x1b2d241b12123f2dULL,0x9eb93a9e1d1da4b9ULL,0x749cb0745858c49cULL,0x2e72682e34344672ULL,0x2d776c2d36364177ULL,0xb2cda3b2dcdc11cdULL,0xee2973eeb4b49d29ULL,0xfb16b6fb5b5b4d16ULL,0xf60153f6a4a4a501ULL,0x4dd7ec4d7676a1d7ULL,0x61a37561b7b714a3ULL,0xce49face7d7d3449ULL,0x7b8da47b5252df8dULL,0x3e42a13edddd9f42ULL,0x7193bc715e5ecd93ULL,0x97a226971313b1a2ULL,0xf50457f5a6a6a204ULL,0x68b86968b9b901b8ULL,0x0000000000000000ULL,0x2c74992cc1c1b574ULL,0x60a080604040e0a0ULL,0x1f21dd1fe3e3c221ULL,0xc843f2c879793a43ULL,0xed2c77edb6b69a2cULL,0xbed9b3bed4d40dd9ULL,0x46ca01468d8d47caULL,0xd970ced967671770ULL,0x4bdde44b7272afddULL,0xde7933de9494ed79ULL,0xd4672bd49898ff67ULL,0xe8237be8b0b09323ULL,0x4ade114a85855bdeULL,0x6bbd6d6bbbbb06bdULL,0x2a7e912ac5c5bb7eULL,0xe5349ee54f4f7b34ULL,0x163ac116ededd73aULL,0xc55417c58686d254ULL,0xd7622fd79a9af862ULL,0x55ffcc55666699ffULL,0x94a722941111b6a7ULL,0xcf4a0fcf8a8ac04aULL,0x1030c910e9e9d930ULL,0x060a080604040e0aULL,0x8198e781fefe6698ULL,0xf00b5bf0a0a0ab0bULL,0x44ccf0447878b4ccULL,0xbad54aba2525f0d5ULL,0xe33e96e34b4b753eULL,0xf30e5ff3a2a2ac0eULL,0xfe19bafe5d5d4419ULL,0xc05b1bc08080db5bULL,0x8a850a8a05058085ULL,0xadec7ead3f3fd3ecULL,0xbcdf42bc2121fedfULL,0x48d8e0487070a8d8ULL,0x040cf904f1f1fd0cULL,0xdf7ac6df6363197aULL,0xc158eec177772f58ULL,0x759f4575afaf309fULL,0x63a584634242e7a5ULL,0x3050403020207050ULL,0x1a2ed11ae5e5cb2eULL,0x0e12e10efdfdef12ULL,0x6db7656dbfbf08b7ULL,0x4cd4194c818155d4ULL,0x143c30141818243cULL,0x355f4c352626795fULL,0x2f719d2fc3c3b271ULL,0xe13867e1bebe8638ULL,0xa2fd6aa23535c8fdULL,0xcc4f0bcc8888c74fULL,0x394b5c392e2e654bULL,0x57f93d5793936af9ULL,0xf20daaf25555580dULL,0x829de382fcfc619dULL,0x47c9f4477a7ab3c9ULL,0xacef8bacc8c827efULL,0xe7326fe7baba8832ULL,0x2b7d642b32324f7dULL,0x95a4d795e6e642a4ULL,0xa0fb9ba0c0c03bfbULL,0x98b332981919aab3ULL,0xd16827d19e9ef668ULL,0x7f815d7fa3a32281ULL,0x66aa88664444eeaaULL,0x7e82a87e5454d682ULL,0xabe676ab3b3bdde6ULL,0x839e16830b0b959eULL,0xca4503ca8c8cc945ULL,0x297b9529c7c7bc7bULL,0xd36ed6d36b6b056eULL,0x3c44503c28286c44ULL,0x798b5579a7a72c8bULL,0xe23d63e2bcbc813dULL,0x1d272c1d16163127ULL,0x769a4176adad379aULL,0x3b4dad3bdbdb964dULL,0x56fac85664649efaULL,0x4ed2e84e7474a6d2ULL,0x1e22281e14143622ULL,0xdb763fdb9292e476ULL,0x0a1e180a0c0c121eULL,0x6cb4906c4848fcb4ULL,0xe4376be4b8b88f37ULL,0x5de7255d9f9f78e7ULL,0x6eb2616ebdbd0fb2ULL,0xef2a86ef4343692aULL,0xa6f193a6c4c435f1ULL,0xa8e372a83939dae3ULL,0xa4f762a43131c6f7ULL,0x3759bd37d3d38a59ULL,0x8b86ff8bf2f27486ULL,0x3256b132d5d58356ULL,0x43c50d438b8b4ec5ULL,0x59ebdc596e6e85ebULL,0xb7c2afb7dada18c2ULL,0x8c8f028c01018e8fULL,0x64ac7964b1b11dacULL,0xd26d23d29c9cf16dULL,0xe03b92e04949723bULL,0xb4c7abb4d8d81fc7ULL,0xfa1543faacacb915ULL,0x0709fd07f3f3fa09ULL,0x256f8525cfcfa06fULL,0xafea8fafcaca20eaULL,0x8e89f38ef4f47d89ULL,0xe9208ee947476720ULL,0x1828201810103828ULL,0xd564ded56f6f0b64ULL,0x8883fb88f0f07383ULL,0x6fb1946f4a4afbb1ULL,0x7296b8725c5cca96ULL,0x246c70243838546cULL,0xf108aef157575f08ULL,0xc752e6c773732152ULL,0x51f33551979764f3ULL,0x23658d23cbcbae65ULL,0x7c84597ca1a12584ULL,0x9cbfcb9ce8e857bfULL,0x21637c213e3e5d63ULL,0xdd7c37dd9696ea7cULL,0xdc7fc2dc61611e7fULL,0x86911a860d0d9c91ULL,0x85941e850f0f9b94ULL,0x90abdb90e0e04babULL,0x42c6f8427c7cbac6ULL,0xc457e2c471712657ULL,0xaae583aacccc29e5ULL,0xd8733bd89090e373ULL,0x050f0c050606090fULL,0x0103f501f7f7f403ULL,0x123638121c1c2a36ULL,0xa3fe9fa3c2c23cfeULL,0x5fe1d45f6a6a8be1ULL,0xf91047f9aeaebe10ULL,0xd06bd2d06969026bULL,0x91a82e911717bfa8ULL,0x58e82958999971e8ULL,0x276974273a3a5369ULL,0xb9d04eb92727f7d0ULL,0x3848a938d9d99148ULL,0x1335cd13ebebde35ULL,0xb3ce56b32b2be5ceULL,0x3355443322227755ULL,0xbbd6bfbbd2d204d6ULL,0x70904970a9a93990ULL,0x89800e8907078780ULL,0xa7f266a73333c1f2ULL,0xb6c15ab62d2decc1ULL,0x226678223c3c5a66ULL,0x92ad2a921515b8adULL,0x20608920c9c9a960ULL,0x49db154987875cdbULL,0xff1a4fffaaaab01aULL,0x7888a0785050d888ULL,0x7a8e517aa5a52b8eULL,0x8f8a068f0303898aULL,0xf813b2f859594a13ULL,0x809b12800909929bULL,0x173934171a1a2339ULL,0xda75cada65651075ULL,0x3153b531d7d78453ULL,0xc65113c68484d551ULL,0xb8d3bbb8d0d003d3ULL,0xc35e1fc38282dc5eULL,0xb0cb52b02929e2cbULL,0x7799b4775a5ac399ULL,0x11333c111e1e2d33ULL,0xcb46f6cb7b7b3d46ULL,0xfc1f4bfca8a8b71fULL,0xd661dad66d6d0c61ULL,0x3a4e583a2c2c624eULL,
+0xf4a5f497a5c6c632ULL,0x978497eb84f8f86fULL,0xb099b0c799eeee5eULL,0x8c8d8cf78df6f67aULL,0x170d17e50dffffe8ULL,0xdcbddcb7bdd6d60aULL,0xc8b1c8a7b1dede16ULL,0xfc54fc395491916dULL,0xf050f0c050606090ULL,0x0503050403020207ULL,0xe0a9e087a9cece2eULL,0x877d87ac7d5656d1ULL,0x2b192bd519e7e7ccULL,0xa662a67162b5b513ULL,0x31e6319ae64d4d7cULL,0xb59ab5c39aecec59ULL,0xcf45cf05458f8f40ULL,0xbc9dbc3e9d1f1fa3ULL,0xc040c00940898949ULL,0x928792ef87fafa68ULL,0x3f153fc515efefd0ULL,0x26eb267febb2b294ULL,0x40c94007c98e8eceULL,0x1d0b1ded0bfbfbe6ULL,0x2fec2f82ec41416eULL,0xa967a97d67b3b31aULL,0x1cfd1cbefd5f5f43ULL,0x25ea258aea454560ULL,0xdabfda46bf2323f9ULL,0x02f702a6f7535351ULL,0xa196a1d396e4e445ULL,0xed5bed2d5b9b9b76ULL,0x5dc25deac2757528ULL,0x241c24d91ce1e1c5ULL,0xe9aee97aae3d3dd4ULL,0xbe6abe986a4c4cf2ULL,0xee5aeed85a6c6c82ULL,0xc341c3fc417e7ebdULL,0x060206f102f5f5f3ULL,0xd14fd11d4f838352ULL,0xe45ce4d05c68688cULL,0x07f407a2f4515156ULL,0x5c345cb934d1d18dULL,0x180818e908f9f9e1ULL,0xae93aedf93e2e24cULL,0x9573954d73abab3eULL,0xf553f5c453626297ULL,0x413f41543f2a2a6bULL,0x140c14100c08081cULL,0xf652f63152959563ULL,0xaf65af8c654646e9ULL,0xe25ee2215e9d9d7fULL,0x7828786028303048ULL,0xf8a1f86ea13737cfULL,0x110f11140f0a0a1bULL,0xc4b5c45eb52f2febULL,0x1b091b1c090e0e15ULL,0x5a365a483624247eULL,0xb69bb6369b1b1badULL,0x473d47a53ddfdf98ULL,0x6a266a8126cdcda7ULL,0xbb69bb9c694e4ef5ULL,0x4ccd4cfecd7f7f33ULL,0xba9fbacf9feaea50ULL,0x2d1b2d241b12123fULL,0xb99eb93a9e1d1da4ULL,0x9c749cb0745858c4ULL,0x722e72682e343446ULL,0x772d776c2d363641ULL,0xcdb2cda3b2dcdc11ULL,0x29ee2973eeb4b49dULL,0x16fb16b6fb5b5b4dULL,0x01f60153f6a4a4a5ULL,0xd74dd7ec4d7676a1ULL,0xa361a37561b7b714ULL,0x49ce49face7d7d34ULL,0x8d7b8da47b5252dfULL,0x423e42a13edddd9fULL,0x937193bc715e5ecdULL,0xa297a226971313b1ULL,0x04f50457f5a6a6a2ULL,0xb868b86968b9b901ULL,0x0000000000000000ULL,0x742c74992cc1c1b5ULL,0xa060a080604040e0ULL,0x211f21dd1fe3e3c2ULL,0x43c843f2c879793aULL,0x2ced2c77edb6b69aULL,0xd9bed9b3bed4d40dULL,0xca46ca01468d8d47ULL,0x70d970ced9676717ULL,0xdd4bdde44b7272afULL,0x79de7933de9494edULL,0x67d4672bd49898ffULL,0x23e8237be8b0b093ULL,0xde4ade114a85855bULL,0xbd6bbd6d6bbbbb06ULL,0x7e2a7e912ac5c5bbULL,0x34e5349ee54f4f7bULL,0x3a163ac116ededd7ULL,0x54c55417c58686d2ULL,0x62d7622fd79a9af8ULL,0xff55ffcc55666699ULL,0xa794a722941111b6ULL,0x4acf4a0fcf8a8ac0ULL,0x301030c910e9e9d9ULL,0x0a060a080604040eULL,0x988198e781fefe66ULL,0x0bf00b5bf0a0a0abULL,0xcc44ccf0447878b4ULL,0xd5bad54aba2525f0ULL,0x3ee33e96e34b4b75ULL,0x0ef30e5ff3a2a2acULL,0x19fe19bafe5d5d44ULL,0x5bc05b1bc08080dbULL,0x858a850a8a050580ULL,0xecadec7ead3f3fd3ULL,0xdfbcdf42bc2121feULL,0xd848d8e0487070a8ULL,0x0c040cf904f1f1fdULL,0x7adf7ac6df636319ULL,0x58c158eec177772fULL,0x9f759f4575afaf30ULL,0xa563a584634242e7ULL,0x5030504030202070ULL,0x2e1a2ed11ae5e5cbULL,0x120e12e10efdfdefULL,0xb76db7656dbfbf08ULL,0xd44cd4194c818155ULL,0x3c143c3014181824ULL,0x5f355f4c35262679ULL,0x712f719d2fc3c3b2ULL,0x38e13867e1bebe86ULL,0xfda2fd6aa23535c8ULL,0x4fcc4f0bcc8888c7ULL,0x4b394b5c392e2e65ULL,0xf957f93d5793936aULL,0x0df20daaf2555558ULL,0x9d829de382fcfc61ULL,0xc947c9f4477a7ab3ULL,0xefacef8bacc8c827ULL,0x32e7326fe7baba88ULL,0x7d2b7d642b32324fULL,0xa495a4d795e6e642ULL,0xfba0fb9ba0c0c03bULL,0xb398b332981919aaULL,0x68d16827d19e9ef6ULL,0x817f815d7fa3a322ULL,0xaa66aa88664444eeULL,0x827e82a87e5454d6ULL,0xe6abe676ab3b3bddULL,0x9e839e16830b0b95ULL,0x45ca4503ca8c8cc9ULL,0x7b297b9529c7c7bcULL,0x6ed36ed6d36b6b05ULL,0x443c44503c28286cULL,0x8b798b5579a7a72cULL,0x3de23d63e2bcbc81ULL,0x271d272c1d161631ULL,0x9a769a4176adad37ULL,0x4d3b4dad3bdbdb96ULL,0xfa56fac85664649eULL,0xd24ed2e84e7474a6ULL,0x221e22281e141436ULL,0x76db763fdb9292e4ULL,0x1e0a1e180a0c0c12ULL,0xb46cb4906c4848fcULL,0x37e4376be4b8b88fULL,0xe75de7255d9f9f78ULL,0xb26eb2616ebdbd0fULL,0x2aef2a86ef434369ULL,0xf1a6f193a6c4c435ULL,0xe3a8e372a83939daULL,0xf7a4f762a43131c6ULL,0x593759bd37d3d38aULL,0x868b86ff8bf2f274ULL,0x563256b132d5d583ULL,0xc543c50d438b8b4eULL,0xeb59ebdc596e6e85ULL,0xc2b7c2afb7dada18ULL,0x8f8c8f028c01018eULL,0xac64ac7964b1b11dULL,0x6dd26d23d29c9cf1ULL,0x3be03b92e0494972ULL,0xc7b4c7abb4d8d81fULL,0x15fa1543faacacb9ULL,0x090709fd07f3f3faULL,0x6f256f8525cfcfa0ULL,0xeaafea8fafcaca20ULL,0x898e89f38ef4f47dULL,0x20e9208ee9474767ULL,0x2818282018101038ULL,0x64d564ded56f6f0bULL,0x838883fb88f0f073ULL,0xb16fb1946f4a4afbULL,0x967296b8725c5ccaULL,0x6c246c7024383854ULL,0x08f108aef157575fULL,0x52c752e6c7737321ULL,0xf351f33551979764ULL,0x6523658d23cbcbaeULL,0x847c84597ca1a125ULL,0xbf9cbfcb9ce8e857ULL,0x6321637c213e3e5dULL,0x7cdd7c37dd9696eaULL,0x7fdc7fc2dc61611eULL,0x9186911a860d0d9cULL,0x9485941e850f0f9bULL,0xab90abdb90e0e04bULL,0xc642c6f8427c7cbaULL,0x57c457e2c4717126ULL,0xe5aae583aacccc29ULL,0x73d8733bd89090e3ULL,0x0f050f0c05060609ULL,0x030103f501f7f7f4ULL,0x36123638121c1c2aULL,0xfea3fe9fa3c2c23cULL,0xe15fe1d45f6a6a8bULL,0x10f91047f9aeaebeULL,0x6bd06bd2d0696902ULL,0xa891a82e911717bfULL,0xe858e82958999971ULL,0x69276974273a3a53ULL,0xd0b9d04eb92727f7ULL,0x483848a938d9d991ULL,0x351335cd13ebebdeULL,0xceb3ce56b32b2be5ULL,0x5533554433222277ULL,0xd6bbd6bfbbd2d204ULL,0x9070904970a9a939ULL,0x8089800e89070787ULL,0xf2a7f266a73333c1ULL,0xc1b6c15ab62d2decULL,0x66226678223c3c5aULL,0xad92ad2a921515b8ULL,0x6020608920c9c9a9ULL,0xdb49db154987875cULL,0x1aff1a4fffaaaab0ULL,0x887888a0785050d8ULL,0x8e7a8e517aa5a52bULL,0x8a8f8a068f030389ULL,0x13f813b2f859594aULL,0x9b809b1280090992ULL,0x39173934171a1a23ULL,0x75da75cada656510ULL,0x533153b531d7d784ULL,0x51c65113c68484d5ULL,0xd3b8d3bbb8d0d003ULL,0x5ec35e1fc38282dcULL,0xcbb0cb52b02929e2ULL,0x997799b4775a5ac3ULL,0x3311333c111e1e2dULL,0x46cb46f6cb7b7b3dULL,0x1ffc1f4bfca8a8b7ULL,0x61d661dad66d6d0cULL,0x4e3a4e583a2c2c62ULL,
+0x32f4a5f497a5c6c6ULL,0x6f978497eb84f8f8ULL,0x5eb099b0c799eeeeULL,0x7a8c8d8cf78df6f6ULL,0xe8170d17e50dffffULL,0x0adcbddcb7bdd6d6ULL,0x16c8b1c8a7b1dedeULL,0x6dfc54fc39549191ULL,0x90f050f0c0506060ULL,0x0705030504030202ULL,0x2ee0a9e087a9ceceULL,0xd1877d87ac7d5656ULL,0xcc2b192bd519e7e7ULL,0x13a662a67162b5b5ULL,0x7c31e6319ae64d4dULL,0x59b59ab5c39aececULL,0x40cf45cf05458f8fULL,0xa3bc9dbc3e9d1f1fULL,0x49c040c009408989ULL,0x68928792ef87fafaULL,0xd03f153fc515efefULL,0x9426eb267febb2b2ULL,0xce40c94007c98e8eULL,0xe61d0b1ded0bfbfbULL,0x6e2fec2f82ec4141ULL,0x1aa967a97d67b3b3ULL,0x431cfd1cbefd5f5fULL,0x6025ea258aea4545ULL,0xf9dabfda46bf2323ULL,0x5102f702a6f75353ULL,0x45a196a1d396e4e4ULL,0x76ed5bed2d5b9b9bULL,0x285dc25deac27575ULL,0xc5241c24d91ce1e1ULL,0xd4e9aee97aae3d3dULL,0xf2be6abe986a4c4cULL,0x82ee5aeed85a6c6cULL,0xbdc341c3fc417e7eULL,0xf3060206f102f5f5ULL,0x52d14fd11d4f8383ULL,0x8ce45ce4d05c6868ULL,0x5607f407a2f45151ULL,0x8d5c345cb934d1d1ULL,0xe1180818e908f9f9ULL,0x4cae93aedf93e2e2ULL,0x3e9573954d73ababULL,0x97f553f5c4536262ULL,0x6b413f41543f2a2aULL,0x1c140c14100c0808ULL,0x63f652f631529595ULL,0xe9af65af8c654646ULL,0x7fe25ee2215e9d9dULL,0x4878287860283030ULL,0xcff8a1f86ea13737ULL,0x1b110f11140f0a0aULL,0xebc4b5c45eb52f2fULL,0x151b091b1c090e0eULL,0x7e5a365a48362424ULL,0xadb69bb6369b1b1bULL,0x98473d47a53ddfdfULL,0xa76a266a8126cdcdULL,0xf5bb69bb9c694e4eULL,0x334ccd4cfecd7f7fULL,0x50ba9fbacf9feaeaULL,0x3f2d1b2d241b1212ULL,0xa4b99eb93a9e1d1dULL,0xc49c749cb0745858ULL,0x46722e72682e3434ULL,0x41772d776c2d3636ULL,0x11cdb2cda3b2dcdcULL,0x9d29ee2973eeb4b4ULL,0x4d16fb16b6fb5b5bULL,0xa501f60153f6a4a4ULL,0xa1d74dd7ec4d7676ULL,0x14a361a37561b7b7ULL,0x3449ce49face7d7dULL,0xdf8d7b8da47b5252ULL,0x9f423e42a13eddddULL,0xcd937193bc715e5eULL,0xb1a297a226971313ULL,0xa204f50457f5a6a6ULL,0x01b868b86968b9b9ULL,0x0000000000000000ULL,0xb5742c74992cc1c1ULL,0xe0a060a080604040ULL,0xc2211f21dd1fe3e3ULL,0x3a43c843f2c87979ULL,0x9a2ced2c77edb6b6ULL,0x0dd9bed9b3bed4d4ULL,0x47ca46ca01468d8dULL,0x1770d970ced96767ULL,0xafdd4bdde44b7272ULL,0xed79de7933de9494ULL,0xff67d4672bd49898ULL,0x9323e8237be8b0b0ULL,0x5bde4ade114a8585ULL,0x06bd6bbd6d6bbbbbULL,0xbb7e2a7e912ac5c5ULL,0x7b34e5349ee54f4fULL,0xd73a163ac116ededULL,0xd254c55417c58686ULL,0xf862d7622fd79a9aULL,0x99ff55ffcc556666ULL,0xb6a794a722941111ULL,0xc04acf4a0fcf8a8aULL,0xd9301030c910e9e9ULL,0x0e0a060a08060404ULL,0x66988198e781fefeULL,0xab0bf00b5bf0a0a0ULL,0xb4cc44ccf0447878ULL,0xf0d5bad54aba2525ULL,0x753ee33e96e34b4bULL,0xac0ef30e5ff3a2a2ULL,0x4419fe19bafe5d5dULL,0xdb5bc05b1bc08080ULL,0x80858a850a8a0505ULL,0xd3ecadec7ead3f3fULL,0xfedfbcdf42bc2121ULL,0xa8d848d8e0487070ULL,0xfd0c040cf904f1f1ULL,0x197adf7ac6df6363ULL,0x2f58c158eec17777ULL,0x309f759f4575afafULL,0xe7a563a584634242ULL,0x7050305040302020ULL,0xcb2e1a2ed11ae5e5ULL,0xef120e12e10efdfdULL,0x08b76db7656dbfbfULL,0x55d44cd4194c8181ULL,0x243c143c30141818ULL,0x795f355f4c352626ULL,0xb2712f719d2fc3c3ULL,0x8638e13867e1bebeULL,0xc8fda2fd6aa23535ULL,0xc74fcc4f0bcc8888ULL,0x654b394b5c392e2eULL,0x6af957f93d579393ULL,0x580df20daaf25555ULL,0x619d829de382fcfcULL,0xb3c947c9f4477a7aULL,0x27efacef8bacc8c8ULL,0x8832e7326fe7babaULL,0x4f7d2b7d642b3232ULL,0x42a495a4d795e6e6ULL,0x3bfba0fb9ba0c0c0ULL,0xaab398b332981919ULL,0xf668d16827d19e9eULL,0x22817f815d7fa3a3ULL,0xeeaa66aa88664444ULL,0xd6827e82a87e5454ULL,0xdde6abe676ab3b3bULL,0x959e839e16830b0bULL,0xc945ca4503ca8c8cULL,0xbc7b297b9529c7c7ULL,0x056ed36ed6d36b6bULL,0x6c443c44503c2828ULL,0x2c8b798b5579a7a7ULL,0x813de23d63e2bcbcULL,0x31271d272c1d1616ULL,0x379a769a4176adadULL,0x964d3b4dad3bdbdbULL,0x9efa56fac8566464ULL,0xa6d24ed2e84e7474ULL,0x36221e22281e1414ULL,0xe476db763fdb9292ULL,0x121e0a1e180a0c0cULL,0xfcb46cb4906c4848ULL,0x8f37e4376be4b8b8ULL,0x78e75de7255d9f9fULL,0x0fb26eb2616ebdbdULL,0x692aef2a86ef4343ULL,0x35f1a6f193a6c4c4ULL,0xdae3a8e372a83939ULL,0xc6f7a4f762a43131ULL,0x8a593759bd37d3d3ULL,0x74868b86ff8bf2f2ULL,0x83563256b132d5d5ULL,0x4ec543c50d438b8bULL,0x85eb59ebdc596e6eULL,0x18c2b7c2afb7dadaULL,0x8e8f8c8f028c0101ULL,0x1dac64ac7964b1b1ULL,0xf16dd26d23d29c9cULL,0x723be03b92e04949ULL,0x1fc7b4c7abb4d8d8ULL,0xb915fa1543faacacULL,0xfa090709fd07f3f3ULL,0xa06f256f8525cfcfULL,0x20eaafea8fafcacaULL,0x7d898e89f38ef4f4ULL,0x6720e9208ee94747ULL,0x3828182820181010ULL,0x0b64d564ded56f6fULL,0x73838883fb88f0f0ULL,0xfbb16fb1946f4a4aULL,0xca967296b8725c5cULL,0x546c246c70243838ULL,0x5f08f108aef15757ULL,0x2152c752e6c77373ULL,0x64f351f335519797ULL,0xae6523658d23cbcbULL,0x25847c84597ca1a1ULL,0x57bf9cbfcb9ce8e8ULL,0x5d6321637c213e3eULL,0xea7cdd7c37dd9696ULL,0x1e7fdc7fc2dc6161ULL,0x9c9186911a860d0dULL,0x9b9485941e850f0fULL,0x4bab90abdb90e0e0ULL,0xbac642c6f8427c7cULL,0x2657c457e2c47171ULL,0x29e5aae583aaccccULL,0xe373d8733bd89090ULL,0x090f050f0c050606ULL,0xf4030103f501f7f7ULL,0x2a36123638121c1cULL,0x3cfea3fe9fa3c2c2ULL,0x8be15fe1d45f6a6aULL,0xbe10f91047f9aeaeULL,0x026bd06bd2d06969ULL,0xbfa891a82e911717ULL,0x71e858e829589999ULL,0x5369276974273a3aULL,0xf7d0b9d04eb92727ULL,0x91483848a938d9d9ULL,0xde351335cd13ebebULL,0xe5ceb3ce56b32b2bULL,0x7755335544332222ULL,0x04d6bbd6bfbbd2d2ULL,0x399070904970a9a9ULL,0x878089800e890707ULL,0xc1f2a7f266a73333ULL,0xecc1b6c15ab62d2dULL,0x5a66226678223c3cULL,0xb8ad92ad2a921515ULL,0xa96020608920c9c9ULL,0x5cdb49db15498787ULL,0xb01aff1a4fffaaaaULL,0xd8887888a0785050ULL,0x2b8e7a8e517aa5a5ULL,0x898a8f8a068f0303ULL,0x4a13f813b2f85959ULL,0x929b809b12800909ULL,0x2339173934171a1aULL,0x1075da75cada6565ULL,0x84533153b531d7d7ULL,0xd551c65113c68484ULL,0x03d3b8d3bbb8d0d0ULL,0xdc5ec35e1fc38282ULL,0xe2cbb0cb52b02929ULL,0xc3997799b4775a5aULL,0x2d3311333c111e1eULL,0x3d46cb46f6cb7b7bULL,0xb71ffc1f4bfca8a8ULL,0x0c61d661dad66d6dULL,0x624e3a4e583a2c2cULL};
 #endif /* IS_BIG_ENDIAN */
 
 #if (PLATFORM_BYTE_ORDER == IS_LITTLE_ENDIAN)
-const grostl_u32 GROSTL_T[8*256]  /*__attribute__((aligned(64)))*/ = {
-  0xa5f432c6UL,0x84976ff8UL,0x99b05eeeUL,0x8d8c7af6UL,0x0d17e8ffUL,0xbddc0ad6UL,0xb1c816deUL,0x54fc6d91UL,0x50f09060UL,0x03050702UL,0xa9e02eceUL,0x7d87d156UL,0x192bcce7UL,0x62a613b5UL,0xe6317c4dUL,0x9ab559ecUL,0x45cf408fUL,0x9dbca31fUL,0x40c04989UL,0x879268faUL,0x153fd0efUL,0xeb2694b2UL,0xc940ce8eUL,0x0b1de6fbUL,0xec2f6e41UL,0x67a91ab3UL,0xfd1c435fUL,0xea256045UL,0xbfdaf923UL,0xf7025153UL,0x96a145e4UL,0x5bed769bUL,0xc25d2875UL,0x1c24c5e1UL,0xaee9d43dUL,0x6abef24cUL,0x5aee826cUL,0x41c3bd7eUL,0x0206f3f5UL,0x4fd15283UL,0x5ce48c68UL,0xf4075651UL,0x345c8dd1UL,0x0818e1f9UL,0x93ae4ce2UL,0x73953eabUL,0x53f59762UL,0x3f416b2aUL,0x0c141c08UL,0x52f66395UL,0x65afe946UL,0x5ee27f9dUL,0x28784830UL,0xa1f8cf37UL,0x0f111b0aUL,0xb5c4eb2fUL,0x091b150eUL,0x365a7e24UL,0x9bb6ad1bUL,0x3d4798dfUL,0x266aa7cdUL,0x69bbf54eUL,0xcd4c337fUL,0x9fba50eaUL,0x1b2d3f12UL,0x9eb9a41dUL,0x749cc458UL,0x2e724634UL,0x2d774136UL,0xb2cd11dcUL,0xee299db4UL,0xfb164d5bUL,0xf601a5a4UL,0x4dd7a176UL,0x61a314b7UL,0xce49347dUL,0x7b8ddf52UL,0x3e429fddUL,0x7193cd5eUL,0x97a2b113UL,0xf504a2a6UL,0x68b801b9UL,0x00000000UL,0x2c74b5c1UL,0x60a0e040UL,0x1f21c2e3UL,0xc8433a79UL,0xed2c9ab6UL,0xbed90dd4UL,0x46ca478dUL,0xd9701767UL,0x4bddaf72UL,0xde79ed94UL,0xd467ff98UL,0xe82393b0UL,0x4ade5b85UL,0x6bbd06bbUL,0x2a7ebbc5UL,0xe5347b4fUL,0x163ad7edUL,0xc554d286UL,0xd762f89aUL,0x55ff9966UL,0x94a7b611UL,0xcf4ac08aUL,0x1030d9e9UL,0x060a0e04UL,0x819866feUL,0xf00baba0UL,0x44ccb478UL,0xbad5f025UL,0xe33e754bUL,0xf30eaca2UL,0xfe19445dUL,0xc05bdb80UL,0x8a858005UL,0xadecd33fUL,0xbcdffe21UL,0x48d8a870UL,0x040cfdf1UL,0xdf7a1963UL,0xc1582f77UL,0x759f30afUL,0x63a5e742UL,0x30507020UL,0x1a2ecbe5UL,0x0e12effdUL,0x6db708bfUL,0x4cd45581UL,0x143c2418UL,0x355f7926UL,0x2f71b2c3UL,0xe13886beUL,0xa2fdc835UL,0xcc4fc788UL,0x394b652eUL,0x57f96a93UL,0xf20d5855UL,0x829d61fcUL,0x47c9b37aUL,0xacef27c8UL,0xe73288baUL,0x2b7d4f32UL,0x95a442e6UL,0xa0fb3bc0UL,0x98b3aa19UL,0xd168f69eUL,0x7f8122a3UL,0x66aaee44UL,0x7e82d654UL,0xabe6dd3bUL,0x839e950bUL,0xca45c98cUL,0x297bbcc7UL,0xd36e056bUL,0x3c446c28UL,0x798b2ca7UL,0xe23d81bcUL,0x1d273116UL,0x769a37adUL,0x3b4d96dbUL,0x56fa9e64UL,0x4ed2a674UL,0x1e223614UL,0xdb76e492UL,0x0a1e120cUL,0x6cb4fc48UL,0xe4378fb8UL,0x5de7789fUL,0x6eb20fbdUL,0xef2a6943UL,0xa6f135c4UL,0xa8e3da39UL,0xa4f7c631UL,0x37598ad3UL,0x8b8674f2UL,0x325683d5UL,0x43c54e8bUL,0x59eb856eUL,0xb7c218daUL,0x8c8f8e01UL,0x64ac1db1UL,0xd26df19cUL,0xe03b7249UL,0xb4c71fd8UL,0xfa15b9acUL,0x0709faf3UL,0x256fa0cfUL,0xafea20caUL,0x8e897df4UL,0xe9206747UL,0x18283810UL,0xd5640b6fUL,0x888373f0UL,0x6fb1fb4aUL,0x7296ca5cUL,0x246c5438UL,0xf1085f57UL,0xc7522173UL,0x51f36497UL,0x2365aecbUL,0x7c8425a1UL,0x9cbf57e8UL,0x21635d3eUL,0xdd7cea96UL,0xdc7f1e61UL,0x86919c0dUL,0x85949b0fUL,0x90ab4be0UL,0x42c6ba7cUL,0xc4572671UL,0xaae529ccUL,0xd873e390UL,0x050f0906UL,0x0103f4f7UL,0x12362a1cUL,0xa3fe3cc2UL,0x5fe18b6aUL,0xf910beaeUL,0xd06b0269UL,0x91a8bf17UL,0x58e87199UL,0x2769533aUL,0xb9d0f727UL,0x384891d9UL,0x1335deebUL,0xb3cee52bUL,0x33557722UL,0xbbd604d2UL,0x709039a9UL,0x89808707UL,0xa7f2c133UL,0xb6c1ec2dUL,0x22665a3cUL,0x92adb815UL,0x2060a9c9UL,0x49db5c87UL,0xff1ab0aaUL,0x7888d850UL,0x7a8e2ba5UL,0x8f8a8903UL,0xf8134a59UL,0x809b9209UL,0x1739231aUL,0xda751065UL,0x315384d7UL,0xc651d584UL,0xb8d303d0UL,0xc35edc82UL,0xb0cbe229UL,0x7799c35aUL,0x11332d1eUL,0xcb463d7bUL,0xfc1fb7a8UL,0xd6610c6dUL,0x3a4e622cUL,
-  0xf432c6c6UL,0x976ff8f8UL,0xb05eeeeeUL,0x8c7af6f6UL,0x17e8ffffUL,0xdc0ad6d6UL,0xc816dedeUL,0xfc6d9191UL,0xf0906060UL,0x05070202UL,0xe02ececeUL,0x87d15656UL,0x2bcce7e7UL,0xa613b5b5UL,0x317c4d4dUL,0xb559ececUL,0xcf408f8fUL,0xbca31f1fUL,0xc0498989UL,0x9268fafaUL,0x3fd0efefUL,0x2694b2b2UL,0x40ce8e8eUL,0x1de6fbfbUL,0x2f6e4141UL,0xa91ab3b3UL,0x1c435f5fUL,0x25604545UL,0xdaf92323UL,0x02515353UL,0xa145e4e4UL,0xed769b9bUL,0x5d287575UL,0x24c5e1e1UL,0xe9d43d3dUL,0xbef24c4cUL,0xee826c6cUL,0xc3bd7e7eUL,0x06f3f5f5UL,0xd1528383UL,0xe48c6868UL,0x07565151UL,0x5c8dd1d1UL,0x18e1f9f9UL,0xae4ce2e2UL,0x953eababUL,0xf5976262UL,0x416b2a2aUL,0x141c0808UL,0xf6639595UL,0xafe94646UL,0xe27f9d9dUL,0x78483030UL,0xf8cf3737UL,0x111b0a0aUL,0xc4eb2f2fUL,0x1b150e0eUL,0x5a7e2424UL,0xb6ad1b1bUL,0x4798dfdfUL,0x6aa7cdcdUL,0xbbf54e4eUL,0x4c337f7fUL,0xba50eaeaUL,0x2d3f1212UL,0xb9a41d1dUL,0x9cc45858UL,0x72463434UL,0x77413636UL,0xcd11dcdcUL,0x299db4b4UL,0x164d5b5bUL,0x01a5a4a4UL,0xd7a17676UL,0xa314b7b7UL,0x49347d7dUL,0x8ddf5252UL,0x429fddddUL,0x93cd5e5eUL,0xa2b11313UL,0x04a2a6a6UL,0xb801b9b9UL,0x00000000UL,0x74b5c1c1UL,0xa0e04040UL,0x21c2e3e3UL,0x433a7979UL,0x2c9ab6b6UL,0xd90dd4d4UL,0xca478d8dUL,0x70176767UL,0xddaf7272UL,0x79ed9494UL,0x67ff9898UL,0x2393b0b0UL,0xde5b8585UL,0xbd06bbbbUL,0x7ebbc5c5UL,0x347b4f4fUL,0x3ad7ededUL,0x54d28686UL,0x62f89a9aUL,0xff996666UL,0xa7b61111UL,0x4ac08a8aUL,0x30d9e9e9UL,0x0a0e0404UL,0x9866fefeUL,0x0baba0a0UL,0xccb47878UL,0xd5f02525UL,0x3e754b4bUL,0x0eaca2a2UL,0x19445d5dUL,0x5bdb8080UL,0x85800505UL,0xecd33f3fUL,0xdffe2121UL,0xd8a87070UL,0x0cfdf1f1UL,0x7a196363UL,0x582f7777UL,0x9f30afafUL,0xa5e74242UL,0x50702020UL,0x2ecbe5e5UL,0x12effdfdUL,0xb708bfbfUL,0xd4558181UL,0x3c241818UL,0x5f792626UL,0x71b2c3c3UL,0x3886bebeUL,0xfdc83535UL,0x4fc78888UL,0x4b652e2eUL,0xf96a9393UL,0x0d585555UL,0x9d61fcfcUL,0xc9b37a7aUL,0xef27c8c8UL,0x3288babaUL,0x7d4f3232UL,0xa442e6e6UL,0xfb3bc0c0UL,0xb3aa1919UL,0x68f69e9eUL,0x8122a3a3UL,0xaaee4444UL,0x82d65454UL,0xe6dd3b3bUL,0x9e950b0bUL,0x45c98c8cUL,0x7bbcc7c7UL,0x6e056b6bUL,0x446c2828UL,0x8b2ca7a7UL,0x3d81bcbcUL,0x27311616UL,0x9a37adadUL,0x4d96dbdbUL,0xfa9e6464UL,0xd2a67474UL,0x22361414UL,0x76e49292UL,0x1e120c0cUL,0xb4fc4848UL,0x378fb8b8UL,0xe7789f9fUL,0xb20fbdbdUL,0x2a694343UL,0xf135c4c4UL,0xe3da3939UL,0xf7c63131UL,0x598ad3d3UL,0x8674f2f2UL,0x5683d5d5UL,0xc54e8b8bUL,0xeb856e6eUL,0xc218dadaUL,0x8f8e0101UL,0xac1db1b1UL,0x6df19c9cUL,0x3b724949UL,0xc71fd8d8UL,0x15b9acacUL,0x09faf3f3UL,0x6fa0cfcfUL,0xea20cacaUL,0x897df4f4UL,0x20674747UL,0x28381010UL,0x640b6f6fUL,0x8373f0f0UL,0xb1fb4a4aUL,0x96ca5c5cUL,0x6c543838UL,0x085f5757UL,0x52217373UL,0xf3649797UL,0x65aecbcbUL,0x8425a1a1UL,0xbf57e8e8UL,0x635d3e3eUL,0x7cea9696UL,0x7f1e6161UL,0x919c0d0dUL,0x949b0f0fUL,0xab4be0e0UL,0xc6ba7c7cUL,0x57267171UL,0xe529ccccUL,0x73e39090UL,0x0f090606UL,0x03f4f7f7UL,0x362a1c1cUL,0xfe3cc2c2UL,0xe18b6a6aUL,0x10beaeaeUL,0x6b026969UL,0xa8bf1717UL,0xe8719999UL,0x69533a3aUL,0xd0f72727UL,0x4891d9d9UL,0x35deebebUL,0xcee52b2bUL,0x55772222UL,0xd604d2d2UL,0x9039a9a9UL,0x80870707UL,0xf2c13333UL,0xc1ec2d2dUL,0x665a3c3cUL,0xadb81515UL,0x60a9c9c9UL,0xdb5c8787UL,0x1ab0aaaaUL,0x88d85050UL,0x8e2ba5a5UL,0x8a890303UL,0x134a5959UL,0x9b920909UL,0x39231a1aUL,0x75106565UL,0x5384d7d7UL,0x51d58484UL,0xd303d0d0UL,0x5edc8282UL,0xcbe22929UL,0x99c35a5aUL,0x332d1e1eUL,0x463d7b7bUL,0x1fb7a8a8UL,0x610c6d6dUL,0x4e622c2cUL,
-  0x32c6c6a5UL,0x6ff8f884UL,0x5eeeee99UL,0x7af6f68dUL,0xe8ffff0dUL,0x0ad6d6bdUL,0x16dedeb1UL,0x6d919154UL,0x90606050UL,0x07020203UL,0x2ececea9UL,0xd156567dUL,0xcce7e719UL,0x13b5b562UL,0x7c4d4de6UL,0x59ecec9aUL,0x408f8f45UL,0xa31f1f9dUL,0x49898940UL,0x68fafa87UL,0xd0efef15UL,0x94b2b2ebUL,0xce8e8ec9UL,0xe6fbfb0bUL,0x6e4141ecUL,0x1ab3b367UL,0x435f5ffdUL,0x604545eaUL,0xf92323bfUL,0x515353f7UL,0x45e4e496UL,0x769b9b5bUL,0x287575c2UL,0xc5e1e11cUL,0xd43d3daeUL,0xf24c4c6aUL,0x826c6c5aUL,0xbd7e7e41UL,0xf3f5f502UL,0x5283834fUL,0x8c68685cUL,0x565151f4UL,0x8dd1d134UL,0xe1f9f908UL,0x4ce2e293UL,0x3eabab73UL,0x97626253UL,0x6b2a2a3fUL,0x1c08080cUL,0x63959552UL,0xe9464665UL,0x7f9d9d5eUL,0x48303028UL,0xcf3737a1UL,0x1b0a0a0fUL,0xeb2f2fb5UL,0x150e0e09UL,0x7e242436UL,0xad1b1b9bUL,0x98dfdf3dUL,0xa7cdcd26UL,0xf54e4e69UL,0x337f7fcdUL,0x50eaea9fUL,0x3f12121bUL,0xa41d1d9eUL,0xc4585874UL,0x4634342eUL,0x4136362dUL,0x11dcdcb2UL,0x9db4b4eeUL,0x4d5b5bfbUL,0xa5a4a4f6UL,0xa176764dUL,0x14b7b761UL,0x347d7dceUL,0xdf52527bUL,0x9fdddd3eUL,0xcd5e5e71UL,0xb1131397UL,0xa2a6a6f5UL,0x01b9b968UL,0x00000000UL,0xb5c1c12cUL,0xe0404060UL,0xc2e3e31fUL,0x3a7979c8UL,0x9ab6b6edUL,0x0dd4d4beUL,0x478d8d46UL,0x176767d9UL,0xaf72724bUL,0xed9494deUL,0xff9898d4UL,0x93b0b0e8UL,0x5b85854aUL,0x06bbbb6bUL,0xbbc5c52aUL,0x7b4f4fe5UL,0xd7eded16UL,0xd28686c5UL,0xf89a9ad7UL,0x99666655UL,0xb6111194UL,0xc08a8acfUL,0xd9e9e910UL,0x0e040406UL,0x66fefe81UL,0xaba0a0f0UL,0xb4787844UL,0xf02525baUL,0x754b4be3UL,0xaca2a2f3UL,0x445d5dfeUL,0xdb8080c0UL,0x8005058aUL,0xd33f3fadUL,0xfe2121bcUL,0xa8707048UL,0xfdf1f104UL,0x196363dfUL,0x2f7777c1UL,0x30afaf75UL,0xe7424263UL,0x70202030UL,0xcbe5e51aUL,0xeffdfd0eUL,0x08bfbf6dUL,0x5581814cUL,0x24181814UL,0x79262635UL,0xb2c3c32fUL,0x86bebee1UL,0xc83535a2UL,0xc78888ccUL,0x652e2e39UL,0x6a939357UL,0x585555f2UL,0x61fcfc82UL,0xb37a7a47UL,0x27c8c8acUL,0x88babae7UL,0x4f32322bUL,0x42e6e695UL,0x3bc0c0a0UL,0xaa191998UL,0xf69e9ed1UL,0x22a3a37fUL,0xee444466UL,0xd654547eUL,0xdd3b3babUL,0x950b0b83UL,0xc98c8ccaUL,0xbcc7c729UL,0x056b6bd3UL,0x6c28283cUL,0x2ca7a779UL,0x81bcbce2UL,0x3116161dUL,0x37adad76UL,0x96dbdb3bUL,0x9e646456UL,0xa674744eUL,0x3614141eUL,0xe49292dbUL,0x120c0c0aUL,0xfc48486cUL,0x8fb8b8e4UL,0x789f9f5dUL,0x0fbdbd6eUL,0x694343efUL,0x35c4c4a6UL,0xda3939a8UL,0xc63131a4UL,0x8ad3d337UL,0x74f2f28bUL,0x83d5d532UL,0x4e8b8b43UL,0x856e6e59UL,0x18dadab7UL,0x8e01018cUL,0x1db1b164UL,0xf19c9cd2UL,0x724949e0UL,0x1fd8d8b4UL,0xb9acacfaUL,0xfaf3f307UL,0xa0cfcf25UL,0x20cacaafUL,0x7df4f48eUL,0x674747e9UL,0x38101018UL,0x0b6f6fd5UL,0x73f0f088UL,0xfb4a4a6fUL,0xca5c5c72UL,0x54383824UL,0x5f5757f1UL,0x217373c7UL,0x64979751UL,0xaecbcb23UL,0x25a1a17cUL,0x57e8e89cUL,0x5d3e3e21UL,0xea9696ddUL,0x1e6161dcUL,0x9c0d0d86UL,0x9b0f0f85UL,0x4be0e090UL,0xba7c7c42UL,0x267171c4UL,0x29ccccaaUL,0xe39090d8UL,0x09060605UL,0xf4f7f701UL,0x2a1c1c12UL,0x3cc2c2a3UL,0x8b6a6a5fUL,0xbeaeaef9UL,0x026969d0UL,0xbf171791UL,0x71999958UL,0x533a3a27UL,0xf72727b9UL,0x91d9d938UL,0xdeebeb13UL,0xe52b2bb3UL,0x77222233UL,0x04d2d2bbUL,0x39a9a970UL,0x87070789UL,0xc13333a7UL,0xec2d2db6UL,0x5a3c3c22UL,0xb8151592UL,0xa9c9c920UL,0x5c878749UL,0xb0aaaaffUL,0xd8505078UL,0x2ba5a57aUL,0x8903038fUL,0x4a5959f8UL,0x92090980UL,0x231a1a17UL,0x106565daUL,0x84d7d731UL,0xd58484c6UL,0x03d0d0b8UL,0xdc8282c3UL,0xe22929b0UL,0xc35a5a77UL,0x2d1e1e11UL,0x3d7b7bcbUL,0xb7a8a8fcUL,0x0c6d6dd6UL,0x622c2c3aUL,
-  0xc6c6a597UL,0xf8f884ebUL,0xeeee99c7UL,0xf6f68df7UL,0xffff0de5UL,0xd6d6bdb7UL,0xdedeb1a7UL,0x91915439UL,0x606050c0UL,0x02020304UL,0xcecea987UL,0x56567dacUL,0xe7e719d5UL,0xb5b56271UL,0x4d4de69aUL,0xecec9ac3UL,0x8f8f4505UL,0x1f1f9d3eUL,0x89894009UL,0xfafa87efUL,0xefef15c5UL,0xb2b2eb7fUL,0x8e8ec907UL,0xfbfb0bedUL,0x4141ec82UL,0xb3b3677dUL,0x5f5ffdbeUL,0x4545ea8aUL,0x2323bf46UL,0x5353f7a6UL,0xe4e496d3UL,0x9b9b5b2dUL,0x7575c2eaUL,0xe1e11cd9UL,0x3d3dae7aUL,0x4c4c6a98UL,0x6c6c5ad8UL,0x7e7e41fcUL,0xf5f502f1UL,0x83834f1dUL,0x68685cd0UL,0x5151f4a2UL,0xd1d134b9UL,0xf9f908e9UL,0xe2e293dfUL,0xabab734dUL,0x626253c4UL,0x2a2a3f54UL,0x08080c10UL,0x95955231UL,0x4646658cUL,0x9d9d5e21UL,0x30302860UL,0x3737a16eUL,0x0a0a0f14UL,0x2f2fb55eUL,0x0e0e091cUL,0x24243648UL,0x1b1b9b36UL,0xdfdf3da5UL,0xcdcd2681UL,0x4e4e699cUL,0x7f7fcdfeUL,0xeaea9fcfUL,0x12121b24UL,0x1d1d9e3aUL,0x585874b0UL,0x34342e68UL,0x36362d6cUL,0xdcdcb2a3UL,0xb4b4ee73UL,0x5b5bfbb6UL,0xa4a4f653UL,0x76764decUL,0xb7b76175UL,0x7d7dcefaUL,0x52527ba4UL,0xdddd3ea1UL,0x5e5e71bcUL,0x13139726UL,0xa6a6f557UL,0xb9b96869UL,0x00000000UL,0xc1c12c99UL,0x40406080UL,0xe3e31fddUL,0x7979c8f2UL,0xb6b6ed77UL,0xd4d4beb3UL,0x8d8d4601UL,0x6767d9ceUL,0x72724be4UL,0x9494de33UL,0x9898d42bUL,0xb0b0e87bUL,0x85854a11UL,0xbbbb6b6dUL,0xc5c52a91UL,0x4f4fe59eUL,0xeded16c1UL,0x8686c517UL,0x9a9ad72fUL,0x666655ccUL,0x11119422UL,0x8a8acf0fUL,0xe9e910c9UL,0x04040608UL,0xfefe81e7UL,0xa0a0f05bUL,0x787844f0UL,0x2525ba4aUL,0x4b4be396UL,0xa2a2f35fUL,0x5d5dfebaUL,0x8080c01bUL,0x05058a0aUL,0x3f3fad7eUL,0x2121bc42UL,0x707048e0UL,0xf1f104f9UL,0x6363dfc6UL,0x7777c1eeUL,0xafaf7545UL,0x42426384UL,0x20203040UL,0xe5e51ad1UL,0xfdfd0ee1UL,0xbfbf6d65UL,0x81814c19UL,0x18181430UL,0x2626354cUL,0xc3c32f9dUL,0xbebee167UL,0x3535a26aUL,0x8888cc0bUL,0x2e2e395cUL,0x9393573dUL,0x5555f2aaUL,0xfcfc82e3UL,0x7a7a47f4UL,0xc8c8ac8bUL,0xbabae76fUL,0x32322b64UL,0xe6e695d7UL,0xc0c0a09bUL,0x19199832UL,0x9e9ed127UL,0xa3a37f5dUL,0x44446688UL,0x54547ea8UL,0x3b3bab76UL,0x0b0b8316UL,0x8c8cca03UL,0xc7c72995UL,0x6b6bd3d6UL,0x28283c50UL,0xa7a77955UL,0xbcbce263UL,0x16161d2cUL,0xadad7641UL,0xdbdb3badUL,0x646456c8UL,0x74744ee8UL,0x14141e28UL,0x9292db3fUL,0x0c0c0a18UL,0x48486c90UL,0xb8b8e46bUL,0x9f9f5d25UL,0xbdbd6e61UL,0x4343ef86UL,0xc4c4a693UL,0x3939a872UL,0x3131a462UL,0xd3d337bdUL,0xf2f28bffUL,0xd5d532b1UL,0x8b8b430dUL,0x6e6e59dcUL,0xdadab7afUL,0x01018c02UL,0xb1b16479UL,0x9c9cd223UL,0x4949e092UL,0xd8d8b4abUL,0xacacfa43UL,0xf3f307fdUL,0xcfcf2585UL,0xcacaaf8fUL,0xf4f48ef3UL,0x4747e98eUL,0x10101820UL,0x6f6fd5deUL,0xf0f088fbUL,0x4a4a6f94UL,0x5c5c72b8UL,0x38382470UL,0x5757f1aeUL,0x7373c7e6UL,0x97975135UL,0xcbcb238dUL,0xa1a17c59UL,0xe8e89ccbUL,0x3e3e217cUL,0x9696dd37UL,0x6161dcc2UL,0x0d0d861aUL,0x0f0f851eUL,0xe0e090dbUL,0x7c7c42f8UL,0x7171c4e2UL,0xccccaa83UL,0x9090d83bUL,0x0606050cUL,0xf7f701f5UL,0x1c1c1238UL,0xc2c2a39fUL,0x6a6a5fd4UL,0xaeaef947UL,0x6969d0d2UL,0x1717912eUL,0x99995829UL,0x3a3a2774UL,0x2727b94eUL,0xd9d938a9UL,0xebeb13cdUL,0x2b2bb356UL,0x22223344UL,0xd2d2bbbfUL,0xa9a97049UL,0x0707890eUL,0x3333a766UL,0x2d2db65aUL,0x3c3c2278UL,0x1515922aUL,0xc9c92089UL,0x87874915UL,0xaaaaff4fUL,0x505078a0UL,0xa5a57a51UL,0x03038f06UL,0x5959f8b2UL,0x09098012UL,0x1a1a1734UL,0x6565dacaUL,0xd7d731b5UL,0x8484c613UL,0xd0d0b8bbUL,0x8282c31fUL,0x2929b052UL,0x5a5a77b4UL,0x1e1e113cUL,0x7b7bcbf6UL,0xa8a8fc4bUL,0x6d6dd6daUL,0x2c2c3a58UL,
-  0xc6a597f4UL,0xf884eb97UL,0xee99c7b0UL,0xf68df78cUL,0xff0de517UL,0xd6bdb7dcUL,0xdeb1a7c8UL,0x915439fcUL,0x6050c0f0UL,0x02030405UL,0xcea987e0UL,0x567dac87UL,0xe719d52bUL,0xb56271a6UL,0x4de69a31UL,0xec9ac3b5UL,0x8f4505cfUL,0x1f9d3ebcUL,0x894009c0UL,0xfa87ef92UL,0xef15c53fUL,0xb2eb7f26UL,0x8ec90740UL,0xfb0bed1dUL,0x41ec822fUL,0xb3677da9UL,0x5ffdbe1cUL,0x45ea8a25UL,0x23bf46daUL,0x53f7a602UL,0xe496d3a1UL,0x9b5b2dedUL,0x75c2ea5dUL,0xe11cd924UL,0x3dae7ae9UL,0x4c6a98beUL,0x6c5ad8eeUL,0x7e41fcc3UL,0xf502f106UL,0x834f1dd1UL,0x685cd0e4UL,0x51f4a207UL,0xd134b95cUL,0xf908e918UL,0xe293dfaeUL,0xab734d95UL,0x6253c4f5UL,0x2a3f5441UL,0x080c1014UL,0x955231f6UL,0x46658cafUL,0x9d5e21e2UL,0x30286078UL,0x37a16ef8UL,0x0a0f1411UL,0x2fb55ec4UL,0x0e091c1bUL,0x2436485aUL,0x1b9b36b6UL,0xdf3da547UL,0xcd26816aUL,0x4e699cbbUL,0x7fcdfe4cUL,0xea9fcfbaUL,0x121b242dUL,0x1d9e3ab9UL,0x5874b09cUL,0x342e6872UL,0x362d6c77UL,0xdcb2a3cdUL,0xb4ee7329UL,0x5bfbb616UL,0xa4f65301UL,0x764decd7UL,0xb76175a3UL,0x7dcefa49UL,0x527ba48dUL,0xdd3ea142UL,0x5e71bc93UL,0x139726a2UL,0xa6f55704UL,0xb96869b8UL,0x00000000UL,0xc12c9974UL,0x406080a0UL,0xe31fdd21UL,0x79c8f243UL,0xb6ed772cUL,0xd4beb3d9UL,0x8d4601caUL,0x67d9ce70UL,0x724be4ddUL,0x94de3379UL,0x98d42b67UL,0xb0e87b23UL,0x854a11deUL,0xbb6b6dbdUL,0xc52a917eUL,0x4fe59e34UL,0xed16c13aUL,0x86c51754UL,0x9ad72f62UL,0x6655ccffUL,0x119422a7UL,0x8acf0f4aUL,0xe910c930UL,0x0406080aUL,0xfe81e798UL,0xa0f05b0bUL,0x7844f0ccUL,0x25ba4ad5UL,0x4be3963eUL,0xa2f35f0eUL,0x5dfeba19UL,0x80c01b5bUL,0x058a0a85UL,0x3fad7eecUL,0x21bc42dfUL,0x7048e0d8UL,0xf104f90cUL,0x63dfc67aUL,0x77c1ee58UL,0xaf75459fUL,0x426384a5UL,0x20304050UL,0xe51ad12eUL,0xfd0ee112UL,0xbf6d65b7UL,0x814c19d4UL,0x1814303cUL,0x26354c5fUL,0xc32f9d71UL,0xbee16738UL,0x35a26afdUL,0x88cc0b4fUL,0x2e395c4bUL,0x93573df9UL,0x55f2aa0dUL,0xfc82e39dUL,0x7a47f4c9UL,0xc8ac8befUL,0xbae76f32UL,0x322b647dUL,0xe695d7a4UL,0xc0a09bfbUL,0x199832b3UL,0x9ed12768UL,0xa37f5d81UL,0x446688aaUL,0x547ea882UL,0x3bab76e6UL,0x0b83169eUL,0x8cca0345UL,0xc729957bUL,0x6bd3d66eUL,0x283c5044UL,0xa779558bUL,0xbce2633dUL,0x161d2c27UL,0xad76419aUL,0xdb3bad4dUL,0x6456c8faUL,0x744ee8d2UL,0x141e2822UL,0x92db3f76UL,0x0c0a181eUL,0x486c90b4UL,0xb8e46b37UL,0x9f5d25e7UL,0xbd6e61b2UL,0x43ef862aUL,0xc4a693f1UL,0x39a872e3UL,0x31a462f7UL,0xd337bd59UL,0xf28bff86UL,0xd532b156UL,0x8b430dc5UL,0x6e59dcebUL,0xdab7afc2UL,0x018c028fUL,0xb16479acUL,0x9cd2236dUL,0x49e0923bUL,0xd8b4abc7UL,0xacfa4315UL,0xf307fd09UL,0xcf25856fUL,0xcaaf8feaUL,0xf48ef389UL,0x47e98e20UL,0x10182028UL,0x6fd5de64UL,0xf088fb83UL,0x4a6f94b1UL,0x5c72b896UL,0x3824706cUL,0x57f1ae08UL,0x73c7e652UL,0x975135f3UL,0xcb238d65UL,0xa17c5984UL,0xe89ccbbfUL,0x3e217c63UL,0x96dd377cUL,0x61dcc27fUL,0x0d861a91UL,0x0f851e94UL,0xe090dbabUL,0x7c42f8c6UL,0x71c4e257UL,0xccaa83e5UL,0x90d83b73UL,0x06050c0fUL,0xf701f503UL,0x1c123836UL,0xc2a39ffeUL,0x6a5fd4e1UL,0xaef94710UL,0x69d0d26bUL,0x17912ea8UL,0x995829e8UL,0x3a277469UL,0x27b94ed0UL,0xd938a948UL,0xeb13cd35UL,0x2bb356ceUL,0x22334455UL,0xd2bbbfd6UL,0xa9704990UL,0x07890e80UL,0x33a766f2UL,0x2db65ac1UL,0x3c227866UL,0x15922aadUL,0xc9208960UL,0x874915dbUL,0xaaff4f1aUL,0x5078a088UL,0xa57a518eUL,0x038f068aUL,0x59f8b213UL,0x0980129bUL,0x1a173439UL,0x65daca75UL,0xd731b553UL,0x84c61351UL,0xd0b8bbd3UL,0x82c31f5eUL,0x29b052cbUL,0x5a77b499UL,0x1e113c33UL,0x7bcbf646UL,0xa8fc4b1fUL,0x6dd6da61UL,0x2c3a584eUL,
-  0xa597f4a5UL,0x84eb9784UL,0x99c7b099UL,0x8df78c8dUL,0x0de5170dUL,0xbdb7dcbdUL,0xb1a7c8b1UL,0x5439fc54UL,0x50c0f050UL,0x03040503UL,0xa987e0a9UL,0x7dac877dUL,0x19d52b19UL,0x6271a662UL,0xe69a31e6UL,0x9ac3b59aUL,0x4505cf45UL,0x9d3ebc9dUL,0x4009c040UL,0x87ef9287UL,0x15c53f15UL,0xeb7f26ebUL,0xc90740c9UL,0x0bed1d0bUL,0xec822fecUL,0x677da967UL,0xfdbe1cfdUL,0xea8a25eaUL,0xbf46dabfUL,0xf7a602f7UL,0x96d3a196UL,0x5b2ded5bUL,0xc2ea5dc2UL,0x1cd9241cUL,0xae7ae9aeUL,0x6a98be6aUL,0x5ad8ee5aUL,0x41fcc341UL,0x02f10602UL,0x4f1dd14fUL,0x5cd0e45cUL,0xf4a207f4UL,0x34b95c34UL,0x08e91808UL,0x93dfae93UL,0x734d9573UL,0x53c4f553UL,0x3f54413fUL,0x0c10140cUL,0x5231f652UL,0x658caf65UL,0x5e21e25eUL,0x28607828UL,0xa16ef8a1UL,0x0f14110fUL,0xb55ec4b5UL,0x091c1b09UL,0x36485a36UL,0x9b36b69bUL,0x3da5473dUL,0x26816a26UL,0x699cbb69UL,0xcdfe4ccdUL,0x9fcfba9fUL,0x1b242d1bUL,0x9e3ab99eUL,0x74b09c74UL,0x2e68722eUL,0x2d6c772dUL,0xb2a3cdb2UL,0xee7329eeUL,0xfbb616fbUL,0xf65301f6UL,0x4decd74dUL,0x6175a361UL,0xcefa49ceUL,0x7ba48d7bUL,0x3ea1423eUL,0x71bc9371UL,0x9726a297UL,0xf55704f5UL,0x6869b868UL,0x00000000UL,0x2c99742cUL,0x6080a060UL,0x1fdd211fUL,0xc8f243c8UL,0xed772cedUL,0xbeb3d9beUL,0x4601ca46UL,0xd9ce70d9UL,0x4be4dd4bUL,0xde3379deUL,0xd42b67d4UL,0xe87b23e8UL,0x4a11de4aUL,0x6b6dbd6bUL,0x2a917e2aUL,0xe59e34e5UL,0x16c13a16UL,0xc51754c5UL,0xd72f62d7UL,0x55ccff55UL,0x9422a794UL,0xcf0f4acfUL,0x10c93010UL,0x06080a06UL,0x81e79881UL,0xf05b0bf0UL,0x44f0cc44UL,0xba4ad5baUL,0xe3963ee3UL,0xf35f0ef3UL,0xfeba19feUL,0xc01b5bc0UL,0x8a0a858aUL,0xad7eecadUL,0xbc42dfbcUL,0x48e0d848UL,0x04f90c04UL,0xdfc67adfUL,0xc1ee58c1UL,0x75459f75UL,0x6384a563UL,0x30405030UL,0x1ad12e1aUL,0x0ee1120eUL,0x6d65b76dUL,0x4c19d44cUL,0x14303c14UL,0x354c5f35UL,0x2f9d712fUL,0xe16738e1UL,0xa26afda2UL,0xcc0b4fccUL,0x395c4b39UL,0x573df957UL,0xf2aa0df2UL,0x82e39d82UL,0x47f4c947UL,0xac8befacUL,0xe76f32e7UL,0x2b647d2bUL,0x95d7a495UL,0xa09bfba0UL,0x9832b398UL,0xd12768d1UL,0x7f5d817fUL,0x6688aa66UL,0x7ea8827eUL,0xab76e6abUL,0x83169e83UL,0xca0345caUL,0x29957b29UL,0xd3d66ed3UL,0x3c50443cUL,0x79558b79UL,0xe2633de2UL,0x1d2c271dUL,0x76419a76UL,0x3bad4d3bUL,0x56c8fa56UL,0x4ee8d24eUL,0x1e28221eUL,0xdb3f76dbUL,0x0a181e0aUL,0x6c90b46cUL,0xe46b37e4UL,0x5d25e75dUL,0x6e61b26eUL,0xef862aefUL,0xa693f1a6UL,0xa872e3a8UL,0xa462f7a4UL,0x37bd5937UL,0x8bff868bUL,0x32b15632UL,0x430dc543UL,0x59dceb59UL,0xb7afc2b7UL,0x8c028f8cUL,0x6479ac64UL,0xd2236dd2UL,0xe0923be0UL,0xb4abc7b4UL,0xfa4315faUL,0x07fd0907UL,0x25856f25UL,0xaf8feaafUL,0x8ef3898eUL,0xe98e20e9UL,0x18202818UL,0xd5de64d5UL,0x88fb8388UL,0x6f94b16fUL,0x72b89672UL,0x24706c24UL,0xf1ae08f1UL,0xc7e652c7UL,0x5135f351UL,0x238d6523UL,0x7c59847cUL,0x9ccbbf9cUL,0x217c6321UL,0xdd377cddUL,0xdcc27fdcUL,0x861a9186UL,0x851e9485UL,0x90dbab90UL,0x42f8c642UL,0xc4e257c4UL,0xaa83e5aaUL,0xd83b73d8UL,0x050c0f05UL,0x01f50301UL,0x12383612UL,0xa39ffea3UL,0x5fd4e15fUL,0xf94710f9UL,0xd0d26bd0UL,0x912ea891UL,0x5829e858UL,0x27746927UL,0xb94ed0b9UL,0x38a94838UL,0x13cd3513UL,0xb356ceb3UL,0x33445533UL,0xbbbfd6bbUL,0x70499070UL,0x890e8089UL,0xa766f2a7UL,0xb65ac1b6UL,0x22786622UL,0x922aad92UL,0x20896020UL,0x4915db49UL,0xff4f1affUL,0x78a08878UL,0x7a518e7aUL,0x8f068a8fUL,0xf8b213f8UL,0x80129b80UL,0x17343917UL,0xdaca75daUL,0x31b55331UL,0xc61351c6UL,0xb8bbd3b8UL,0xc31f5ec3UL,0xb052cbb0UL,0x77b49977UL,0x113c3311UL,0xcbf646cbUL,0xfc4b1ffcUL,0xd6da61d6UL,0x3a584e3aUL,
-  0x97f4a5f4UL,0xeb978497UL,0xc7b099b0UL,0xf78c8d8cUL,0xe5170d17UL,0xb7dcbddcUL,0xa7c8b1c8UL,0x39fc54fcUL,0xc0f050f0UL,0x04050305UL,0x87e0a9e0UL,0xac877d87UL,0xd52b192bUL,0x71a662a6UL,0x9a31e631UL,0xc3b59ab5UL,0x05cf45cfUL,0x3ebc9dbcUL,0x09c040c0UL,0xef928792UL,0xc53f153fUL,0x7f26eb26UL,0x0740c940UL,0xed1d0b1dUL,0x822fec2fUL,0x7da967a9UL,0xbe1cfd1cUL,0x8a25ea25UL,0x46dabfdaUL,0xa602f702UL,0xd3a196a1UL,0x2ded5bedUL,0xea5dc25dUL,0xd9241c24UL,0x7ae9aee9UL,0x98be6abeUL,0xd8ee5aeeUL,0xfcc341c3UL,0xf1060206UL,0x1dd14fd1UL,0xd0e45ce4UL,0xa207f407UL,0xb95c345cUL,0xe9180818UL,0xdfae93aeUL,0x4d957395UL,0xc4f553f5UL,0x54413f41UL,0x10140c14UL,0x31f652f6UL,0x8caf65afUL,0x21e25ee2UL,0x60782878UL,0x6ef8a1f8UL,0x14110f11UL,0x5ec4b5c4UL,0x1c1b091bUL,0x485a365aUL,0x36b69bb6UL,0xa5473d47UL,0x816a266aUL,0x9cbb69bbUL,0xfe4ccd4cUL,0xcfba9fbaUL,0x242d1b2dUL,0x3ab99eb9UL,0xb09c749cUL,0x68722e72UL,0x6c772d77UL,0xa3cdb2cdUL,0x7329ee29UL,0xb616fb16UL,0x5301f601UL,0xecd74dd7UL,0x75a361a3UL,0xfa49ce49UL,0xa48d7b8dUL,0xa1423e42UL,0xbc937193UL,0x26a297a2UL,0x5704f504UL,0x69b868b8UL,0x00000000UL,0x99742c74UL,0x80a060a0UL,0xdd211f21UL,0xf243c843UL,0x772ced2cUL,0xb3d9bed9UL,0x01ca46caUL,0xce70d970UL,0xe4dd4bddUL,0x3379de79UL,0x2b67d467UL,0x7b23e823UL,0x11de4adeUL,0x6dbd6bbdUL,0x917e2a7eUL,0x9e34e534UL,0xc13a163aUL,0x1754c554UL,0x2f62d762UL,0xccff55ffUL,0x22a794a7UL,0x0f4acf4aUL,0xc9301030UL,0x080a060aUL,0xe7988198UL,0x5b0bf00bUL,0xf0cc44ccUL,0x4ad5bad5UL,0x963ee33eUL,0x5f0ef30eUL,0xba19fe19UL,0x1b5bc05bUL,0x0a858a85UL,0x7eecadecUL,0x42dfbcdfUL,0xe0d848d8UL,0xf90c040cUL,0xc67adf7aUL,0xee58c158UL,0x459f759fUL,0x84a563a5UL,0x40503050UL,0xd12e1a2eUL,0xe1120e12UL,0x65b76db7UL,0x19d44cd4UL,0x303c143cUL,0x4c5f355fUL,0x9d712f71UL,0x6738e138UL,0x6afda2fdUL,0x0b4fcc4fUL,0x5c4b394bUL,0x3df957f9UL,0xaa0df20dUL,0xe39d829dUL,0xf4c947c9UL,0x8befacefUL,0x6f32e732UL,0x647d2b7dUL,0xd7a495a4UL,0x9bfba0fbUL,0x32b398b3UL,0x2768d168UL,0x5d817f81UL,0x88aa66aaUL,0xa8827e82UL,0x76e6abe6UL,0x169e839eUL,0x0345ca45UL,0x957b297bUL,0xd66ed36eUL,0x50443c44UL,0x558b798bUL,0x633de23dUL,0x2c271d27UL,0x419a769aUL,0xad4d3b4dUL,0xc8fa56faUL,0xe8d24ed2UL,0x28221e22UL,0x3f76db76UL,0x181e0a1eUL,0x90b46cb4UL,0x6b37e437UL,0x25e75de7UL,0x61b26eb2UL,0x862aef2aUL,0x93f1a6f1UL,0x72e3a8e3UL,0x62f7a4f7UL,0xbd593759UL,0xff868b86UL,0xb1563256UL,0x0dc543c5UL,0xdceb59ebUL,0xafc2b7c2UL,0x028f8c8fUL,0x79ac64acUL,0x236dd26dUL,0x923be03bUL,0xabc7b4c7UL,0x4315fa15UL,0xfd090709UL,0x856f256fUL,0x8feaafeaUL,0xf3898e89UL,0x8e20e920UL,0x20281828UL,0xde64d564UL,0xfb838883UL,0x94b16fb1UL,0xb8967296UL,0x706c246cUL,0xae08f108UL,0xe652c752UL,0x35f351f3UL,0x8d652365UL,0x59847c84UL,0xcbbf9cbfUL,0x7c632163UL,0x377cdd7cUL,0xc27fdc7fUL,0x1a918691UL,0x1e948594UL,0xdbab90abUL,0xf8c642c6UL,0xe257c457UL,0x83e5aae5UL,0x3b73d873UL,0x0c0f050fUL,0xf5030103UL,0x38361236UL,0x9ffea3feUL,0xd4e15fe1UL,0x4710f910UL,0xd26bd06bUL,0x2ea891a8UL,0x29e858e8UL,0x74692769UL,0x4ed0b9d0UL,0xa9483848UL,0xcd351335UL,0x56ceb3ceUL,0x44553355UL,0xbfd6bbd6UL,0x49907090UL,0x0e808980UL,0x66f2a7f2UL,0x5ac1b6c1UL,0x78662266UL,0x2aad92adUL,0x89602060UL,0x15db49dbUL,0x4f1aff1aUL,0xa0887888UL,0x518e7a8eUL,0x068a8f8aUL,0xb213f813UL,0x129b809bUL,0x34391739UL,0xca75da75UL,0xb5533153UL,0x1351c651UL,0xbbd3b8d3UL,0x1f5ec35eUL,0x52cbb0cbUL,0xb4997799UL,0x3c331133UL,0xf646cb46UL,0x4b1ffc1fUL,0xda61d661UL,0x584e3a4eUL,
-  0xf4a5f432UL,0x9784976fUL,0xb099b05eUL,0x8c8d8c7aUL,0x170d17e8UL,0xdcbddc0aUL,0xc8b1c816UL,0xfc54fc6dUL,0xf050f090UL,0x05030507UL,0xe0a9e02eUL,0x877d87d1UL,0x2b192bccUL,0xa662a613UL,0x31e6317cUL,0xb59ab559UL,0xcf45cf40UL,0xbc9dbca3UL,0xc040c049UL,0x92879268UL,0x3f153fd0UL,0x26eb2694UL,0x40c940ceUL,0x1d0b1de6UL,0x2fec2f6eUL,0xa967a91aUL,0x1cfd1c43UL,0x25ea2560UL,0xdabfdaf9UL,0x02f70251UL,0xa196a145UL,0xed5bed76UL,0x5dc25d28UL,0x241c24c5UL,0xe9aee9d4UL,0xbe6abef2UL,0xee5aee82UL,0xc341c3bdUL,0x060206f3UL,0xd14fd152UL,0xe45ce48cUL,0x07f40756UL,0x5c345c8dUL,0x180818e1UL,0xae93ae4cUL,0x9573953eUL,0xf553f597UL,0x413f416bUL,0x140c141cUL,0xf652f663UL,0xaf65afe9UL,0xe25ee27fUL,0x78287848UL,0xf8a1f8cfUL,0x110f111bUL,0xc4b5c4ebUL,0x1b091b15UL,0x5a365a7eUL,0xb69bb6adUL,0x473d4798UL,0x6a266aa7UL,0xbb69bbf5UL,0x4ccd4c33UL,0xba9fba50UL,0x2d1b2d3fUL,0xb99eb9a4UL,0x9c749cc4UL,0x722e7246UL,0x772d7741UL,0xcdb2cd11UL,0x29ee299dUL,0x16fb164dUL,0x01f601a5UL,0xd74dd7a1UL,0xa361a314UL,0x49ce4934UL,0x8d7b8ddfUL,0x423e429fUL,0x937193cdUL,0xa297a2b1UL,0x04f504a2UL,0xb868b801UL,0x00000000UL,0x742c74b5UL,0xa060a0e0UL,0x211f21c2UL,0x43c8433aUL,0x2ced2c9aUL,0xd9bed90dUL,0xca46ca47UL,0x70d97017UL,0xdd4bddafUL,0x79de79edUL,0x67d467ffUL,0x23e82393UL,0xde4ade5bUL,0xbd6bbd06UL,0x7e2a7ebbUL,0x34e5347bUL,0x3a163ad7UL,0x54c554d2UL,0x62d762f8UL,0xff55ff99UL,0xa794a7b6UL,0x4acf4ac0UL,0x301030d9UL,0x0a060a0eUL,0x98819866UL,0x0bf00babUL,0xcc44ccb4UL,0xd5bad5f0UL,0x3ee33e75UL,0x0ef30eacUL,0x19fe1944UL,0x5bc05bdbUL,0x858a8580UL,0xecadecd3UL,0xdfbcdffeUL,0xd848d8a8UL,0x0c040cfdUL,0x7adf7a19UL,0x58c1582fUL,0x9f759f30UL,0xa563a5e7UL,0x50305070UL,0x2e1a2ecbUL,0x120e12efUL,0xb76db708UL,0xd44cd455UL,0x3c143c24UL,0x5f355f79UL,0x712f71b2UL,0x38e13886UL,0xfda2fdc8UL,0x4fcc4fc7UL,0x4b394b65UL,0xf957f96aUL,0x0df20d58UL,0x9d829d61UL,0xc947c9b3UL,0xefacef27UL,0x32e73288UL,0x7d2b7d4fUL,0xa495a442UL,0xfba0fb3bUL,0xb398b3aaUL,0x68d168f6UL,0x817f8122UL,0xaa66aaeeUL,0x827e82d6UL,0xe6abe6ddUL,0x9e839e95UL,0x45ca45c9UL,0x7b297bbcUL,0x6ed36e05UL,0x443c446cUL,0x8b798b2cUL,0x3de23d81UL,0x271d2731UL,0x9a769a37UL,0x4d3b4d96UL,0xfa56fa9eUL,0xd24ed2a6UL,0x221e2236UL,0x76db76e4UL,0x1e0a1e12UL,0xb46cb4fcUL,0x37e4378fUL,0xe75de778UL,0xb26eb20fUL,0x2aef2a69UL,0xf1a6f135UL,0xe3a8e3daUL,0xf7a4f7c6UL,0x5937598aUL,0x868b8674UL,0x56325683UL,0xc543c54eUL,0xeb59eb85UL,0xc2b7c218UL,0x8f8c8f8eUL,0xac64ac1dUL,0x6dd26df1UL,0x3be03b72UL,0xc7b4c71fUL,0x15fa15b9UL,0x090709faUL,0x6f256fa0UL,0xeaafea20UL,0x898e897dUL,0x20e92067UL,0x28182838UL,0x64d5640bUL,0x83888373UL,0xb16fb1fbUL,0x967296caUL,0x6c246c54UL,0x08f1085fUL,0x52c75221UL,0xf351f364UL,0x652365aeUL,0x847c8425UL,0xbf9cbf57UL,0x6321635dUL,0x7cdd7ceaUL,0x7fdc7f1eUL,0x9186919cUL,0x9485949bUL,0xab90ab4bUL,0xc642c6baUL,0x57c45726UL,0xe5aae529UL,0x73d873e3UL,0x0f050f09UL,0x030103f4UL,0x3612362aUL,0xfea3fe3cUL,0xe15fe18bUL,0x10f910beUL,0x6bd06b02UL,0xa891a8bfUL,0xe858e871UL,0x69276953UL,0xd0b9d0f7UL,0x48384891UL,0x351335deUL,0xceb3cee5UL,0x55335577UL,0xd6bbd604UL,0x90709039UL,0x80898087UL,0xf2a7f2c1UL,0xc1b6c1ecUL,0x6622665aUL,0xad92adb8UL,0x602060a9UL,0xdb49db5cUL,0x1aff1ab0UL,0x887888d8UL,0x8e7a8e2bUL,0x8a8f8a89UL,0x13f8134aUL,0x9b809b92UL,0x39173923UL,0x75da7510UL,0x53315384UL,0x51c651d5UL,0xd3b8d303UL,0x5ec35edcUL,0xcbb0cbe2UL,0x997799c3UL,0x3311332dUL,0x46cb463dUL,0x1ffc1fb7UL,0x61d6610cUL,0x4e3a4e62UL};
+const grostl_u64 GROSTL_T[8*256]  /*__attribute__((aligned(64)))*/ = {
+0xc6a597f4a5f432c6ULL,0xf884eb9784976ff8ULL,0xee99c7b099b05eeeULL,0xf68df78c8d8c7af6ULL,0xff0de5170d17e8ffULL,0xd6bdb7dcbddc0ad6ULL,0xdeb1a7c8b1c816deULL,0x915439fc54fc6d91ULL,0x6050c0f050f09060ULL,0x0203040503050702ULL,0xcea987e0a9e02eceULL,0x567dac877d87d156ULL,0xe719d52b192bcce7ULL,0xb56271a662a613b5ULL,0x4de69a31e6317c4dULL,0xec9ac3b59ab559ecULL,0x8f4505cf45cf408fULL,0x1f9d3ebc9dbca31fULL,0x894009c040c04989ULL,0xfa87ef92879268faULL,0xef15c53f153fd0efULL,0xb2eb7f26eb2694b2ULL,0x8ec90740c940ce8eULL,0xfb0bed1d0b1de6fbULL,0x41ec822fec2f6e41ULL,0xb3677da967a91ab3ULL,0x5ffdbe1cfd1c435fULL,0x45ea8a25ea256045ULL,0x23bf46dabfdaf923ULL,0x53f7a602f7025153ULL,0xe496d3a196a145e4ULL,0x9b5b2ded5bed769bULL,0x75c2ea5dc25d2875ULL,0xe11cd9241c24c5e1ULL,0x3dae7ae9aee9d43dULL,0x4c6a98be6abef24cULL,0x6c5ad8ee5aee826cULL,0x7e41fcc341c3bd7eULL,0xf502f1060206f3f5ULL,0x834f1dd14fd15283ULL,0x685cd0e45ce48c68ULL,0x51f4a207f4075651ULL,0xd134b95c345c8dd1ULL,0xf908e9180818e1f9ULL,0xe293dfae93ae4ce2ULL,0xab734d9573953eabULL,0x6253c4f553f59762ULL,0x2a3f54413f416b2aULL,0x080c10140c141c08ULL,0x955231f652f66395ULL,0x46658caf65afe946ULL,0x9d5e21e25ee27f9dULL,0x3028607828784830ULL,0x37a16ef8a1f8cf37ULL,0x0a0f14110f111b0aULL,0x2fb55ec4b5c4eb2fULL,0x0e091c1b091b150eULL,0x2436485a365a7e24ULL,0x1b9b36b69bb6ad1bULL,0xdf3da5473d4798dfULL,0xcd26816a266aa7cdULL,0x4e699cbb69bbf54eULL,0x7fcdfe4ccd4c337fULL,0xea9fcfba9fba50eaULL,0x121b242d1b2d3f12ULL,0x1d9e3ab99eb9a41dULL,0x5874b09c749cc458ULL,0x342e68722e724634ULL,0x362d6c772d774136ULL,0xdcb2a3cdb2cd11dcULL,0xb4ee7329ee299db4ULL,0x5bfbb616fb164d5bULL,0xa4f65301f601a5a4ULL,0x764decd74dd7a176ULL,0xb76175a361a314b7ULL,0x7dcefa49ce49347dULL,0x527ba48d7b8ddf52ULL,0xdd3ea1423e429fddULL,0x5e71bc937193cd5eULL,0x139726a297a2b113ULL,0xa6f55704f504a2a6ULL,0xb96869b868b801b9ULL,0x0000000000000000ULL,0xc12c99742c74b5c1ULL,0x406080a060a0e040ULL,0xe31fdd211f21c2e3ULL,0x79c8f243c8433a79ULL,0xb6ed772ced2c9ab6ULL,0xd4beb3d9bed90dd4ULL,0x8d4601ca46ca478dULL,0x67d9ce70d9701767ULL,0x724be4dd4bddaf72ULL,0x94de3379de79ed94ULL,0x98d42b67d467ff98ULL,0xb0e87b23e82393b0ULL,0x854a11de4ade5b85ULL,0xbb6b6dbd6bbd06bbULL,0xc52a917e2a7ebbc5ULL,0x4fe59e34e5347b4fULL,0xed16c13a163ad7edULL,0x86c51754c554d286ULL,0x9ad72f62d762f89aULL,0x6655ccff55ff9966ULL,0x119422a794a7b611ULL,0x8acf0f4acf4ac08aULL,0xe910c9301030d9e9ULL,0x0406080a060a0e04ULL,0xfe81e798819866feULL,0xa0f05b0bf00baba0ULL,0x7844f0cc44ccb478ULL,0x25ba4ad5bad5f025ULL,0x4be3963ee33e754bULL,0xa2f35f0ef30eaca2ULL,0x5dfeba19fe19445dULL,0x80c01b5bc05bdb80ULL,0x058a0a858a858005ULL,0x3fad7eecadecd33fULL,0x21bc42dfbcdffe21ULL,0x7048e0d848d8a870ULL,0xf104f90c040cfdf1ULL,0x63dfc67adf7a1963ULL,0x77c1ee58c1582f77ULL,0xaf75459f759f30afULL,0x426384a563a5e742ULL,0x2030405030507020ULL,0xe51ad12e1a2ecbe5ULL,0xfd0ee1120e12effdULL,0xbf6d65b76db708bfULL,0x814c19d44cd45581ULL,0x1814303c143c2418ULL,0x26354c5f355f7926ULL,0xc32f9d712f71b2c3ULL,0xbee16738e13886beULL,0x35a26afda2fdc835ULL,0x88cc0b4fcc4fc788ULL,0x2e395c4b394b652eULL,0x93573df957f96a93ULL,0x55f2aa0df20d5855ULL,0xfc82e39d829d61fcULL,0x7a47f4c947c9b37aULL,0xc8ac8befacef27c8ULL,0xbae76f32e73288baULL,0x322b647d2b7d4f32ULL,0xe695d7a495a442e6ULL,0xc0a09bfba0fb3bc0ULL,0x199832b398b3aa19ULL,0x9ed12768d168f69eULL,0xa37f5d817f8122a3ULL,0x446688aa66aaee44ULL,0x547ea8827e82d654ULL,0x3bab76e6abe6dd3bULL,0x0b83169e839e950bULL,0x8cca0345ca45c98cULL,0xc729957b297bbcc7ULL,0x6bd3d66ed36e056bULL,0x283c50443c446c28ULL,0xa779558b798b2ca7ULL,0xbce2633de23d81bcULL,0x161d2c271d273116ULL,0xad76419a769a37adULL,0xdb3bad4d3b4d96dbULL,0x6456c8fa56fa9e64ULL,0x744ee8d24ed2a674ULL,0x141e28221e223614ULL,0x92db3f76db76e492ULL,0x0c0a181e0a1e120cULL,0x486c90b46cb4fc48ULL,0xb8e46b37e4378fb8ULL,0x9f5d25e75de7789fULL,0xbd6e61b26eb20fbdULL,0x43ef862aef2a6943ULL,0xc4a693f1a6f135c4ULL,0x39a872e3a8e3da39ULL,0x31a462f7a4f7c631ULL,0xd337bd5937598ad3ULL,0xf28bff868b8674f2ULL,0xd532b156325683d5ULL,0x8b430dc543c54e8bULL,0x6e59dceb59eb856eULL,0xdab7afc2b7c218daULL,0x018c028f8c8f8e01ULL,0xb16479ac64ac1db1ULL,0x9cd2236dd26df19cULL,0x49e0923be03b7249ULL,0xd8b4abc7b4c71fd8ULL,0xacfa4315fa15b9acULL,0xf307fd090709faf3ULL,0xcf25856f256fa0cfULL,0xcaaf8feaafea20caULL,0xf48ef3898e897df4ULL,0x47e98e20e9206747ULL,0x1018202818283810ULL,0x6fd5de64d5640b6fULL,0xf088fb83888373f0ULL,0x4a6f94b16fb1fb4aULL,0x5c72b8967296ca5cULL,0x3824706c246c5438ULL,0x57f1ae08f1085f57ULL,0x73c7e652c7522173ULL,0x975135f351f36497ULL,0xcb238d652365aecbULL,0xa17c59847c8425a1ULL,0xe89ccbbf9cbf57e8ULL,0x3e217c6321635d3eULL,0x96dd377cdd7cea96ULL,0x61dcc27fdc7f1e61ULL,0x0d861a9186919c0dULL,0x0f851e9485949b0fULL,0xe090dbab90ab4be0ULL,0x7c42f8c642c6ba7cULL,0x71c4e257c4572671ULL,0xccaa83e5aae529ccULL,0x90d83b73d873e390ULL,0x06050c0f050f0906ULL,0xf701f5030103f4f7ULL,0x1c12383612362a1cULL,0xc2a39ffea3fe3cc2ULL,0x6a5fd4e15fe18b6aULL,0xaef94710f910beaeULL,0x69d0d26bd06b0269ULL,0x17912ea891a8bf17ULL,0x995829e858e87199ULL,0x3a2774692769533aULL,0x27b94ed0b9d0f727ULL,0xd938a948384891d9ULL,0xeb13cd351335deebULL,0x2bb356ceb3cee52bULL,0x2233445533557722ULL,0xd2bbbfd6bbd604d2ULL,0xa9704990709039a9ULL,0x07890e8089808707ULL,0x33a766f2a7f2c133ULL,0x2db65ac1b6c1ec2dULL,0x3c22786622665a3cULL,0x15922aad92adb815ULL,0xc92089602060a9c9ULL,0x874915db49db5c87ULL,0xaaff4f1aff1ab0aaULL,0x5078a0887888d850ULL,0xa57a518e7a8e2ba5ULL,0x038f068a8f8a8903ULL,0x59f8b213f8134a59ULL,0x0980129b809b9209ULL,0x1a1734391739231aULL,0x65daca75da751065ULL,0xd731b553315384d7ULL,0x84c61351c651d584ULL,0xd0b8bbd3b8d303d0ULL,0x82c31f5ec35edc82ULL,0x29b052cbb0cbe229ULL,0x5a77b4997799c35aULL,0x1e113c3311332d1eULL,0x7bcbf646cb463d7bULL,0xa8fc4b1ffc1fb7a8ULL,0x6dd6da61d6610c6dULL,0x2c3a584e3a4e622cULL,
+0xa597f4a5f432c6c6ULL,0x84eb9784976ff8f8ULL,0x99c7b099b05eeeeeULL,0x8df78c8d8c7af6f6ULL,0x0de5170d17e8ffffULL,0xbdb7dcbddc0ad6d6ULL,0xb1a7c8b1c816dedeULL,0x5439fc54fc6d9191ULL,0x50c0f050f0906060ULL,0x0304050305070202ULL,0xa987e0a9e02ececeULL,0x7dac877d87d15656ULL,0x19d52b192bcce7e7ULL,0x6271a662a613b5b5ULL,0xe69a31e6317c4d4dULL,0x9ac3b59ab559ececULL,0x4505cf45cf408f8fULL,0x9d3ebc9dbca31f1fULL,0x4009c040c0498989ULL,0x87ef92879268fafaULL,0x15c53f153fd0efefULL,0xeb7f26eb2694b2b2ULL,0xc90740c940ce8e8eULL,0x0bed1d0b1de6fbfbULL,0xec822fec2f6e4141ULL,0x677da967a91ab3b3ULL,0xfdbe1cfd1c435f5fULL,0xea8a25ea25604545ULL,0xbf46dabfdaf92323ULL,0xf7a602f702515353ULL,0x96d3a196a145e4e4ULL,0x5b2ded5bed769b9bULL,0xc2ea5dc25d287575ULL,0x1cd9241c24c5e1e1ULL,0xae7ae9aee9d43d3dULL,0x6a98be6abef24c4cULL,0x5ad8ee5aee826c6cULL,0x41fcc341c3bd7e7eULL,0x02f1060206f3f5f5ULL,0x4f1dd14fd1528383ULL,0x5cd0e45ce48c6868ULL,0xf4a207f407565151ULL,0x34b95c345c8dd1d1ULL,0x08e9180818e1f9f9ULL,0x93dfae93ae4ce2e2ULL,0x734d9573953eababULL,0x53c4f553f5976262ULL,0x3f54413f416b2a2aULL,0x0c10140c141c0808ULL,0x5231f652f6639595ULL,0x658caf65afe94646ULL,0x5e21e25ee27f9d9dULL,0x2860782878483030ULL,0xa16ef8a1f8cf3737ULL,0x0f14110f111b0a0aULL,0xb55ec4b5c4eb2f2fULL,0x091c1b091b150e0eULL,0x36485a365a7e2424ULL,0x9b36b69bb6ad1b1bULL,0x3da5473d4798dfdfULL,0x26816a266aa7cdcdULL,0x699cbb69bbf54e4eULL,0xcdfe4ccd4c337f7fULL,0x9fcfba9fba50eaeaULL,0x1b242d1b2d3f1212ULL,0x9e3ab99eb9a41d1dULL,0x74b09c749cc45858ULL,0x2e68722e72463434ULL,0x2d6c772d77413636ULL,0xb2a3cdb2cd11dcdcULL,0xee7329ee299db4b4ULL,0xfbb616fb164d5b5bULL,0xf65301f601a5a4a4ULL,0x4decd74dd7a17676ULL,0x6175a361a314b7b7ULL,0xcefa49ce49347d7dULL,0x7ba48d7b8ddf5252ULL,0x3ea1423e429fddddULL,0x71bc937193cd5e5eULL,0x9726a297a2b11313ULL,0xf55704f504a2a6a6ULL,0x6869b868b801b9b9ULL,0x0000000000000000ULL,0x2c99742c74b5c1c1ULL,0x6080a060a0e04040ULL,0x1fdd211f21c2e3e3ULL,0xc8f243c8433a7979ULL,0xed772ced2c9ab6b6ULL,0xbeb3d9bed90dd4d4ULL,0x4601ca46ca478d8dULL,0xd9ce70d970176767ULL,0x4be4dd4bddaf7272ULL,0xde3379de79ed9494ULL,0xd42b67d467ff9898ULL,0xe87b23e82393b0b0ULL,0x4a11de4ade5b8585ULL,0x6b6dbd6bbd06bbbbULL,0x2a917e2a7ebbc5c5ULL,0xe59e34e5347b4f4fULL,0x16c13a163ad7ededULL,0xc51754c554d28686ULL,0xd72f62d762f89a9aULL,0x55ccff55ff996666ULL,0x9422a794a7b61111ULL,0xcf0f4acf4ac08a8aULL,0x10c9301030d9e9e9ULL,0x06080a060a0e0404ULL,0x81e798819866fefeULL,0xf05b0bf00baba0a0ULL,0x44f0cc44ccb47878ULL,0xba4ad5bad5f02525ULL,0xe3963ee33e754b4bULL,0xf35f0ef30eaca2a2ULL,0xfeba19fe19445d5dULL,0xc01b5bc05bdb8080ULL,0x8a0a858a85800505ULL,0xad7eecadecd33f3fULL,0xbc42dfbcdffe2121ULL,0x48e0d848d8a87070ULL,0x04f90c040cfdf1f1ULL,0xdfc67adf7a196363ULL,0xc1ee58c1582f7777ULL,0x75459f759f30afafULL,0x6384a563a5e74242ULL,0x3040503050702020ULL,0x1ad12e1a2ecbe5e5ULL,0x0ee1120e12effdfdULL,0x6d65b76db708bfbfULL,0x4c19d44cd4558181ULL,0x14303c143c241818ULL,0x354c5f355f792626ULL,0x2f9d712f71b2c3c3ULL,0xe16738e13886bebeULL,0xa26afda2fdc83535ULL,0xcc0b4fcc4fc78888ULL,0x395c4b394b652e2eULL,0x573df957f96a9393ULL,0xf2aa0df20d585555ULL,0x82e39d829d61fcfcULL,0x47f4c947c9b37a7aULL,0xac8befacef27c8c8ULL,0xe76f32e73288babaULL,0x2b647d2b7d4f3232ULL,0x95d7a495a442e6e6ULL,0xa09bfba0fb3bc0c0ULL,0x9832b398b3aa1919ULL,0xd12768d168f69e9eULL,0x7f5d817f8122a3a3ULL,0x6688aa66aaee4444ULL,0x7ea8827e82d65454ULL,0xab76e6abe6dd3b3bULL,0x83169e839e950b0bULL,0xca0345ca45c98c8cULL,0x29957b297bbcc7c7ULL,0xd3d66ed36e056b6bULL,0x3c50443c446c2828ULL,0x79558b798b2ca7a7ULL,0xe2633de23d81bcbcULL,0x1d2c271d27311616ULL,0x76419a769a37adadULL,0x3bad4d3b4d96dbdbULL,0x56c8fa56fa9e6464ULL,0x4ee8d24ed2a67474ULL,0x1e28221e22361414ULL,0xdb3f76db76e49292ULL,0x0a181e0a1e120c0cULL,0x6c90b46cb4fc4848ULL,0xe46b37e4378fb8b8ULL,0x5d25e75de7789f9fULL,0x6e61b26eb20fbdbdULL,0xef862aef2a694343ULL,0xa693f1a6f135c4c4ULL,0xa872e3a8e3da3939ULL,0xa462f7a4f7c63131ULL,0x37bd5937598ad3d3ULL,0x8bff868b8674f2f2ULL,0x32b156325683d5d5ULL,0x430dc543c54e8b8bULL,0x59dceb59eb856e6eULL,0xb7afc2b7c218dadaULL,0x8c028f8c8f8e0101ULL,0x6479ac64ac1db1b1ULL,0xd2236dd26df19c9cULL,0xe0923be03b724949ULL,0xb4abc7b4c71fd8d8ULL,0xfa4315fa15b9acacULL,0x07fd090709faf3f3ULL,0x25856f256fa0cfcfULL,0xaf8feaafea20cacaULL,0x8ef3898e897df4f4ULL,0xe98e20e920674747ULL,0x1820281828381010ULL,0xd5de64d5640b6f6fULL,0x88fb83888373f0f0ULL,0x6f94b16fb1fb4a4aULL,0x72b8967296ca5c5cULL,0x24706c246c543838ULL,0xf1ae08f1085f5757ULL,0xc7e652c752217373ULL,0x5135f351f3649797ULL,0x238d652365aecbcbULL,0x7c59847c8425a1a1ULL,0x9ccbbf9cbf57e8e8ULL,0x217c6321635d3e3eULL,0xdd377cdd7cea9696ULL,0xdcc27fdc7f1e6161ULL,0x861a9186919c0d0dULL,0x851e9485949b0f0fULL,0x90dbab90ab4be0e0ULL,0x42f8c642c6ba7c7cULL,0xc4e257c457267171ULL,0xaa83e5aae529ccccULL,0xd83b73d873e39090ULL,0x050c0f050f090606ULL,0x01f5030103f4f7f7ULL,0x12383612362a1c1cULL,0xa39ffea3fe3cc2c2ULL,0x5fd4e15fe18b6a6aULL,0xf94710f910beaeaeULL,0xd0d26bd06b026969ULL,0x912ea891a8bf1717ULL,0x5829e858e8719999ULL,0x2774692769533a3aULL,0xb94ed0b9d0f72727ULL,0x38a948384891d9d9ULL,0x13cd351335deebebULL,0xb356ceb3cee52b2bULL,0x3344553355772222ULL,0xbbbfd6bbd604d2d2ULL,0x704990709039a9a9ULL,0x890e808980870707ULL,0xa766f2a7f2c13333ULL,0xb65ac1b6c1ec2d2dULL,0x22786622665a3c3cULL,0x922aad92adb81515ULL,0x2089602060a9c9c9ULL,0x4915db49db5c8787ULL,0xff4f1aff1ab0aaaaULL,0x78a0887888d85050ULL,0x7a518e7a8e2ba5a5ULL,0x8f068a8f8a890303ULL,0xf8b213f8134a5959ULL,0x80129b809b920909ULL,0x1734391739231a1aULL,0xdaca75da75106565ULL,0x31b553315384d7d7ULL,0xc61351c651d58484ULL,0xb8bbd3b8d303d0d0ULL,0xc31f5ec35edc8282ULL,0xb052cbb0cbe22929ULL,0x77b4997799c35a5aULL,0x113c3311332d1e1eULL,0xcbf646cb463d7b7bULL,0xfc4b1ffc1fb7a8a8ULL,0xd6da61d6610c6d6dULL,0x3a584e3a4e622c2cULL,
+0x97f4a5f432c6c6a5ULL,0xeb9784976ff8f884ULL,0xc7b099b05eeeee99ULL,0xf78c8d8c7af6f68dULL,0xe5170d17e8ffff0dULL,0xb7dcbddc0ad6d6bdULL,0xa7c8b1c816dedeb1ULL,0x39fc54fc6d919154ULL,0xc0f050f090606050ULL,0x0405030507020203ULL,0x87e0a9e02ececea9ULL,0xac877d87d156567dULL,0xd52b192bcce7e719ULL,0x71a662a613b5b562ULL,0x9a31e6317c4d4de6ULL,0xc3b59ab559ecec9aULL,0x05cf45cf408f8f45ULL,0x3ebc9dbca31f1f9dULL,0x09c040c049898940ULL,0xef92879268fafa87ULL,0xc53f153fd0efef15ULL,0x7f26eb2694b2b2ebULL,0x0740c940ce8e8ec9ULL,0xed1d0b1de6fbfb0bULL,0x822fec2f6e4141ecULL,0x7da967a91ab3b367ULL,0xbe1cfd1c435f5ffdULL,0x8a25ea25604545eaULL,0x46dabfdaf92323bfULL,0xa602f702515353f7ULL,0xd3a196a145e4e496ULL,0x2ded5bed769b9b5bULL,0xea5dc25d287575c2ULL,0xd9241c24c5e1e11cULL,0x7ae9aee9d43d3daeULL,0x98be6abef24c4c6aULL,0xd8ee5aee826c6c5aULL,0xfcc341c3bd7e7e41ULL,0xf1060206f3f5f502ULL,0x1dd14fd15283834fULL,0xd0e45ce48c68685cULL,0xa207f407565151f4ULL,0xb95c345c8dd1d134ULL,0xe9180818e1f9f908ULL,0xdfae93ae4ce2e293ULL,0x4d9573953eabab73ULL,0xc4f553f597626253ULL,0x54413f416b2a2a3fULL,0x10140c141c08080cULL,0x31f652f663959552ULL,0x8caf65afe9464665ULL,0x21e25ee27f9d9d5eULL,0x6078287848303028ULL,0x6ef8a1f8cf3737a1ULL,0x14110f111b0a0a0fULL,0x5ec4b5c4eb2f2fb5ULL,0x1c1b091b150e0e09ULL,0x485a365a7e242436ULL,0x36b69bb6ad1b1b9bULL,0xa5473d4798dfdf3dULL,0x816a266aa7cdcd26ULL,0x9cbb69bbf54e4e69ULL,0xfe4ccd4c337f7fcdULL,0xcfba9fba50eaea9fULL,0x242d1b2d3f12121bULL,0x3ab99eb9a41d1d9eULL,0xb09c749cc4585874ULL,0x68722e724634342eULL,0x6c772d774136362dULL,0xa3cdb2cd11dcdcb2ULL,0x7329ee299db4b4eeULL,0xb616fb164d5b5bfbULL,0x5301f601a5a4a4f6ULL,0xecd74dd7a176764dULL,0x75a361a314b7b761ULL,0xfa49ce49347d7dceULL,0xa48d7b8ddf52527bULL,0xa1423e429fdddd3eULL,0xbc937193cd5e5e71ULL,0x26a297a2b1131397ULL,0x5704f504a2a6a6f5ULL,0x69b868b801b9b968ULL,0x0000000000000000ULL,0x99742c74b5c1c12cULL,0x80a060a0e0404060ULL,0xdd211f21c2e3e31fULL,0xf243c8433a7979c8ULL,0x772ced2c9ab6b6edULL,0xb3d9bed90dd4d4beULL,0x01ca46ca478d8d46ULL,0xce70d970176767d9ULL,0xe4dd4bddaf72724bULL,0x3379de79ed9494deULL,0x2b67d467ff9898d4ULL,0x7b23e82393b0b0e8ULL,0x11de4ade5b85854aULL,0x6dbd6bbd06bbbb6bULL,0x917e2a7ebbc5c52aULL,0x9e34e5347b4f4fe5ULL,0xc13a163ad7eded16ULL,0x1754c554d28686c5ULL,0x2f62d762f89a9ad7ULL,0xccff55ff99666655ULL,0x22a794a7b6111194ULL,0x0f4acf4ac08a8acfULL,0xc9301030d9e9e910ULL,0x080a060a0e040406ULL,0xe798819866fefe81ULL,0x5b0bf00baba0a0f0ULL,0xf0cc44ccb4787844ULL,0x4ad5bad5f02525baULL,0x963ee33e754b4be3ULL,0x5f0ef30eaca2a2f3ULL,0xba19fe19445d5dfeULL,0x1b5bc05bdb8080c0ULL,0x0a858a858005058aULL,0x7eecadecd33f3fadULL,0x42dfbcdffe2121bcULL,0xe0d848d8a8707048ULL,0xf90c040cfdf1f104ULL,0xc67adf7a196363dfULL,0xee58c1582f7777c1ULL,0x459f759f30afaf75ULL,0x84a563a5e7424263ULL,0x4050305070202030ULL,0xd12e1a2ecbe5e51aULL,0xe1120e12effdfd0eULL,0x65b76db708bfbf6dULL,0x19d44cd45581814cULL,0x303c143c24181814ULL,0x4c5f355f79262635ULL,0x9d712f71b2c3c32fULL,0x6738e13886bebee1ULL,0x6afda2fdc83535a2ULL,0x0b4fcc4fc78888ccULL,0x5c4b394b652e2e39ULL,0x3df957f96a939357ULL,0xaa0df20d585555f2ULL,0xe39d829d61fcfc82ULL,0xf4c947c9b37a7a47ULL,0x8befacef27c8c8acULL,0x6f32e73288babae7ULL,0x647d2b7d4f32322bULL,0xd7a495a442e6e695ULL,0x9bfba0fb3bc0c0a0ULL,0x32b398b3aa191998ULL,0x2768d168f69e9ed1ULL,0x5d817f8122a3a37fULL,0x88aa66aaee444466ULL,0xa8827e82d654547eULL,0x76e6abe6dd3b3babULL,0x169e839e950b0b83ULL,0x0345ca45c98c8ccaULL,0x957b297bbcc7c729ULL,0xd66ed36e056b6bd3ULL,0x50443c446c28283cULL,0x558b798b2ca7a779ULL,0x633de23d81bcbce2ULL,0x2c271d273116161dULL,0x419a769a37adad76ULL,0xad4d3b4d96dbdb3bULL,0xc8fa56fa9e646456ULL,0xe8d24ed2a674744eULL,0x28221e223614141eULL,0x3f76db76e49292dbULL,0x181e0a1e120c0c0aULL,0x90b46cb4fc48486cULL,0x6b37e4378fb8b8e4ULL,0x25e75de7789f9f5dULL,0x61b26eb20fbdbd6eULL,0x862aef2a694343efULL,0x93f1a6f135c4c4a6ULL,0x72e3a8e3da3939a8ULL,0x62f7a4f7c63131a4ULL,0xbd5937598ad3d337ULL,0xff868b8674f2f28bULL,0xb156325683d5d532ULL,0x0dc543c54e8b8b43ULL,0xdceb59eb856e6e59ULL,0xafc2b7c218dadab7ULL,0x028f8c8f8e01018cULL,0x79ac64ac1db1b164ULL,0x236dd26df19c9cd2ULL,0x923be03b724949e0ULL,0xabc7b4c71fd8d8b4ULL,0x4315fa15b9acacfaULL,0xfd090709faf3f307ULL,0x856f256fa0cfcf25ULL,0x8feaafea20cacaafULL,0xf3898e897df4f48eULL,0x8e20e920674747e9ULL,0x2028182838101018ULL,0xde64d5640b6f6fd5ULL,0xfb83888373f0f088ULL,0x94b16fb1fb4a4a6fULL,0xb8967296ca5c5c72ULL,0x706c246c54383824ULL,0xae08f1085f5757f1ULL,0xe652c752217373c7ULL,0x35f351f364979751ULL,0x8d652365aecbcb23ULL,0x59847c8425a1a17cULL,0xcbbf9cbf57e8e89cULL,0x7c6321635d3e3e21ULL,0x377cdd7cea9696ddULL,0xc27fdc7f1e6161dcULL,0x1a9186919c0d0d86ULL,0x1e9485949b0f0f85ULL,0xdbab90ab4be0e090ULL,0xf8c642c6ba7c7c42ULL,0xe257c457267171c4ULL,0x83e5aae529ccccaaULL,0x3b73d873e39090d8ULL,0x0c0f050f09060605ULL,0xf5030103f4f7f701ULL,0x383612362a1c1c12ULL,0x9ffea3fe3cc2c2a3ULL,0xd4e15fe18b6a6a5fULL,0x4710f910beaeaef9ULL,0xd26bd06b026969d0ULL,0x2ea891a8bf171791ULL,0x29e858e871999958ULL,0x74692769533a3a27ULL,0x4ed0b9d0f72727b9ULL,0xa948384891d9d938ULL,0xcd351335deebeb13ULL,0x56ceb3cee52b2bb3ULL,0x4455335577222233ULL,0xbfd6bbd604d2d2bbULL,0x4990709039a9a970ULL,0x0e80898087070789ULL,0x66f2a7f2c13333a7ULL,0x5ac1b6c1ec2d2db6ULL,0x786622665a3c3c22ULL,0x2aad92adb8151592ULL,0x89602060a9c9c920ULL,0x15db49db5c878749ULL,0x4f1aff1ab0aaaaffULL,0xa0887888d8505078ULL,0x518e7a8e2ba5a57aULL,0x068a8f8a8903038fULL,0xb213f8134a5959f8ULL,0x129b809b92090980ULL,0x34391739231a1a17ULL,0xca75da75106565daULL,0xb553315384d7d731ULL,0x1351c651d58484c6ULL,0xbbd3b8d303d0d0b8ULL,0x1f5ec35edc8282c3ULL,0x52cbb0cbe22929b0ULL,0xb4997799c35a5a77ULL,0x3c3311332d1e1e11ULL,0xf646cb463d7b7bcbULL,0x4b1ffc1fb7a8a8fcULL,0xda61d6610c6d6dd6ULL,0x584e3a4e622c2c3aULL,
+0xf4a5f432c6c6a597ULL,0x9784976ff8f884ebULL,0xb099b05eeeee99c7ULL,0x8c8d8c7af6f68df7ULL,0x170d17e8ffff0de5ULL,0xdcbddc0ad6d6bdb7ULL,0xc8b1c816dedeb1a7ULL,0xfc54fc6d91915439ULL,0xf050f090606050c0ULL,0x0503050702020304ULL,0xe0a9e02ececea987ULL,0x877d87d156567dacULL,0x2b192bcce7e719d5ULL,0xa662a613b5b56271ULL,0x31e6317c4d4de69aULL,0xb59ab559ecec9ac3ULL,0xcf45cf408f8f4505ULL,0xbc9dbca31f1f9d3eULL,0xc040c04989894009ULL,0x92879268fafa87efULL,0x3f153fd0efef15c5ULL,0x26eb2694b2b2eb7fULL,0x40c940ce8e8ec907ULL,0x1d0b1de6fbfb0bedULL,0x2fec2f6e4141ec82ULL,0xa967a91ab3b3677dULL,0x1cfd1c435f5ffdbeULL,0x25ea25604545ea8aULL,0xdabfdaf92323bf46ULL,0x02f702515353f7a6ULL,0xa196a145e4e496d3ULL,0xed5bed769b9b5b2dULL,0x5dc25d287575c2eaULL,0x241c24c5e1e11cd9ULL,0xe9aee9d43d3dae7aULL,0xbe6abef24c4c6a98ULL,0xee5aee826c6c5ad8ULL,0xc341c3bd7e7e41fcULL,0x060206f3f5f502f1ULL,0xd14fd15283834f1dULL,0xe45ce48c68685cd0ULL,0x07f407565151f4a2ULL,0x5c345c8dd1d134b9ULL,0x180818e1f9f908e9ULL,0xae93ae4ce2e293dfULL,0x9573953eabab734dULL,0xf553f597626253c4ULL,0x413f416b2a2a3f54ULL,0x140c141c08080c10ULL,0xf652f66395955231ULL,0xaf65afe94646658cULL,0xe25ee27f9d9d5e21ULL,0x7828784830302860ULL,0xf8a1f8cf3737a16eULL,0x110f111b0a0a0f14ULL,0xc4b5c4eb2f2fb55eULL,0x1b091b150e0e091cULL,0x5a365a7e24243648ULL,0xb69bb6ad1b1b9b36ULL,0x473d4798dfdf3da5ULL,0x6a266aa7cdcd2681ULL,0xbb69bbf54e4e699cULL,0x4ccd4c337f7fcdfeULL,0xba9fba50eaea9fcfULL,0x2d1b2d3f12121b24ULL,0xb99eb9a41d1d9e3aULL,0x9c749cc4585874b0ULL,0x722e724634342e68ULL,0x772d774136362d6cULL,0xcdb2cd11dcdcb2a3ULL,0x29ee299db4b4ee73ULL,0x16fb164d5b5bfbb6ULL,0x01f601a5a4a4f653ULL,0xd74dd7a176764decULL,0xa361a314b7b76175ULL,0x49ce49347d7dcefaULL,0x8d7b8ddf52527ba4ULL,0x423e429fdddd3ea1ULL,0x937193cd5e5e71bcULL,0xa297a2b113139726ULL,0x04f504a2a6a6f557ULL,0xb868b801b9b96869ULL,0x0000000000000000ULL,0x742c74b5c1c12c99ULL,0xa060a0e040406080ULL,0x211f21c2e3e31fddULL,0x43c8433a7979c8f2ULL,0x2ced2c9ab6b6ed77ULL,0xd9bed90dd4d4beb3ULL,0xca46ca478d8d4601ULL,0x70d970176767d9ceULL,0xdd4bddaf72724be4ULL,0x79de79ed9494de33ULL,0x67d467ff9898d42bULL,0x23e82393b0b0e87bULL,0xde4ade5b85854a11ULL,0xbd6bbd06bbbb6b6dULL,0x7e2a7ebbc5c52a91ULL,0x34e5347b4f4fe59eULL,0x3a163ad7eded16c1ULL,0x54c554d28686c517ULL,0x62d762f89a9ad72fULL,0xff55ff99666655ccULL,0xa794a7b611119422ULL,0x4acf4ac08a8acf0fULL,0x301030d9e9e910c9ULL,0x0a060a0e04040608ULL,0x98819866fefe81e7ULL,0x0bf00baba0a0f05bULL,0xcc44ccb4787844f0ULL,0xd5bad5f02525ba4aULL,0x3ee33e754b4be396ULL,0x0ef30eaca2a2f35fULL,0x19fe19445d5dfebaULL,0x5bc05bdb8080c01bULL,0x858a858005058a0aULL,0xecadecd33f3fad7eULL,0xdfbcdffe2121bc42ULL,0xd848d8a8707048e0ULL,0x0c040cfdf1f104f9ULL,0x7adf7a196363dfc6ULL,0x58c1582f7777c1eeULL,0x9f759f30afaf7545ULL,0xa563a5e742426384ULL,0x5030507020203040ULL,0x2e1a2ecbe5e51ad1ULL,0x120e12effdfd0ee1ULL,0xb76db708bfbf6d65ULL,0xd44cd45581814c19ULL,0x3c143c2418181430ULL,0x5f355f792626354cULL,0x712f71b2c3c32f9dULL,0x38e13886bebee167ULL,0xfda2fdc83535a26aULL,0x4fcc4fc78888cc0bULL,0x4b394b652e2e395cULL,0xf957f96a9393573dULL,0x0df20d585555f2aaULL,0x9d829d61fcfc82e3ULL,0xc947c9b37a7a47f4ULL,0xefacef27c8c8ac8bULL,0x32e73288babae76fULL,0x7d2b7d4f32322b64ULL,0xa495a442e6e695d7ULL,0xfba0fb3bc0c0a09bULL,0xb398b3aa19199832ULL,0x68d168f69e9ed127ULL,0x817f8122a3a37f5dULL,0xaa66aaee44446688ULL,0x827e82d654547ea8ULL,0xe6abe6dd3b3bab76ULL,0x9e839e950b0b8316ULL,0x45ca45c98c8cca03ULL,0x7b297bbcc7c72995ULL,0x6ed36e056b6bd3d6ULL,0x443c446c28283c50ULL,0x8b798b2ca7a77955ULL,0x3de23d81bcbce263ULL,0x271d273116161d2cULL,0x9a769a37adad7641ULL,0x4d3b4d96dbdb3badULL,0xfa56fa9e646456c8ULL,0xd24ed2a674744ee8ULL,0x221e223614141e28ULL,0x76db76e49292db3fULL,0x1e0a1e120c0c0a18ULL,0xb46cb4fc48486c90ULL,0x37e4378fb8b8e46bULL,0xe75de7789f9f5d25ULL,0xb26eb20fbdbd6e61ULL,0x2aef2a694343ef86ULL,0xf1a6f135c4c4a693ULL,0xe3a8e3da3939a872ULL,0xf7a4f7c63131a462ULL,0x5937598ad3d337bdULL,0x868b8674f2f28bffULL,0x56325683d5d532b1ULL,0xc543c54e8b8b430dULL,0xeb59eb856e6e59dcULL,0xc2b7c218dadab7afULL,0x8f8c8f8e01018c02ULL,0xac64ac1db1b16479ULL,0x6dd26df19c9cd223ULL,0x3be03b724949e092ULL,0xc7b4c71fd8d8b4abULL,0x15fa15b9acacfa43ULL,0x090709faf3f307fdULL,0x6f256fa0cfcf2585ULL,0xeaafea20cacaaf8fULL,0x898e897df4f48ef3ULL,0x20e920674747e98eULL,0x2818283810101820ULL,0x64d5640b6f6fd5deULL,0x83888373f0f088fbULL,0xb16fb1fb4a4a6f94ULL,0x967296ca5c5c72b8ULL,0x6c246c5438382470ULL,0x08f1085f5757f1aeULL,0x52c752217373c7e6ULL,0xf351f36497975135ULL,0x652365aecbcb238dULL,0x847c8425a1a17c59ULL,0xbf9cbf57e8e89ccbULL,0x6321635d3e3e217cULL,0x7cdd7cea9696dd37ULL,0x7fdc7f1e6161dcc2ULL,0x9186919c0d0d861aULL,0x9485949b0f0f851eULL,0xab90ab4be0e090dbULL,0xc642c6ba7c7c42f8ULL,0x57c457267171c4e2ULL,0xe5aae529ccccaa83ULL,0x73d873e39090d83bULL,0x0f050f090606050cULL,0x030103f4f7f701f5ULL,0x3612362a1c1c1238ULL,0xfea3fe3cc2c2a39fULL,0xe15fe18b6a6a5fd4ULL,0x10f910beaeaef947ULL,0x6bd06b026969d0d2ULL,0xa891a8bf1717912eULL,0xe858e87199995829ULL,0x692769533a3a2774ULL,0xd0b9d0f72727b94eULL,0x48384891d9d938a9ULL,0x351335deebeb13cdULL,0xceb3cee52b2bb356ULL,0x5533557722223344ULL,0xd6bbd604d2d2bbbfULL,0x90709039a9a97049ULL,0x808980870707890eULL,0xf2a7f2c13333a766ULL,0xc1b6c1ec2d2db65aULL,0x6622665a3c3c2278ULL,0xad92adb81515922aULL,0x602060a9c9c92089ULL,0xdb49db5c87874915ULL,0x1aff1ab0aaaaff4fULL,0x887888d8505078a0ULL,0x8e7a8e2ba5a57a51ULL,0x8a8f8a8903038f06ULL,0x13f8134a5959f8b2ULL,0x9b809b9209098012ULL,0x391739231a1a1734ULL,0x75da75106565dacaULL,0x53315384d7d731b5ULL,0x51c651d58484c613ULL,0xd3b8d303d0d0b8bbULL,0x5ec35edc8282c31fULL,0xcbb0cbe22929b052ULL,0x997799c35a5a77b4ULL,0x3311332d1e1e113cULL,0x46cb463d7b7bcbf6ULL,0x1ffc1fb7a8a8fc4bULL,0x61d6610c6d6dd6daULL,0x4e3a4e622c2c3a58ULL,
+0xa5f432c6c6a597f4ULL,0x84976ff8f884eb97ULL,0x99b05eeeee99c7b0ULL,0x8d8c7af6f68df78cULL,0x0d17e8ffff0de517ULL,0xbddc0ad6d6bdb7dcULL,0xb1c816dedeb1a7c8ULL,0x54fc6d91915439fcULL,0x50f090606050c0f0ULL,0x0305070202030405ULL,0xa9e02ececea987e0ULL,0x7d87d156567dac87ULL,0x192bcce7e719d52bULL,0x62a613b5b56271a6ULL,0xe6317c4d4de69a31ULL,0x9ab559ecec9ac3b5ULL,0x45cf408f8f4505cfULL,0x9dbca31f1f9d3ebcULL,0x40c04989894009c0ULL,0x879268fafa87ef92ULL,0x153fd0efef15c53fULL,0xeb2694b2b2eb7f26ULL,0xc940ce8e8ec90740ULL,0x0b1de6fbfb0bed1dULL,0xec2f6e4141ec822fULL,0x67a91ab3b3677da9ULL,0xfd1c435f5ffdbe1cULL,0xea25604545ea8a25ULL,0xbfdaf92323bf46daULL,0xf702515353f7a602ULL,0x96a145e4e496d3a1ULL,0x5bed769b9b5b2dedULL,0xc25d287575c2ea5dULL,0x1c24c5e1e11cd924ULL,0xaee9d43d3dae7ae9ULL,0x6abef24c4c6a98beULL,0x5aee826c6c5ad8eeULL,0x41c3bd7e7e41fcc3ULL,0x0206f3f5f502f106ULL,0x4fd15283834f1dd1ULL,0x5ce48c68685cd0e4ULL,0xf407565151f4a207ULL,0x345c8dd1d134b95cULL,0x0818e1f9f908e918ULL,0x93ae4ce2e293dfaeULL,0x73953eabab734d95ULL,0x53f597626253c4f5ULL,0x3f416b2a2a3f5441ULL,0x0c141c08080c1014ULL,0x52f66395955231f6ULL,0x65afe94646658cafULL,0x5ee27f9d9d5e21e2ULL,0x2878483030286078ULL,0xa1f8cf3737a16ef8ULL,0x0f111b0a0a0f1411ULL,0xb5c4eb2f2fb55ec4ULL,0x091b150e0e091c1bULL,0x365a7e242436485aULL,0x9bb6ad1b1b9b36b6ULL,0x3d4798dfdf3da547ULL,0x266aa7cdcd26816aULL,0x69bbf54e4e699cbbULL,0xcd4c337f7fcdfe4cULL,0x9fba50eaea9fcfbaULL,0x1b2d3f12121b242dULL,0x9eb9a41d1d9e3ab9ULL,0x749cc4585874b09cULL,0x2e724634342e6872ULL,0x2d774136362d6c77ULL,0xb2cd11dcdcb2a3cdULL,0xee299db4b4ee7329ULL,0xfb164d5b5bfbb616ULL,0xf601a5a4a4f65301ULL,0x4dd7a176764decd7ULL,0x61a314b7b76175a3ULL,0xce49347d7dcefa49ULL,0x7b8ddf52527ba48dULL,0x3e429fdddd3ea142ULL,0x7193cd5e5e71bc93ULL,0x97a2b113139726a2ULL,0xf504a2a6a6f55704ULL,0x68b801b9b96869b8ULL,0x0000000000000000ULL,0x2c74b5c1c12c9974ULL,0x60a0e040406080a0ULL,0x1f21c2e3e31fdd21ULL,0xc8433a7979c8f243ULL,0xed2c9ab6b6ed772cULL,0xbed90dd4d4beb3d9ULL,0x46ca478d8d4601caULL,0xd970176767d9ce70ULL,0x4bddaf72724be4ddULL,0xde79ed9494de3379ULL,0xd467ff9898d42b67ULL,0xe82393b0b0e87b23ULL,0x4ade5b85854a11deULL,0x6bbd06bbbb6b6dbdULL,0x2a7ebbc5c52a917eULL,0xe5347b4f4fe59e34ULL,0x163ad7eded16c13aULL,0xc554d28686c51754ULL,0xd762f89a9ad72f62ULL,0x55ff99666655ccffULL,0x94a7b611119422a7ULL,0xcf4ac08a8acf0f4aULL,0x1030d9e9e910c930ULL,0x060a0e040406080aULL,0x819866fefe81e798ULL,0xf00baba0a0f05b0bULL,0x44ccb4787844f0ccULL,0xbad5f02525ba4ad5ULL,0xe33e754b4be3963eULL,0xf30eaca2a2f35f0eULL,0xfe19445d5dfeba19ULL,0xc05bdb8080c01b5bULL,0x8a858005058a0a85ULL,0xadecd33f3fad7eecULL,0xbcdffe2121bc42dfULL,0x48d8a8707048e0d8ULL,0x040cfdf1f104f90cULL,0xdf7a196363dfc67aULL,0xc1582f7777c1ee58ULL,0x759f30afaf75459fULL,0x63a5e742426384a5ULL,0x3050702020304050ULL,0x1a2ecbe5e51ad12eULL,0x0e12effdfd0ee112ULL,0x6db708bfbf6d65b7ULL,0x4cd45581814c19d4ULL,0x143c24181814303cULL,0x355f792626354c5fULL,0x2f71b2c3c32f9d71ULL,0xe13886bebee16738ULL,0xa2fdc83535a26afdULL,0xcc4fc78888cc0b4fULL,0x394b652e2e395c4bULL,0x57f96a9393573df9ULL,0xf20d585555f2aa0dULL,0x829d61fcfc82e39dULL,0x47c9b37a7a47f4c9ULL,0xacef27c8c8ac8befULL,0xe73288babae76f32ULL,0x2b7d4f32322b647dULL,0x95a442e6e695d7a4ULL,0xa0fb3bc0c0a09bfbULL,0x98b3aa19199832b3ULL,0xd168f69e9ed12768ULL,0x7f8122a3a37f5d81ULL,0x66aaee44446688aaULL,0x7e82d654547ea882ULL,0xabe6dd3b3bab76e6ULL,0x839e950b0b83169eULL,0xca45c98c8cca0345ULL,0x297bbcc7c729957bULL,0xd36e056b6bd3d66eULL,0x3c446c28283c5044ULL,0x798b2ca7a779558bULL,0xe23d81bcbce2633dULL,0x1d273116161d2c27ULL,0x769a37adad76419aULL,0x3b4d96dbdb3bad4dULL,0x56fa9e646456c8faULL,0x4ed2a674744ee8d2ULL,0x1e223614141e2822ULL,0xdb76e49292db3f76ULL,0x0a1e120c0c0a181eULL,0x6cb4fc48486c90b4ULL,0xe4378fb8b8e46b37ULL,0x5de7789f9f5d25e7ULL,0x6eb20fbdbd6e61b2ULL,0xef2a694343ef862aULL,0xa6f135c4c4a693f1ULL,0xa8e3da3939a872e3ULL,0xa4f7c63131a462f7ULL,0x37598ad3d337bd59ULL,0x8b8674f2f28bff86ULL,0x325683d5d532b156ULL,0x43c54e8b8b430dc5ULL,0x59eb856e6e59dcebULL,0xb7c218dadab7afc2ULL,0x8c8f8e01018c028fULL,0x64ac1db1b16479acULL,0xd26df19c9cd2236dULL,0xe03b724949e0923bULL,0xb4c71fd8d8b4abc7ULL,0xfa15b9acacfa4315ULL,0x0709faf3f307fd09ULL,0x256fa0cfcf25856fULL,0xafea20cacaaf8feaULL,0x8e897df4f48ef389ULL,0xe920674747e98e20ULL,0x1828381010182028ULL,0xd5640b6f6fd5de64ULL,0x888373f0f088fb83ULL,0x6fb1fb4a4a6f94b1ULL,0x7296ca5c5c72b896ULL,0x246c54383824706cULL,0xf1085f5757f1ae08ULL,0xc752217373c7e652ULL,0x51f36497975135f3ULL,0x2365aecbcb238d65ULL,0x7c8425a1a17c5984ULL,0x9cbf57e8e89ccbbfULL,0x21635d3e3e217c63ULL,0xdd7cea9696dd377cULL,0xdc7f1e6161dcc27fULL,0x86919c0d0d861a91ULL,0x85949b0f0f851e94ULL,0x90ab4be0e090dbabULL,0x42c6ba7c7c42f8c6ULL,0xc457267171c4e257ULL,0xaae529ccccaa83e5ULL,0xd873e39090d83b73ULL,0x050f090606050c0fULL,0x0103f4f7f701f503ULL,0x12362a1c1c123836ULL,0xa3fe3cc2c2a39ffeULL,0x5fe18b6a6a5fd4e1ULL,0xf910beaeaef94710ULL,0xd06b026969d0d26bULL,0x91a8bf1717912ea8ULL,0x58e87199995829e8ULL,0x2769533a3a277469ULL,0xb9d0f72727b94ed0ULL,0x384891d9d938a948ULL,0x1335deebeb13cd35ULL,0xb3cee52b2bb356ceULL,0x3355772222334455ULL,0xbbd604d2d2bbbfd6ULL,0x709039a9a9704990ULL,0x8980870707890e80ULL,0xa7f2c13333a766f2ULL,0xb6c1ec2d2db65ac1ULL,0x22665a3c3c227866ULL,0x92adb81515922aadULL,0x2060a9c9c9208960ULL,0x49db5c87874915dbULL,0xff1ab0aaaaff4f1aULL,0x7888d8505078a088ULL,0x7a8e2ba5a57a518eULL,0x8f8a8903038f068aULL,0xf8134a5959f8b213ULL,0x809b92090980129bULL,0x1739231a1a173439ULL,0xda75106565daca75ULL,0x315384d7d731b553ULL,0xc651d58484c61351ULL,0xb8d303d0d0b8bbd3ULL,0xc35edc8282c31f5eULL,0xb0cbe22929b052cbULL,0x7799c35a5a77b499ULL,0x11332d1e1e113c33ULL,0xcb463d7b7bcbf646ULL,0xfc1fb7a8a8fc4b1fULL,0xd6610c6d6dd6da61ULL,0x3a4e622c2c3a584eULL,
+0xf432c6c6a597f4a5ULL,0x976ff8f884eb9784ULL,0xb05eeeee99c7b099ULL,0x8c7af6f68df78c8dULL,0x17e8ffff0de5170dULL,0xdc0ad6d6bdb7dcbdULL,0xc816dedeb1a7c8b1ULL,0xfc6d91915439fc54ULL,0xf090606050c0f050ULL,0x0507020203040503ULL,0xe02ececea987e0a9ULL,0x87d156567dac877dULL,0x2bcce7e719d52b19ULL,0xa613b5b56271a662ULL,0x317c4d4de69a31e6ULL,0xb559ecec9ac3b59aULL,0xcf408f8f4505cf45ULL,0xbca31f1f9d3ebc9dULL,0xc04989894009c040ULL,0x9268fafa87ef9287ULL,0x3fd0efef15c53f15ULL,0x2694b2b2eb7f26ebULL,0x40ce8e8ec90740c9ULL,0x1de6fbfb0bed1d0bULL,0x2f6e4141ec822fecULL,0xa91ab3b3677da967ULL,0x1c435f5ffdbe1cfdULL,0x25604545ea8a25eaULL,0xdaf92323bf46dabfULL,0x02515353f7a602f7ULL,0xa145e4e496d3a196ULL,0xed769b9b5b2ded5bULL,0x5d287575c2ea5dc2ULL,0x24c5e1e11cd9241cULL,0xe9d43d3dae7ae9aeULL,0xbef24c4c6a98be6aULL,0xee826c6c5ad8ee5aULL,0xc3bd7e7e41fcc341ULL,0x06f3f5f502f10602ULL,0xd15283834f1dd14fULL,0xe48c68685cd0e45cULL,0x07565151f4a207f4ULL,0x5c8dd1d134b95c34ULL,0x18e1f9f908e91808ULL,0xae4ce2e293dfae93ULL,0x953eabab734d9573ULL,0xf597626253c4f553ULL,0x416b2a2a3f54413fULL,0x141c08080c10140cULL,0xf66395955231f652ULL,0xafe94646658caf65ULL,0xe27f9d9d5e21e25eULL,0x7848303028607828ULL,0xf8cf3737a16ef8a1ULL,0x111b0a0a0f14110fULL,0xc4eb2f2fb55ec4b5ULL,0x1b150e0e091c1b09ULL,0x5a7e242436485a36ULL,0xb6ad1b1b9b36b69bULL,0x4798dfdf3da5473dULL,0x6aa7cdcd26816a26ULL,0xbbf54e4e699cbb69ULL,0x4c337f7fcdfe4ccdULL,0xba50eaea9fcfba9fULL,0x2d3f12121b242d1bULL,0xb9a41d1d9e3ab99eULL,0x9cc4585874b09c74ULL,0x724634342e68722eULL,0x774136362d6c772dULL,0xcd11dcdcb2a3cdb2ULL,0x299db4b4ee7329eeULL,0x164d5b5bfbb616fbULL,0x01a5a4a4f65301f6ULL,0xd7a176764decd74dULL,0xa314b7b76175a361ULL,0x49347d7dcefa49ceULL,0x8ddf52527ba48d7bULL,0x429fdddd3ea1423eULL,0x93cd5e5e71bc9371ULL,0xa2b113139726a297ULL,0x04a2a6a6f55704f5ULL,0xb801b9b96869b868ULL,0x0000000000000000ULL,0x74b5c1c12c99742cULL,0xa0e040406080a060ULL,0x21c2e3e31fdd211fULL,0x433a7979c8f243c8ULL,0x2c9ab6b6ed772cedULL,0xd90dd4d4beb3d9beULL,0xca478d8d4601ca46ULL,0x70176767d9ce70d9ULL,0xddaf72724be4dd4bULL,0x79ed9494de3379deULL,0x67ff9898d42b67d4ULL,0x2393b0b0e87b23e8ULL,0xde5b85854a11de4aULL,0xbd06bbbb6b6dbd6bULL,0x7ebbc5c52a917e2aULL,0x347b4f4fe59e34e5ULL,0x3ad7eded16c13a16ULL,0x54d28686c51754c5ULL,0x62f89a9ad72f62d7ULL,0xff99666655ccff55ULL,0xa7b611119422a794ULL,0x4ac08a8acf0f4acfULL,0x30d9e9e910c93010ULL,0x0a0e040406080a06ULL,0x9866fefe81e79881ULL,0x0baba0a0f05b0bf0ULL,0xccb4787844f0cc44ULL,0xd5f02525ba4ad5baULL,0x3e754b4be3963ee3ULL,0x0eaca2a2f35f0ef3ULL,0x19445d5dfeba19feULL,0x5bdb8080c01b5bc0ULL,0x858005058a0a858aULL,0xecd33f3fad7eecadULL,0xdffe2121bc42dfbcULL,0xd8a8707048e0d848ULL,0x0cfdf1f104f90c04ULL,0x7a196363dfc67adfULL,0x582f7777c1ee58c1ULL,0x9f30afaf75459f75ULL,0xa5e742426384a563ULL,0x5070202030405030ULL,0x2ecbe5e51ad12e1aULL,0x12effdfd0ee1120eULL,0xb708bfbf6d65b76dULL,0xd45581814c19d44cULL,0x3c24181814303c14ULL,0x5f792626354c5f35ULL,0x71b2c3c32f9d712fULL,0x3886bebee16738e1ULL,0xfdc83535a26afda2ULL,0x4fc78888cc0b4fccULL,0x4b652e2e395c4b39ULL,0xf96a9393573df957ULL,0x0d585555f2aa0df2ULL,0x9d61fcfc82e39d82ULL,0xc9b37a7a47f4c947ULL,0xef27c8c8ac8befacULL,0x3288babae76f32e7ULL,0x7d4f32322b647d2bULL,0xa442e6e695d7a495ULL,0xfb3bc0c0a09bfba0ULL,0xb3aa19199832b398ULL,0x68f69e9ed12768d1ULL,0x8122a3a37f5d817fULL,0xaaee44446688aa66ULL,0x82d654547ea8827eULL,0xe6dd3b3bab76e6abULL,0x9e950b0b83169e83ULL,0x45c98c8cca0345caULL,0x7bbcc7c729957b29ULL,0x6e056b6bd3d66ed3ULL,0x446c28283c50443cULL,0x8b2ca7a779558b79ULL,0x3d81bcbce2633de2ULL,0x273116161d2c271dULL,0x9a37adad76419a76ULL,0x4d96dbdb3bad4d3bULL,0xfa9e646456c8fa56ULL,0xd2a674744ee8d24eULL,0x223614141e28221eULL,0x76e49292db3f76dbULL,0x1e120c0c0a181e0aULL,0xb4fc48486c90b46cULL,0x378fb8b8e46b37e4ULL,0xe7789f9f5d25e75dULL,0xb20fbdbd6e61b26eULL,0x2a694343ef862aefULL,0xf135c4c4a693f1a6ULL,0xe3da3939a872e3a8ULL,0xf7c63131a462f7a4ULL,0x598ad3d337bd5937ULL,0x8674f2f28bff868bULL,0x5683d5d532b15632ULL,0xc54e8b8b430dc543ULL,0xeb856e6e59dceb59ULL,0xc218dadab7afc2b7ULL,0x8f8e01018c028f8cULL,0xac1db1b16479ac64ULL,0x6df19c9cd2236dd2ULL,0x3b724949e0923be0ULL,0xc71fd8d8b4abc7b4ULL,0x15b9acacfa4315faULL,0x09faf3f307fd0907ULL,0x6fa0cfcf25856f25ULL,0xea20cacaaf8feaafULL,0x897df4f48ef3898eULL,0x20674747e98e20e9ULL,0x2838101018202818ULL,0x640b6f6fd5de64d5ULL,0x8373f0f088fb8388ULL,0xb1fb4a4a6f94b16fULL,0x96ca5c5c72b89672ULL,0x6c54383824706c24ULL,0x085f5757f1ae08f1ULL,0x52217373c7e652c7ULL,0xf36497975135f351ULL,0x65aecbcb238d6523ULL,0x8425a1a17c59847cULL,0xbf57e8e89ccbbf9cULL,0x635d3e3e217c6321ULL,0x7cea9696dd377cddULL,0x7f1e6161dcc27fdcULL,0x919c0d0d861a9186ULL,0x949b0f0f851e9485ULL,0xab4be0e090dbab90ULL,0xc6ba7c7c42f8c642ULL,0x57267171c4e257c4ULL,0xe529ccccaa83e5aaULL,0x73e39090d83b73d8ULL,0x0f090606050c0f05ULL,0x03f4f7f701f50301ULL,0x362a1c1c12383612ULL,0xfe3cc2c2a39ffea3ULL,0xe18b6a6a5fd4e15fULL,0x10beaeaef94710f9ULL,0x6b026969d0d26bd0ULL,0xa8bf1717912ea891ULL,0xe87199995829e858ULL,0x69533a3a27746927ULL,0xd0f72727b94ed0b9ULL,0x4891d9d938a94838ULL,0x35deebeb13cd3513ULL,0xcee52b2bb356ceb3ULL,0x5577222233445533ULL,0xd604d2d2bbbfd6bbULL,0x9039a9a970499070ULL,0x80870707890e8089ULL,0xf2c13333a766f2a7ULL,0xc1ec2d2db65ac1b6ULL,0x665a3c3c22786622ULL,0xadb81515922aad92ULL,0x60a9c9c920896020ULL,0xdb5c87874915db49ULL,0x1ab0aaaaff4f1affULL,0x88d8505078a08878ULL,0x8e2ba5a57a518e7aULL,0x8a8903038f068a8fULL,0x134a5959f8b213f8ULL,0x9b92090980129b80ULL,0x39231a1a17343917ULL,0x75106565daca75daULL,0x5384d7d731b55331ULL,0x51d58484c61351c6ULL,0xd303d0d0b8bbd3b8ULL,0x5edc8282c31f5ec3ULL,0xcbe22929b052cbb0ULL,0x99c35a5a77b49977ULL,0x332d1e1e113c3311ULL,0x463d7b7bcbf646cbULL,0x1fb7a8a8fc4b1ffcULL,0x610c6d6dd6da61d6ULL,0x4e622c2c3a584e3aULL,
+0x32c6c6a597f4a5f4ULL,0x6ff8f884eb978497ULL,0x5eeeee99c7b099b0ULL,0x7af6f68df78c8d8cULL,0xe8ffff0de5170d17ULL,0x0ad6d6bdb7dcbddcULL,0x16dedeb1a7c8b1c8ULL,0x6d91915439fc54fcULL,0x90606050c0f050f0ULL,0x0702020304050305ULL,0x2ececea987e0a9e0ULL,0xd156567dac877d87ULL,0xcce7e719d52b192bULL,0x13b5b56271a662a6ULL,0x7c4d4de69a31e631ULL,0x59ecec9ac3b59ab5ULL,0x408f8f4505cf45cfULL,0xa31f1f9d3ebc9dbcULL,0x4989894009c040c0ULL,0x68fafa87ef928792ULL,0xd0efef15c53f153fULL,0x94b2b2eb7f26eb26ULL,0xce8e8ec90740c940ULL,0xe6fbfb0bed1d0b1dULL,0x6e4141ec822fec2fULL,0x1ab3b3677da967a9ULL,0x435f5ffdbe1cfd1cULL,0x604545ea8a25ea25ULL,0xf92323bf46dabfdaULL,0x515353f7a602f702ULL,0x45e4e496d3a196a1ULL,0x769b9b5b2ded5bedULL,0x287575c2ea5dc25dULL,0xc5e1e11cd9241c24ULL,0xd43d3dae7ae9aee9ULL,0xf24c4c6a98be6abeULL,0x826c6c5ad8ee5aeeULL,0xbd7e7e41fcc341c3ULL,0xf3f5f502f1060206ULL,0x5283834f1dd14fd1ULL,0x8c68685cd0e45ce4ULL,0x565151f4a207f407ULL,0x8dd1d134b95c345cULL,0xe1f9f908e9180818ULL,0x4ce2e293dfae93aeULL,0x3eabab734d957395ULL,0x97626253c4f553f5ULL,0x6b2a2a3f54413f41ULL,0x1c08080c10140c14ULL,0x6395955231f652f6ULL,0xe94646658caf65afULL,0x7f9d9d5e21e25ee2ULL,0x4830302860782878ULL,0xcf3737a16ef8a1f8ULL,0x1b0a0a0f14110f11ULL,0xeb2f2fb55ec4b5c4ULL,0x150e0e091c1b091bULL,0x7e242436485a365aULL,0xad1b1b9b36b69bb6ULL,0x98dfdf3da5473d47ULL,0xa7cdcd26816a266aULL,0xf54e4e699cbb69bbULL,0x337f7fcdfe4ccd4cULL,0x50eaea9fcfba9fbaULL,0x3f12121b242d1b2dULL,0xa41d1d9e3ab99eb9ULL,0xc4585874b09c749cULL,0x4634342e68722e72ULL,0x4136362d6c772d77ULL,0x11dcdcb2a3cdb2cdULL,0x9db4b4ee7329ee29ULL,0x4d5b5bfbb616fb16ULL,0xa5a4a4f65301f601ULL,0xa176764decd74dd7ULL,0x14b7b76175a361a3ULL,0x347d7dcefa49ce49ULL,0xdf52527ba48d7b8dULL,0x9fdddd3ea1423e42ULL,0xcd5e5e71bc937193ULL,0xb113139726a297a2ULL,0xa2a6a6f55704f504ULL,0x01b9b96869b868b8ULL,0x0000000000000000ULL,0xb5c1c12c99742c74ULL,0xe040406080a060a0ULL,0xc2e3e31fdd211f21ULL,0x3a7979c8f243c843ULL,0x9ab6b6ed772ced2cULL,0x0dd4d4beb3d9bed9ULL,0x478d8d4601ca46caULL,0x176767d9ce70d970ULL,0xaf72724be4dd4bddULL,0xed9494de3379de79ULL,0xff9898d42b67d467ULL,0x93b0b0e87b23e823ULL,0x5b85854a11de4adeULL,0x06bbbb6b6dbd6bbdULL,0xbbc5c52a917e2a7eULL,0x7b4f4fe59e34e534ULL,0xd7eded16c13a163aULL,0xd28686c51754c554ULL,0xf89a9ad72f62d762ULL,0x99666655ccff55ffULL,0xb611119422a794a7ULL,0xc08a8acf0f4acf4aULL,0xd9e9e910c9301030ULL,0x0e040406080a060aULL,0x66fefe81e7988198ULL,0xaba0a0f05b0bf00bULL,0xb4787844f0cc44ccULL,0xf02525ba4ad5bad5ULL,0x754b4be3963ee33eULL,0xaca2a2f35f0ef30eULL,0x445d5dfeba19fe19ULL,0xdb8080c01b5bc05bULL,0x8005058a0a858a85ULL,0xd33f3fad7eecadecULL,0xfe2121bc42dfbcdfULL,0xa8707048e0d848d8ULL,0xfdf1f104f90c040cULL,0x196363dfc67adf7aULL,0x2f7777c1ee58c158ULL,0x30afaf75459f759fULL,0xe742426384a563a5ULL,0x7020203040503050ULL,0xcbe5e51ad12e1a2eULL,0xeffdfd0ee1120e12ULL,0x08bfbf6d65b76db7ULL,0x5581814c19d44cd4ULL,0x24181814303c143cULL,0x792626354c5f355fULL,0xb2c3c32f9d712f71ULL,0x86bebee16738e138ULL,0xc83535a26afda2fdULL,0xc78888cc0b4fcc4fULL,0x652e2e395c4b394bULL,0x6a9393573df957f9ULL,0x585555f2aa0df20dULL,0x61fcfc82e39d829dULL,0xb37a7a47f4c947c9ULL,0x27c8c8ac8befacefULL,0x88babae76f32e732ULL,0x4f32322b647d2b7dULL,0x42e6e695d7a495a4ULL,0x3bc0c0a09bfba0fbULL,0xaa19199832b398b3ULL,0xf69e9ed12768d168ULL,0x22a3a37f5d817f81ULL,0xee44446688aa66aaULL,0xd654547ea8827e82ULL,0xdd3b3bab76e6abe6ULL,0x950b0b83169e839eULL,0xc98c8cca0345ca45ULL,0xbcc7c729957b297bULL,0x056b6bd3d66ed36eULL,0x6c28283c50443c44ULL,0x2ca7a779558b798bULL,0x81bcbce2633de23dULL,0x3116161d2c271d27ULL,0x37adad76419a769aULL,0x96dbdb3bad4d3b4dULL,0x9e646456c8fa56faULL,0xa674744ee8d24ed2ULL,0x3614141e28221e22ULL,0xe49292db3f76db76ULL,0x120c0c0a181e0a1eULL,0xfc48486c90b46cb4ULL,0x8fb8b8e46b37e437ULL,0x789f9f5d25e75de7ULL,0x0fbdbd6e61b26eb2ULL,0x694343ef862aef2aULL,0x35c4c4a693f1a6f1ULL,0xda3939a872e3a8e3ULL,0xc63131a462f7a4f7ULL,0x8ad3d337bd593759ULL,0x74f2f28bff868b86ULL,0x83d5d532b1563256ULL,0x4e8b8b430dc543c5ULL,0x856e6e59dceb59ebULL,0x18dadab7afc2b7c2ULL,0x8e01018c028f8c8fULL,0x1db1b16479ac64acULL,0xf19c9cd2236dd26dULL,0x724949e0923be03bULL,0x1fd8d8b4abc7b4c7ULL,0xb9acacfa4315fa15ULL,0xfaf3f307fd090709ULL,0xa0cfcf25856f256fULL,0x20cacaaf8feaafeaULL,0x7df4f48ef3898e89ULL,0x674747e98e20e920ULL,0x3810101820281828ULL,0x0b6f6fd5de64d564ULL,0x73f0f088fb838883ULL,0xfb4a4a6f94b16fb1ULL,0xca5c5c72b8967296ULL,0x54383824706c246cULL,0x5f5757f1ae08f108ULL,0x217373c7e652c752ULL,0x6497975135f351f3ULL,0xaecbcb238d652365ULL,0x25a1a17c59847c84ULL,0x57e8e89ccbbf9cbfULL,0x5d3e3e217c632163ULL,0xea9696dd377cdd7cULL,0x1e6161dcc27fdc7fULL,0x9c0d0d861a918691ULL,0x9b0f0f851e948594ULL,0x4be0e090dbab90abULL,0xba7c7c42f8c642c6ULL,0x267171c4e257c457ULL,0x29ccccaa83e5aae5ULL,0xe39090d83b73d873ULL,0x090606050c0f050fULL,0xf4f7f701f5030103ULL,0x2a1c1c1238361236ULL,0x3cc2c2a39ffea3feULL,0x8b6a6a5fd4e15fe1ULL,0xbeaeaef94710f910ULL,0x026969d0d26bd06bULL,0xbf1717912ea891a8ULL,0x7199995829e858e8ULL,0x533a3a2774692769ULL,0xf72727b94ed0b9d0ULL,0x91d9d938a9483848ULL,0xdeebeb13cd351335ULL,0xe52b2bb356ceb3ceULL,0x7722223344553355ULL,0x04d2d2bbbfd6bbd6ULL,0x39a9a97049907090ULL,0x870707890e808980ULL,0xc13333a766f2a7f2ULL,0xec2d2db65ac1b6c1ULL,0x5a3c3c2278662266ULL,0xb81515922aad92adULL,0xa9c9c92089602060ULL,0x5c87874915db49dbULL,0xb0aaaaff4f1aff1aULL,0xd8505078a0887888ULL,0x2ba5a57a518e7a8eULL,0x8903038f068a8f8aULL,0x4a5959f8b213f813ULL,0x92090980129b809bULL,0x231a1a1734391739ULL,0x106565daca75da75ULL,0x84d7d731b5533153ULL,0xd58484c61351c651ULL,0x03d0d0b8bbd3b8d3ULL,0xdc8282c31f5ec35eULL,0xe22929b052cbb0cbULL,0xc35a5a77b4997799ULL,0x2d1e1e113c331133ULL,0x3d7b7bcbf646cb46ULL,0xb7a8a8fc4b1ffc1fULL,0x0c6d6dd6da61d661ULL,0x622c2c3a584e3a4eULL,
+0xc6c6a597f4a5f432ULL,0xf8f884eb9784976fULL,0xeeee99c7b099b05eULL,0xf6f68df78c8d8c7aULL,0xffff0de5170d17e8ULL,0xd6d6bdb7dcbddc0aULL,0xdedeb1a7c8b1c816ULL,0x91915439fc54fc6dULL,0x606050c0f050f090ULL,0x0202030405030507ULL,0xcecea987e0a9e02eULL,0x56567dac877d87d1ULL,0xe7e719d52b192bccULL,0xb5b56271a662a613ULL,0x4d4de69a31e6317cULL,0xecec9ac3b59ab559ULL,0x8f8f4505cf45cf40ULL,0x1f1f9d3ebc9dbca3ULL,0x89894009c040c049ULL,0xfafa87ef92879268ULL,0xefef15c53f153fd0ULL,0xb2b2eb7f26eb2694ULL,0x8e8ec90740c940ceULL,0xfbfb0bed1d0b1de6ULL,0x4141ec822fec2f6eULL,0xb3b3677da967a91aULL,0x5f5ffdbe1cfd1c43ULL,0x4545ea8a25ea2560ULL,0x2323bf46dabfdaf9ULL,0x5353f7a602f70251ULL,0xe4e496d3a196a145ULL,0x9b9b5b2ded5bed76ULL,0x7575c2ea5dc25d28ULL,0xe1e11cd9241c24c5ULL,0x3d3dae7ae9aee9d4ULL,0x4c4c6a98be6abef2ULL,0x6c6c5ad8ee5aee82ULL,0x7e7e41fcc341c3bdULL,0xf5f502f1060206f3ULL,0x83834f1dd14fd152ULL,0x68685cd0e45ce48cULL,0x5151f4a207f40756ULL,0xd1d134b95c345c8dULL,0xf9f908e9180818e1ULL,0xe2e293dfae93ae4cULL,0xabab734d9573953eULL,0x626253c4f553f597ULL,0x2a2a3f54413f416bULL,0x08080c10140c141cULL,0x95955231f652f663ULL,0x4646658caf65afe9ULL,0x9d9d5e21e25ee27fULL,0x3030286078287848ULL,0x3737a16ef8a1f8cfULL,0x0a0a0f14110f111bULL,0x2f2fb55ec4b5c4ebULL,0x0e0e091c1b091b15ULL,0x242436485a365a7eULL,0x1b1b9b36b69bb6adULL,0xdfdf3da5473d4798ULL,0xcdcd26816a266aa7ULL,0x4e4e699cbb69bbf5ULL,0x7f7fcdfe4ccd4c33ULL,0xeaea9fcfba9fba50ULL,0x12121b242d1b2d3fULL,0x1d1d9e3ab99eb9a4ULL,0x585874b09c749cc4ULL,0x34342e68722e7246ULL,0x36362d6c772d7741ULL,0xdcdcb2a3cdb2cd11ULL,0xb4b4ee7329ee299dULL,0x5b5bfbb616fb164dULL,0xa4a4f65301f601a5ULL,0x76764decd74dd7a1ULL,0xb7b76175a361a314ULL,0x7d7dcefa49ce4934ULL,0x52527ba48d7b8ddfULL,0xdddd3ea1423e429fULL,0x5e5e71bc937193cdULL,0x13139726a297a2b1ULL,0xa6a6f55704f504a2ULL,0xb9b96869b868b801ULL,0x0000000000000000ULL,0xc1c12c99742c74b5ULL,0x40406080a060a0e0ULL,0xe3e31fdd211f21c2ULL,0x7979c8f243c8433aULL,0xb6b6ed772ced2c9aULL,0xd4d4beb3d9bed90dULL,0x8d8d4601ca46ca47ULL,0x6767d9ce70d97017ULL,0x72724be4dd4bddafULL,0x9494de3379de79edULL,0x9898d42b67d467ffULL,0xb0b0e87b23e82393ULL,0x85854a11de4ade5bULL,0xbbbb6b6dbd6bbd06ULL,0xc5c52a917e2a7ebbULL,0x4f4fe59e34e5347bULL,0xeded16c13a163ad7ULL,0x8686c51754c554d2ULL,0x9a9ad72f62d762f8ULL,0x666655ccff55ff99ULL,0x11119422a794a7b6ULL,0x8a8acf0f4acf4ac0ULL,0xe9e910c9301030d9ULL,0x040406080a060a0eULL,0xfefe81e798819866ULL,0xa0a0f05b0bf00babULL,0x787844f0cc44ccb4ULL,0x2525ba4ad5bad5f0ULL,0x4b4be3963ee33e75ULL,0xa2a2f35f0ef30eacULL,0x5d5dfeba19fe1944ULL,0x8080c01b5bc05bdbULL,0x05058a0a858a8580ULL,0x3f3fad7eecadecd3ULL,0x2121bc42dfbcdffeULL,0x707048e0d848d8a8ULL,0xf1f104f90c040cfdULL,0x6363dfc67adf7a19ULL,0x7777c1ee58c1582fULL,0xafaf75459f759f30ULL,0x42426384a563a5e7ULL,0x2020304050305070ULL,0xe5e51ad12e1a2ecbULL,0xfdfd0ee1120e12efULL,0xbfbf6d65b76db708ULL,0x81814c19d44cd455ULL,0x181814303c143c24ULL,0x2626354c5f355f79ULL,0xc3c32f9d712f71b2ULL,0xbebee16738e13886ULL,0x3535a26afda2fdc8ULL,0x8888cc0b4fcc4fc7ULL,0x2e2e395c4b394b65ULL,0x9393573df957f96aULL,0x5555f2aa0df20d58ULL,0xfcfc82e39d829d61ULL,0x7a7a47f4c947c9b3ULL,0xc8c8ac8befacef27ULL,0xbabae76f32e73288ULL,0x32322b647d2b7d4fULL,0xe6e695d7a495a442ULL,0xc0c0a09bfba0fb3bULL,0x19199832b398b3aaULL,0x9e9ed12768d168f6ULL,0xa3a37f5d817f8122ULL,0x44446688aa66aaeeULL,0x54547ea8827e82d6ULL,0x3b3bab76e6abe6ddULL,0x0b0b83169e839e95ULL,0x8c8cca0345ca45c9ULL,0xc7c729957b297bbcULL,0x6b6bd3d66ed36e05ULL,0x28283c50443c446cULL,0xa7a779558b798b2cULL,0xbcbce2633de23d81ULL,0x16161d2c271d2731ULL,0xadad76419a769a37ULL,0xdbdb3bad4d3b4d96ULL,0x646456c8fa56fa9eULL,0x74744ee8d24ed2a6ULL,0x14141e28221e2236ULL,0x9292db3f76db76e4ULL,0x0c0c0a181e0a1e12ULL,0x48486c90b46cb4fcULL,0xb8b8e46b37e4378fULL,0x9f9f5d25e75de778ULL,0xbdbd6e61b26eb20fULL,0x4343ef862aef2a69ULL,0xc4c4a693f1a6f135ULL,0x3939a872e3a8e3daULL,0x3131a462f7a4f7c6ULL,0xd3d337bd5937598aULL,0xf2f28bff868b8674ULL,0xd5d532b156325683ULL,0x8b8b430dc543c54eULL,0x6e6e59dceb59eb85ULL,0xdadab7afc2b7c218ULL,0x01018c028f8c8f8eULL,0xb1b16479ac64ac1dULL,0x9c9cd2236dd26df1ULL,0x4949e0923be03b72ULL,0xd8d8b4abc7b4c71fULL,0xacacfa4315fa15b9ULL,0xf3f307fd090709faULL,0xcfcf25856f256fa0ULL,0xcacaaf8feaafea20ULL,0xf4f48ef3898e897dULL,0x4747e98e20e92067ULL,0x1010182028182838ULL,0x6f6fd5de64d5640bULL,0xf0f088fb83888373ULL,0x4a4a6f94b16fb1fbULL,0x5c5c72b8967296caULL,0x383824706c246c54ULL,0x5757f1ae08f1085fULL,0x7373c7e652c75221ULL,0x97975135f351f364ULL,0xcbcb238d652365aeULL,0xa1a17c59847c8425ULL,0xe8e89ccbbf9cbf57ULL,0x3e3e217c6321635dULL,0x9696dd377cdd7ceaULL,0x6161dcc27fdc7f1eULL,0x0d0d861a9186919cULL,0x0f0f851e9485949bULL,0xe0e090dbab90ab4bULL,0x7c7c42f8c642c6baULL,0x7171c4e257c45726ULL,0xccccaa83e5aae529ULL,0x9090d83b73d873e3ULL,0x0606050c0f050f09ULL,0xf7f701f5030103f4ULL,0x1c1c12383612362aULL,0xc2c2a39ffea3fe3cULL,0x6a6a5fd4e15fe18bULL,0xaeaef94710f910beULL,0x6969d0d26bd06b02ULL,0x1717912ea891a8bfULL,0x99995829e858e871ULL,0x3a3a277469276953ULL,0x2727b94ed0b9d0f7ULL,0xd9d938a948384891ULL,0xebeb13cd351335deULL,0x2b2bb356ceb3cee5ULL,0x2222334455335577ULL,0xd2d2bbbfd6bbd604ULL,0xa9a9704990709039ULL,0x0707890e80898087ULL,0x3333a766f2a7f2c1ULL,0x2d2db65ac1b6c1ecULL,0x3c3c22786622665aULL,0x1515922aad92adb8ULL,0xc9c92089602060a9ULL,0x87874915db49db5cULL,0xaaaaff4f1aff1ab0ULL,0x505078a0887888d8ULL,0xa5a57a518e7a8e2bULL,0x03038f068a8f8a89ULL,0x5959f8b213f8134aULL,0x090980129b809b92ULL,0x1a1a173439173923ULL,0x6565daca75da7510ULL,0xd7d731b553315384ULL,0x8484c61351c651d5ULL,0xd0d0b8bbd3b8d303ULL,0x8282c31f5ec35edcULL,0x2929b052cbb0cbe2ULL,0x5a5a77b4997799c3ULL,0x1e1e113c3311332dULL,0x7b7bcbf646cb463dULL,0xa8a8fc4b1ffc1fb7ULL,0x6d6dd6da61d6610cULL,0x2c2c3a584e3a4e62ULL};
 #endif /* IS_LITTLE_ENDIAN */
 
 #endif /* __tables_h */
@@ -153,4 +153,8 @@ int Hamsi::Hash(int hashbitlen, const BitSequence* data, DataLength databitlen,
     else return Hamsi::Final(hashval);
 }
 
+std::size_t Hamsi::UpdateBytes(int hashbitlen) const {
+	return hashbitlen <= 256 ? 4 : 8;
+}
+
 } // namespace sha3
@@ -89,145 +89,153 @@ const unsigned char JH_E8_bitslice_roundconstant[42][32]={
       m1 ^= (temp0 & (m0));        \
       m2 ^= temp0;
 
-/*The bijective function E8, in bitslice form*/
+/*The bijective function E8, in bitslice form; the state is kept in a local copy so
+  that each row (4 words) can live in a register across all rounds*/
 void JH::E8() {
     jh_uint32 i, j, roundnumber, temp0;
+    jh_uint32 x[8][4];
+
+    memcpy(x, jhState.x, sizeof(x));
 
     /*perform 42 rounds*/
     for (roundnumber = 0; roundnumber < jhNumRounds; roundnumber = roundnumber + 7) {
         /*round 7*roundnumber+0: Sbox, MDS and swapping layer*/
         if(jhNumRounds >= roundnumber + 1) {
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
-                JH_SWAP1(jhState.x[1][i]);
-                JH_SWAP1(jhState.x[3][i]);
-                JH_SWAP1(jhState.x[5][i]);
-                JH_SWAP1(jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
+                JH_SWAP1(x[1][i]);
+                JH_SWAP1(x[3][i]);
+                JH_SWAP1(x[5][i]);
+                JH_SWAP1(x[7][i]);
             }
         }
 
         if(jhNumRounds >= roundnumber + 2) {
             /*round 7*roundnumber+1: Sbox, MDS and swapping layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 1])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 1])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
-                JH_SWAP2(jhState.x[1][i]);
-                JH_SWAP2(jhState.x[3][i]);
-                JH_SWAP2(jhState.x[5][i]);
-                JH_SWAP2(jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
+                JH_SWAP2(x[1][i]);
+                JH_SWAP2(x[3][i]);
+                JH_SWAP2(x[5][i]);
+                JH_SWAP2(x[7][i]);
             }
         }
 
         if(jhNumRounds >= roundnumber + 3) {
             /*round 7*roundnumber+2: Sbox, MDS and swapping layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 2])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 2])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
-                JH_SWAP4(jhState.x[1][i]);
-                JH_SWAP4(jhState.x[3][i]);
-                JH_SWAP4(jhState.x[5][i]);
-                JH_SWAP4(jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
+                JH_SWAP4(x[1][i]);
+                JH_SWAP4(x[3][i]);
+                JH_SWAP4(x[5][i]);
+                JH_SWAP4(x[7][i]);
             }
         }
 
         if(jhNumRounds >= roundnumber + 4) {
             /*round 7*roundnumber+3: Sbox, MDS and swapping layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 3])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 3])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
-                JH_SWAP8(jhState.x[1][i]);
-                JH_SWAP8(jhState.x[3][i]);
-                JH_SWAP8(jhState.x[5][i]);
-                JH_SWAP8(jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
+                JH_SWAP8(x[1][i]);
+                JH_SWAP8(x[3][i]);
+                JH_SWAP8(x[5][i]);
+                JH_SWAP8(x[7][i]);
             }
         }
 
         if(jhNumRounds >= roundnumber + 5) {
             /*round 7*roundnumber+4: Sbox, MDS and swapping layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 4])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 4])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
-                JH_SWAP16(jhState.x[1][i]);
-                JH_SWAP16(jhState.x[3][i]);
-                JH_SWAP16(jhState.x[5][i]);
-                JH_SWAP16(jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
+                JH_SWAP16(x[1][i]);
+                JH_SWAP16(x[3][i]);
+                JH_SWAP16(x[5][i]);
+                JH_SWAP16(x[7][i]);
             }
         }
 
         if(jhNumRounds >= roundnumber + 6) {
             /*round 7*roundnumber+5: Sbox and MDS layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 5])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 5])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
             }
             /*round 7*roundnumber+5: swapping layer*/
             for (j = 1; j < 8; j = j + 2)
                 for (i = 0; i < 4; i = i + 2) {
-                    temp0 = jhState.x[j][i];
-                    jhState.x[j][i] = jhState.x[j][i + 1];
-                    jhState.x[j][i + 1] = temp0;
+                    temp0 = x[j][i];
+                    x[j][i] = x[j][i + 1];
+                    x[j][i + 1] = temp0;
                 }
         }
 
         if(jhNumRounds >= roundnumber + 7) {
             /*round 7*roundnumber+6: Sbox and MDS layer*/
             for (i = 0; i < 4; i++) {
-                JH_Sbox(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i],
+                JH_Sbox(x[0][i], x[2][i], x[4][i], x[6][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 6])[i]);
-                JH_Sbox(jhState.x[1][i], jhState.x[3][i], jhState.x[5][i], jhState.x[7][i],
+                JH_Sbox(x[1][i], x[3][i], x[5][i], x[7][i],
                         ((jh_uint32*) JH_E8_bitslice_roundconstant[roundnumber + 6])[i + 4]);
-                JH_L(jhState.x[0][i], jhState.x[2][i], jhState.x[4][i], jhState.x[6][i], jhState.x[1][i],
-                     jhState.x[3][i], jhState.x[5][i], jhState.x[7][i]);
+                JH_L(x[0][i], x[2][i], x[4][i], x[6][i], x[1][i],
+                     x[3][i], x[5][i], x[7][i]);
             }
             /*round 7*roundnumber+6: swapping layer*/
             for (j = 1; j < 8; j = j + 2)
                 for (i = 0; i < 2; i++) {
-                    temp0 = jhState.x[j][i];
-                    jhState.x[j][i] = jhState.x[j][i + 2];
-                    jhState.x[j][i + 2] = temp0;
+                    temp0 = x[j][i];
+                    x[j][i] = x[j][i + 2];
+                    x[j][i + 2] = temp0;
                 }
         }
     }
 
+    memcpy(jhState.x, x, sizeof(x));
 }
 
-/* the compresssion function F8 */
-void JH::F8() {
+/* the compresssion function F8, the 512-bit message block is read directly from the input */
+void JH::F8(const BitSequence *block) {
     jh_uint32 i;
+    jh_uint32 m[16];
+
+    memcpy(m, block, 64);
 
     /*xor the 512-bit message with the first half of the 1024-bit hash state*/
-    for (i = 0; i < 16; i++) jhState.x[i >> 2][i & 3] ^= ((jh_uint32*) jhState.buffer)[i];
+    for (i = 0; i < 16; i++) jhState.x[i >> 2][i & 3] ^= m[i];
 
     /*perform 42 rounds*/
     JH::E8();
 
     /*xor the 512-bit message with the second half of the 1024-bit hash state*/
-    for (i = 0; i < 16; i++) jhState.x[(i + 16) >> 2][i & 3] ^= ((jh_uint32*) jhState.buffer)[i];
+    for (i = 0; i < 16; i++) jhState.x[(i + 16) >> 2][i & 3] ^= m[i];
 }
 
 /*before hashing a message, initialize the hash state as H0 */
@@ -284,14 +292,13 @@ int JH::Update(const BitSequence* data, DataLength databitlen) {
         memcpy(jhState.buffer + (jhState.datasize_in_buffer >> 3), data, 64 - (jhState.datasize_in_buffer >> 3));
         index = 64 - (jhState.datasize_in_buffer >> 3);
         databitlen = databitlen - (512 - jhState.datasize_in_buffer);
-        JH::F8();
+        JH::F8(jhState.buffer);
         jhState.datasize_in_buffer = 0;
     }
 
     /*hash the remaining full message blocks*/
     for (; databitlen >= 512; index = index + 64, databitlen = databitlen - 512) {
-        memcpy(jhState.buffer, data + index, 64);
-        JH::F8();
+        JH::F8(data + index);
     }
 
     /*store the partial block into buffer, assume that -- if part of the last byte is not part of the message, then that part consists of 0 bits*/
@@ -322,7 +329,7 @@ int JH::Final(BitSequence* hashval) {
         jhState.buffer[58] = (jhState.databitlen >> 40) & 0xff;
         jhState.buffer[57] = (jhState.databitlen >> 48) & 0xff;
         jhState.buffer[56] = (jhState.databitlen >> 56) & 0xff;
-        JH::F8();
+        JH::F8(jhState.buffer);
     } else {
         /*set the rest of the bytes in the buffer to 0*/
         if((jhState.datasize_in_buffer & 7) == 0)
@@ -333,7 +340,7 @@ int JH::Final(BitSequence* hashval) {
         /*pad and process the partial block when databitlen is not multiple of 512 bits, then hash the padded blocks*/
         jhState.buffer[((jhState.databitlen & 0x1ff) >> 3)] |= 1 << (7 - (jhState.databitlen & 7));
 
-        JH::F8();
+        JH::F8(jhState.buffer);
         memset(jhState.buffer, 0, 64);
         jhState.buffer[63] = jhState.databitlen & 0xff;
         jhState.buffer[62] = (jhState.databitlen >> 8) & 0xff;
@@ -343,7 +350,7 @@ int JH::Final(BitSequence* hashval) {
         jhState.buffer[58] = (jhState.databitlen >> 40) & 0xff;
         jhState.buffer[57] = (jhState.databitlen >> 48) & 0xff;
         jhState.buffer[56] = (jhState.databitlen >> 56) & 0xff;
-        JH::F8();
+        JH::F8(jhState.buffer);
     }
 
     /*truncating the final hash value to generate the message digest*/
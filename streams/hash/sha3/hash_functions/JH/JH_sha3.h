@@ -50,7 +50,7 @@ int Hash(int hashbitlen, const BitSequence *data,DataLength databitlen, BitSeque
 
 private:
 void E8();   /*The bijective function E8, in bitslice form */
-void F8();   /*The compression function F8 */
+void F8(const BitSequence *block);   /*The compression function F8 */
 
 };
 
@@ -1,4 +0,0 @@
-#define Unrolling 1
-//#define UseBebigokimisa
-//#define UseInterleaveTables
-//#define UseSchedule 3
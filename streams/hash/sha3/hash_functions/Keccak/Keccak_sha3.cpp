@@ -3,7 +3,6 @@
 #include "Keccak_sha3.h"
 extern "C" {
 #include "KeccakF-1600-interface.h"
-#include "KeccakF-1600-opt32-settings.h"
 }
 
 namespace sha3 {
@@ -13,12 +12,6 @@ Keccak::Keccak(const int numRounds) {
         throw std::out_of_range("Valid numRounds range for Keccak is <1-24>");
     }
 
-#if (Unrolling != 1)
-    if (numRounds != KECCAK_FULL_ROUNDS){
-        throw std::out_of_range("Keccak compiled with optimized unrolling, full round range is supported only");
-    }
-#endif
-
     this->m_rounds = (unsigned)numRounds;
 }
 
@@ -2022,6 +2022,22 @@ int Lane::Init (int hashbitlen)
   return SUCCESS;
 }
 
+std::size_t Lane::BlockBytes(int hashbitlen) const
+{
+  return hashbitlen > 256 ? 128 : 64;
+}
+
+bool Lane::SaveState()
+{
+  laneSavedState = laneState;
+  return true;
+}
+
+void Lane::RestoreState()
+{
+  laneState = laneSavedState;
+}
+
 int Lane::Update (const BitSequence *data, DataLength databitlen)
 {
   unsigned long long buffill;
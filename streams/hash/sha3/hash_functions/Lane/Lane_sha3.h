@@ -28,6 +28,7 @@ int numRoundsLane224Q;
 int numRoundsLane384P;
 int numRoundsLane384Q;
 hashState laneState;
+hashState laneSavedState; /* after Init() (the IV is one compression) or a prefix */
 
 public:
 Lane(const int numRounds);
@@ -36,6 +37,11 @@ int Update (const BitSequence *data, DataLength databitlen);
 int Final (BitSequence *hashval);
 int Hash (int hashbitlen, const BitSequence *data, DataLength databitlen, BitSequence *hashval);
 
+protected:
+std::size_t BlockBytes(int hashbitlen) const override;
+bool SaveState() override;
+void RestoreState() override;
+
 private:
 void lane256_compress(const unsigned char m[64], unsigned int h[8], const unsigned int ctrh, const unsigned int ctrl);
 void lane512_compress(const unsigned char m[128], unsigned int h[16], const unsigned int ctrh, const unsigned int ctrl);
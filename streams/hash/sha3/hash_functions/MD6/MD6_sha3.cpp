@@ -1,4 +1,7 @@
 #include <stdio.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
 #include "MD6_sha3.h"
 
 namespace sha3 {
@@ -15,9 +18,50 @@ int MD6::Init( int hashbitlen )
 }
 
 int MD6::Update( const BitSequence *data, DataLength databitlen )
-{ return md6_update( (md6_state *) &mdsixState, 
-		     (unsigned char *)data, 
-		     (uint64_t) databitlen );
+{ const unsigned long long subtree = (unsigned long long) md6_b * (md6_w / 8) << 2 * (MD6_SUBTREE_LEVEL - 1);
+  const unsigned long long head = (subtree - mdsixState.bits_processed / 8 % subtree) % subtree;
+  int err;
+
+  // whole subtrees of the tree are independent of each other and of the state, they are
+  // compressed side by side and their chaining values fed to the state in order; each one
+  // must be followed by more input, as the last node may turn out to be the root
+  if (mdsixState.bits_processed % 8 != 0 || MD6_SUBTREE_LEVEL >= mdsixState.L ||
+      databitlen <= 8 * (head + subtree))
+    return md6_update( (md6_state *) &mdsixState, 
+		       (unsigned char *)data, 
+		       (uint64_t) databitlen );
+
+  const unsigned long long count = (databitlen - 8 * head - 1) / (8 * subtree);
+  if (head != 0 && (err = md6_update(&mdsixState, (unsigned char *)data, 8 * head)))
+    return err;
+
+  const unsigned long long first = mdsixState.bits_processed / 8 / subtree;
+  const unsigned workers = unsigned(std::min<unsigned long long>(
+      count, std::max(1u, std::thread::hardware_concurrency())));
+  std::vector<md6_word> chaining(count * md6_c);
+  std::vector<int> errors(workers, MD6_SUCCESS);
+  auto compress = [&](unsigned t) {
+    for (unsigned long long j = t; j < count && errors[t] == MD6_SUCCESS; j += workers)
+      errors[t] = md6_compress_subtree(&mdsixState, MD6_SUBTREE_LEVEL, first + j,
+                                       data + head + j * subtree, &chaining[j * md6_c]);
+  };
+  std::vector<std::thread> threads;
+  for (unsigned t = 1; t < workers; ++t)
+    threads.emplace_back(compress, t);
+  compress(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int e : errors)
+    if (e != MD6_SUCCESS)
+      return e;
+  for (unsigned long long j = 0; j < count; ++j)
+    if ((err = md6_append_subtree(&mdsixState, MD6_SUBTREE_LEVEL, &chaining[j * md6_c])))
+      return err;
+
+  return md6_update( (md6_state *) &mdsixState, 
+		     (unsigned char *)data + head + count * subtree, 
+		     (uint64_t) (databitlen - 8 * (head + count * subtree)) );
 }
 
 int MD6::Final( BitSequence *hashval )
@@ -11,6 +11,8 @@ namespace sha3 {
 class MD6 : public sha3_interface {
 
 #define MD6_DEFAULT_ROUNDS	104
+// level of the subtrees hashed in parallel, 4^3 leaves make 32 KB of input each
+#define MD6_SUBTREE_LEVEL	4
 
 typedef unsigned char BitSequence;
 typedef unsigned long long DataLength;
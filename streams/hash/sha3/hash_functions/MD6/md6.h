@@ -290,6 +290,23 @@ extern int md6_final( md6_state *st,            /* initialized/updated */
 		      unsigned char *hashval       /* output; NULL OK  */
 		      );
 
+/* Independent subtrees of the PAR tree, see md6_mode.c.
+** md6_compress_subtree only reads the state and may run concurrently;
+** md6_append_subtree then feeds the chaining values back in order.
+*/
+
+extern int md6_compress_subtree( const md6_state *st,   /* parameters */
+				 int ell,          /* level of the root */
+				 unsigned long long i,  /* index of root */
+				 const unsigned char *data, /* leaves */
+				 md6_word *C                   /* output */
+				 );
+
+extern int md6_append_subtree( md6_state *st,    /* initialized state */
+			       int ell,            /* level of the root */
+			       const md6_word *C     /* chaining value */
+			       );
+
 /* MD6 main interface routines
 **
 ** These routines are defined in md6_mode.c
@@ -703,7 +703,98 @@ int md6_update( md6_state *st,
   return MD6_SUCCESS;
 }
 
-/* Convert hash value to hexadecimal, and store it in state.
+/* Subtrees -- compress whole subtrees independently of the state.
+*/
+
+int md6_compress_subtree( const md6_state *st,
+			  int ell,
+			  unsigned long long i,
+			  const unsigned char *data,
+			  md6_word *C )
+/* Compute the chaining value of node i on level ell of a PAR tree.
+** Input:
+**     st         initialized state, only its parameters are read
+**     ell        level of the subtree root, 1 <= ell <= st->L
+**     i          index of the root within its level
+**     data       the b*(w/8)*4^(ell-1) message bytes below the node
+** Output:
+**     C          c-word chaining value, as md6_process would put it
+**                into B[ell+1] when more input follows the subtree
+** The state is not modified, so disjoint subtrees may be compressed
+** concurrently.
+** Returns one of the return codes of md6_standard_compress.
+*/
+{ md6_word B[b];
+  md6_word K[k];
+  unsigned long long child_bytes;
+  int j, err;
+
+  if (ell == 1)
+    { memcpy(B,data,b*(w/8));
+      md6_reverse_little_endian(B,b);
+    }
+  else
+    { child_bytes = ((unsigned long long) b*(w/8)) << (2*(ell-2));
+      for (j=0;j<b/c;j++)
+	if ((err = md6_compress_subtree(st,ell-1,(b/c)*i+j,
+					data+j*child_bytes,B+j*c)))
+	  return err;
+    }
+  memcpy(K,st->K,sizeof(K));
+  return md6_standard_compress(C,Q,K,ell,(int)i,
+			       st->r,st->L,0,0,st->keylen,st->d,B);
+}
+
+int md6_append_subtree( md6_state *st,
+			int ell,
+			const md6_word *C )
+/* Account for a subtree compressed by md6_compress_subtree.
+** Input:
+**     st         state that has processed a whole number of level ell
+**                subtrees; a full level-1 block left over by
+**                md6_update may still be pending
+**     ell        level of the subtree root, 1 <= ell < st->L
+**     C          chaining value of the next subtree on level ell
+** Modifies:
+**     st         as if md6_update had absorbed the subtree's data
+**                with more input still to come
+** Returns one of the following:
+**     MD6_SUCCESS
+**     MD6_NULLSTATE
+**     MD6_STATENOTINIT
+**     MD6_BAD_ELL       if the state is not at a subtree boundary
+*/
+{ int err, lev;
+
+  if ( st == NULL) return MD6_NULLSTATE;
+  if ( st->initialized == 0 ) return MD6_STATENOTINIT;
+  if ( ell < 1 || ell >= st->L || ell >= md6_max_stack_height-2 )
+    return MD6_BAD_ELL;
+
+  /* more input follows, so a pending full leaf can be compressed now */
+  if (st->bits[1] == b*w)
+    if ((err = md6_process(st,1,0)))
+      return err;
+  for (lev=1;lev<=ell;lev++)
+    if (st->bits[lev] != 0)
+      return MD6_BAD_ELL;
+
+  for (lev=1;lev<=ell;lev++)
+    { st->i_for_level[lev] += 1ULL << (2*(ell-lev));
+      st->compression_calls += 1ULL << (2*(ell-lev));
+    }
+  st->bits_processed += ((unsigned long long) b*w) << (2*(ell-1));
+
+  memcpy((char *)st->B[ell+1] + st->bits[ell+1]/8,
+	 C,
+	 c*(w/8));
+  st->bits[ell+1] += c*w;
+  if (ell+1 > st->top) st->top = ell+1;
+
+  return md6_process(st,ell+1,0);
+}
+
+/* Convert hash value to hexadecimal, and store it in state.
 */
 
 int md6_compute_hex_hashval( md6_state *st )
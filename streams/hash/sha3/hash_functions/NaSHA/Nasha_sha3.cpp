@@ -592,6 +592,11 @@ int Nasha::Hash(int hashbitlen, const BitSequence *data, DataLength databitlen,
 		   return FAIL;
 }
 
+std::size_t Nasha::UpdateBytes(int hashbitlen) const {
+	// the 384 and 512 bit versions lose data when Update() is called again
+	return hashbitlen <= 256 ? Nasha256_BLOCK_SIZE : 0;
+}
+
 #endif
 
 } // namespace sha3
@@ -2332,4 +2332,8 @@ int Shamata::ProduceOutput(hashState *state, BitSequence *hashval)
 	return SUCCESS;
 }
 
+std::size_t Shamata::UpdateBytes(int) const {
+	return 16;
+}
+
 } // namespace sha3
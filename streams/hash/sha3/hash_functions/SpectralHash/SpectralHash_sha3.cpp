@@ -730,4 +730,9 @@ int SpectralHash::Hash(int hashbitlen, const BitSequence *data, DataLength datab
 	return SUCCESS;
 }
 
+std::size_t SpectralHash::UpdateBytes(int) const {
+	// partial blocks carried over to the next Update() are not unpacked correctly
+	return 64;
+}
+
 } // namespace sha3
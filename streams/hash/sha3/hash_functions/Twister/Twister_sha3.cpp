@@ -865,4 +865,8 @@ Twister::Twister(const int numRounds) {
 	}
 }
 
+std::size_t Twister::UpdateBytes(int) const {
+	return 64;
+}
+
 } // namespace sha3
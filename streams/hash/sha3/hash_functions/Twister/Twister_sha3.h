@@ -99,6 +99,7 @@ int Final(BitSequence *hashval);
 /* Hash the supplied data and provie the resulting hash value */
 int Hash(int hashbitlen, const BitSequence *data,
 		DataLength databitlen, BitSequence *hashval); 
+std::size_t UpdateBytes(int hashbitlen) const override;
 
 
 
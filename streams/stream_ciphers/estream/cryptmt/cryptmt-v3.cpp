@@ -47,16 +47,16 @@ static INLINE void filter_bytes(u32 sfmt[], u32 accum[4], u8 cipher[], const u8
 static INLINE void booter_am(u32 acc[4], u32 pos1[][4], u32 pos2[][4], s32 count);
 
 #if (!defined(SLOW_CODE)) && defined(__ppc__) && defined(__ALTIVEC__)
-static int fast_code = 1;
+static const int fast_code_compiled = 1;
 #include "altivec.cpp"
 #elif (!defined(SLOW_CODE)) && defined(__INTEL_COMPILER)
-static int fast_code = 1;
+static const int fast_code_compiled = 1;
 #include "sse2.cpp"
 #elif (!defined(SLOW_CODE)) && defined(__GNUC__) && defined(__SSE__)
-static int fast_code = 1;
+static const int fast_code_compiled = 1;
 #include "sse2.cpp"
 #else /* other normal C */
-static int fast_code = 0;
+static const int fast_code_compiled = 0;
 static int is_simd_cpu(void) {
     return 0;
 }
@@ -374,10 +374,14 @@ static void boot_up(CRYPTMT_ctx* ctx, s32 length) {
  * ECRYPT API FUNCTIONS
  ************************/
 
+/* the SIMD check runs once, instances only read the result */
+static int fast_code() {
+    static const int fast = fast_code_compiled && is_simd_cpu();
+    return fast;
+}
+
 void ECRYPT_Cryptmt::ECRYPT_init(void) {
-    if (fast_code) {
-        fast_code = is_simd_cpu();
-    }
+    fast_code();
 }
 
 /* Key size in bits. */
@@ -417,7 +421,7 @@ void ECRYPT_Cryptmt::ECRYPT_ivsetup(const u8* iv) {
     ctx->sfmt[p][2] += 979323UL;
     ctx->sfmt[p][3] += 846264UL;
     ctx->length = block_size * 2;
-    if (fast_code) {
+    if (fast_code()) {
         fast_boot_up(ctx, ctx->length);
     } else {
         boot_up(ctx, ctx->length);
@@ -428,7 +432,7 @@ void ECRYPT_Cryptmt::ECRYPT_ivsetup(const u8* iv) {
 /* Message length in bytes. */
 void ECRYPT_Cryptmt::ECRYPT_encrypt_bytes(const u8* plaintext, u8* ciphertext, u32 msglen) {
     CRYPTMT_ctx* ctx = &_ctx;
-    if (fast_code) {
+    if (fast_code()) {
         if (ctx->first && (msglen > 0)) {
             if (msglen >= CRYPTMT_BLOCKLENGTH) {
                 fast_genrand_block_first(ctx, ciphertext, plaintext);
@@ -487,7 +491,7 @@ void ECRYPT_Cryptmt::CRYPTMT_encrypt_blocks(CRYPTMT_ctx* ctx,
                                             u32 blocks) {
     s32 i;
 
-    if (fast_code) {
+    if (fast_code()) {
         if (ctx->first && (blocks > 0)) {
             fast_genrand_block_first(ctx, ciphertext, plaintext);
             ciphertext += CRYPTMT_BLOCKLENGTH;
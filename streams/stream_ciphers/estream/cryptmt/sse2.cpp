@@ -160,25 +160,8 @@ static INLINE void fast_genrand_block(CRYPTMT_ctx * ctx, u8 cipher[],
 #if defined(__GNUC__)
 static int is_simd_cpu(void)
 {
-    int sse2;
-
-   __asm__ __volatile__ (
-       "movl  $0, %%eax\n\t"
-       "cpuid\n\t"
-       "cmp   $1, %%eax\n\t"
-       "jb    no\n\t"
-       "movl  $1, %%eax\n\t"
-       "cpuid \n\t"
-       "testl $0x04000000, %%edx\n\t"
-       "jnz   yes\n\t"
-       "movl  $0, %0\n\t"
-       "jmp   no\n\t"
-       "yes:\n\t"
-       "movl  $1, %0\n\t"
-       "no:\n\t"
-       : "=m" (sse2) : 
-       : "%eax", "%ebx", "%ecx", "%edx");
-   return sse2;
+    /* fixed asm labels clash once the function is inlined more than once */
+    return __builtin_cpu_supports("sse2");
 }
 #else
 static int is_simd_cpu(void){
@@ -23,9 +23,39 @@ namespace estream {
 
 /* This is a permutation of all the values between 0 and 255, */
 /* used by the key setup and IV setup.                        */
-/* It is computed by the init function. It can also be        */
+/* It is computed on first use. It can also be                */
 /* computed in advance and put into the code.                 */
-u8 internal_permutation[256];
+struct py_internal_permutation {
+    py_internal_permutation() {
+        int i;
+        u8 j = 0;
+        static const u8 str[] =
+                "This is the seed for generating the fixed internal permutation for Py. "
+                "The permutation is used in the key setup and IV setup as a source of nonlinearity. "
+                "The shifted special keys on a keyboard are ~!@#$%^&*()_+{}:|<>?";
+        const u8* p = str;
+
+        for (i = 0; i < 256; i++)
+            table[i] = i;
+
+        for (i = 0; i < 256 * 16; i++) {
+            j += p[0];
+            u8 tmp = table[i & 0xFF];
+            table[i & 0xFF] = table[j & 0xFF];
+            table[j & 0xFF] = tmp;
+            p++;
+            if (p[0] == 0)
+                p = str;
+        }
+    }
+
+    u8 table[256];
+};
+
+static const u8* internal_permutation_table() {
+    static const py_internal_permutation permutation;
+    return permutation.table;
+}
 
 /*
  * Key setup. It is the user's responsibility to select a legal
@@ -36,6 +66,7 @@ void ECRYPT_Py::ECRYPT_keysetup(const u8* key,
                                 u32 ivsize)  /* IV size in bits. */
 {
     PY_ctx* ctx = &_ctx;
+    const u8* internal_permutation = internal_permutation_table();
     int i, j;
     u32 s;
 
@@ -189,7 +220,8 @@ void ECRYPT_Py::ECRYPT_ivsetup(const u8* iv) {
 /* All computations are made in multiples of                 */
 /* NUMBLOCKSATONCE*8 bytes, if possible                      */
 
-static u32 PY[(NUMBLOCKSATONCE + PYSIZE) * 2];
+/* per-thread scratch, so independent instances can run concurrently */
+static thread_local u32 PY[(NUMBLOCKSATONCE + PYSIZE) * 2];
 #define P(i8, j) (((u8*)PY)[(i8) + 8 * (j) + 4])
 /* access P[i+j] where i8=8*i. */
 /* P is byte 4 of the 8-byte record */
@@ -371,26 +403,8 @@ void ECRYPT_Py::PY_keystream_bytes(PY_ctx* ctx,
 #undef Y
 
 void ECRYPT_Py::ECRYPT_init(void) {
-    int i;
-    u8 j = 0;
-    static u8 str[] =
-            "This is the seed for generating the fixed internal permutation for Py. "
-            "The permutation is used in the key setup and IV setup as a source of nonlinearity. "
-            "The shifted special keys on a keyboard are ~!@#$%^&*()_+{}:|<>?";
-    u8* p = str;
-
-    for (i = 0; i < 256; i++)
-        internal_permutation[i] = i;
-
-    for (i = 0; i < 256 * 16; i++) {
-        j += p[0];
-        u8 tmp = internal_permutation[i & 0xFF];
-        internal_permutation[i & 0xFF] = internal_permutation[j & 0xFF];
-        internal_permutation[j & 0xFF] = tmp;
-        p++;
-        if (p[0] == 0)
-            p = str;
-    }
+    /* the internal permutation is computed once and shared by all instances */
+    internal_permutation_table();
 }
 
 void ECRYPT_Py::ECRYPT_encrypt_bytes(const u8* plaintext, u8* ciphertext, u32 msglen) {
@@ -35,47 +35,42 @@ namespace estream {
 
 /* Square a 32-bit unsigned integer to obtain the 64-bit result and return */
 /* the upper 32 bits XOR the lower 32 bits */
-static u32 RABBIT_g_func(u32 x) {
-    /* Temporary variables */
-    u32 a, b, h, l;
-
-    /* Construct high and low argument for squaring */
-    a = x & 0xFFFF;
-    b = x >> 16;
-
-    /* Calculate high and low result of squaring */
-    h = (((U32V(a * a) >> 17) + U32V(a * b)) >> 15) + b * b;
-    l = x * x;
+static inline u32 RABBIT_g_func(u32 x) {
+    /* A single 32x32->64 multiply, as in the optimised eSTREAM submission; */
+    /* bit-identical to the portable 16-bit split of the reference code */
+    u64 s = (u64)x * x;
 
     /* Return high XOR low */
-    return U32V(h ^ l);
+    return U32V((u32)s ^ (u32)(s >> 32));
 }
 
 /* -------------------------------------------------------------------------- */
 
 /* Calculate the next internal state */
-static void RABBIT_next_state(RABBIT2_ctx* p_instance) {
+static inline void RABBIT_next_state(RABBIT2_ctx* p_instance) {
     /* Temporary variables */
-    u32 g[8], c_old[8], i;
+    u32 g[8], c_old[8], c[8], i;
 
     /* Save old counter values */
     for (i = 0; i < 8; i++)
         c_old[i] = p_instance->c[i];
 
     /* Calculate new counter values */
-    p_instance->c[0] = U32V(p_instance->c[0] + 0x4D34D34D + p_instance->carry);
-    p_instance->c[1] = U32V(p_instance->c[1] + 0xD34D34D3 + (p_instance->c[0] < c_old[0]));
-    p_instance->c[2] = U32V(p_instance->c[2] + 0x34D34D34 + (p_instance->c[1] < c_old[1]));
-    p_instance->c[3] = U32V(p_instance->c[3] + 0x4D34D34D + (p_instance->c[2] < c_old[2]));
-    p_instance->c[4] = U32V(p_instance->c[4] + 0xD34D34D3 + (p_instance->c[3] < c_old[3]));
-    p_instance->c[5] = U32V(p_instance->c[5] + 0x34D34D34 + (p_instance->c[4] < c_old[4]));
-    p_instance->c[6] = U32V(p_instance->c[6] + 0x4D34D34D + (p_instance->c[5] < c_old[5]));
-    p_instance->c[7] = U32V(p_instance->c[7] + 0xD34D34D3 + (p_instance->c[6] < c_old[6]));
-    p_instance->carry = (p_instance->c[7] < c_old[7]);
+    c[0] = U32V(c_old[0] + 0x4D34D34D + p_instance->carry);
+    c[1] = U32V(c_old[1] + 0xD34D34D3 + (c[0] < c_old[0]));
+    c[2] = U32V(c_old[2] + 0x34D34D34 + (c[1] < c_old[1]));
+    c[3] = U32V(c_old[3] + 0x4D34D34D + (c[2] < c_old[2]));
+    c[4] = U32V(c_old[4] + 0xD34D34D3 + (c[3] < c_old[3]));
+    c[5] = U32V(c_old[5] + 0x34D34D34 + (c[4] < c_old[4]));
+    c[6] = U32V(c_old[6] + 0x4D34D34D + (c[5] < c_old[5]));
+    c[7] = U32V(c_old[7] + 0xD34D34D3 + (c[6] < c_old[6]));
+    p_instance->carry = (c[7] < c_old[7]);
 
     /* Calculate the g-values */
-    for (i = 0; i < 8; i++)
-        g[i] = RABBIT_g_func(U32V(p_instance->x[i] + p_instance->c[i]));
+    for (i = 0; i < 8; i++) {
+        p_instance->c[i] = c[i];
+        g[i] = RABBIT_g_func(U32V(p_instance->x[i] + c[i]));
+    }
 
     /* Calculate new state values */
     p_instance->x[0] = U32V(g[0] + ROTL32(g[7],16) + ROTL32(g[6], 16));
@@ -88,6 +83,22 @@ static void RABBIT_next_state(RABBIT2_ctx* p_instance) {
     p_instance->x[7] = U32V(g[7] + ROTL32(g[6], 8) + g[5]);
 }
 
+/* Iterate the system and extract 128 bits of keystream into ks[0..3] */
+static inline void RABBIT_next_block(RABBIT2_ctx* p_instance, u32* ks) {
+    u32 x[8], i;
+
+    RABBIT_next_state(p_instance);
+
+    /* Read the state once; the caller's stores cannot alias these copies */
+    for (i = 0; i < 8; i++)
+        x[i] = p_instance->x[i];
+
+    ks[0] = U32TO32_LITTLE(x[0] ^ (x[5]>>16) ^ U32V(x[3]<<16));
+    ks[1] = U32TO32_LITTLE(x[2] ^ (x[7]>>16) ^ U32V(x[5]<<16));
+    ks[2] = U32TO32_LITTLE(x[4] ^ (x[1]>>16) ^ U32V(x[7]<<16));
+    ks[3] = U32TO32_LITTLE(x[6] ^ (x[3]>>16) ^ U32V(x[1]<<16));
+}
+
 /* ------------------------------------------------------------------------- */
 
 /* No initialization is needed for Rabbit */
@@ -189,23 +200,18 @@ void ECRYPT_Rabbit::RABBIT_process_bytes(
         int action, void* ctxa, const u8* input, u8* output, u32 msglen) {
     RABBIT_ctx* ctx = (RABBIT_ctx*)ctxa;
     /* Temporary variables */
-    u32 i;
-    u8 buffer[16];
+    u32 i, ks[4];
 
     /* Encrypt/decrypt all full blocks */
     while (msglen >= 16) {
         /* Iterate the system */
-        RABBIT_next_state(&(ctx->work_ctx));
+        RABBIT_next_block(&(ctx->work_ctx), ks);
 
         /* Encrypt/decrypt 16 bytes of data */
-        *(u32*)(output+ 0) = *(u32*)(input+ 0) ^ U32TO32_LITTLE(ctx->work_ctx.x[0] ^
-                  (ctx->work_ctx.x[5]>>16) ^ U32V(ctx->work_ctx.x[3]<<16));
-        *(u32*)(output+ 4) = *(u32*)(input+ 4) ^ U32TO32_LITTLE(ctx->work_ctx.x[2] ^
-                  (ctx->work_ctx.x[7]>>16) ^ U32V(ctx->work_ctx.x[5]<<16));
-        *(u32*)(output+ 8) = *(u32*)(input+ 8) ^ U32TO32_LITTLE(ctx->work_ctx.x[4] ^
-                  (ctx->work_ctx.x[1]>>16) ^ U32V(ctx->work_ctx.x[7]<<16));
-        *(u32*)(output+12) = *(u32*)(input+12) ^ U32TO32_LITTLE(ctx->work_ctx.x[6] ^
-                  (ctx->work_ctx.x[3]>>16) ^ U32V(ctx->work_ctx.x[1]<<16));
+        *(u32*)(output+ 0) = *(u32*)(input+ 0) ^ ks[0];
+        *(u32*)(output+ 4) = *(u32*)(input+ 4) ^ ks[1];
+        *(u32*)(output+ 8) = *(u32*)(input+ 8) ^ ks[2];
+        *(u32*)(output+12) = *(u32*)(input+12) ^ ks[3];
 
         /* Increment pointers and decrement length */
         input += 16;
@@ -216,21 +222,11 @@ void ECRYPT_Rabbit::RABBIT_process_bytes(
     /* Encrypt/decrypt remaining data */
     if (msglen) {
         /* Iterate the system */
-        RABBIT_next_state(&(ctx->work_ctx));
-
-        /* Generate 16 bytes of pseudo-random data */
-        *(u32*)(buffer+ 0) = U32TO32_LITTLE(ctx->work_ctx.x[0] ^
-                  (ctx->work_ctx.x[5]>>16) ^ U32V(ctx->work_ctx.x[3]<<16));
-        *(u32*)(buffer+ 4) = U32TO32_LITTLE(ctx->work_ctx.x[2] ^
-                  (ctx->work_ctx.x[7]>>16) ^ U32V(ctx->work_ctx.x[5]<<16));
-        *(u32*)(buffer+ 8) = U32TO32_LITTLE(ctx->work_ctx.x[4] ^
-                  (ctx->work_ctx.x[1]>>16) ^ U32V(ctx->work_ctx.x[7]<<16));
-        *(u32*)(buffer+12) = U32TO32_LITTLE(ctx->work_ctx.x[6] ^
-                  (ctx->work_ctx.x[3]>>16) ^ U32V(ctx->work_ctx.x[1]<<16));
+        RABBIT_next_block(&(ctx->work_ctx), ks);
 
         /* Encrypt/decrypt the data */
         for (i = 0; i < msglen; i++)
-            output[i] = input[i] ^ buffer[i];
+            output[i] = input[i] ^ ((u8*)ks)[i];
     }
 }
 
@@ -239,23 +235,18 @@ void ECRYPT_Rabbit::RABBIT_process_bytes(
 /* Generate keystream */
 void ECRYPT_Rabbit::RABBIT_keystream_bytes(RABBIT_ctx* ctx, u8* keystream, u32 length) {
     /* Temporary variables */
-    u32 i;
-    u8 buffer[16];
+    u32 i, ks[4];
 
     /* Generate all full blocks */
     while (length >= 16) {
         /* Iterate the system */
-        RABBIT_next_state(&(ctx->work_ctx));
+        RABBIT_next_block(&(ctx->work_ctx), ks);
 
         /* Generate 16 bytes of pseudo-random data */
-        *(u32*)(keystream+ 0) = U32TO32_LITTLE(ctx->work_ctx.x[0] ^
-                  (ctx->work_ctx.x[5]>>16) ^ U32V(ctx->work_ctx.x[3]<<16));
-        *(u32*)(keystream+ 4) = U32TO32_LITTLE(ctx->work_ctx.x[2] ^
-                  (ctx->work_ctx.x[7]>>16) ^ U32V(ctx->work_ctx.x[5]<<16));
-        *(u32*)(keystream+ 8) = U32TO32_LITTLE(ctx->work_ctx.x[4] ^
-                  (ctx->work_ctx.x[1]>>16) ^ U32V(ctx->work_ctx.x[7]<<16));
-        *(u32*)(keystream+12) = U32TO32_LITTLE(ctx->work_ctx.x[6] ^
-                  (ctx->work_ctx.x[3]>>16) ^ U32V(ctx->work_ctx.x[1]<<16));
+        *(u32*)(keystream+ 0) = ks[0];
+        *(u32*)(keystream+ 4) = ks[1];
+        *(u32*)(keystream+ 8) = ks[2];
+        *(u32*)(keystream+12) = ks[3];
 
         /* Increment pointers and decrement length */
         keystream += 16;
@@ -265,21 +256,11 @@ void ECRYPT_Rabbit::RABBIT_keystream_bytes(RABBIT_ctx* ctx, u8* keystream, u32 l
     /* Generate remaining pseudo-random data */
     if (length) {
         /* Iterate the system */
-        RABBIT_next_state(&(ctx->work_ctx));
-
-        /* Generate 16 bytes of pseudo-random data */
-        *(u32*)(buffer+ 0) = U32TO32_LITTLE(ctx->work_ctx.x[0] ^
-                  (ctx->work_ctx.x[5]>>16) ^ U32V(ctx->work_ctx.x[3]<<16));
-        *(u32*)(buffer+ 4) = U32TO32_LITTLE(ctx->work_ctx.x[2] ^
-                  (ctx->work_ctx.x[7]>>16) ^ U32V(ctx->work_ctx.x[5]<<16));
-        *(u32*)(buffer+ 8) = U32TO32_LITTLE(ctx->work_ctx.x[4] ^
-                  (ctx->work_ctx.x[1]>>16) ^ U32V(ctx->work_ctx.x[7]<<16));
-        *(u32*)(buffer+12) = U32TO32_LITTLE(ctx->work_ctx.x[6] ^
-                  (ctx->work_ctx.x[3]>>16) ^ U32V(ctx->work_ctx.x[1]<<16));
+        RABBIT_next_block(&(ctx->work_ctx), ks);
 
         /* Copy remaining data */
         for (i = 0; i < length; i++)
-            keystream[i] = buffer[i];
+            keystream[i] = ((u8*)ks)[i];
     }
 }
 
@@ -289,21 +270,17 @@ void ECRYPT_Rabbit::RABBIT_keystream_bytes(RABBIT_ctx* ctx, u8* keystream, u32 l
 void ECRYPT_Rabbit::RABBIT_process_blocks(
         int action, RABBIT_ctx* ctx, const u8* input, u8* output, u32 blocks) {
     /* Temporary variables */
-    u32 i;
+    u32 i, ks[4];
 
     for (i = 0; i < blocks; i++) {
         /* Iterate the system */
-        RABBIT_next_state(&(ctx->work_ctx));
+        RABBIT_next_block(&(ctx->work_ctx), ks);
 
         /* Encrypt/decrypt 16 bytes of data */
-        *(u32*)(output+ 0) = *(u32*)(input+ 0) ^ U32TO32_LITTLE(ctx->work_ctx.x[0] ^
-                  (ctx->work_ctx.x[5]>>16) ^ U32V(ctx->work_ctx.x[3]<<16));
-        *(u32*)(output+ 4) = *(u32*)(input+ 4) ^ U32TO32_LITTLE(ctx->work_ctx.x[2] ^
-                  (ctx->work_ctx.x[7]>>16) ^ U32V(ctx->work_ctx.x[5]<<16));
-        *(u32*)(output+ 8) = *(u32*)(input+ 8) ^ U32TO32_LITTLE(ctx->work_ctx.x[4] ^
-                  (ctx->work_ctx.x[1]>>16) ^ U32V(ctx->work_ctx.x[7]<<16));
-        *(u32*)(output+12) = *(u32*)(input+12) ^ U32TO32_LITTLE(ctx->work_ctx.x[6] ^
-                  (ctx->work_ctx.x[3]>>16) ^ U32V(ctx->work_ctx.x[1]<<16));
+        *(u32*)(output+ 0) = *(u32*)(input+ 0) ^ ks[0];
+        *(u32*)(output+ 4) = *(u32*)(input+ 4) ^ ks[1];
+        *(u32*)(output+ 8) = *(u32*)(input+ 8) ^ ks[2];
+        *(u32*)(output+12) = *(u32*)(input+12) ^ ks[3];
 
         /* Increment pointers to input and output data */
         input += 16;
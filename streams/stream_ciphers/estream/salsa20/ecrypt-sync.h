@@ -69,9 +69,12 @@ typedef struct {
 class ECRYPT_Salsa : public estream_interface {
     SALSA_ctx _ctx;
 
+    /* Keystream block function, specialised (unrolled) for the round count */
+    typedef void (*wordtobyte_fn)(u8 output[64], const u32 input[16], int numRounds);
+    const wordtobyte_fn _wordtobyte;
+
 public:
-    ECRYPT_Salsa(int rounds)
-        : estream_interface(rounds) {}
+    ECRYPT_Salsa(int rounds);
     /* Mandatory functions */
 
     /*
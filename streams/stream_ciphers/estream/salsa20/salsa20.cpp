@@ -5,6 +5,7 @@ Public domain.
 */
 
 #include "ecrypt-sync.h"
+#include "../../unrolled_rounds.h"
 #include <iostream>
 
 namespace stream_ciphers {
@@ -15,52 +16,84 @@ namespace estream {
 #define PLUS(v, w) (U32V((v) + (w)))
 #define PLUSONE(v) (PLUS((v), 1))
 
-static void salsa20_wordtobyte(u8 output[64], const u32 input[16], int numRounds) {
-    u32 x[16];
+static UNROLLED_INLINE void salsa20_doubleround(u32 x[16]) {
+    x[4] = XOR(x[4], ROTATE(PLUS(x[0], x[12]), 7));
+    x[8] = XOR(x[8], ROTATE(PLUS(x[4], x[0]), 9));
+    x[12] = XOR(x[12], ROTATE(PLUS(x[8], x[4]), 13));
+    x[0] = XOR(x[0], ROTATE(PLUS(x[12], x[8]), 18));
+    x[9] = XOR(x[9], ROTATE(PLUS(x[5], x[1]), 7));
+    x[13] = XOR(x[13], ROTATE(PLUS(x[9], x[5]), 9));
+    x[1] = XOR(x[1], ROTATE(PLUS(x[13], x[9]), 13));
+    x[5] = XOR(x[5], ROTATE(PLUS(x[1], x[13]), 18));
+    x[14] = XOR(x[14], ROTATE(PLUS(x[10], x[6]), 7));
+    x[2] = XOR(x[2], ROTATE(PLUS(x[14], x[10]), 9));
+    x[6] = XOR(x[6], ROTATE(PLUS(x[2], x[14]), 13));
+    x[10] = XOR(x[10], ROTATE(PLUS(x[6], x[2]), 18));
+    x[3] = XOR(x[3], ROTATE(PLUS(x[15], x[11]), 7));
+    x[7] = XOR(x[7], ROTATE(PLUS(x[3], x[15]), 9));
+    x[11] = XOR(x[11], ROTATE(PLUS(x[7], x[3]), 13));
+    x[15] = XOR(x[15], ROTATE(PLUS(x[11], x[7]), 18));
+    x[1] = XOR(x[1], ROTATE(PLUS(x[0], x[3]), 7));
+    x[2] = XOR(x[2], ROTATE(PLUS(x[1], x[0]), 9));
+    x[3] = XOR(x[3], ROTATE(PLUS(x[2], x[1]), 13));
+    x[0] = XOR(x[0], ROTATE(PLUS(x[3], x[2]), 18));
+    x[6] = XOR(x[6], ROTATE(PLUS(x[5], x[4]), 7));
+    x[7] = XOR(x[7], ROTATE(PLUS(x[6], x[5]), 9));
+    x[4] = XOR(x[4], ROTATE(PLUS(x[7], x[6]), 13));
+    x[5] = XOR(x[5], ROTATE(PLUS(x[4], x[7]), 18));
+    x[11] = XOR(x[11], ROTATE(PLUS(x[10], x[9]), 7));
+    x[8] = XOR(x[8], ROTATE(PLUS(x[11], x[10]), 9));
+    x[9] = XOR(x[9], ROTATE(PLUS(x[8], x[11]), 13));
+    x[10] = XOR(x[10], ROTATE(PLUS(x[9], x[8]), 18));
+    x[12] = XOR(x[12], ROTATE(PLUS(x[15], x[14]), 7));
+    x[13] = XOR(x[13], ROTATE(PLUS(x[12], x[15]), 9));
+    x[14] = XOR(x[14], ROTATE(PLUS(x[13], x[12]), 13));
+    x[15] = XOR(x[15], ROTATE(PLUS(x[14], x[13]), 18));
+}
+
+static UNROLLED_INLINE void salsa20_output(u8 output[64], u32 x[16], const u32 input[16]) {
     int i;
 
-    for (i = 0; i < 16; ++i)
-        x[i] = input[i];
-    for (i = numRounds; i > 0; i -= 2) {
-        x[4] = XOR(x[4], ROTATE(PLUS(x[0], x[12]), 7));
-        x[8] = XOR(x[8], ROTATE(PLUS(x[4], x[0]), 9));
-        x[12] = XOR(x[12], ROTATE(PLUS(x[8], x[4]), 13));
-        x[0] = XOR(x[0], ROTATE(PLUS(x[12], x[8]), 18));
-        x[9] = XOR(x[9], ROTATE(PLUS(x[5], x[1]), 7));
-        x[13] = XOR(x[13], ROTATE(PLUS(x[9], x[5]), 9));
-        x[1] = XOR(x[1], ROTATE(PLUS(x[13], x[9]), 13));
-        x[5] = XOR(x[5], ROTATE(PLUS(x[1], x[13]), 18));
-        x[14] = XOR(x[14], ROTATE(PLUS(x[10], x[6]), 7));
-        x[2] = XOR(x[2], ROTATE(PLUS(x[14], x[10]), 9));
-        x[6] = XOR(x[6], ROTATE(PLUS(x[2], x[14]), 13));
-        x[10] = XOR(x[10], ROTATE(PLUS(x[6], x[2]), 18));
-        x[3] = XOR(x[3], ROTATE(PLUS(x[15], x[11]), 7));
-        x[7] = XOR(x[7], ROTATE(PLUS(x[3], x[15]), 9));
-        x[11] = XOR(x[11], ROTATE(PLUS(x[7], x[3]), 13));
-        x[15] = XOR(x[15], ROTATE(PLUS(x[11], x[7]), 18));
-        x[1] = XOR(x[1], ROTATE(PLUS(x[0], x[3]), 7));
-        x[2] = XOR(x[2], ROTATE(PLUS(x[1], x[0]), 9));
-        x[3] = XOR(x[3], ROTATE(PLUS(x[2], x[1]), 13));
-        x[0] = XOR(x[0], ROTATE(PLUS(x[3], x[2]), 18));
-        x[6] = XOR(x[6], ROTATE(PLUS(x[5], x[4]), 7));
-        x[7] = XOR(x[7], ROTATE(PLUS(x[6], x[5]), 9));
-        x[4] = XOR(x[4], ROTATE(PLUS(x[7], x[6]), 13));
-        x[5] = XOR(x[5], ROTATE(PLUS(x[4], x[7]), 18));
-        x[11] = XOR(x[11], ROTATE(PLUS(x[10], x[9]), 7));
-        x[8] = XOR(x[8], ROTATE(PLUS(x[11], x[10]), 9));
-        x[9] = XOR(x[9], ROTATE(PLUS(x[8], x[11]), 13));
-        x[10] = XOR(x[10], ROTATE(PLUS(x[9], x[8]), 18));
-        x[12] = XOR(x[12], ROTATE(PLUS(x[15], x[14]), 7));
-        x[13] = XOR(x[13], ROTATE(PLUS(x[12], x[15]), 9));
-        x[14] = XOR(x[14], ROTATE(PLUS(x[13], x[12]), 13));
-        x[15] = XOR(x[15], ROTATE(PLUS(x[14], x[13]), 18));
-    }
     for (i = 0; i < 16; ++i)
         x[i] = PLUS(x[i], input[i]);
     for (i = 0; i < 16; ++i)
         U32TO8_LITTLE(output + 4 * i, x[i]);
 }
 
+static void salsa20_wordtobyte(u8 output[64], const u32 input[16], int numRounds) {
+    u32 x[16];
+    int i;
+
+    for (i = 0; i < 16; ++i)
+        x[i] = input[i];
+    for (i = numRounds; i > 0; i -= 2)
+        salsa20_doubleround(x);
+    salsa20_output(output, x, input);
+}
+
+struct salsa20_doubleround_op {
+    static UNROLLED_INLINE void apply(u32 x[16]) { salsa20_doubleround(x); }
+};
+
+/* Same as salsa20_wordtobyte(), with the double rounds unrolled for a fixed round count */
+template <unsigned Rounds>
+struct salsa20_unrolled {
+    static void run(u8 output[64], const u32 input[16], int) {
+        u32 x[16];
+        int i;
+
+        for (i = 0; i < 16; ++i)
+            x[i] = input[i];
+        /* like the loop above, an odd round count is rounded up to a whole double round */
+        unroll<(Rounds + 1) / 2>::template apply<salsa20_doubleround_op>(x);
+        salsa20_output(output, x, input);
+    }
+};
+
+ECRYPT_Salsa::ECRYPT_Salsa(int rounds)
+    : estream_interface(rounds)
+    , _wordtobyte(select_unrolled<salsa20_unrolled, 20>(rounds, &salsa20_wordtobyte)) {}
+
 void ECRYPT_Salsa::ECRYPT_init(void) {
     return;
 }
@@ -107,7 +140,7 @@ void ECRYPT_Salsa::ECRYPT_encrypt_bytes(const u8* m, u8* c, u32 bytes) {
     if (!bytes)
         return;
     for (;;) {
-        salsa20_wordtobyte(output, x->input, _rounds);
+        _wordtobyte(output, x->input, _rounds);
         x->input[8] = PLUSONE(x->input[8]);
         if (!x->input[8]) {
             x->input[9] = PLUSONE(x->input[9]);
@@ -79,16 +79,24 @@ typedef struct {
     u32 s00, s01, s02, s03, s04, s05, s06, s07, s08, s09;
     u32 r1, r2;
 
+    /*
+     * Number of rounds (reduced-round variants).
+     */
+    int rounds;
+
 } SOSEMANUK_ctx;
 
 /* ------------------------------------------------------------------------- */
 class ECRYPT_Sosemanuk : public estream_interface {
     SOSEMANUK_ctx _ctx;
 
+    /* Block function (80 bytes of keystream), specialised for the round count */
+    typedef void (*internal_fn)(SOSEMANUK_ctx* rc, const u32* src, u32* dst);
+    const internal_fn _internal;
+
 public:
+    ECRYPT_Sosemanuk(int rounds);
     /* Mandatory functions */
-    ECRYPT_Sosemanuk(int rounds)
-        : estream_interface(rounds) {}
 
     /*
      * Key and message independent initialization. This function will be
@@ -27,6 +27,8 @@
 #endif
 
 #include "sosemanuk.h"
+#include "../../unrolled_rounds.h"
+#include <algorithm>
 
 namespace stream_ciphers {
 namespace estream {
@@ -334,11 +336,9 @@ static INLINE void encode32le(unsigned char* dst, unum32 val) {
 
 /* ======================================================================== */
 
-static int num_rounds;
-
 #ifdef SOSEMANUK_ECRYPT
 void ECRYPT_Sosemanuk::ECRYPT_init(void) {
-    num_rounds = _rounds;
+    _ctx.rounds = _rounds;
     return;
 }
 #endif
@@ -578,7 +578,7 @@ void sosemanuk_init(sosemanuk_run_context* rc,
  */
 #define FSS(zc, S, i0, i1, i2, i3, i4, o0, o1, o2, o3, rNum)                                       \
     do {                                                                                           \
-      if (num_rounds >= (rNum)) {                                                                  \
+      if (rc->rounds >= (rNum)) {                                                                  \
         KA(zc, r##i0, r##i1, r##i2, r##i3);                                                        \
         S(r##i0, r##i1, r##i2, r##i3, r##i4);                                                      \
         SERPENT_LT(r##o0, r##o1, r##o2, r##o3);                                                    \
@@ -591,7 +591,7 @@ void sosemanuk_init(sosemanuk_run_context* rc,
  */
 #define FSF(zc, S, i0, i1, i2, i3, i4, o0, o1, o2, o3, rNum)                                       \
     do {                                                                                           \
-      if (num_rounds >= (rNum)) {                                                                  \
+      if (rc->rounds >= (rNum)) {                                                                  \
         KA(zc, r##i0, r##i1, r##i2, r##i3);                                                        \
         S(r##i0, r##i1, r##i2, r##i3, r##i4);                                                      \
         SERPENT_LT(r##o0, r##o1, r##o2, r##o3);                                                    \
@@ -809,8 +809,9 @@ static unum32 mul_ia[] = {
  * provided also, and this function performs the XOR. The input and
  * output buffers are assumed to be 32-bit aligned.
  */
+template <unsigned Rounds>
 #if defined SOSEMANUK_ECRYPT
-static void sosemanuk_internal(SOSEMANUK_ctx* rc, const u32* src, u32* dst)
+static UNROLLED_INLINE void sosemanuk_internal(SOSEMANUK_ctx* rc, const u32* src, u32* dst)
 #elif defined SOSEMANUK_SPEED
 static unum32 sosemanuk_internal(sosemanuk_run_context* rc, unsigned long counter)
 #else
@@ -880,7 +881,7 @@ static void sosemanuk_internal(sosemanuk_run_context* rc)
  */
 #define STEP(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, dd, ee, rNum)                                 \
     do {                                                                                           \
-      if (num_rounds >= (rNum)) {                                                                  \
+      if (Rounds >= (rNum)) {                                                                     \
         FSM(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9);                                               \
         LRU(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, dd);                                           \
         CC1(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, ee);                                           \
@@ -909,7 +910,7 @@ static void sosemanuk_internal(sosemanuk_run_context* rc)
 #ifdef SOSEMANUK_ECRYPT
 #define SRD(S, x0, x1, x2, x3, ooff, rNum)                                                         \
     do {                                                                                           \
-      if (num_rounds >= (rNum)) {                                                                  \
+      if (Rounds >= (rNum)) {                                                                      \
         PSPIN(u0, u1, u2, u3);                                                                     \
         S(u0, u1, u2, u3, u4);                                                                     \
         PSPOUT(u##x0, u##x1, u##x2, u##x3);                                                        \
@@ -918,6 +919,12 @@ static void sosemanuk_internal(sosemanuk_run_context* rc)
         dst[(ooff / 4) + 2] = src[(ooff / 4) + 2] ^ U32TO32_LITTLE(u##x2 ^ v2);                    \
         dst[(ooff / 4) + 3] = src[(ooff / 4) + 3] ^ U32TO32_LITTLE(u##x3 ^ v3);                    \
         POUT((unsigned char*)dst + ooff);                                                          \
+      } else {                                                                                     \
+        /* no keystream from the rounds that were cut off */                                      \
+        dst[(ooff / 4)] = src[(ooff / 4)];                                                         \
+        dst[(ooff / 4) + 1] = src[(ooff / 4) + 1];                                                 \
+        dst[(ooff / 4) + 2] = src[(ooff / 4) + 2];                                                 \
+        dst[(ooff / 4) + 3] = src[(ooff / 4) + 3];                                                 \
       }                                                                                            \
     } while (0)
 #else
@@ -1076,6 +1083,27 @@ static void sosemanuk_internal(sosemanuk_run_context* rc)
 #endif
 }
 
+#if defined SOSEMANUK_ECRYPT
+
+/*
+ * sosemanuk_internal() with the round count fixed at compile time, so the
+ * per-step round checks fold away. One block is 25 steps; anything above
+ * that runs the full cipher.
+ */
+template <unsigned Rounds>
+struct sosemanuk_unrolled {
+    static void run(SOSEMANUK_ctx* rc, const u32* src, u32* dst) {
+        sosemanuk_internal<Rounds>(rc, src, dst);
+    }
+};
+
+ECRYPT_Sosemanuk::ECRYPT_Sosemanuk(int rounds)
+    : estream_interface(rounds)
+    , _internal(select_unrolled<sosemanuk_unrolled, 25>(
+              std::max(rounds, 0), &sosemanuk_unrolled<25>::run)) {}
+
+#endif
+
 #if !defined SOSEMANUK_ECRYPT && !defined SOSEMANUK_SPEED
 
 /*
@@ -1132,20 +1160,20 @@ void ECRYPT_Sosemanuk::SOSEMANUK_process_bytes(
     SOSEMANUK_ctx* ctx = (SOSEMANUK_ctx*)ctxa;
     (void)action;
 
-    while (msglen > 0) {
+    /* whole blocks go straight between the caller's buffers */
+    for (; msglen >= SOSEMANUK_BLOCKLENGTH; msglen -= SOSEMANUK_BLOCKLENGTH) {
+        _internal(ctx, (const u32*)input, (u32*)output);
+        input += SOSEMANUK_BLOCKLENGTH;
+        output += SOSEMANUK_BLOCKLENGTH;
+    }
+
+    if (msglen > 0) {
         u32 ibuf[SOSEMANUK_BLOCKLENGTH / 4];
         u32 obuf[SOSEMANUK_BLOCKLENGTH / 4];
-        size_t len;
-
-        len = sizeof ibuf;
-        if (len > msglen)
-            len = msglen;
-        memcpy(ibuf, input, len);
-        sosemanuk_internal(ctx, ibuf, obuf);
-        memcpy(output, obuf, len);
-        input += len;
-        output += len;
-        msglen -= len;
+
+        memcpy(ibuf, input, msglen);
+        _internal(ctx, ibuf, obuf);
+        memcpy(output, obuf, msglen);
     }
 }
 
@@ -1156,7 +1184,7 @@ void ECRYPT_Sosemanuk::SOSEMANUK_keystream_bytes(SOSEMANUK_ctx* ctx, u8* keystre
     while (length > 0) {
         u32 tbuf[SOSEMANUK_BLOCKLENGTH / 4];
 
-        sosemanuk_internal(ctx, zb, tbuf);
+        _internal(ctx, zb, tbuf);
         if (length >= SOSEMANUK_BLOCKLENGTH) {
             memcpy(keystream, tbuf, SOSEMANUK_BLOCKLENGTH);
             keystream += SOSEMANUK_BLOCKLENGTH;
@@ -1174,7 +1202,7 @@ void ECRYPT_Sosemanuk::SOSEMANUK_process_blocks(
     (void)action;
 
     while (blocks-- > 0) {
-        sosemanuk_internal(ctx, (u32*)input, (u32*)output);
+        _internal(ctx, (const u32*)input, (u32*)output);
         input += SOSEMANUK_BLOCKLENGTH;
         output += SOSEMANUK_BLOCKLENGTH;
     }
@@ -1185,7 +1213,7 @@ void ECRYPT_Sosemanuk::SOSEMANUK_keystream_blocks(SOSEMANUK_ctx* ctx, u8* keystr
     static const u32 zb[SOSEMANUK_BLOCKLENGTH / 4] = {};
 
     while (blocks-- > 0) {
-        sosemanuk_internal(ctx, zb, (u32*)keystream);
+        _internal(ctx, zb, (u32*)keystream);
         keystream += SOSEMANUK_BLOCKLENGTH;
     }
 }
@@ -14,6 +14,7 @@ Public domain.
 */
 
 #include "chacha.h"
+#include "../../unrolled_rounds.h"
 
 namespace stream_ciphers {
 namespace others {
@@ -29,6 +30,30 @@ namespace others {
   x[a] = PLUS(x[a],x[b]); x[d] = ROTATE(XOR(x[d],x[a]), 8); \
   x[c] = PLUS(x[c],x[d]); x[b] = ROTATE(XOR(x[b],x[c]), 7);
 
+static UNROLLED_INLINE void chacha_column_round(u32 x[16])
+{
+    QUARTERROUND( 0, 4, 8,12)
+    QUARTERROUND( 1, 5, 9,13)
+    QUARTERROUND( 2, 6,10,14)
+    QUARTERROUND( 3, 7,11,15)
+}
+
+static UNROLLED_INLINE void chacha_diagonal_round(u32 x[16])
+{
+    QUARTERROUND(0, 5, 10, 15)
+    QUARTERROUND(1, 6, 11, 12)
+    QUARTERROUND(2, 7, 8, 13)
+    QUARTERROUND(3, 4, 9, 14)
+}
+
+static UNROLLED_INLINE void chacha_output(u8 output[64], u32 x[16], const u32 input[16])
+{
+    int i;
+
+    for (i = 0;i < 16;++i) x[i] = PLUS(x[i],input[i]);
+    for (i = 0;i < 16;++i) U32TO8_LITTLE(output + 4 * i,x[i]);
+}
+
 static void salsa20_wordtobyte(u8 output[64],const u32 input[16], unsigned nr)
 {
     u32 x[16];
@@ -36,22 +61,43 @@ static void salsa20_wordtobyte(u8 output[64],const u32 input[16], unsigned nr)
 
     for (i = 0;i < 16;++i) x[i] = input[i];
     for (i = nr;i > 0;i -= 2) {
-        QUARTERROUND( 0, 4, 8,12)
-        QUARTERROUND( 1, 5, 9,13)
-        QUARTERROUND( 2, 6,10,14)
-        QUARTERROUND( 3, 7,11,15)
+        chacha_column_round(x);
 
         if (i - 1 > 0) {
-            QUARTERROUND(0, 5, 10, 15)
-            QUARTERROUND(1, 6, 11, 12)
-            QUARTERROUND(2, 7, 8, 13)
-            QUARTERROUND(3, 4, 9, 14)
+            chacha_diagonal_round(x);
         }
     }
-    for (i = 0;i < 16;++i) x[i] = PLUS(x[i],input[i]);
-    for (i = 0;i < 16;++i) U32TO8_LITTLE(output + 4 * i,x[i]);
+    chacha_output(output, x, input);
 }
 
+struct chacha_doubleround_op {
+    static UNROLLED_INLINE void apply(u32 x[16])
+    {
+        chacha_column_round(x);
+        chacha_diagonal_round(x);
+    }
+};
+
+/* Same as salsa20_wordtobyte(), with the rounds unrolled for a fixed round count */
+template <unsigned Rounds>
+struct chacha_unrolled {
+    static void run(u8 output[64], const u32 input[16], unsigned)
+    {
+        u32 x[16];
+        int i;
+
+        for (i = 0;i < 16;++i) x[i] = input[i];
+        unroll<Rounds / 2>::template apply<chacha_doubleround_op>(x);
+        /* an odd round count ends with a column round, as in the loop above */
+        if (Rounds & 1) chacha_column_round(x);
+        chacha_output(output, x, input);
+    }
+};
+
+Chacha::Chacha(int rounds)
+    : stream_interface(rounds)
+    , _wordtobyte(select_unrolled<chacha_unrolled, CHACHA_FULL_ROUNDS>(rounds, &salsa20_wordtobyte)) {}
+
 static const char sigma[] = "expand 32-byte k";
 static const char tau[] = "expand 16-byte k";
 
@@ -97,7 +143,7 @@ void Chacha::encrypt_bytes(const u8 *m, u8 *c, const u32 msglen)
 
     if (!bytes) return;
     for (;;) {
-        salsa20_wordtobyte(output, x->input, (unsigned int) _rounds);
+        _wordtobyte(output, x->input, (unsigned int) _rounds);
         x->input[12] = PLUSONE(x->input[12]);
         if (!x->input[12]) {
             x->input[13] = PLUSONE(x->input[13]);
@@ -24,9 +24,12 @@ class Chacha : public stream_interface {
         u32 input[16]; /* could be compressed */
     } _ctx;
 
+    /* Keystream block function, specialised (unrolled) for the round count */
+    typedef void (*wordtobyte_fn)(u8 output[64], const u32 input[16], unsigned nr);
+    const wordtobyte_fn _wordtobyte;
+
 public:
-    Chacha(int rounds=CHACHA_FULL_ROUNDS)
-        : stream_interface(rounds) {}
+    Chacha(int rounds=CHACHA_FULL_ROUNDS);
 
     void init() override {}
 
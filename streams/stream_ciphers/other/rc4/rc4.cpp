@@ -17,69 +17,139 @@
 namespace stream_ciphers {
 namespace others {
 
-#include <stdlib.h>
-
 static const unsigned state_size = 256;
 
 /*********************** FUNCTION DEFINITIONS ***********************/
-static void arcfour_key_setup(std::uint8_t state[state_size], const std::uint8_t key[], const int len)
+// Repeats the key cyclically over the whole state, so the KSA does not need `i % len`
+static void arcfour_expand_key(std::uint8_t expanded[state_size], const std::uint8_t key[], const unsigned len)
 {
-    int i, j;
+    for (unsigned i = 0; i < state_size; ++i)
+        expanded[i] = key[i % len];
+}
+
+// Runs the KSA of N independent states in one loop. Expects keys expanded by arcfour_expand_key.
+template <unsigned N>
+static void arcfour_key_setup(std::uint8_t *const state[N], const std::uint8_t *const key[N])
+{
+    unsigned j[N];
     std::uint8_t t;
 
-    for (i = 0; i < state_size; ++i)
-        state[i] = i;
-    for (i = 0, j = 0; i < state_size; ++i) {
-        j = (j + state[i] + key[i % len]) % 256;
-        t = state[i];
-        state[i] = state[j];
-        state[j] = t;
+    for (unsigned l = 0; l < N; ++l) {
+        j[l] = 0;
+        for (unsigned i = 0; i < state_size; ++i)
+            state[l][i] = std::uint8_t(i);
+    }
+    for (unsigned i = 0; i < state_size; ++i) {
+        for (unsigned l = 0; l < N; ++l) {
+            j[l] = (j[l] + state[l][i] + key[l][i]) % 256;
+            t = state[l][i];
+            state[l][i] = state[l][j[l]];
+            state[l][j[l]] = t;
+        }
     }
 }
 
-// This does not hold state between calls. It always generates the
-// stream starting from the first  output byte.
+// Runs the PRGA of N independent states in one loop and xors the keystream into `out`.
 // indices i and j has to be part of internal state - they were added to the former API
-static void arcfour_generate_stream(std::uint8_t state[], std::uint8_t out[], const size_t len, int &i, int &j)
+template <unsigned N>
+static void arcfour_crypt(std::uint8_t *const state[N],
+                          const std::uint8_t *const in[N],
+                          std::uint8_t *const out[N],
+                          const size_t len,
+                          int i[N],
+                          int j[N])
 {
     size_t idx;
     std::uint8_t t;
 
-    for (idx = 0; idx < len; ++idx)  {
-        i = (i + 1) % 256;
-        j = (j + state[i]) % 256;
-        t = state[i];
-        state[i] = state[j];
-        state[j] = t;
-        out[idx] = state[(state[i] + state[j]) % 256];
+    for (idx = 0; idx < len; ++idx) {
+        for (unsigned l = 0; l < N; ++l) {
+            i[l] = (i[l] + 1) % 256;
+            j[l] = (j[l] + state[l][i[l]]) % 256;
+            t = state[l][i[l]];
+            state[l][i[l]] = state[l][j[l]];
+            state[l][j[l]] = t;
+            out[l][idx] = in[l][idx] ^ state[l][(state[l][i[l]] + state[l][j[l]]) % 256];
+        }
     }
 }
 
 void rc4::keysetup(const u8* key, const u32 key_bitsize, const u32 iv_bitsize) {
+    const u32 key_size = key_bitsize / 8;
+    if (key_size == 0 || key_size > state_size)
+        throw std::runtime_error("RC4 key has to be 1 to 256 bytes long");
+
     _ctx.i = 0;
     _ctx.j = 0;
-    _ctx.key = std::make_unique<std::uint8_t[]>(key_bitsize / 8);
-    std::copy_n(key, key_bitsize / 8, _ctx.key.get());
-    arcfour_key_setup(_ctx.state, _ctx.key.get(), int(key_bitsize / 8));
+    _ctx.key_size = key_size;
+    arcfour_expand_key(_ctx.key, key, key_size);
+
+    std::uint8_t *state[1] = {_ctx.state};
+    const std::uint8_t *expanded[1] = {_ctx.key};
+    arcfour_key_setup<1>(state, expanded);
     if (iv_bitsize > 0)
         throw std::runtime_error("RC4 is not using IV");
 }
 
-void rc4::ivsetup(const u8* iv) { }
+void rc4::ivsetup(const u8*) { }
 
 void rc4::encrypt_bytes(const u8 *plaintext, u8 *ciphertext, const u32 ptx_size) {
-    // prepare stream
-    auto stream = std::make_unique<std::uint8_t[]>(ptx_size);
-    arcfour_generate_stream(_ctx.state, stream.get(), ptx_size, _ctx.i, _ctx.j);
-    // xor it with input
-    for (unsigned i = 0; i < ptx_size; ++i) {
-        ciphertext[i] = plaintext[i] ^ stream[i];
-    }
+    std::uint8_t *state[1] = {_ctx.state};
+    arcfour_crypt<1>(state, &plaintext, &ciphertext, ptx_size, &_ctx.i, &_ctx.j);
 }
 
 void rc4::decrypt_bytes(const u8* ciphertext, u8* plaintext, const u32 ctx_size) {
     encrypt_bytes(ciphertext, plaintext, ctx_size);
 }
 
+void rc4::encrypt_bytes_multi(const u8* keys,
+                              const u32 key_bitsize,
+                              const u8* plaintexts,
+                              u8* ciphertexts,
+                              const u32 msglen,
+                              const std::size_t count) {
+    const u32 key_size = key_bitsize / 8;
+    if (key_size == 0 || key_size > state_size)
+        throw std::runtime_error("RC4 key has to be 1 to 256 bytes long");
+
+    std::uint8_t states[lanes][state_size];
+    std::uint8_t expanded[lanes][state_size];
+
+    std::size_t n = 0;
+    for (; n + lanes <= count; n += lanes) {
+        std::uint8_t *state[lanes];
+        const std::uint8_t *key[lanes];
+        const std::uint8_t *in[lanes];
+        std::uint8_t *out[lanes];
+        int i[lanes], j[lanes];
+
+        for (unsigned l = 0; l < lanes; ++l) {
+            arcfour_expand_key(expanded[l], keys + (n + l) * key_size, key_size);
+            state[l] = states[l];
+            key[l] = expanded[l];
+            in[l] = plaintexts + (n + l) * msglen;
+            out[l] = ciphertexts + (n + l) * msglen;
+            i[l] = 0;
+            j[l] = 0;
+        }
+        arcfour_key_setup<lanes>(state, key);
+        arcfour_crypt<lanes>(state, in, out, msglen, i, j);
+
+        if (n + lanes == count) {
+            // leave the instance in the same state as the sequential path would
+            std::copy_n(states[lanes - 1], state_size, _ctx.state);
+            std::copy_n(expanded[lanes - 1], state_size, _ctx.key);
+            _ctx.key_size = key_size;
+            _ctx.i = i[lanes - 1];
+            _ctx.j = j[lanes - 1];
+        }
+    }
+
+    for (; n < count; ++n) {
+        keysetup(keys + n * key_size, key_bitsize, 0);
+        encrypt_bytes(plaintexts + n * msglen, ciphertexts + n * msglen, msglen);
+    }
+}
+
 } // namespace others
 } // namespace stream_ciphers
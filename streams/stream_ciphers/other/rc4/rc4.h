@@ -5,7 +5,7 @@
  */
 
 #include "../../stream_interface.h"
-#include <memory>
+#include <cstddef>
 #include <cstdint>
 
 namespace stream_ciphers {
@@ -15,18 +15,31 @@ class rc4 : public stream_interface {
 
     /* Data structures */
 
+    static const unsigned state_size = 256;
+
     struct rc4_ctx {
 
         rc4_ctx()
-            : state{0} {}
+            : state{0}
+            , key{0}
+            , key_size(0)
+            , i(0)
+            , j(0) {}
 
-        std::uint8_t state[256];
-        std::unique_ptr<std::uint8_t[]> key;
+        std::uint8_t state[state_size];
+        // key repeated cyclically up to state_size, so KSA can index it directly
+        std::uint8_t key[state_size];
         std::uint32_t key_size;
         int i, j;
     } _ctx;
 
 public:
+    /**
+     * Number of independent RC4 states advanced together by the interleaved
+     * KSA/PRGA in encrypt_bytes_multi().
+     */
+    static const unsigned lanes = 4;
+
     rc4(int rounds)
         : stream_interface(rounds) {}
 
@@ -39,6 +52,32 @@ public:
     void encrypt_bytes(const u8* plaintext, u8* ciphertext, const u32 ptx_size) override;
 
     void decrypt_bytes(const u8* ciphertext, u8* plaintext, const u32 ctx_size) override;
+
+    /**
+     * Encrypts `count` messages of `msglen` bytes, each one under its own key.
+     * Keys, plaintexts and ciphertexts are stored contiguously. Equivalent to calling
+     * keysetup() and encrypt_bytes() for each message in turn (the instance ends up keyed
+     * with the last key), but up to `lanes` states are processed in one loop to hide
+     * the latency of the dependent loads in the state-table swaps.
+     */
+    void encrypt_bytes_multi(const u8* keys,
+                             const u32 key_bitsize,
+                             const u8* plaintexts,
+                             u8* ciphertexts,
+                             const u32 msglen,
+                             const std::size_t count);
+
+    /* RC4 has no IV, so this is encrypt_bytes_multi() above with the IVs ignored */
+    void encrypt_bytes_multi(const u8* keys,
+                             const u32 keysize,
+                             const u8* /* ivs */,
+                             const u32 /* ivsize */,
+                             const u8* plaintexts,
+                             u8* ciphertexts,
+                             const u32 msglen,
+                             const std::size_t count) override {
+        encrypt_bytes_multi(keys, keysize, plaintexts, ciphertexts, msglen, count);
+    }
 };
 
 } // namespace others
@@ -5,7 +5,7 @@
 
 #include "estream/abc/ecrypt-sync.h"
 #include "estream/achterbahn/ecrypt-sync.h"
-// #include "estream/cryptmt/ecrypt-sync.h" // Doesn't work on debian
+#include "estream/cryptmt/ecrypt-sync.h"
 #include "estream/decim/ecrypt-sync.h"
 #include "estream/dicing/ecrypt-sync.h"
 #include "estream/dragon/ecrypt-sync.h"
@@ -42,7 +42,7 @@ std::unique_ptr<stream_interface> create_stream_cipher(const std::string &name,
     // eSTREAM
     if (name == "ABC")              return std::make_unique<estream::ECRYPT_ABC>();
     if (name == "Achterbahn")       return std::make_unique<estream::ECRYPT_Achterbahn>();
-    // if (name == "CryptMT")          return std::make_unique<estream::ECRYPT_Cryptmt>(); // Doesn't work on debian
+    if (name == "CryptMT")          return std::make_unique<estream::ECRYPT_Cryptmt>();
     if (name == "DECIM")            return std::make_unique<estream::ECRYPT_Decim>(round);
     if (name == "DICING")           return std::make_unique<estream::ECRYPT_Dicing>();
     if (name == "Dragon")           return std::make_unique<estream::ECRYPT_Dragon>(round);
@@ -83,6 +83,9 @@ stream_cipher::stream_cipher(const std::string &name,
                              const std::size_t key_size)
     : _iv(iv_size)
     , _key(key_size)
+    , _iv_size(iv_size)
+    , _key_size(key_size)
+    , _batch(0)
     , _encryptor(create_stream_cipher(name, round))
     , _decryptor(create_stream_cipher(name, round)) {
     _encryptor->init();
@@ -106,6 +109,35 @@ void stream_cipher::setup_key_iv(std::unique_ptr<stream> &key, std::unique_ptr<s
     _decryptor->ivsetup(_iv.data());
 }
 
+void stream_cipher::read_key_iv_batch(std::unique_ptr<stream> &key,
+                                      std::unique_ptr<stream> &iv,
+                                      const std::size_t count) {
+    _key_size = key->osize();
+    _iv_size = iv->osize();
+    _batch = count;
+    _key.resize(count * _key_size);
+    _iv.resize(count * _iv_size);
+
+    for (std::size_t n = 0; n < count; ++n) {
+        vec_cview key_data = key->next();
+        std::copy(key_data.begin(), key_data.end(), _key.begin() + std::ptrdiff_t(n * _key_size));
+        vec_cview iv_data = iv->next();
+        std::copy(iv_data.begin(), iv_data.end(), _iv.begin() + std::ptrdiff_t(n * _iv_size));
+    }
+}
+
+void stream_cipher::encrypt_batch(const u8 *plaintexts, u8 *ciphertexts, std::size_t size) {
+    // BEWARE: only able to proccess max 2GB of plaintext per message
+    _encryptor->encrypt_bytes_multi(_key.data(),
+                                    u32(8 * _key_size),
+                                    _iv.data(),
+                                    u32(8 * _iv_size),
+                                    plaintexts,
+                                    ciphertexts,
+                                    u32(size),
+                                    _batch);
+}
+
 void stream_cipher::encrypt(const u8 *plaintext, u8 *ciphertext, std::size_t size) {
     // BEWARE: only able to proccess max 2GB of plaintext
     _encryptor->encrypt_bytes(plaintext, ciphertext, u32(size));
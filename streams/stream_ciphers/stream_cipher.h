@@ -25,12 +25,29 @@ struct stream_cipher {
 
     void setup_key_iv(std::unique_ptr<stream> &key, std::unique_ptr<stream> &iv);
 
+    /**
+     * Draws `count` key/IV pairs from the streams, in the same order as `count` calls
+     * of setup_key_iv() would, for the following encrypt_batch().
+     */
+    void read_key_iv_batch(std::unique_ptr<stream> &key,
+                           std::unique_ptr<stream> &iv,
+                           const std::size_t count);
+
+    /**
+     * Encrypts consecutive messages of `size` bytes, the n-th one under the n-th key/IV
+     * pair read by read_key_iv_batch(). Only the encryptor is rekeyed.
+     */
+    void encrypt_batch(const std::uint8_t *plaintexts, std::uint8_t *ciphertexts, const std::size_t size);
+
     void encrypt(const std::uint8_t *plaintext, std::uint8_t *ciphertext, const std::size_t size);
     void decrypt(const std::uint8_t *ciphertext, std::uint8_t *plaintext, const std::size_t size);
 
 protected:
     std::vector<value_type> _iv;
     std::vector<value_type> _key;
+    std::size_t _iv_size;
+    std::size_t _key_size;
+    std::size_t _batch;
 
     std::unique_ptr<stream_interface> _encryptor;
     std::unique_ptr<stream_interface> _decryptor;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "estream/ecrypt-portable.h"
+#include <cstddef>
 
 namespace stream_ciphers {
 
@@ -21,6 +22,27 @@ struct stream_interface {
     virtual void encrypt_bytes(const u8 *plaintext, u8 *ciphertext, const u32 msglen) = 0;
     virtual void decrypt_bytes(const u8 *ciphertext, u8 *plaintext, const u32 msglen) = 0;
 
+    /**
+     * Encrypts `count` messages of `msglen` bytes, the n-th one under the n-th key and IV.
+     * Keys, IVs, plaintexts and ciphertexts are stored contiguously. The default runs
+     * keysetup(), ivsetup() and encrypt_bytes() for each message in turn (the instance ends
+     * up keyed with the last pair); ciphers with multi-instance kernels override it.
+     */
+    virtual void encrypt_bytes_multi(const u8 *keys,
+                                     const u32 keysize,
+                                     const u8 *ivs,
+                                     const u32 ivsize,
+                                     const u8 *plaintexts,
+                                     u8 *ciphertexts,
+                                     const u32 msglen,
+                                     const std::size_t count) {
+        for (std::size_t n = 0; n < count; ++n) {
+            keysetup(keys + n * (keysize / 8), keysize, ivsize);
+            ivsetup(ivs + n * (ivsize / 8));
+            encrypt_bytes(plaintexts + n * msglen, ciphertexts + n * msglen, msglen);
+        }
+    }
+
 protected:
     const int _rounds;
 };
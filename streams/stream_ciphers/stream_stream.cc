@@ -12,10 +12,13 @@ stream_stream::stream_stream(
     , _reinit(config.at("key").at("type") == "repeating_stream" or
               config.at("iv").at("type") == "repeating_stream")
     , _block_size(config.at("block_size"))
+    , _rekey_batch(_reinit ? config.value("rekey_batch", std::size_t(1)) : 1)
+    , _batch_pos(_rekey_batch)
     , _iv_stream(make_stream(config.at("iv"), seeder, pipes, config.value("iv_size", std::size_t(default_iv_size))))
     , _key_stream(make_stream(config.at("key"), seeder, pipes, config.value("key_size", std::size_t(default_key_size))))
     , _source(make_stream(config.at("plaintext"), seeder, pipes, _block_size))
-    , _plaintext(osize)
+    , _plaintext(osize * _rekey_batch)
+    , _ciphertext(_rekey_batch > 1 ? osize * _rekey_batch : 0)
     , _algorithm(config.at("algorithm"),
                  unsigned(config.at("round")),
                  _iv_stream->osize(),
@@ -24,6 +27,8 @@ stream_stream::stream_stream(
     if (osize % _block_size != 0) // not necessary wrong, but we never needed this, we always did
                                   // this by mistake. Change to warning if needed
         throw std::runtime_error("Output size is not multiple of block size");
+    if (_rekey_batch == 0)
+        throw std::runtime_error("Rekey batch has to be at least 1");
 
     logger::info() << "stream source is estream cipher: " << config.at("algorithm") << std::endl;
 
@@ -34,17 +39,38 @@ stream_stream::stream_stream(
 
 vec_cview stream_stream::next() {
     if (_reinit) {
-        _algorithm.setup_key_iv(_key_stream, _iv_stream);
-    }
-    for (auto beg = _plaintext.begin(); beg != _plaintext.end(); beg += _block_size) {
-        vec_cview view = _source->next();
+        // Keys and IVs of a whole batch are drawn first, then the plaintexts. With the default
+        // batch of 1 this is the same order as rekeying before each test vector.
+        if (_batch_pos == _rekey_batch) {
+            _algorithm.read_key_iv_batch(_key_stream, _iv_stream, _rekey_batch);
+            read_plaintext();
+            // a single test vector goes straight to the output
+            if (_rekey_batch == 1) {
+                _algorithm.encrypt_batch(_plaintext.data(), _data.data(), osize());
+                return make_cview(_data);
+            }
+            _algorithm.encrypt_batch(_plaintext.data(), _ciphertext.data(), osize());
+            _batch_pos = 0;
+        }
+        auto beg = _ciphertext.cbegin() + std::ptrdiff_t(_batch_pos * osize());
+        std::copy(beg, beg + std::ptrdiff_t(osize()), _data.begin());
+        ++_batch_pos;
 
-        std::move(view.begin(), view.end(), beg);
+        return make_cview(_data);
     }
 
+    read_plaintext();
     _algorithm.encrypt(_plaintext.data(), _data.data(), _plaintext.size());
 
     return make_cview(_data);
 }
 
+void stream_stream::read_plaintext() {
+    for (auto beg = _plaintext.begin(); beg != _plaintext.end(); beg += _block_size) {
+        vec_cview view = _source->next();
+
+        std::move(view.begin(), view.end(), beg);
+    }
+}
+
 } // namespace stream_ciphers
@@ -16,9 +16,13 @@ struct stream_stream : stream {
     vec_cview next() override;
 
 private:
+    void read_plaintext();
 
     const bool _reinit;
     const std::size_t _block_size;
+    // number of test vectors rekeyed and encrypted in one call when reinitializing per TV
+    const std::size_t _rekey_batch;
+    std::size_t _batch_pos;
     constexpr static unsigned default_iv_size = 16;
     constexpr static unsigned default_key_size = 16;
 
@@ -28,6 +32,8 @@ private:
     std::unique_ptr<stream> _source;
 
     std::vector<std::uint8_t> _plaintext;
+    // outputs of a rekey batch, unused with a batch of 1
+    std::vector<std::uint8_t> _ciphertext;
 
     stream_cipher _algorithm;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <utility>
+
+/* Round functions are forced inline, otherwise the unrolled chain turns into calls */
+#if defined(__GNUC__) || defined(__clang__)
+#define UNROLLED_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define UNROLLED_INLINE __forceinline
+#else
+#define UNROLLED_INLINE inline
+#endif
+
+namespace stream_ciphers {
+
+/**
+ * Applies Round::apply(state) N times. The calls are expanded at compile time, so the
+ * round function is fully unrolled and the cipher state can stay in registers.
+ */
+template <unsigned N>
+struct unroll {
+    template <typename Round, typename State>
+    static UNROLLED_INLINE void apply(State state) {
+        Round::apply(state);
+        unroll<N - 1>::template apply<Round>(state);
+    }
+};
+
+template <>
+struct unroll<0> {
+    template <typename Round, typename State>
+    static UNROLLED_INLINE void apply(State) {}
+};
+
+template <template <unsigned> class Kernel, typename Fn, unsigned... Rounds>
+Fn select_unrolled(const int rounds, Fn fallback, std::integer_sequence<unsigned, Rounds...>) {
+    static const Fn kernels[] = {&Kernel<Rounds>::run...};
+
+    if (rounds < 0 || unsigned(rounds) >= sizeof...(Rounds))
+        return fallback;
+    return kernels[rounds];
+}
+
+/**
+ * Returns Kernel<rounds>::run when 0 <= rounds <= MaxRounds, the runtime-loop fallback
+ * otherwise. Kernel<R>::run and fallback share the signature Fn; the specialisations
+ * ignore any round count argument, it is there only for the fallback.
+ */
+template <template <unsigned> class Kernel, unsigned MaxRounds, typename Fn>
+Fn select_unrolled(const int rounds, Fn fallback) {
+    return select_unrolled<Kernel>(
+            rounds, fallback, std::make_integer_sequence<unsigned, MaxRounds + 1>());
+}
+
+} // namespace stream_ciphers
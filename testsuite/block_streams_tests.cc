@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <testsuite/test_utils/block_test_case.h>
+#include <testsuite/test_utils/common_functions.h>
+#include <streams/block/block_factory.h>
+#include <thread>
 
 TEST(aes, test_vectors) {
     testsuite::block_test_case("AES", 10)();
@@ -353,3 +356,222 @@ TEST(twine, round_reduction) {
 TEST(lowmc, test_vectors) {
     testsuite::block_test_case("LOWMC", 12)();
 }
+
+static std::vector<std::uint8_t> encrypt_blocks(block::block_cipher& cipher,
+                                                const std::uint8_t key_seed,
+                                                const std::size_t blocks) {
+    std::vector<std::uint8_t> key(16);
+    for (std::size_t i = 0; i < key.size(); ++i)
+        key[i] = std::uint8_t(key_seed + i);
+    std::vector<std::uint8_t> plaintext(16);
+    std::vector<std::uint8_t> ciphertext(16 * blocks);
+
+    cipher.keysetup(key.data(), key.size());
+    for (std::size_t b = 0; b < blocks; ++b) {
+        plaintext[0] = std::uint8_t(b);
+        plaintext[1] = std::uint8_t(b >> 8);
+        cipher.encrypt(plaintext.data(), &ciphertext[16 * b]);
+    }
+    return ciphertext;
+}
+
+TEST(block_ciphers, concurrent_instances) {
+    // ciphers which used to keep rounds or key schedules in file-scope statics
+    const std::vector<std::string> names = {"AES", "MARS", "SERPENT", "TWOFISH"};
+    const std::size_t rounds[2] = {1, 4};
+    const std::size_t blocks = 2000;
+
+    for (const auto& name : names) {
+        std::vector<std::uint8_t> expected[2];
+        for (std::size_t n = 0; n < 2; ++n) {
+            auto cipher = block::make_block_cipher(name, rounds[n]);
+            expected[n] = encrypt_blocks(*cipher, std::uint8_t(n + 1), blocks);
+        }
+
+        std::vector<std::uint8_t> actual[2];
+        std::vector<std::thread> threads;
+        for (std::size_t n = 0; n < 2; ++n) {
+            threads.emplace_back([&, n] {
+                auto cipher = block::make_block_cipher(name, rounds[n]);
+                for (int rep = 0; rep < 8; ++rep)
+                    actual[n] = encrypt_blocks(*cipher, std::uint8_t(n + 1), blocks);
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        ASSERT_EQ(expected[0], actual[0]) << name;
+        ASSERT_EQ(expected[1], actual[1]) << name;
+    }
+}
+
+static void expect_multi_block_matches_single_block(const std::string& name,
+                                                    const std::size_t rounds,
+                                                    const std::size_t block_size,
+                                                    const std::size_t key_size) {
+    std::vector<std::uint8_t> key(key_size);
+    for (std::size_t i = 0; i < key.size(); ++i)
+        key[i] = std::uint8_t(3 * i + 1);
+
+    // not multiples of the lane counts, so the tails are exercised too
+    for (const std::size_t nblocks : {1, 5, 9, 37, 325}) {
+        const std::size_t len = nblocks * block_size;
+        std::vector<std::uint8_t> plaintext(len);
+        for (std::size_t i = 0; i < len; ++i)
+            plaintext[i] = std::uint8_t(7 * i + nblocks);
+
+        auto enc = block::make_block_cipher(name, rounds, block_size, key_size, true);
+        enc->keysetup(key.data(), key.size());
+        auto dec = block::make_block_cipher(name, rounds, block_size, key_size, false);
+        dec->keysetup(key.data(), key.size());
+
+        std::vector<std::uint8_t> expected(len);
+        for (std::size_t b = 0; b < nblocks; ++b)
+            enc->encrypt(&plaintext[b * block_size], &expected[b * block_size]);
+
+        std::vector<std::uint8_t> actual(len);
+        enc->encrypt_blocks(plaintext.data(), actual.data(), nblocks, block_size);
+        ASSERT_EQ(expected, actual) << name << " " << rounds << " " << nblocks;
+
+        std::vector<std::uint8_t> in_place(plaintext);
+        enc->encrypt_blocks(in_place.data(), in_place.data(), nblocks, block_size);
+        ASSERT_EQ(expected, in_place) << name << " " << rounds << " " << nblocks;
+
+        std::vector<std::uint8_t> decrypted(len);
+        for (std::size_t b = 0; b < nblocks; ++b)
+            dec->decrypt(&expected[b * block_size], &decrypted[b * block_size]);
+
+        dec->decrypt_blocks(expected.data(), actual.data(), nblocks, block_size);
+        ASSERT_EQ(decrypted, actual) << name << " " << rounds << " " << nblocks;
+
+        dec->decrypt_blocks(in_place.data(), in_place.data(), nblocks, block_size);
+        ASSERT_EQ(decrypted, in_place) << name << " " << rounds << " " << nblocks;
+    }
+}
+
+TEST(block_ciphers, multi_block_matches_single_block) {
+    struct params {
+        std::string name;
+        std::size_t rounds, block_size, key_size;
+    };
+    const std::vector<params> ciphers = {
+            {"AES", 10, 16, 16},       {"TEA", 32, 8, 16},       {"XTEA", 32, 8, 16},
+            {"KASUMI", 8, 8, 16},      {"NOEKEON", 16, 16, 16},  {"SHACAL2", 64, 32, 16},
+            {"MISTY1", 4, 8, 16},      {"SERPENT", 32, 16, 16},  {"LEA", 24, 16, 16},
+            {"LEA", 7, 16, 16},        {"SPARX-B64", 8, 8, 16},  {"ROBIN", 16, 16, 16},
+            {"TWINE", 35, 8, 10}};
+
+    for (const auto& p : ciphers)
+        expect_multi_block_matches_single_block(p.name, p.rounds, p.block_size, p.key_size);
+}
+
+TEST(block_ciphers, reduced_rounds_unchanged) {
+    // outputs of the ARIA, Camellia and Kuznyechik code before the rounds became table-driven
+    struct params {
+        std::string name;
+        std::size_t rounds, key_size;
+        std::string encrypted, decrypted;
+    };
+    const std::vector<params> vectors = {
+            {"ARIA", 1, 16, "b00dc2803d11724a04b2f207169a69cf", "738aa893e285a63e58ffc390ccd04cb4"},
+            {"ARIA", 5, 16, "ac7536cedfa15914e1fc2a9f88351306", "01542a4316f81416b5e881ef83ca3418"},
+            {"ARIA", 12, 16, "88857945716bd187ad0028ade6786908", "5262126dc56d1654be64b10d8ca45378"},
+            {"CAMELLIA", 1, 16, "35dc601b9a59e86c4a9a431c5a954d05", "74f909d56094e013e2d383353261a20a"},
+            {"CAMELLIA", 7, 16, "35248f73c5be75c48df1ade8f96f1e9a", "f94ac4b5910e757207a2881a352c5405"},
+            {"CAMELLIA", 18, 16, "5fdf6d04f8e53a12be3379d1c3942d0f", "51ea0f2869f16c5178f344c8359cd85e"},
+            {"CAMELLIA", 13, 32, "da1144d1eaff6b2aa35a3524bf221ecb", "b0651fb5ef8608f3073f5923f5e13c32"},
+            {"CAMELLIA", 24, 32, "b78b727a46f8ddb5bf30214670665193", "f42bf37b3dc6db2e3f36e96cde34bf1c"},
+            {"KUZNYECHIK", 2, 32, "05e8e3be170688e91f726478e83dabab", "e0b237c83a24090d07eaec9617fcb9be"},
+            {"KUZNYECHIK", 5, 32, "df3dc11813a3ff1275c6f2bb5c97c065", "7613e1d4d510b419ba3bbc98aa4ad201"},
+            {"KUZNYECHIK", 10, 32, "6a3937bd3249d64b1a0c1799203444c6", "d85d21fdff0f2008f2a3aa22af5433ca"}};
+
+    for (const auto& v : vectors) {
+        const auto key = testsuite::pattern_bytes(v.key_size, 7, 1);
+        const auto block = testsuite::pattern_bytes(16, 11, v.rounds);
+
+        for (const bool encrypt : {true, false}) {
+            auto cipher = block::make_block_cipher(v.name, v.rounds, 16, v.key_size, encrypt);
+            cipher->keysetup(key.data(), key.size());
+            std::vector<std::uint8_t> out(16);
+            if (encrypt)
+                cipher->encrypt(block.data(), out.data());
+            else
+                cipher->decrypt(block.data(), out.data());
+            ASSERT_EQ(encrypt ? v.encrypted : v.decrypted, testsuite::binary_to_hex_string(out))
+                    << v.name << " rounds " << v.rounds << (encrypt ? " encrypt" : " decrypt");
+        }
+    }
+}
+
+TEST(simon_speck, multi_block_all_parameter_sets) {
+    // (block size, key size) in bytes and full rounds of SIMON and SPECK for each set
+    const std::size_t sets[][4] = {{4, 8, 32, 22},   {6, 9, 36, 22},   {6, 12, 36, 23},
+                                   {8, 12, 42, 26},  {8, 16, 44, 27},  {12, 12, 52, 28},
+                                   {12, 18, 54, 29}, {16, 16, 68, 32}, {16, 24, 69, 33},
+                                   {16, 32, 72, 34}};
+
+    for (const auto& set : sets) {
+        for (const std::size_t rounds : {std::size_t(1), std::size_t(7), set[2]})
+            expect_multi_block_matches_single_block("SIMON", rounds, set[0], set[1]);
+        for (const std::size_t rounds : {std::size_t(1), std::size_t(7), set[3]})
+            expect_multi_block_matches_single_block("SPECK", rounds, set[0], set[1]);
+    }
+}
+
+TEST(des, multi_block_all_rounds) {
+    for (std::size_t rounds = 0; rounds <= 16; ++rounds) {
+        expect_multi_block_matches_single_block("SINGLE-DES", rounds, 8, 7);
+        expect_multi_block_matches_single_block("TRIPLE-DES", rounds, 8, 21);
+    }
+}
+
+TEST(lightweight, bitsliced_all_rounds) {
+    struct params {
+        std::string name;
+        std::size_t rounds, block_size, key_size;
+    };
+    const std::vector<params> ciphers = {
+            {"RECTANGLE-K80", 25, 8, 10}, {"RECTANGLE-K128", 25, 8, 16}, {"PRIDE", 20, 8, 16},
+            {"LED", 48, 8, 10},           {"TWINE", 35, 8, 10},          {"FANTOMAS", 12, 16, 16},
+            {"ROBIN", 16, 16, 16},        {"PICCOLO", 25, 8, 10},        {"LBLOCK", 32, 8, 10},
+            {"PRINCE", 12, 8, 16}};
+
+    for (const auto& p : ciphers) {
+        for (std::size_t rounds = 1; rounds <= p.rounds; ++rounds)
+            expect_multi_block_matches_single_block(p.name, rounds, p.block_size, p.key_size);
+    }
+}
+
+TEST(lightweight, keysetup_expands_whole_schedule) {
+    struct params {
+        std::string name;
+        std::size_t rounds, block_size, key_size;
+    };
+    const std::vector<params> ciphers = {
+            {"LED", 48, 8, 10},     {"LBLOCK", 32, 8, 10},        {"TWINE", 35, 8, 10},
+            {"HIGHT", 32, 8, 16},   {"PICCOLO", 25, 8, 10},       {"RECTANGLE-K80", 25, 8, 10},
+            {"SPARX-B64", 8, 8, 16}};
+
+    for (const auto& p : ciphers) {
+        std::vector<std::uint8_t> key(p.key_size);
+        for (std::size_t i = 0; i < key.size(); ++i)
+            key[i] = std::uint8_t(7 * i + 1);
+        const std::vector<std::uint8_t> plaintext(p.block_size, 0x5a);
+
+        // a rekeyed instance must not keep anything of the previous key
+        auto fresh = block::make_block_cipher(p.name, p.rounds, p.block_size, p.key_size, true);
+        fresh->keysetup(key.data(), key.size());
+        auto rekeyed = block::make_block_cipher(p.name, p.rounds, p.block_size, p.key_size, true);
+        const std::vector<std::uint8_t> other(p.key_size, 0xff);
+        rekeyed->keysetup(other.data(), other.size());
+        rekeyed->keysetup(key.data(), key.size());
+
+        std::vector<std::uint8_t> expected(p.block_size), actual(p.block_size);
+        fresh->encrypt(plaintext.data(), expected.data());
+        rekeyed->encrypt(plaintext.data(), actual.data());
+        EXPECT_EQ(expected, actual) << p.name;
+
+        const std::vector<std::uint8_t> wrong(p.key_size + 1);
+        EXPECT_THROW(fresh->keysetup(wrong.data(), wrong.size()), std::runtime_error) << p.name;
+    }
+}
@@ -1,11 +1,14 @@
 #include "stream.h"
 #include "streams.h"
 #include <eacirc-core/json.h>
+#include <eacirc-core/seed.h>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <streams/hash/hash_factory.h>
 #include <streams/hash/sha3/sha3_interface.h>
+#include <tuple>
 
+#include "testsuite/test_utils/common_functions.h"
 #include "testsuite/test_utils/hash_test_case.h"
 
 /** Source of test vectors http://csrc.nist.gov/groups/ST/hash/sha-3/index.html */
@@ -179,4 +182,431 @@ TEST(MCSSHA3, test_vectors) {
 
 TEST(Boole, test_vectors) {
     testsuite::hash_test_case("Boole", 16)();
-}
\ No newline at end of file
+}
+
+TEST(hash_batch, multi_buffer_matches_single_messages) {
+    const std::vector<std::pair<std::string, std::size_t>> hashes = {
+        {"MD5", 16}, {"SHA1", 20}, {"SHA2", 32}};
+    // 11 messages span a full group of lanes and a partial one
+    const std::size_t count = 11;
+
+    for (const auto &h : hashes) {
+        for (unsigned rounds : {0u, 1u, 7u, 16u, 33u, 64u, 65u, 80u, 100u}) {
+            auto batch_hasher = hash::hash_factory::create(h.first, rounds);
+            auto hasher = hash::hash_factory::create(h.first, rounds);
+
+            for (std::size_t len : {0u, 1u, 55u, 56u, 63u, 64u, 65u, 119u, 120u, 200u}) {
+                std::vector<std::uint8_t> data(count * len);
+                for (std::size_t i = 0; i < data.size(); ++i)
+                    data[i] = std::uint8_t(i * 131 + len);
+
+                std::vector<std::uint8_t> batch(count * h.second);
+                ASSERT_EQ(0,
+                          batch_hasher->HashBatch(
+                              int(h.second * 8), data.data(), 8 * len, count, batch.data()));
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    std::vector<std::uint8_t> single(h.second);
+                    hasher->Init(int(h.second * 8));
+                    hasher->Update(data.data() + i * len, 8 * len);
+                    hasher->Final(single.data());
+
+                    std::vector<std::uint8_t> from_batch(batch.begin() + i * h.second,
+                                                         batch.begin() + (i + 1) * h.second);
+                    ASSERT_EQ(single, from_batch) << h.first << " rounds " << rounds << " length "
+                                                  << len << " message " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(hash_batch, init_state_restored_between_messages) {
+    // CubeHash, LANE and BLAKE restore a snapshot taken after Init(), ARIRANG runs Init() each time
+    const std::vector<std::pair<std::string, unsigned>> hashes = {
+        {"CubeHash", 8}, {"CubeHash", 2}, {"LANE", 12}, {"LANE", 3}, {"ARIRANG", 4}, {"BLAKE", 14}};
+    const std::size_t count = 5;
+    const std::size_t hash_size = 32;
+
+    for (const auto &h : hashes) {
+        auto batch_hasher = hash::hash_factory::create(h.first, h.second);
+        auto hasher = hash::hash_factory::create(h.first, h.second);
+
+        for (std::size_t len : {0u, 16u, 64u, 150u}) {
+            std::vector<std::uint8_t> data(count * len);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                data[i] = std::uint8_t(i * 29 + len);
+
+            std::vector<std::uint8_t> batch(count * hash_size);
+            ASSERT_EQ(0,
+                      batch_hasher->HashBatch(
+                          int(hash_size * 8), data.data(), 8 * len, count, batch.data()));
+
+            for (std::size_t i = 0; i < count; ++i) {
+                std::vector<std::uint8_t> single(hash_size);
+                hasher->Init(int(hash_size * 8));
+                hasher->Update(data.data() + i * len, 8 * len);
+                hasher->Final(single.data());
+
+                std::vector<std::uint8_t> from_batch(batch.begin() + i * hash_size,
+                                                     batch.begin() + (i + 1) * hash_size);
+                ASSERT_EQ(single, from_batch)
+                    << h.first << " rounds " << h.second << " length " << len << " message " << i;
+            }
+        }
+    }
+}
+
+TEST(hash_batch, prefix_midstate_matches_whole_messages) {
+    const std::vector<std::tuple<std::string, unsigned, std::size_t>> hashes = {
+        std::make_tuple("MD5", 64, 16),       std::make_tuple("SHA1", 80, 20),
+        std::make_tuple("SHA2", 64, 32),      std::make_tuple("RIPEMD160", 80, 20),
+        std::make_tuple("Tiger", 24, 24),     std::make_tuple("Whirlpool", 10, 64),
+        std::make_tuple("CubeHash", 8, 32),   std::make_tuple("LANE", 12, 32),
+        std::make_tuple("LANE", 12, 64),      std::make_tuple("BLAKE", 14, 32),
+        std::make_tuple("BLAKE", 14, 64)};
+    const std::size_t count = 11;
+    const std::size_t prefix_len = 133;
+
+    for (const auto &h : hashes) {
+        const std::string name = std::get<0>(h);
+        const std::size_t hash_size = std::get<2>(h);
+        auto batch_hasher = hash::hash_factory::create(name, std::get<1>(h));
+        auto hasher = hash::hash_factory::create(name, std::get<1>(h));
+
+        for (std::size_t len : {prefix_len, prefix_len + 1, prefix_len + 60, prefix_len + 200}) {
+            std::vector<std::uint8_t> data(count * len);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                data[i] = std::uint8_t(i % len < prefix_len ? i % len * 7 : i * 131 + len);
+
+            const std::size_t absorbed =
+                batch_hasher->SetPrefix(int(hash_size * 8), data.data(), prefix_len);
+            ASSERT_GE(absorbed, 128u) << name;
+            ASSERT_LE(absorbed, prefix_len) << name;
+
+            std::vector<std::uint8_t> suffixes;
+            for (std::size_t i = 0; i < count; ++i)
+                suffixes.insert(suffixes.end(),
+                                data.begin() + std::ptrdiff_t(i * len + absorbed),
+                                data.begin() + std::ptrdiff_t((i + 1) * len));
+
+            // the midstate survives several batches
+            std::vector<std::uint8_t> batch(count * hash_size);
+            for (std::size_t half : {std::size_t(0), count / 2}) {
+                const std::size_t n = half == 0 ? count / 2 : count - half;
+                ASSERT_EQ(0,
+                          batch_hasher->HashBatch(int(hash_size * 8),
+                                                  suffixes.data() + half * (len - absorbed),
+                                                  8 * (len - absorbed),
+                                                  n,
+                                                  batch.data() + half * hash_size));
+            }
+            batch_hasher->ClearPrefix();
+
+            for (std::size_t i = 0; i < count; ++i) {
+                std::vector<std::uint8_t> single(hash_size);
+                hasher->Init(int(hash_size * 8));
+                hasher->Update(data.data() + i * len, 8 * len);
+                hasher->Final(single.data());
+
+                std::vector<std::uint8_t> from_batch(batch.begin() + i * hash_size,
+                                                     batch.begin() + (i + 1) * hash_size);
+                ASSERT_EQ(single, from_batch)
+                    << name << " " << hash_size << " length " << len << " message " << i;
+            }
+        }
+    }
+}
+
+TEST(hash_stream, constant_prefix_hint_keeps_output) {
+    // a 64 byte zero prefix followed by a counter, and random inputs the hint does not fit
+    const json prefixed = R"({
+        "type": "tuple_stream",
+        "sources": [
+            {"type": "false_stream", "output_size": 64},
+            {"type": "counter", "output_size": 16}
+        ]
+    })"_json;
+    const json random = R"({"type": "pcg32_stream"})"_json;
+
+    for (const json &source : {prefixed, random}) {
+        for (const std::string algorithm : {"SHA2", "CubeHash", "BLAKE"}) {
+            json config = {{"type", "hash"},
+                           {"algorithm", algorithm},
+                           {"round", algorithm == "SHA2" ? 64 : algorithm == "CubeHash" ? 8 : 14},
+                           {"hash_size", 32},
+                           {"input_size", 80},
+                           {"source", source}};
+            std::vector<std::vector<value_type>> outputs;
+            for (std::size_t hint : {0u, 64u, 70u}) {
+                config["constant_prefix"] = hint;
+                seed_seq_from<pcg32> seeder(testsuite::seed1);
+                std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+                auto hs = make_stream(config, seeder, pipes, 32 * 40);
+
+                std::vector<value_type> output;
+                for (unsigned k = 0; k < 3; ++k) {
+                    auto view = hs->next().copy_to_vector();
+                    output.insert(output.end(), view.begin(), view.end());
+                }
+                outputs.push_back(output);
+            }
+            ASSERT_EQ(outputs[0], outputs[1]) << algorithm;
+            ASSERT_EQ(outputs[0], outputs[2]) << algorithm;
+        }
+    }
+}
+
+TEST(keccak_core, reduced_rounds_unchanged) {
+    // digests of the 32-bit Keccak and rhash SHA-3 permutations the shared 64-bit one replaced
+    const std::vector<std::tuple<std::string, unsigned, std::string>> vectors = {
+        std::make_tuple("Keccak", 1, "319563403d3490152e5eb4bd1e575ff38e0c58dd503858ef68fb1af3c76fa4e7"),
+        std::make_tuple("Keccak", 4, "b42a02fb1a8acb8bbf39bf4eec16c62dec5faeccbd6c808f9a848fc63fe78f13"),
+        std::make_tuple("Keccak", 23, "3c597912811fa657d19d19f1adbd9714556a1f702b6bb0166bc2ac29cb284a47"),
+        std::make_tuple("SHA3", 1, "319263403d3480152e5eb4bd1e572ff38e0cd8dd503858ef68f91af3c76fa4e7"),
+        std::make_tuple("SHA3", 4, "feda3c984c7c2dcaf69ed9fefb47966c7fd931b631016ef89b1e9ca313a7be38"),
+        std::make_tuple("SHA3", 23, "8f9a32e14e2924d5c1595fa07081d93449fe89f95ab7b26f1c66163aa17ee012")};
+
+    for (const auto &v : vectors) {
+        const unsigned rounds = std::get<1>(v);
+        const auto data = testsuite::pattern_bytes(137, 37, rounds + 137);
+
+        auto hasher = hash::hash_factory::create(std::get<0>(v), rounds);
+        std::vector<std::uint8_t> digest(32);
+        ASSERT_EQ(0, hasher->Hash(256, data.data(), 8 * data.size(), digest.data()));
+        ASSERT_EQ(std::get<2>(v), testsuite::binary_to_hex_string(digest))
+                << std::get<0>(v) << " rounds " << rounds;
+    }
+}
+
+TEST(sha3_finalists, reduced_rounds_unchanged) {
+    // digests of the reference BLAKE, Grostl and JH code the optimised compression functions replaced
+    const std::vector<std::tuple<std::string, unsigned, int, std::string>> vectors = {
+        std::make_tuple("BLAKE", 3, 256, "6295a6e4f552f763cb4c71f313a472c3920bbf8995ae4152334edd84ad22673c"),
+        std::make_tuple("BLAKE", 7, 512, "90dbfc07c8f434abb0d5a5da8323b772623a80f0a7e495c99bfa1179a7e0fc17"
+                                         "af3a24e9f0b82c280fdfdbe668c0fa2cb93f57ba04d24452977d67dc8648dfd3"),
+        std::make_tuple("Grostl", 11, 512, "e44e8c182beeee1277e07ab4e30c2c9af351bde60e4388c5c0a4aae05a01cdc3"
+                                           "6460f42ab139f515bff9132d89a2bceae9d6492fd0ddfa988dc714b3a2a77e14"),
+        std::make_tuple("Grostl", 13, 512, "2af208a1bd6307d01bc1d066f46c391fd6e214d2a9a40a72273de8148c61ae16"
+                                           "5bcbf8684beed864b480f0cb636a4132d1fe9f50bec4868293fd4361e6794411"),
+        std::make_tuple("JH", 10, 256, "22835fdced03f70ccab69604492c728f9c50f8eba0eea35ab45f1c970ee1a72c"),
+        std::make_tuple("JH", 23, 512, "a6789115614f9c5b9f666898a842164e9ba53a1c57283267861fd00b3f9d51e9"
+                                       "f36641fa550f1804654a02500d494d4e912d5f301f6fee0380b85f30fdd2d494")};
+
+    for (const auto &v : vectors) {
+        const unsigned rounds = std::get<1>(v);
+        const auto data = testsuite::pattern_bytes(129, 37, rounds + 129);
+
+        auto hasher = hash::hash_factory::create(std::get<0>(v), rounds);
+        std::vector<std::uint8_t> digest(std::get<2>(v) / 8);
+        ASSERT_EQ(0, hasher->Hash(std::get<2>(v), data.data(), 8 * data.size(), digest.data()));
+        ASSERT_EQ(std::get<3>(v), testsuite::binary_to_hex_string(digest))
+                << std::get<0>(v) << " rounds " << rounds;
+    }
+}
+
+TEST(rhash_tables, reduced_rounds_unchanged) {
+    // digests of the rhash Whirlpool, Tiger and GOST code before the compression functions were reworked
+    const std::vector<std::tuple<std::string, unsigned, int, std::string>> vectors = {
+        std::make_tuple("Whirlpool", 3, 512, "c84508e10faeaca1f7a881ab03bf29dce6e9491e5041acf7ddab3c9441bf9e6f"
+                                             "344e186dfab983151bceeca3eae0da7cd7a5a890efe99f6633c51aa8f5b0039a"),
+        std::make_tuple("Whirlpool", 10, 512, "48d9392efae6baeef3cd5b7755e89243b7307ce3162ee832958d1b96c4f5c049"
+                                              "4200e8d05f53adf2a1c4a2012ed01e7ba45d61541f6f0f04658e1246e161641b"),
+        std::make_tuple("Tiger", 7, 192, "0f1a2b5d0b300b64523f44e226f190087b6ee2f60bf6842a"),
+        std::make_tuple("Tiger", 24, 192, "c94cbb491376c9da15cf2307f35cde9ca2c6af61f76dea20"),
+        std::make_tuple("Gost", 5, 256, "7dd22dc0851169335a9b9a883a21bfa0fde28be8ea372735431e6b042deac564"),
+        std::make_tuple("Gost", 31, 256, "0aa50c727a33be15c12f01d32bc1d5ff77550c327f8705b81cfeb8a27aa0896f")};
+
+    for (const auto &v : vectors) {
+        const unsigned rounds = std::get<1>(v);
+        const auto data = testsuite::pattern_bytes(129, 37, rounds + 129);
+
+        auto hasher = hash::hash_factory::create(std::get<0>(v), rounds);
+        std::vector<std::uint8_t> digest(std::get<2>(v) / 8);
+        ASSERT_EQ(0, hasher->Hash(std::get<2>(v), data.data(), 8 * data.size(), digest.data()));
+        ASSERT_EQ(std::get<3>(v), testsuite::binary_to_hex_string(digest))
+                << std::get<0>(v) << " rounds " << rounds;
+    }
+}
+
+TEST(hash_stream, chain_matches_manual_iteration) {
+    const std::size_t hash_size = 32;
+    for (std::size_t input_size : {32u, 36u}) {
+        for (std::size_t emit_every : {1u, 3u}) {
+            const json config = {{"type", "hash"},
+                                 {"algorithm", "SHA2"},
+                                 {"round", 64},
+                                 {"hash_size", hash_size},
+                                 {"input_size", input_size},
+                                 {"mode", "chain"},
+                                 {"emit_every", emit_every},
+                                 {"source", {{"type", "false_stream"}}}};
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+            auto hs = make_stream(config, seeder, pipes, hash_size * 5);
+
+            std::vector<value_type> output;
+            for (unsigned k = 0; k < 2; ++k) {
+                auto view = hs->next().copy_to_vector();
+                output.insert(output.end(), view.begin(), view.end());
+            }
+
+            auto hasher = hash::hash_factory::create("SHA2", 64);
+            std::vector<std::uint8_t> input(input_size, 0);
+            std::vector<value_type> expected;
+            for (std::uint32_t step = 0; expected.size() < output.size(); ++step) {
+                for (std::size_t i = hash_size; i < input_size; ++i)
+                    input[i] = std::uint8_t(step >> (8 * (i - hash_size)));
+                std::vector<std::uint8_t> h(hash_size);
+                hasher->Init(int(hash_size * 8));
+                hasher->Update(input.data(), 8 * input_size);
+                hasher->Final(h.data());
+                std::copy(h.begin(), h.end(), input.begin());
+                if ((step + 1) % emit_every == 0)
+                    expected.insert(expected.end(), h.begin(), h.end());
+            }
+            ASSERT_EQ(expected, output) << input_size << " " << emit_every;
+        }
+    }
+}
+
+TEST(hash_stream, chunked_input_matches_whole_input) {
+    const std::vector<std::pair<std::string, unsigned>> hashes = {
+        {"SHA2", 64}, {"Keccak", 24}, {"BLAKE", 14}, {"Grostl", 10},
+        {"JH", 42},   {"MD6", 96},    {"BMW", 16}};
+
+    for (const auto &h : hashes) {
+        std::vector<std::vector<value_type>> outputs;
+        for (std::size_t chunk_size : {4096u, 512u, 128u}) {
+            const json config = {{"type", "hash"},
+                                 {"algorithm", h.first},
+                                 {"round", h.second},
+                                 {"hash_size", 32},
+                                 {"input_size", 4096},
+                                 {"chunk_size", chunk_size},
+                                 {"source", {{"type", "pcg32_stream"}}}};
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+            auto hs = make_stream(config, seeder, pipes, 32 * 3);
+
+            std::vector<value_type> output;
+            for (unsigned k = 0; k < 2; ++k) {
+                auto view = hs->next().copy_to_vector();
+                output.insert(output.end(), view.begin(), view.end());
+            }
+            outputs.push_back(output);
+        }
+        ASSERT_EQ(outputs[0], outputs[1]) << h.first;
+        ASSERT_EQ(outputs[0], outputs[2]) << h.first;
+    }
+}
+
+TEST(hash_stream, chunked_input_rejected_when_unsupported) {
+    // Cheetah takes a message in a single Update only, BMW-256 whole 64 byte blocks
+    const std::vector<std::tuple<std::string, unsigned, std::size_t, bool>> cases = {
+        std::make_tuple("Cheetah", 16, 512, false), std::make_tuple("BMW", 16, 32, false),
+        std::make_tuple("BMW", 16, 96, false), std::make_tuple("BMW", 16, 128, true)};
+
+    for (const auto &c : cases) {
+        const json config = {{"type", "hash"},
+                             {"algorithm", std::get<0>(c)},
+                             {"round", std::get<1>(c)},
+                             {"hash_size", 32},
+                             {"input_size", 1536},
+                             {"chunk_size", std::get<2>(c)},
+                             {"source", {{"type", "pcg32_stream"}}}};
+        seed_seq_from<pcg32> seeder(testsuite::seed1);
+        std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+        if (std::get<3>(c))
+            ASSERT_NO_THROW(make_stream(config, seeder, pipes, 32)) << std::get<0>(c);
+        else
+            ASSERT_THROW(make_stream(config, seeder, pipes, 32), std::runtime_error)
+                << std::get<0>(c) << " " << std::get<2>(c);
+    }
+}
+
+TEST(md6, parallel_subtrees_match_sequential) {
+    const std::size_t subtree = 32768;
+    std::vector<std::uint8_t> data(5 * subtree + 1000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = std::uint8_t(i * 131 + (i >> 8));
+
+    for (unsigned rounds : {5u, 104u}) {
+        for (int bits : {256, 512}) {
+            auto hasher = hash::hash_factory::create("MD6", rounds);
+            for (std::size_t len : {subtree, subtree + 1, 4 * subtree, 4 * subtree + 7, data.size()}) {
+                for (std::size_t head : {0u, 100u}) {
+                    // a single Update takes the parallel path, 1000 byte pieces never do
+                    std::vector<std::uint8_t> whole(64), pieces(64);
+                    hasher->Init(bits);
+                    hasher->Update(data.data(), 8 * head);
+                    hasher->Update(data.data() + head, 8 * (len - head));
+                    hasher->Final(whole.data());
+
+                    hasher->Init(bits);
+                    for (std::size_t done = 0; done < len; done += 1000)
+                        hasher->Update(data.data() + done, 8 * std::min<std::size_t>(1000, len - done));
+                    hasher->Final(pieces.data());
+
+                    ASSERT_EQ(pieces, whole) << rounds << " " << bits << " " << len << " " << head;
+                }
+            }
+        }
+    }
+}
+
+TEST(hash_stream, input_bits_match_single_messages) {
+    for (const std::string algorithm : {"BLAKE", "Keccak", "JH"}) {
+        std::vector<std::vector<value_type>> outputs;
+        for (std::size_t input_bits : {127u, 128u}) {
+            const json config = {{"type", "hash"},
+                                 {"algorithm", algorithm},
+                                 {"round", algorithm == "BLAKE" ? 14 : algorithm == "Keccak" ? 24 : 42},
+                                 {"hash_size", 32},
+                                 {"input_bits", input_bits},
+                                 {"source", {{"type", "pcg32_stream"}}}};
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+            const std::size_t hash_size = config["hash_size"];
+            auto hs = make_stream(config, seeder, pipes, hash_size * 20);
+            outputs.push_back(hs->next().copy_to_vector());
+
+            // the same 16 byte inputs hashed one by one with the exact bit length
+            seed_seq_from<pcg32> source_seeder(testsuite::seed1);
+            pcg32_stream source(source_seeder, 16);
+            auto hasher = hash::hash_factory::create(algorithm, config["round"]);
+            for (std::size_t i = 0; i < 20; ++i) {
+                auto input = source.next().copy_to_vector();
+                std::vector<value_type> digest(hash_size);
+                ASSERT_EQ(0, hasher->Hash(int(8 * hash_size), input.data(), input_bits, digest.data()));
+                ASSERT_TRUE(std::equal(digest.begin(), digest.end(), outputs.back().begin() + i * hash_size))
+                    << algorithm << " " << input_bits << " message " << i;
+            }
+        }
+        ASSERT_NE(outputs[0], outputs[1]) << algorithm;
+    }
+}
+
+TEST(hash_stream, input_bits_rejected_for_byte_hashes) {
+    // the rhash-based hashes would drop the bits of the partial byte
+    for (const std::string algorithm :
+         {"MD5", "SHA1", "SHA2", "SHA3", "RIPEMD160", "Tiger", "Whirlpool", "Gost"}) {
+        auto hasher = hash::hash_factory::create(algorithm, 1);
+        ASSERT_TRUE(hasher->WholeBytesOnly()) << algorithm;
+    }
+
+    for (std::size_t input_bits : {127u, 128u}) {
+        const json config = {{"type", "hash"},
+                             {"algorithm", "MD5"},
+                             {"round", 64},
+                             {"hash_size", 16},
+                             {"input_bits", input_bits},
+                             {"source", {{"type", "pcg32_stream"}}}};
+        seed_seq_from<pcg32> seeder(testsuite::seed1);
+        std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> pipes;
+        if (input_bits % 8 != 0)
+            ASSERT_THROW(make_stream(config, seeder, pipes, 16 * 20), std::runtime_error);
+        else
+            ASSERT_NO_THROW(make_stream(config, seeder, pipes, 16 * 20));
+    }
+}
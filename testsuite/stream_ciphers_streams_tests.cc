@@ -5,18 +5,106 @@
 #include <gtest/gtest.h>
 #include <streams/stream_ciphers/stream_cipher.h>
 #include <streams/stream_ciphers/stream_interface.h>
+#include <streams/stream_ciphers/other/rc4/rc4.h>
 #include <testsuite/test_utils/common_functions.h>
 #include <testsuite/test_utils/stream_ciphers_test_case.h>
+#include <thread>
 
 TEST(chacha, test_vectors) {
     testsuite::stream_cipher_test_case("Chacha", 20)();
     testsuite::stream_cipher_test_case("Chacha", 12)();
 }
 
+// zero key and IV (set up as 256-bit key, 64-bit IV), keystreams at the given round counts
+static void check_reduced_rounds(const std::string& name,
+                                 const std::vector<std::pair<unsigned, std::string>>& vectors) {
+    const std::vector<value_type> key(32);
+    const std::vector<value_type> iv(8);
+
+    for (const auto& v : vectors) {
+        const auto expected = testsuite::hex_string_to_binary(v.second);
+        std::vector<value_type> actual(expected.size());
+
+        auto cipher = stream_ciphers::create_stream_cipher(name, v.first);
+        cipher->init();
+        cipher->keysetup(key.data(), 256, 64);
+        cipher->ivsetup(iv.data());
+        cipher->encrypt_bytes(actual.data(), actual.data(), u32(actual.size()));
+        ASSERT_EQ(expected, actual) << name << " " << v.first;
+    }
+}
+
+TEST(chacha, reduced_rounds) {
+    check_reduced_rounds("Chacha",
+                         {{8, "3e00ef2f895f40d67f5bb8e81f09a5a12c840ec3ce9a7f3b181be188ef711a1e"},
+                          {12, "9bf49a6a0755f953811fce125f2683d50429c3bb49e074147e0089a52eae155f"},
+                          {20, "76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7"}});
+}
+
+TEST(salsa20, reduced_rounds) {
+    check_reduced_rounds("Salsa20",
+                         {{8, "9f591da5f99c235445ea91866ead681b977c4ffa036d770fbca79d41fb014178"},
+                          {12, "bd78a2f8118a563c761db4f2fbe055da97f90988d27594d9c5dfd13a3efeaa3f"},
+                          {20, "9a97f65b9b4c721b960a672145fca8d4e32e67f9111ea979ce9c4826806aeee6"}});
+}
+
+TEST(rabbit, reduced_rounds) {
+    check_reduced_rounds("Rabbit",
+                         {{1, "d6374db0b7b5e098ebe8e12452710d79924d25b235dd22d7b1c8779756e0838f"},
+                          {2, "fce58f6ae8b58e4961cdab9ffadc90d08bb01594f913050293fcb3caadfc6927"},
+                          {4, "edb70567375dcd7cd89554f85e27a7c68d4adc7032298f7bd4eff504aca6295f"}});
+}
+
+// a block is 25 steps with an output every 5th; outputs past the round count are zero keystream
+TEST(sosemanuk, reduced_rounds) {
+    check_reduced_rounds("SOSEMANUK",
+                         {{4, "0000000000000000000000000000000000000000000000000000000000000000"},
+                          {5, "db3d9bc309dd20e0b663e1108d65953e00000000000000000000000000000000"},
+                          {9, "c4dfddb24fa725624aab632b16150c7900000000000000000000000000000000"},
+                          {25, "494e66132da70c4797448e14af376091352ac66e108621e9e175551f05625f8b"}});
+}
+
 TEST(rc4, test_vectors) {
     testsuite::stream_cipher_test_case("RC4", 1)();
 }
 
+TEST(rc4, interleaved_multi_key) {
+    const std::size_t count = 2 * stream_ciphers::others::rc4::lanes + 3;
+    const std::size_t key_size = 13;
+    const std::size_t msglen = 67;
+
+    std::vector<value_type> keys(count * key_size);
+    std::vector<value_type> plaintexts(count * msglen);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = value_type(i * 7 + 1);
+    for (std::size_t i = 0; i < plaintexts.size(); ++i)
+        plaintexts[i] = value_type(i * 3);
+
+    stream_ciphers::others::rc4 single(1);
+    std::vector<value_type> expected(count * msglen);
+    for (std::size_t n = 0; n < count; ++n) {
+        single.keysetup(&keys[n * key_size], 8 * key_size, 0);
+        single.encrypt_bytes(&plaintexts[n * msglen], &expected[n * msglen], msglen);
+    }
+
+    for (std::size_t c : {count, std::size_t(stream_ciphers::others::rc4::lanes)}) {
+        stream_ciphers::others::rc4 multi(1);
+        std::vector<value_type> actual(c * msglen);
+        multi.encrypt_bytes_multi(keys.data(), 8 * key_size, plaintexts.data(), actual.data(), msglen, c);
+        ASSERT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+
+        // the instance has to continue the keystream of the last key
+        std::vector<value_type> next_expected(msglen);
+        std::vector<value_type> next_actual(msglen);
+        stream_ciphers::others::rc4 last(1);
+        last.keysetup(&keys[(c - 1) * key_size], 8 * key_size, 0);
+        last.encrypt_bytes(plaintexts.data(), next_expected.data(), msglen);
+        last.encrypt_bytes(plaintexts.data(), next_expected.data(), msglen);
+        multi.encrypt_bytes(plaintexts.data(), next_actual.data(), msglen);
+        ASSERT_EQ(next_expected, next_actual);
+    }
+}
+
 TEST(decim, test_vectors) {
     testsuite::stream_cipher_test_case("DECIM", 8)();
 }
@@ -68,3 +156,63 @@ TEST(tsc4, test_vectors) {
 TEST(trivium, test_vectors) {
     testsuite::stream_cipher_test_case("Trivium", 9)();
 }
+
+static std::vector<value_type> keystream(stream_ciphers::stream_interface& cipher,
+                                         const value_type key_seed,
+                                         const std::size_t key_size,
+                                         const std::size_t size) {
+    std::vector<value_type> key(key_size);
+    std::vector<value_type> iv(16);
+    for (std::size_t i = 0; i < key.size(); ++i)
+        key[i] = value_type(key_seed + i);
+    for (std::size_t i = 0; i < iv.size(); ++i)
+        iv[i] = value_type(key_seed * i);
+    std::vector<value_type> plaintext(size);
+    std::vector<value_type> ciphertext(size);
+
+    cipher.keysetup(key.data(), u32(8 * key.size()), u32(8 * iv.size()));
+    cipher.ivsetup(iv.data());
+    cipher.encrypt_bytes(plaintext.data(), ciphertext.data(), u32(size));
+    return ciphertext;
+}
+
+TEST(stream_ciphers, concurrent_instances) {
+    // ciphers which used to keep rounds or scratch buffers in file-scope statics, in pairs of
+    // differing configurations; Py and CryptMT have no rounds, so their key sizes differ
+    struct params {
+        std::string name;
+        unsigned round;
+        std::size_t key_size;
+    };
+    const std::vector<params> configs = {{"SOSEMANUK", 25, 16}, {"SOSEMANUK", 24, 16},
+                                         {"Py", 1, 16},         {"Py", 1, 32},
+                                         {"CryptMT", 1, 16},    {"CryptMT", 1, 32}};
+    const std::size_t size = 40000; // more than Py processes at once
+
+    for (std::size_t c = 0; c < configs.size(); c += 2) {
+        std::vector<value_type> expected[2];
+        for (std::size_t n = 0; n < 2; ++n) {
+            const params& p = configs[c + n];
+            auto cipher = stream_ciphers::create_stream_cipher(p.name, p.round);
+            cipher->init();
+            expected[n] = keystream(*cipher, value_type(n + 1), p.key_size, size);
+        }
+
+        std::vector<value_type> actual[2];
+        std::vector<std::thread> threads;
+        for (std::size_t n = 0; n < 2; ++n) {
+            threads.emplace_back([&, n] {
+                const params& p = configs[c + n];
+                auto cipher = stream_ciphers::create_stream_cipher(p.name, p.round);
+                cipher->init();
+                for (int rep = 0; rep < 8; ++rep)
+                    actual[n] = keystream(*cipher, value_type(n + 1), p.key_size, size);
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        ASSERT_EQ(expected[0], actual[0]) << configs[c].name;
+        ASSERT_EQ(expected[1], actual[1]) << configs[c + 1].name;
+    }
+}
@@ -7,7 +7,10 @@
 #include "gtest/gtest.h"
 #include <eacirc-core/seed.h>
 #include <streams/stream_ciphers/stream_cipher.h>
+#include <streams/stream_ciphers/stream_stream.h>
 #include <streams/block/block_factory.h>
+#include <streams/block/keyed_cipher_cache.h>
+#include <testsuite/test_utils/common_functions.h>
 #include <testsuite/test_utils/test_case.h>
 
 const static int testing_size = 1536;
@@ -715,6 +718,53 @@ TEST(stream_first_block, RC4) {
     }
 }
 
+TEST(stream_stream, rekey_batch) {
+    json json_config = R"({
+        "type": "stream_cipher",
+        "round": 8,
+        "block_size": 16,
+        "plaintext": {
+          "type": "counter"
+        },
+        "key_size": 16,
+        "key": {
+          "type": "pcg32_stream"
+        },
+        "iv_size": 8,
+        "iv": {
+          "type": "repeating_stream",
+          "period": 1,
+          "source": {
+            "type": "pcg32_stream"
+          }
+        }
+    })"_json;
+
+    for (const std::string algorithm : {"RC4", "Salsa20"}) {
+        json_config["algorithm"] = algorithm;
+
+        std::vector<std::vector<value_type>> expected;
+        {
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            stream_ciphers::stream_stream stream(json_config, seeder, map, 48);
+            for (unsigned i = 0; i < 50; ++i)
+                expected.push_back(stream.next().copy_to_vector());
+        }
+
+        for (std::size_t batch : {4, 7, 64}) {
+            json_config["rekey_batch"] = batch;
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            stream_ciphers::stream_stream stream(json_config, seeder, map, 48);
+
+            for (unsigned i = 0; i < expected.size(); ++i)
+                ASSERT_EQ(expected[i], stream.next().copy_to_vector()) << algorithm << " " << batch;
+        }
+        json_config.erase("rekey_batch");
+    }
+}
+
 TEST(stream_first_block, AES) {
     json json_config = R"({
         "type": "block",
@@ -790,3 +840,345 @@ TEST(stream_first_block, AES) {
     }
 }
 
+
+TEST(block_stream, sp800_38a_modes) {
+    // AES-128 examples F.2.1, F.4.1 and F.5.1 of NIST SP 800-38A
+    const std::string plaintext = "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+                                  "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+    const struct {
+        std::string mode, iv, ciphertext;
+    } vectors[] = {
+        {"CBC", "000102030405060708090a0b0c0d0e0f",
+         "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+         "73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7"},
+        {"OFB", "000102030405060708090a0b0c0d0e0f",
+         "3b3fd92eb72dad20333449f8e83cfb4a7789508d16918f03f53c52dac54ed825"
+         "9740051e9c5fecf64344f7a82260edcc304c6528f659c77866a510d9c1d6ae5e"},
+        {"CTR", "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+         "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+         "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee"},
+    };
+
+    for (const auto& tv : vectors) {
+        json json_config = {{"type", "block"},
+                            {"algorithm", "AES"},
+                            {"round", 10},
+                            {"block_size", 16},
+                            {"key_size", 16},
+                            {"key", {{"type", "const_stream"}, {"value", "2b7e151628aed2a6abf7158809cf4f3c"}}},
+                            {"mode", tv.mode},
+                            {"init_frequency", "only_once"},
+                            {"iv", {{"type", "const_stream"}, {"value", tv.iv}}}};
+
+        json_config["plaintext"] = {{"type", "const_stream"}, {"value", plaintext}};
+        {
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            block::block_stream stream(json_config, seeder, map, 64);
+            ASSERT_EQ(testsuite::hex_string_to_binary(tv.ciphertext), stream.next().copy_to_vector()) << tv.mode;
+        }
+
+        json_config["plaintext"] = {{"type", "const_stream"}, {"value", tv.ciphertext}};
+        json_config["encryption_mode"] = false;
+        {
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            block::block_stream stream(json_config, seeder, map, 64);
+            ASSERT_EQ(testsuite::hex_string_to_binary(plaintext), stream.next().copy_to_vector()) << tv.mode;
+        }
+    }
+}
+
+TEST(block_stream, ctr_keystream) {
+    json json_config = R"({
+        "type": "block",
+        "algorithm": "AES",
+        "round": 10,
+        "block_size": 16,
+        "mode": "CTR",
+        "init_frequency": "only_once",
+        "key_size": 16,
+        "key": {
+            "type": "const_stream",
+            "value": "2b7e151628aed2a6abf7158809cf4f3c"
+        },
+        "iv": {
+            "type": "const_stream",
+            "value": "fffffffffffffffffffffffffffffffe"
+        }
+    })"_json;
+
+    seed_seq_from<pcg32> seeder(testsuite::seed1);
+    std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+    block::block_stream stream(json_config, seeder, map, 32);
+
+    // no plaintext stream, the output is the keystream; the counter carries over the
+    // whole block and continues across next() calls
+    std::vector<value_type> keystream = stream.next().copy_to_vector();
+    vec_cview second = stream.next();
+    keystream.insert(keystream.end(), second.begin(), second.end());
+
+    ASSERT_EQ(testsuite::hex_string_to_binary("d1b714b6fbf5fff1289aee2a4c4eeda38af2860142f786f409307c1a3f7eaaac"
+                       "7df76b0c1ab899b33e42f047b91b546f57127d4034b1bebfaef466b9c7726fc6"),
+              keystream);
+}
+
+TEST(block_stream, key_cache) {
+    // 256 distinct keys drawn cyclically, fresh key for every output
+    json json_config = R"({
+        "type": "block",
+        "round": 4,
+        "init_frequency": "1",
+        "plaintext": {
+            "type": "counter"
+        },
+        "key_size": 16,
+        "key": {
+            "type": "tuple_stream",
+            "sources": [
+                {
+                    "type": "counter",
+                    "output_size": 1
+                },
+                {
+                    "type": "single_value_stream",
+                    "output_size": 15,
+                    "source": {
+                        "type": "pcg32_stream"
+                    }
+                }
+            ]
+        },
+        "iv": {
+            "type": "false_stream"
+        }
+    })"_json;
+
+    for (const std::string algorithm : {"AES", "BLOWFISH", "TWOFISH"}) {
+        json_config["algorithm"] = algorithm;
+        json_config["block_size"] = algorithm == "BLOWFISH" ? 8 : 16;
+
+        std::vector<std::vector<value_type>> expected;
+        {
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            block::block_stream stream(json_config, seeder, map, 32);
+            for (unsigned i = 0; i < 600; ++i)
+                expected.push_back(stream.next().copy_to_vector());
+        }
+
+        // a small cache keeps evicting, a large one serves the second round of keys
+        for (std::size_t capacity : {8, 256}) {
+            json_config["key_cache"] = capacity;
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            block::block_stream stream(json_config, seeder, map, 32);
+
+            for (unsigned i = 0; i < expected.size(); ++i)
+                ASSERT_EQ(expected[i], stream.next().copy_to_vector()) << algorithm << " " << capacity;
+        }
+        json_config.erase("key_cache");
+    }
+}
+
+TEST(keyed_cipher_cache, hits_misses_and_eviction) {
+    std::size_t created = 0;
+    block::keyed_cipher_cache cache(8, [&] {
+        ++created;
+        return block::make_block_cipher("AES", 10, 16, 16, true);
+    });
+
+    auto key = [](const std::size_t n) {
+        std::vector<std::uint8_t> k(16);
+        for (std::size_t i = 0; i < k.size(); ++i)
+            k[i] = std::uint8_t(n * 31 + i);
+        return k;
+    };
+    const std::vector<std::uint8_t> plaintext(16, 0x5a);
+    auto expect_keyed_with = [&](block::block_cipher &cipher, const std::size_t n) {
+        auto reference = block::make_block_cipher("AES", 10, 16, 16, true);
+        reference->keysetup(key(n).data(), 16);
+        std::vector<std::uint8_t> expected(16), actual(16);
+        reference->encrypt(plaintext.data(), expected.data());
+        cipher.encrypt(plaintext.data(), actual.data());
+        ASSERT_EQ(expected, actual) << "key " << n;
+    };
+
+    // keys 0..7 fill the cache, the second round is served from it
+    std::vector<block::block_cipher *> instances;
+    for (std::size_t n = 0; n < 8; ++n)
+        instances.push_back(&cache.get(key(n).data(), 16));
+    ASSERT_EQ(0u, cache.hits());
+    ASSERT_EQ(8u, cache.misses());
+    for (std::size_t n = 0; n < 8; ++n) {
+        block::block_cipher &cipher = cache.get(key(n).data(), 16);
+        ASSERT_EQ(instances[n], &cipher);
+        expect_keyed_with(cipher, n);
+    }
+    ASSERT_EQ(8u, cache.hits());
+    ASSERT_EQ(8u, cache.misses());
+
+    // key 8 rekeys the least recently used instance, the one of key 0
+    ASSERT_EQ(instances[0], &cache.get(key(8).data(), 16));
+    expect_keyed_with(*instances[0], 8);
+    ASSERT_EQ(9u, cache.misses());
+
+    // key 1 is still cached, key 0 is not any more and evicts key 2
+    ASSERT_EQ(instances[1], &cache.get(key(1).data(), 16));
+    ASSERT_EQ(9u, cache.hits());
+    ASSERT_EQ(instances[2], &cache.get(key(0).data(), 16));
+    expect_keyed_with(*instances[2], 0);
+    ASSERT_EQ(10u, cache.misses());
+
+    ASSERT_EQ(8u, created);
+}
+
+TEST(block_differential_stream, pairs) {
+    json json_config = R"({
+        "type": "block_differential",
+        "algorithm": "AES",
+        "round": 3,
+        "block_size": 16,
+        "plaintext": {
+            "type": "counter"
+        },
+        "key_size": 16,
+        "key": {
+            "type": "const_stream",
+            "value": "2b7e151628aed2a6abf7158809cf4f3c"
+        },
+        "difference": "00000000000000000000000000000080"
+    })"_json;
+
+    auto aes = block::make_block_cipher("AES", 3, 16, 16, true);
+    aes->keysetup(testsuite::hex_string_to_binary("2b7e151628aed2a6abf7158809cf4f3c").data(), 16);
+
+    for (const bool xor_output : {false, true}) {
+        json_config["xor_output"] = xor_output;
+        seed_seq_from<pcg32> seeder(testsuite::seed1);
+        std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+        block::block_differential_stream stream(json_config, seeder, map, 64);
+
+        // base blocks come from one counter draw per output
+        const std::size_t pairs = xor_output ? 4 : 2;
+        counter plaintext(pairs * 16);
+        for (unsigned i = 0; i < 10; ++i) {
+            vec_cview base = plaintext.next();
+            std::vector<value_type> expected;
+            for (std::size_t p = 0; p < pairs; ++p) {
+                std::vector<value_type> x(base.begin() + p * 16, base.begin() + (p + 1) * 16);
+                std::vector<value_type> y = x;
+                y[15] ^= 0x80;
+                std::vector<value_type> ex(16), ey(16);
+                aes->encrypt(x.data(), ex.data());
+                aes->encrypt(y.data(), ey.data());
+                if (xor_output) {
+                    for (std::size_t b = 0; b < 16; ++b)
+                        expected.push_back(ex[b] ^ ey[b]);
+                } else {
+                    expected.insert(expected.end(), ex.begin(), ex.end());
+                    expected.insert(expected.end(), ey.begin(), ey.end());
+                }
+            }
+            ASSERT_EQ(expected, stream.next().copy_to_vector()) << xor_output;
+        }
+    }
+}
+
+TEST(block_differential_stream, all_single_bit) {
+    json json_config = R"({
+        "type": "block_differential",
+        "algorithm": "SPECK",
+        "round": 5,
+        "block_size": 8,
+        "plaintext": {
+            "type": "pcg32_stream"
+        },
+        "key_size": 12,
+        "key": {
+            "type": "pcg32_stream"
+        },
+        "difference": "all_single_bit",
+        "xor_output": true
+    })"_json;
+
+    seed_seq_from<pcg32> seeder(testsuite::seed1);
+    std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+    block::block_differential_stream stream(json_config, seeder, map, 8 * 16);
+
+    // the same pipeline as a sac_2d_all_positions-like chain: every bit of one base block
+    seed_seq_from<pcg32> ref_seeder(testsuite::seed1);
+    pcg32_stream plaintext(ref_seeder, 8);
+    pcg32_stream key(ref_seeder, 12);
+    auto speck = block::make_block_cipher("SPECK", 5, 8, 12, true);
+    speck->keysetup(key.next().data(), 12);
+
+    std::vector<value_type> x;
+    for (unsigned i = 0; i < 12; ++i) {
+        vec_cview data = stream.next();
+        for (std::size_t p = 0; p < 16; ++p) {
+            const std::size_t bit = (i * 16 + p) % 64;
+            if (bit == 0)
+                x = plaintext.next().copy_to_vector();
+            std::vector<value_type> y = x;
+            y[bit / 8] ^= value_type(1 << (bit % 8));
+            std::vector<value_type> ex(8), ey(8);
+            speck->encrypt(x.data(), ex.data());
+            speck->encrypt(y.data(), ey.data());
+            for (std::size_t b = 0; b < 8; ++b)
+                ASSERT_EQ(ex[b] ^ ey[b], data[p * 8 + b]) << i << " " << p;
+        }
+    }
+}
+
+TEST(block_stream, round_sweep) {
+    json json_config = R"({
+        "type": "block",
+        "init_frequency": "3",
+        "plaintext": {
+            "type": "pcg32_stream"
+        },
+        "key": {
+            "type": "pcg32_stream"
+        },
+        "iv": {
+            "type": "false_stream"
+        }
+    })"_json;
+
+    // SPECK sweeps in one pass, AES needs an instance per round count
+    const struct {
+        std::string algorithm;
+        std::size_t block_size, key_size, round;
+    } ciphers[] = {{"SPECK", 16, 16, 12}, {"SIMON", 8, 12, 16}, {"AES", 16, 16, 6}};
+
+    for (const auto &c : ciphers) {
+        json_config["algorithm"] = c.algorithm;
+        json_config["block_size"] = c.block_size;
+        json_config["key_size"] = c.key_size;
+        const std::vector<std::size_t> rounds = {0, 1, 2, c.round / 2, c.round};
+
+        std::vector<std::vector<std::vector<value_type>>> expected;
+        for (const std::size_t round : rounds) {
+            json_config["round"] = round;
+            seed_seq_from<pcg32> seeder(testsuite::seed1);
+            std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+            block::block_stream stream(json_config, seeder, map, 4 * c.block_size);
+
+            expected.emplace_back();
+            for (unsigned i = 0; i < 10; ++i)
+                expected.back().push_back(stream.next().copy_to_vector());
+        }
+
+        json_config["round"] = c.round;
+        json_config["round_sweep"] = rounds;
+        seed_seq_from<pcg32> seeder(testsuite::seed1);
+        std::unordered_map<std::string, std::shared_ptr<std::unique_ptr<stream>>> map;
+        block::block_stream stream(json_config, seeder, map, 4 * c.block_size);
+        for (unsigned i = 0; i < 10; ++i) {
+            for (std::size_t r = 0; r < rounds.size(); ++r)
+                ASSERT_EQ(expected[r][i], stream.next().copy_to_vector()) << c.algorithm << " " << rounds[r];
+        }
+        json_config.erase("round_sweep");
+    }
+}
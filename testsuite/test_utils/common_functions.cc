@@ -23,4 +23,27 @@ std::vector<value_type> hex_string_to_binary(const std::string &str) {
     return output;
 }
 
+std::string binary_to_hex_string(const std::vector<value_type> &data) {
+    static const char digits[] = "0123456789abcdef";
+    std::string output;
+    output.reserve(2 * data.size());
+
+    for (value_type byte : data) {
+        output += digits[byte >> 4];
+        output += digits[byte & 0xf];
+    }
+
+    return output;
+}
+
+std::vector<value_type> pattern_bytes(std::size_t size, std::size_t step, std::size_t offset) {
+    std::vector<value_type> output(size);
+
+    for (std::size_t i = 0; i < size; i++) {
+        output[i] = value_type(step * i + offset);
+    }
+
+    return output;
+}
+
 } // namespace testsuite
@@ -20,4 +20,19 @@ value_type hex_to_bin(const char input);
  */
 std::vector<value_type> hex_string_to_binary(const std::string &str);
 
+/**
+ * Inverse of hex_string_to_binary, lowercase digits
+ * @param data Bytes to convert
+ * @return string of length 2 * data.size()
+ */
+std::string binary_to_hex_string(const std::vector<value_type> &data);
+
+/**
+ * Deterministic test input, byte i is (step * i + offset) mod 256
+ * @param size Number of bytes
+ * @param step Increment between adjacent bytes
+ * @param offset Value of the first byte
+ */
+std::vector<value_type> pattern_bytes(std::size_t size, std::size_t step, std::size_t offset);
+
 } // namespace testsuite